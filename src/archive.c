@@ -0,0 +1,557 @@
+// archive.c - Dönem Arşivi Modülü (Salt Okunur, mmap)
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "archive.h"
+#include "utils.h"
+#include "cube.h"
+#include "gradestats.h"
+#include "section.h"
+#include "student.h"
+
+// Mapped archives in freeze order (oldest first) and the directory that holds them.
+// Dondurulma sırasıyla (en eski önce) eşlenmiş arşivler ve bunları tutan dizin.
+static SemesterArchive archives[MAX_ARCHIVES];
+static int archive_total = 0;
+static char archive_dir[256] = ARCHIVE_DIR;
+
+/**
+ * Selects the directory that holds the archive files and their manifest (default data/archive).
+ * Arşiv dosyalarını ve listesini tutan dizini seçer (varsayılan data/archive).
+ * * @param dir - Directory path
+ * @param dir - Dizin yolu
+ */
+void archive_set_directory(const char *dir) {
+    snprintf(archive_dir, sizeof(archive_dir), "%s", dir);
+}
+
+/**
+ * Builds "<dir>/<semester>.arc".
+ * "<dizin>/<dönem>.arc" yolunu oluşturur.
+ */
+static void archive_path(const char *semester, char *path, size_t size) {
+    snprintf(path, size, "%s/%s.arc", archive_dir, semester);
+}
+
+/**
+ * A semester becomes part of a file name, so only letters, digits, '-' and '_' are accepted.
+ * Dönem bir dosya adının parçası olur; yalnızca harf, rakam, '-' ve '_' kabul edilir.
+ */
+static int valid_semester_name(const char *semester) {
+    int i;
+    if (semester == NULL || semester[0] == '\0') return 0;
+    for (i = 0; semester[i] != '\0'; i++) {
+        if (!isalnum((unsigned char)semester[i]) && semester[i] != '-' && semester[i] != '_') return 0;
+    }
+    return 1;
+}
+
+/**
+ * Orders grade rows by student, course and ID.
+ * Not satırlarını öğrenciye, derse ve ID'ye göre sıralar.
+ */
+static int compare_archived_grades(const void *a, const void *b) {
+    const Grade *x = (const Grade *)a, *y = (const Grade *)b;
+    if (x->student_id != y->student_id) return (x->student_id < y->student_id) ? -1 : 1;
+    if (x->course_id != y->course_id) return (x->course_id < y->course_id) ? -1 : 1;
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+/**
+ * Orders enrollment rows by student, course and ID.
+ * Kayıt satırlarını öğrenciye, derse ve ID'ye göre sıralar.
+ */
+static int compare_archived_enrollments(const void *a, const void *b) {
+    const Enrollment *x = (const Enrollment *)a, *y = (const Enrollment *)b;
+    if (x->student_id != y->student_id) return (x->student_id < y->student_id) ? -1 : 1;
+    if (x->course_id != y->course_id) return (x->course_id < y->course_id) ? -1 : 1;
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+/**
+ * Orders grade row pointers by course, keeping the student order within a course.
+ * Not satırı pointer'larını derse göre sıralar; ders içinde öğrenci sırası korunur.
+ */
+static int compare_archived_grade_course(const void *a, const void *b) {
+    const Grade *x = *(const Grade * const *)a, *y = *(const Grade * const *)b;
+    if (x->course_id != y->course_id) return (x->course_id < y->course_id) ? -1 : 1;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Orders enrollment row pointers by course, keeping the student order within a course.
+ * Kayıt satırı pointer'larını derse göre sıralar; ders içinde öğrenci sırası korunur.
+ */
+static int compare_archived_enrollment_course(const void *a, const void *b) {
+    const Enrollment *x = *(const Enrollment * const *)a, *y = *(const Enrollment * const *)b;
+    if (x->course_id != y->course_id) return (x->course_id < y->course_id) ? -1 : 1;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Adds (sign = 1) or removes (sign = -1) an archive's enrollments in the section headcounts, so the
+ * professor course load and faculty workload reports keep counting archived semesters.
+ * Bir arşivin kayıtlarını şube sayılarına ekler (sign = 1) veya çıkarır (sign = -1); profesör ders
+ * yükü ve fakülte iş yükü raporları arşivlenmiş dönemleri saymaya devam eder.
+ */
+static void file_archive_sections(const SemesterArchive *a, int sign) {
+    int i;
+    for (i = 0; i < a->enrollment_count; i++) {
+        if (sign > 0) section_add_enrollment(&a->enrollments[i]);
+        else section_remove_enrollment(&a->enrollments[i]);
+    }
+}
+
+/**
+ * Drops the caches that hold archived rows after the set of mapped archives changed.
+ * Eşlenmiş arşiv kümesi değiştikten sonra arşiv satırlarını tutan önbellekleri bırakır.
+ */
+static void archive_rows_changed(void) {
+    grade_term_index_invalidate();
+    enrollment_range_orders_invalidate();
+    grade_stats_archive_invalidate();
+    student_archived_totals_invalidate();
+}
+
+/**
+ * Maps an archive file read-only and registers it after checking its header, building its per-course
+ * orders and counting its enrollments in their sections. The caller drops the row caches afterwards.
+ * Bir arşiv dosyasını salt okunur eşler ve başlığını kontrol ettikten sonra kaydeder; derse göre
+ * dizilerini kurar ve kayıtlarını şubelerinde sayar. Satır önbelleklerini sonra çağıran bırakır.
+ * * @param semester - Semester the file must hold
+ * @param semester - Dosyanın tutması gereken dönem
+ * @return 1 if mapped, 0 otherwise
+ * @return Eşlendiyse 1, aksi takdirde 0 döner
+ */
+static int map_archive(const char *semester) {
+    char path[320];
+    struct stat info;
+    if (archive_total == MAX_ARCHIVES) {
+        printf("Error: At most %d semesters can be archived.\n", MAX_ARCHIVES);
+        return 0;
+    }
+    archive_path(semester, path, sizeof(path));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Warning: Archive %s is missing.\n", path);
+        return 0;
+    }
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(ArchiveHeader)) {
+        close(fd);
+        printf("Warning: Archive %s is damaged.\n", path);
+        return 0;
+    }
+    void *base = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        printf("Warning: Could not map %s.\n", path);
+        return 0;
+    }
+
+    const ArchiveHeader *header = (const ArchiveHeader *)base;
+    size_t grades_end = (size_t)header->grade_offset + (size_t)header->grade_count * sizeof(Grade);
+    size_t enrollments_end = (size_t)header->enrollment_offset + (size_t)header->enrollment_count * sizeof(Enrollment);
+    if (memcmp(header->magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) != 0 ||
+        header->grade_size != (int)sizeof(Grade) || header->enrollment_size != (int)sizeof(Enrollment) ||
+        strcmp(header->semester, semester) != 0 || header->grade_count < 0 || header->enrollment_count < 0 ||
+        grades_end > (size_t)info.st_size || enrollments_end > (size_t)info.st_size) {
+        munmap(base, (size_t)info.st_size);
+        printf("Warning: Archive %s does not match this build; skipped.\n", path);
+        return 0;
+    }
+
+    SemesterArchive *a = &archives[archive_total];
+    int i;
+    snprintf(a->semester, sizeof(a->semester), "%s", semester);
+    a->base = base;
+    a->length = (size_t)info.st_size;
+    a->grades = (const Grade *)((const char *)base + header->grade_offset);
+    a->grade_count = header->grade_count;
+    a->enrollments = (const Enrollment *)((const char *)base + header->enrollment_offset);
+    a->enrollment_count = header->enrollment_count;
+    a->grades_by_course = (const Grade **)malloc((a->grade_count + 1) * sizeof(const Grade *));
+    a->enrollments_by_course = (const Enrollment **)malloc((a->enrollment_count + 1) * sizeof(const Enrollment *));
+    if (a->grades_by_course == NULL || a->enrollments_by_course == NULL) {
+        free(a->grades_by_course);
+        free(a->enrollments_by_course);
+        munmap(base, (size_t)info.st_size);
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+    for (i = 0; i < a->grade_count; i++) a->grades_by_course[i] = &a->grades[i];
+    for (i = 0; i < a->enrollment_count; i++) a->enrollments_by_course[i] = &a->enrollments[i];
+    qsort(a->grades_by_course, a->grade_count, sizeof(const Grade *), compare_archived_grade_course);
+    qsort(a->enrollments_by_course, a->enrollment_count, sizeof(const Enrollment *), compare_archived_enrollment_course);
+    file_archive_sections(a, 1);
+    archive_total++;
+    return 1;
+}
+
+/**
+ * Unmaps every archive and takes its enrollments out of the section headcounts. The grade cube, the term range
+ * orders and the archived grade sketches hold archived rows, so they are dropped as well.
+ * Tüm arşivlerin eşlemesini kaldırır ve kayıtlarını şube sayılarından çıkarır. Not küpü, dönem aralığı dizileri
+ * ve arşiv not özetleri arşiv satırlarını tuttuğu için onlar da bırakılır.
+ */
+void archive_unload_all(void) {
+    int i;
+    enrollment_lock_list();
+    for (i = 0; i < archive_total; i++) {
+        file_archive_sections(&archives[i], -1);
+        free(archives[i].grades_by_course);
+        free(archives[i].enrollments_by_course);
+        munmap(archives[i].base, archives[i].length);
+    }
+    archive_total = 0;
+    enrollment_unlock_list();
+    grade_cube_invalidate();
+    archive_rows_changed();
+}
+
+/**
+ * Maps every archive listed in the manifest. Call before loading grades and enrollments:
+ * CSV rows of archived semesters are skipped at load.
+ * Listede kayıtlı tüm arşivleri eşler. Notları ve kayıtları yüklemeden önce çağrılmalıdır:
+ * arşivlenmiş dönemlerin CSV satırları yüklemede atlanır.
+ * * @return Number of mapped archives
+ * @return Eşlenen arşiv sayısı
+ */
+int archive_load_all(void) {
+    char path[320], line[128];
+    archive_unload_all();
+    snprintf(path, sizeof(path), "%s/%s", archive_dir, ARCHIVE_MANIFEST);
+    FILE *file = fopen(path, "r");
+    if (file == NULL) return 0;
+    enrollment_lock_list();
+    while (fgets(line, sizeof(line), file)) {
+        remove_newline(line);
+        trim_whitespace(line);
+        if (valid_semester_name(line) && !archive_is_frozen(line)) map_archive(line);
+    }
+    enrollment_unlock_list();
+    fclose(file);
+    archive_rows_changed();
+    if (archive_total > 0) printf("Success: Mapped %d semester archive(s).\n", archive_total);
+    return archive_total;
+}
+
+/**
+ * Checks whether a semester lives in a read-only archive.
+ * Bir dönemin salt okunur bir arşivde olup olmadığını kontrol eder.
+ * * @param semester - Semester string
+ * @param semester - Dönem dizgisi
+ * @return 1 if archived, 0 otherwise
+ * @return Arşivlenmişse 1, aksi takdirde 0 döner
+ */
+int archive_is_frozen(const char *semester) {
+    int i;
+    for (i = 0; i < archive_total; i++) {
+        if (strcmp(archives[i].semester, semester) == 0) return 1;
+    }
+    return 0;
+}
+
+/**
+ * Number of mapped archives.
+ * Eşlenmiş arşiv sayısı.
+ */
+int archive_count(void) {
+    return archive_total;
+}
+
+/**
+ * Returns a mapped archive by position (oldest first), or NULL.
+ * Eşlenmiş bir arşivi sırasına göre (en eski önce) döndürür, yoksa NULL.
+ */
+const SemesterArchive* archive_get(int index) {
+    return (index >= 0 && index < archive_total) ? &archives[index] : NULL;
+}
+
+/**
+ * Finds a student's grades in one archive by binary search.
+ * Bir öğrencinin bir arşivdeki notlarını ikili aramayla bulur.
+ * * @param archive - Mapped archive
+ * @param archive - Eşlenmiş arşiv
+ * @param student_id - Student ID
+ * @param student_id - Öğrenci ID'si
+ * @param first - Receives the first row (rows are contiguous)
+ * @param first - İlk satırı alır (satırlar ardışıktır)
+ * @return Number of rows
+ * @return Satır sayısı
+ */
+int archive_student_grades(const SemesterArchive *archive, int student_id, const Grade **first) {
+    int low = 0, high = archive->grade_count, end;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (archive->grades[mid].student_id < student_id) low = mid + 1;
+        else high = mid;
+    }
+    for (end = low; end < archive->grade_count && archive->grades[end].student_id == student_id; end++);
+    *first = archive->grades + low;
+    return end - low;
+}
+
+/**
+ * Finds a student's enrollments in one archive by binary search.
+ * Bir öğrencinin bir arşivdeki kayıtlarını ikili aramayla bulur.
+ * * @param archive - Mapped archive
+ * @param archive - Eşlenmiş arşiv
+ * @param student_id - Student ID
+ * @param student_id - Öğrenci ID'si
+ * @param first - Receives the first row (rows are contiguous)
+ * @param first - İlk satırı alır (satırlar ardışıktır)
+ * @return Number of rows
+ * @return Satır sayısı
+ */
+int archive_student_enrollments(const SemesterArchive *archive, int student_id, const Enrollment **first) {
+    int low = 0, high = archive->enrollment_count, end;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (archive->enrollments[mid].student_id < student_id) low = mid + 1;
+        else high = mid;
+    }
+    for (end = low; end < archive->enrollment_count && archive->enrollments[end].student_id == student_id; end++);
+    *first = archive->enrollments + low;
+    return end - low;
+}
+
+/**
+ * Finds a course's grades in one archive by binary search over its course order.
+ * Bir dersin bir arşivdeki notlarını ders sırası üzerinde ikili aramayla bulur.
+ * * @param archive - Mapped archive
+ * @param archive - Eşlenmiş arşiv
+ * @param course_id - Course ID
+ * @param course_id - Ders ID'si
+ * @param first - Receives the first row pointer (pointers are contiguous)
+ * @param first - İlk satır pointer'ını alır (pointer'lar ardışıktır)
+ * @return Number of rows
+ * @return Satır sayısı
+ */
+int archive_course_grades(const SemesterArchive *archive, int course_id, const Grade ***first) {
+    int low = 0, high = archive->grade_count, end;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (archive->grades_by_course[mid]->course_id < course_id) low = mid + 1;
+        else high = mid;
+    }
+    for (end = low; end < archive->grade_count && archive->grades_by_course[end]->course_id == course_id; end++);
+    *first = archive->grades_by_course + low;
+    return end - low;
+}
+
+/**
+ * Finds a course's enrollments in one archive by binary search over its course order.
+ * Bir dersin bir arşivdeki kayıtlarını ders sırası üzerinde ikili aramayla bulur.
+ * * @param archive - Mapped archive
+ * @param archive - Eşlenmiş arşiv
+ * @param course_id - Course ID
+ * @param course_id - Ders ID'si
+ * @param first - Receives the first row pointer (pointers are contiguous)
+ * @param first - İlk satır pointer'ını alır (pointer'lar ardışıktır)
+ * @return Number of rows
+ * @return Satır sayısı
+ */
+int archive_course_enrollments(const SemesterArchive *archive, int course_id, const Enrollment ***first) {
+    int low = 0, high = archive->enrollment_count, end;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (archive->enrollments_by_course[mid]->course_id < course_id) low = mid + 1;
+        else high = mid;
+    }
+    for (end = low; end < archive->enrollment_count && archive->enrollments_by_course[end]->course_id == course_id; end++);
+    *first = archive->enrollments_by_course + low;
+    return end - low;
+}
+
+/**
+ * Counts every mapped archive's enrollments in the section headcounts again; free_all_enrollments
+ * calls it after clearing the sections, which the archives outlive.
+ * Eşlenmiş tüm arşivlerin kayıtlarını şube sayılarına yeniden ekler; şubeleri temizledikten sonra
+ * free_all_enrollments çağırır, çünkü arşivler şubelerden uzun yaşar.
+ */
+void archive_file_sections(void) {
+    int i;
+    for (i = 0; i < archive_total; i++) file_archive_sections(&archives[i], 1);
+}
+
+/**
+ * Writes the header and rows of a new archive; the file only appears under its final name once complete.
+ * Yeni bir arşivin başlığını ve satırlarını yazar; dosya ancak tamamlandığında son adıyla görünür.
+ * * @return 1 if written, 0 otherwise
+ * @return Yazıldıysa 1, aksi takdirde 0 döner
+ */
+static int write_archive(const char *semester, const Grade *grades, int grade_count,
+                         const Enrollment *enrollments, int enrollment_count) {
+    char path[320], temp_path[330];
+    ArchiveHeader header;
+
+    if (mkdir(archive_dir, 0755) != 0 && errno != EEXIST) {
+        printf("Error: Could not create %s!\n", archive_dir);
+        return 0;
+    }
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+    snprintf(header.semester, sizeof(header.semester), "%s", semester);
+    header.grade_size = (int)sizeof(Grade);
+    header.enrollment_size = (int)sizeof(Enrollment);
+    header.grade_count = grade_count;
+    header.enrollment_count = enrollment_count;
+    header.grade_offset = (long)sizeof(ArchiveHeader);
+    header.enrollment_offset = header.grade_offset + (long)(grade_count * sizeof(Grade));
+
+    archive_path(semester, path, sizeof(path));
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+    FILE *file = fopen(temp_path, "wb");
+    if (file == NULL) {
+        printf("Error: Could not open %s for writing!\n", temp_path);
+        return 0;
+    }
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             fwrite(grades, sizeof(Grade), grade_count, file) == (size_t)grade_count &&
+             fwrite(enrollments, sizeof(Enrollment), enrollment_count, file) == (size_t)enrollment_count;
+    ok = (fclose(file) == 0) && ok;
+    if (!ok || rename(temp_path, path) != 0) {
+        remove(temp_path);
+        printf("Error: Could not write %s!\n", path);
+        return 0;
+    }
+
+    char manifest[320];
+    snprintf(manifest, sizeof(manifest), "%s/%s", archive_dir, ARCHIVE_MANIFEST);
+    file = fopen(manifest, "a");
+    if (file == NULL) {
+        printf("Error: Could not update %s!\n", manifest);
+        return 0;
+    }
+    fprintf(file, "%s\n", semester);
+    fclose(file);
+    return 1;
+}
+
+/**
+ * Freezes a closed semester: its grades and enrollments are written, sorted by student, into a read-only
+ * archive file, removed from the in-memory lists and served from a memory map from then on.
+ * Reads keep seeing them: transcripts, GPA, prerequisites and enrollment history by student, course
+ * rosters and grade listings by course, and the section headcounts behind the professor course load and
+ * faculty workload reports. The enrollment list lock is held from the first walk until the hot rows are
+ * deleted, so no enrollment of the semester is added or changed in between.
+ * The semester must have no "Enrolled" rows left (run Semester Rollover first).
+ * Kapanmış bir dönemi dondurur: notları ve kayıtları öğrenciye göre sıralanarak salt okunur bir arşiv
+ * dosyasına yazılır, bellek içi listelerden çıkarılır ve bundan sonra bellek eşlemesinden sunulur.
+ * Okumalar bunları görmeye devam eder: öğrenciye göre transkript, GPA, ön koşullar ve kayıt geçmişi,
+ * derse göre sınıf listeleri ve not listeleri, profesör ders yükü ve fakülte iş yükü raporlarının
+ * dayandığı şube sayıları. Kayıt listesi kilidi ilk taramadan sıcak satırlar silinene kadar tutulur;
+ * arada dönemin hiçbir kaydı eklenmez veya değişmez.
+ * Dönemde "Enrolled" kayıt kalmamalıdır (önce Dönem Sonu Devri çalıştırılmalıdır).
+ * * @param e_head - Double pointer to the head of the enrollment list
+ * @param e_head - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param g_head - Double pointer to the head of the grade list
+ * @param g_head - Not listesinin başına işaret eden çift kademeli pointer
+ * @param semester - Semester to freeze, e.g. "2022-FALL"
+ * @param semester - Dondurulacak dönem, örn. "2022-FALL"
+ * @return 1 if the semester was archived, 0 otherwise
+ * @return Dönem arşivlendiyse 1, aksi takdirde 0 döner
+ */
+int archive_freeze_semester(Enrollment **e_head, Grade **g_head, const char *semester) {
+    Enrollment *e;
+    Grade *g;
+    int enrollment_count = 0, grade_count = 0, i;
+
+    if (!valid_semester_name(semester)) {
+        printf("Error: Invalid semester name!\n");
+        return 0;
+    }
+    if (archive_is_frozen(semester)) {
+        printf("Error: Semester %s is already archived.\n", semester);
+        return 0;
+    }
+    enrollment_lock_list();
+    for (e = *e_head; e != NULL; e = e->next) {
+        if (strcmp(e->semester, semester) != 0) continue;
+        if (strcmp(e->status, "Enrolled") == 0) {
+            enrollment_unlock_list();
+            printf("Error: Semester %s still has active enrollments; run Semester Rollover first.\n", semester);
+            return 0;
+        }
+        enrollment_count++;
+    }
+    for (g = *g_head; g != NULL; g = g->next) {
+        if (strcmp(g->semester, semester) == 0) grade_count++;
+    }
+    if (enrollment_count == 0 && grade_count == 0) {
+        enrollment_unlock_list();
+        printf("Error: No rows found for semester %s.\n", semester);
+        return 0;
+    }
+
+    Grade *grades = (Grade *)calloc(grade_count > 0 ? grade_count : 1, sizeof(Grade));
+    Enrollment *enrollments = (Enrollment *)calloc(enrollment_count > 0 ? enrollment_count : 1, sizeof(Enrollment));
+    if (grades == NULL || enrollments == NULL) {
+        enrollment_unlock_list();
+        printf("Error: Memory allocation failed!\n");
+        free(grades);
+        free(enrollments);
+        return 0;
+    }
+    // Satırlar kopyalanır; zincir pointer'ları dosyada anlamsız olduğundan sıfırlanır
+    for (g = *g_head, i = 0; g != NULL; g = g->next) {
+        if (strcmp(g->semester, semester) != 0) continue;
+        grades[i] = *g;
+        grades[i].next_by_student = grades[i].next_by_course = grades[i].prev = grades[i].next = NULL;
+        i++;
+    }
+    for (e = *e_head, i = 0; e != NULL; e = e->next) {
+        if (strcmp(e->semester, semester) != 0) continue;
+        enrollments[i] = *e;
+        enrollments[i].next_by_student = enrollments[i].next_by_course = NULL;
+        enrollments[i].next_by_professor = enrollments[i].prev = enrollments[i].next = NULL;
+        i++;
+    }
+    qsort(grades, grade_count, sizeof(Grade), compare_archived_grades);
+    qsort(enrollments, enrollment_count, sizeof(Enrollment), compare_archived_enrollments);
+
+    int written = write_archive(semester, grades, grade_count, enrollments, enrollment_count);
+    free(grades);
+    free(enrollments);
+    if (!written || !map_archive(semester)) {
+        enrollment_unlock_list();
+        return 0;
+    }
+    // Arşiv şubelerde sayıldı; sıcak kayıtlar silinince sayılar değişmeden kalır
+    delete_semester_enrollments(e_head, semester);
+    enrollment_unlock_list();
+    archive_rows_changed();
+
+    delete_semester_grades(g_head, semester);
+    // Silinen sıcak notlar küpten düştü; aynı satırlar artık arşivden sayılır
+    for (i = 0; i < archives[archive_total - 1].grade_count; i++) {
+        grade_cube_account(&archives[archive_total - 1].grades[i], 1);
+    }
+    printf("Success: Archived %s (%d enrollments, %d grades, %lu bytes).\n", semester, enrollment_count,
+           grade_count, (unsigned long)archives[archive_total - 1].length);
+    return 1;
+}
+
+/**
+ * Lists the mapped archives.
+ * Eşlenmiş arşivleri listeler.
+ */
+void display_archives(void) {
+    int i;
+    printf("\n%-15s %12s %12s %12s\n", "Semester", "Enrollments", "Grades", "Bytes");
+    printf("----------------------------------------------------\n");
+    for (i = 0; i < archive_total; i++) {
+        printf("%-15s %12d %12d %12lu\n", archives[i].semester, archives[i].enrollment_count,
+               archives[i].grade_count, (unsigned long)archives[i].length);
+    }
+    if (archive_total == 0) printf("No archived semesters.\n");
+}
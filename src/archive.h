@@ -0,0 +1,59 @@
+// archive.h - Dönem Arşivi Modülü (Salt Okunur, mmap)
+
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "enrollment.h"
+#include "grade.h"
+
+#define ARCHIVE_DIR "data/archive"
+#define ARCHIVE_MANIFEST "manifest.csv"
+#define ARCHIVE_MAGIC "SSARC01"
+#define MAX_ARCHIVES 64
+
+// File header. Grade rows, then Enrollment rows follow, both sorted by student and with their
+// chain pointers cleared. Rows keep this build's struct layout; the row sizes guard against mismatches.
+// Dosya başlığı. Ardından Grade, sonra Enrollment satırları gelir; ikisi de öğrenciye göre sıralıdır ve
+// zincir pointer'ları temizlenmiştir. Satırlar bu derlemenin yapı düzenini korur; satır boyutları uyumsuzluğa karşı korur.
+typedef struct ArchiveHeader {
+    char magic[8];
+    char semester[20];
+    int grade_size;
+    int enrollment_size;
+    int grade_count;
+    int enrollment_count;
+    long grade_offset;
+    long enrollment_offset;
+} ArchiveHeader;
+
+// One closed semester mapped read-only into memory
+// Belleğe salt okunur eşlenmiş kapanmış bir dönem
+typedef struct SemesterArchive {
+    char semester[20];
+    void *base;
+    size_t length;
+    const Grade *grades;             // Sorted by student_id, course_id, id
+    int grade_count;
+    const Enrollment *enrollments;   // Sorted by student_id, course_id, id
+    int enrollment_count;
+    const Grade **grades_by_course;            // Same grade rows ordered by course_id (built when mapped)
+    const Enrollment **enrollments_by_course;  // Same enrollment rows ordered by course_id
+} SemesterArchive;
+
+void archive_set_directory(const char *dir);
+int archive_load_all(void);
+void archive_unload_all(void);
+int archive_freeze_semester(Enrollment **e_head, Grade **g_head, const char *semester);
+int archive_is_frozen(const char *semester);
+int archive_count(void);
+const SemesterArchive* archive_get(int index);
+int archive_student_grades(const SemesterArchive *archive, int student_id, const Grade **first);
+int archive_student_enrollments(const SemesterArchive *archive, int student_id, const Enrollment **first);
+int archive_course_grades(const SemesterArchive *archive, int course_id, const Grade ***first);
+int archive_course_enrollments(const SemesterArchive *archive, int course_id, const Enrollment ***first);
+void archive_file_sections(void);
+void display_archives(void);
+
+#endif
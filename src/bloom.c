@@ -0,0 +1,175 @@
+// bloom.c - Blok Bloom Filtresi Modülü
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bloom.h"
+
+/**
+ * Scrambles an ID into 64 well-mixed bits (splitmix64 finalizer).
+ * Bir ID'yi iyi karıştırılmış 64 bite dönüştürür (splitmix64 sonlandırıcısı).
+ * * @param id - ID to hash
+ * @param id - Hash'lenecek ID
+ * @return 64-bit hash
+ * @return 64 bitlik hash
+ */
+static uint64_t bloom_hash(int id) {
+    uint64_t x = (uint64_t)(uint32_t)id + 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * Sets the bits of an ID. All bits of one ID fall into a single 512-bit block,
+ * so a lookup touches one cache line.
+ * Bir ID'nin bitlerini işaretler. Bir ID'nin tüm bitleri tek bir 512 bitlik bloğa düşer,
+ * böylece bir sorgu tek bir önbellek satırına dokunur.
+ * * @param filter - Filter with allocated bits
+ * @param filter - Bitleri ayrılmış filtre
+ * @param id - ID to add
+ * @param id - Eklenecek ID
+ */
+static void bloom_set(BloomFilter *filter, int id) {
+    uint64_t h = bloom_hash(id);
+    uint64_t *block = filter->bits + (size_t)((h >> 40) % (uint64_t)filter->block_count) * BLOOM_BLOCK_WORDS;
+    int i;
+    for (i = 0; i < BLOOM_HASHES; i++) {
+        int bit = (int)((h >> (i * 9)) & (BLOOM_BLOCK_BITS - 1));
+        block[bit >> 6] |= (uint64_t)1 << (bit & 63);
+    }
+}
+
+/**
+ * Reallocates the filter for twice the current ID count and re-adds every ID of the exact index.
+ * This also drops the bits left behind by deleted IDs.
+ * Filtreyi mevcut ID sayısının iki katına göre yeniden ayırır ve tam indeksteki tüm ID'leri tekrar ekler.
+ * Bu işlem silinen ID'lerden kalan bitleri de temizler.
+ * * @param filter - Filter to rebuild
+ * @param filter - Yeniden oluşturulacak filtre
+ * @param index - Exact ID index holding the current IDs
+ * @param index - Mevcut ID'leri tutan tam ID indeksi
+ * @return 1 if successful, 0 if memory allocation fails
+ * @return Başarılıysa 1, bellek hatası oluşursa 0 döner
+ */
+static int bloom_rebuild(BloomFilter *filter, IdIndex *index) {
+    int blocks = (index->size * 2 * BLOOM_BITS_PER_ID) / BLOOM_BLOCK_BITS + 1;
+    if (blocks < BLOOM_MIN_BLOCKS) blocks = BLOOM_MIN_BLOCKS;
+
+    uint64_t *bits = (uint64_t *)calloc((size_t)blocks * BLOOM_BLOCK_WORDS, sizeof(uint64_t));
+    if (bits == NULL) return 0;
+    free(filter->bits);
+    filter->bits = bits;
+    filter->block_count = blocks;
+
+    int b;
+    for (b = 0; b < index->bucket_count; b++) {
+        IdIndexNode *node;
+        for (node = index->buckets[b]; node != NULL; node = node->next) {
+            bloom_set(filter, node->id);
+        }
+    }
+    return 1;
+}
+
+/**
+ * Adds an ID that was just inserted into the exact index, growing the filter when it gets too dense.
+ * Tam indekse yeni eklenmiş bir ID'yi filtreye ekler; filtre fazla dolarsa büyütür.
+ * * @param filter - Filter in front of the index
+ * @param filter - İndeksin önündeki filtre
+ * @param index - Exact ID index that already contains the ID
+ * @param index - ID'yi zaten içeren tam ID indeksi
+ * @param id - ID to add
+ * @param id - Eklenecek ID
+ * @return 1 if successful, 0 if memory allocation fails
+ * @return Başarılıysa 1, bellek hatası oluşursa 0 döner
+ */
+int bloom_insert(BloomFilter *filter, IdIndex *index, int id) {
+    if (filter->bits == NULL || (long)index->size * BLOOM_BITS_PER_ID > (long)filter->block_count * BLOOM_BLOCK_BITS) {
+        return bloom_rebuild(filter, index);
+    }
+    bloom_set(filter, id);
+    return 1;
+}
+
+/**
+ * Answers whether an ID may be present. A 0 answer is definite, so the exact lookup can be skipped.
+ * Bir ID'nin var olup olamayacağını söyler. 0 cevabı kesindir, tam arama atlanabilir.
+ * * @param filter - Filter to query
+ * @param filter - Sorgulanacak filtre
+ * @param id - ID to check
+ * @param id - Kontrol edilecek ID
+ * @return 1 if the ID may exist, 0 if it definitely does not
+ * @return ID var olabilirse 1, kesinlikle yoksa 0 döner
+ */
+int bloom_may_contain(BloomFilter *filter, int id) {
+    filter->queries++;
+    if (filter->bits == NULL) {
+        filter->skipped++;
+        return 0;
+    }
+
+    uint64_t h = bloom_hash(id);
+    const uint64_t *block = filter->bits + (size_t)((h >> 40) % (uint64_t)filter->block_count) * BLOOM_BLOCK_WORDS;
+    int i;
+    for (i = 0; i < BLOOM_HASHES; i++) {
+        int bit = (int)((h >> (i * 9)) & (BLOOM_BLOCK_BITS - 1));
+        if ((block[bit >> 6] & ((uint64_t)1 << (bit & 63))) == 0) {
+            filter->skipped++;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Records that a "maybe" answer was not confirmed by the exact index.
+ * Bir "olabilir" cevabının tam indeks tarafından doğrulanmadığını kaydeder.
+ * * @param filter - Filter that answered
+ * @param filter - Cevap veren filtre
+ */
+void bloom_note_false_positive(BloomFilter *filter) {
+    filter->false_positives++;
+}
+
+/**
+ * Measured false-positive rate: share of absent IDs the filter could not rule out.
+ * Ölçülen yanlış pozitif oranı: filtrenin eleyemediği mevcut olmayan ID'lerin payı.
+ * * @param filter - Filter to report
+ * @param filter - Raporlanacak filtre
+ * @return Rate between 0.0 and 1.0
+ * @return 0.0 ile 1.0 arasında oran
+ */
+double bloom_false_positive_rate(const BloomFilter *filter) {
+    long absent = filter->skipped + filter->false_positives;
+    if (absent == 0) return 0.0;
+    return (double)filter->false_positives / (double)absent;
+}
+
+/**
+ * Prints one statistics row for a table's filter.
+ * Bir tablonun filtresi için tek satırlık istatistik yazdırır.
+ * * @param table - Table name
+ * @param table - Tablo adı
+ * @param filter - Filter to report
+ * @param filter - Raporlanacak filtre
+ * @param id_count - Number of IDs in the exact index
+ * @param id_count - Tam indeksteki ID sayısı
+ */
+void bloom_print_stats(const char *table, const BloomFilter *filter, int id_count) {
+    printf("%-12s %8d %10ld %10ld %10ld %10ld %9.3f%%\n",
+           table, id_count, (long)filter->block_count * BLOOM_BLOCK_BITS,
+           filter->queries, filter->skipped, filter->false_positives,
+           bloom_false_positive_rate(filter) * 100.0);
+}
+
+/**
+ * Frees the filter bits and resets the counters.
+ * Filtre bitlerini serbest bırakır ve sayaçları sıfırlar.
+ * * @param filter - Filter to clear
+ * @param filter - Temizlenecek filtre
+ */
+void bloom_clear(BloomFilter *filter) {
+    free(filter->bits);
+    memset(filter, 0, sizeof(BloomFilter));
+}
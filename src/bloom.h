@@ -0,0 +1,32 @@
+// bloom.h - Blok Bloom Filtresi Modülü
+
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "index.h"
+
+#define BLOOM_BLOCK_WORDS 8        // 8 x 64 bit = 512 bit (one cache line)
+#define BLOOM_BLOCK_BITS 512
+#define BLOOM_HASHES 4
+#define BLOOM_BITS_PER_ID 12       // ~1% false positives at full load
+#define BLOOM_MIN_BLOCKS 4
+
+typedef struct BloomFilter {
+    uint64_t *bits;
+    int block_count;
+    long queries;             // Membership checks
+    long skipped;             // Definitely-new answers (exact lookup skipped)
+    long false_positives;     // "Maybe" answers the exact index did not confirm
+} BloomFilter;
+
+int bloom_insert(BloomFilter *filter, IdIndex *index, int id);
+int bloom_may_contain(BloomFilter *filter, int id);
+void bloom_note_false_positive(BloomFilter *filter);
+double bloom_false_positive_rate(const BloomFilter *filter);
+void bloom_print_stats(const char *table, const BloomFilter *filter, int id_count);
+void bloom_clear(BloomFilter *filter);
+
+#endif
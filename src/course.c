@@ -1,419 +1,852 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include "course.h"
-#include "utils.h"
-#include "grade.h"
-#include "enrollment.h"
-
-/**
- * Adds a new course to the system after validating data and checking for duplicate IDs.
- * Verileri doruladktan ve mkerrer ID kontrol yaptktan sonra sisteme yeni bir ders ekler.
- * * @param head_ptr - Double pointer to the head of the course linked list [cite: 98]
- * @param head_ptr - Kurs bal listesinin bana iaret eden ift kademeli pointer [cite: 98]
- * @param new_data - Pointer to the structure containing the new course details
- * @param new_data - Yeni ders detaylarn ieren yapya iaret eden pointer
- * @return 1 if addition is successful, 0 if validation fails or ID already exists [cite: 533]
- * @return Ekleme baarlysa 1, dorulama baarszsa veya ID zaten varsa 0 dner [cite: 533]
- */
-int add_course(Course **head_ptr, const Course *new_data) {
-    if (new_data == NULL) {
-        printf("Error: Invalid course data!\n");
-        return 0;
-    }
-    
-    if (!validate_positive_int(new_data->id)) {
-        printf("Error: Course ID must be positive!\n");
-        return 0;
-    }
-    
-    if (!validate_positive_int(new_data->credits)) {
-        printf("Error: Credits must be positive!\n");
-        return 0;
-    }
-    
-    if (!validate_positive_int(new_data->capacity)) {
-        printf("Error: Capacity must be positive!\n");
-        return 0;
-    }
-    
-    if (find_course_by_id(*head_ptr, new_data->id) != NULL) {
-        printf("Error: Course with ID %d already exists!\n", new_data->id);
-        return 0;
-    }
-    
-    Course *new_node = (Course *)malloc(sizeof(Course));
-    if (new_node == NULL) {
-        printf("Error: Memory allocation failed!\n");
-        return 0;
-    }
-    
-    *new_node = *new_data;
-    new_node->next = NULL;
-    
-    if (*head_ptr == NULL) {
-        *head_ptr = new_node;
-    } else {
-        Course *current = *head_ptr;
-        while (current->next != NULL) {
-            current = current->next;
-        }
-        current->next = new_node;
-    }
-    
-    printf("Success: Course '%s' added successfully!\n", new_data->name);
-    return 1;
-}
-
-/**
- * Searches for a course in the linked list using its unique integer ID.
- * Benzersiz tam say ID'sini kullanarak bal listede bir kursu arar.
- * * @param head - Pointer to the head of the course list
- * @param head - Kurs listesinin bana iaret eden pointer
- * @param id - The unique identifier of the course to find [cite: 40]
- * @param id - Bulunacak kursun benzersiz tanmlaycs [cite: 40]
- * @return Pointer to the course node if found, NULL otherwise
- * @return Kurs dm bulunursa adresi, aksi takdirde NULL dner
- */
-Course* find_course_by_id(Course *head, int id) {
-    Course *current = head;
-    while (current != NULL) {
-        if (current->id == id) {
-            return current;
-        }
-        current = current->next;
-    }
-    return NULL;
-}
-
-/**
- * Searches for a course in the linked list using its unique string code (e.g., "CS101").
- * Benzersiz ders kodunu (rn. "CS101") kullanarak bal listede bir kursu arar.
- * * @param head - Pointer to the head of the course list
- * @param head - Kurs listesinin bana iaret eden pointer
- * @param code - The string code of the course to find
- * @param code - Bulunacak kursun dizgi formatndaki kodu
- * @return Pointer to the course node if found, NULL otherwise
- * @return Kurs dm bulunursa adresi, aksi takdirde NULL dner
- */
-Course* find_course_by_code(Course *head, const char *code) {
-    Course *current = head;
-    while (current != NULL) {
-        if (strcmp(current->code, code) == 0) {
-            return current;
-        }
-        current = current->next;
-    }
-    return NULL;
-}
-
-/**
- * Updates the fields of an existing course node with new validated information.
- * Mevcut bir kurs dmnn alanlarn dorulanm yeni bilgilerle gnceller.
- * * @param course_to_update - Pointer to the course node stored in the system [cite: 38]
- * @param course_to_update - Sistemde kaytl olan gncellenecek kurs dm pointer' [cite: 38]
- * @param new_data - Pointer to the structure containing updated details
- * @param new_data - Gncellenmi detaylar ieren yapya iaret eden pointer
- * @return 1 if update is successful, 0 if validation fails
- * @return Gncelleme baarlysa 1, dorulama baarszsa 0 dner
- */
-int update_course(Course *course_to_update, const Course *new_data) {
-    if (course_to_update == NULL || new_data == NULL) {
-        printf("Error: Invalid parameters!\n");
-        return 0;
-    }
-    
-    if (!validate_positive_int(new_data->credits)) {
-        printf("Error: Credits must be positive!\n");
-        return 0;
-    }
-    
-    if (!validate_positive_int(new_data->capacity)) {
-        printf("Error: Capacity must be positive!\n");
-        return 0;
-    }
-    
-    strcpy(course_to_update->code, new_data->code);
-    strcpy(course_to_update->name, new_data->name);
-    course_to_update->credits = new_data->credits;
-    course_to_update->capacity = new_data->capacity;
-    strcpy(course_to_update->department, new_data->department);
-    strcpy(course_to_update->prerequisites, new_data->prerequisites);
-    
-    printf("Success: Course information updated!\n");
-    return 1;
-}
-
-/**
- * Deletes a course from the linked list and frees the allocated memory.
- * Bal listeden bir kursu siler ve ayrlan bellei serbest brakr.
- * * @param head_ptr - Double pointer to the head of the course list [cite: 39]
- * @param head_ptr - Kurs listesinin bana iaret eden ift kademeli pointer [cite: 39]
- * @param id - The unique ID of the course to be removed
- * @param id - Silinecek kursun benzersiz ID'si
- * @return 1 if deletion is successful, 0 if course is not found
- * @return Silme baarlysa 1, kurs bulunamazsa 0 dner
- */
-int delete_course(Course **head_ptr, int id) {
-    Course *current = *head_ptr;
-    Course *prev = NULL;
-    
-    if (current == NULL) {
-        printf("Error: Course list is empty!\n");
-        return 0;
-    }
-    
-    if (current->id == id) {
-        *head_ptr = current->next;
-        free(current);
-        printf("Success: Course with ID %d deleted.\n", id);
-        return 1;
-    }
-    
-    while (current != NULL && current->id != id) {
-        prev = current;
-        current = current->next;
-    }
-    
-    if (current == NULL) {
-        printf("Error: Course with ID %d not found!\n", id);
-        return 0;
-    }
-    
-    prev->next = current->next;
-    free(current);
-    printf("Success: Course with ID %d deleted.\n", id);
-    return 1;
-}
-
-/**
- * Reads course records from a CSV file and populates the linked list[cite: 144].
- * CSV dosyasndaki kurs kaytlarn okur ve bal listeyi doldurur[cite: 144].
- * * @param head_ptr - Double pointer to receive the head of the loaded list [cite: 93]
- * @param head_ptr - Yklenen listenin ban alacak ift kademeli pointer [cite: 93]
- * @return 1 if loading is successful, 0 if file cannot be opened
- * @return Ykleme baarlysa 1, dosya alamazsa 0 dner
- */
-int load_courses_from_csv(Course **head_ptr) {
-    const char *filename = "data/courses.csv";
-    FILE *file = fopen(filename, "r");
-    
-    if (file == NULL) {
-    	filename = "courses.csv";
-        file = fopen(filename, "r");
-        if (file == NULL) {
-            printf("Warning: Could not open courses.csv. Starting empty.\n");
-            return 0;
-        }
-    }
-    
-    char line[512];
-    char *tokens[10];
-    int count = 0;
-    fgets(line, sizeof(line), file);
-    
-    while (fgets(line, sizeof(line), file)) {
-        remove_newline(line);
-        int token_count = split_csv_line(line, tokens, 7);
-        if (token_count >= 6) {
-            Course temp;
-            temp.id = atoi(tokens[0]);
-            strcpy(temp.code, tokens[1]);
-            strcpy(temp.name, tokens[2]);
-            temp.credits = atoi(tokens[3]);
-            temp.capacity = atoi(tokens[4]);
-            strcpy(temp.department, tokens[5]);
-            if (token_count >= 7) strcpy(temp.prerequisites, tokens[6]);
-            else strcpy(temp.prerequisites, "");
-            
-            Course *new_node = (Course *)malloc(sizeof(Course));
-            if (new_node) {
-                *new_node = temp;
-                new_node->next = NULL;
-                if (*head_ptr == NULL) *head_ptr = new_node;
-                else {
-                    Course *curr = *head_ptr;
-                    while (curr->next != NULL) curr = curr->next;
-                    curr->next = new_node;
-                }
-                count++;
-            }
-        }
-    }
-    fclose(file);
-    printf("Success: Loaded %d courses from CSV.\n", count);
-    return 1;
-}
-
-/**
- * Writes the entire course list into a formatted CSV file for persistence[cite: 92].
- * Tm kurs listesini kalclk salamak iin formatl bir CSV dosyasna yazar[cite: 92].
- * * @param head - Pointer to the head of the course list
- * @param head - Kurs listesinin bana iaret eden pointer
- * @param filename - String representing the path to the save file
- * @param filename - Kayt dosyasnn yolunu temsil eden dizgi
- * @return 1 if save is successful, 0 if file cannot be opened
- * @return Kayt baarlysa 1, dosya alamazsa 0 dner
- */
-int save_courses_to_csv(Course *head, const char *filename) {
-    FILE *file = fopen(filename, "w");
-    if (file == NULL) {
-        printf("Error: Could not open file for writing!\n");
-        return 0;
-    }
-    
-    fprintf(file, "course_id,course_code,course_name,credits,capacity,department,prerequisites\n");
-    Course *current = head;
-    int count = 0;
-    while (current != NULL) {
-        fprintf(file, "%d,%s,%s,%d,%d,%s,%s\n",
-                current->id, current->code, current->name, 
-                current->credits, current->capacity, 
-                current->department, current->prerequisites);
-        current = current->next;
-        count++;
-    }
-    fclose(file);
-    printf("Success: Saved %d courses to CSV.\n", count);
-    return 1;
-}
-
-/**
- * Prints all courses in the system in a readable table format[cite: 80].
- * Sistemdeki tm kurslar okunabilir bir tablo formatnda yazdrr[cite: 80].
- * * @param head - Pointer to the head of the course list
- * @param head - Kurs listesinin bana iaret eden pointer
- */
-void display_all_courses(Course *head) {
-    printf("\n====================================================================================================\n");
-    printf("                                            COURSE LIST\n");
-    printf("====================================================================================================\n");
-    printf("%-6s %-8s %-35s %-4s %-5s %-20s %s\n", "ID", "Code", "Name", "Crd", "Cap", "Department", "Prereqs");
-    printf("----------------------------------------------------------------------------------------------------\n");
-
-    Course *current = head;
-    int count = 0;
-    while (current != NULL) {
-        printf("%-6d %-8s %-35s %-4d %-5d %-20s %s\n", 
-               current->id, current->code, current->name, 
-               current->credits, current->capacity, current->department,
-               (strlen(current->prerequisites) > 1) ? current->prerequisites : "None");
-        current = current->next;
-        count++;
-    }
-    printf("====================================================================================================\n");
-    printf("Total Courses: %d\n", count);
-}
-
-/**
- * Displays full details of a specific course node[cite: 41].
- * Belirli bir kurs dmnn tm detaylarn grntler[cite: 41].
- * * @param course - Pointer to the course structure to display
- * @param course - Grntlenecek kurs yapsna iaret eden pointer
- */
-void display_course_details(Course *course) {
-    if (course == NULL) {
-        printf("Error: Course not found!\n");
-        return;
-    }
-    printf("\n========================================\n");
-    printf("         COURSE DETAILS                 \n");
-    printf("========================================\n");
-    printf("ID:            %d\n", course->id);
-    printf("Code:          %s\n", course->code);
-    printf("Name:          %s\n", course->name);
-    printf("Credits:       %d\n", course->credits);
-    printf("Capacity:      %d\n", course->capacity);
-    printf("Department:    %s\n", course->department);
-    printf("Prerequisites: %s\n", (strlen(course->prerequisites) > 0) ? course->prerequisites : "None");
-    printf("========================================\n");
-}
-
-/**
- * Checks if a course has any defined prerequisite requirements[cite: 43].
- * Bir kursun tanmlanm herhangi bir n koul gereksinimi olup olmadn kontrol eder[cite: 43].
- * * @param course - Pointer to the course structure
- * @param course - Kurs yapsna iaret eden pointer
- * @return 1 if prerequisites exist, 0 otherwise
- * @return n koullar varsa 1, aksi takdirde 0 dner
- */
-int has_prerequisites(Course *course) {
-    if (course == NULL) return 0;
-    return (strlen(course->prerequisites) > 0);
-}
-
-/**
- * Verifies if a student has passed all prerequisites for a specific course[cite: 54].
- * Bir rencinin belirli bir kurs iin tm n koullar geip gemediini dorular[cite: 54].
- * * @param student_id - ID of the student attempting to enroll
- * @param student_id - Kaydolmaya alan rencinin ID'si
- * @param course - Pointer to the course with potential prerequisites
- * @param course - Olas n koullar olan kursa iaret eden pointer
- * @param grade_head_void - Generic pointer to the head of the grade list
- * @param grade_head_void - Not listesinin bana iaret eden genel pointer
- * @param enrollment_head_void - Generic pointer to the head of the enrollment list
- * @param enrollment_head_void - Kayt listesinin bana iaret eden genel pointer
- * @return 1 if all prerequisites are met, 0 otherwise
- * @return Tm n koullar salanmsa 1, aksi takdirde 0 dner
- */
-int check_prerequisites(int student_id, Course *course, void *grade_head_void, void *enrollment_head_void) {
-    if (course == NULL) return 0;
-    if (!has_prerequisites(course)) return 1;
-    
-    Grade *grade_head = (Grade *)grade_head_void;
-    char prereq_copy[100];
-    strcpy(prereq_copy, course->prerequisites);
-    
-    char *token = strtok(prereq_copy, ",");
-    while (token != NULL) {
-        trim_whitespace(token);
-        int passed = 0;
-        Grade *g = grade_head;
-        while (g != NULL) {
-            if (g->student_id == student_id) {
-                if (g->numeric_grade >= 60.0) passed = 1;
-            }
-            g = g->next;
-        }
-        if (!passed) {
-            printf("Error: Student has not completed prerequisite: %s\n", token);
-            return 0;
-        }
-        token = strtok(NULL, ",");
-    }
-    return 1;
-}
-
-/**
- * Frees all dynamically allocated memory within the course linked list[cite: 162].
- * Kurs bal listesi iindeki dinamik olarak ayrlm tm bellei serbest brakr[cite: 162].
- * * @param head - Pointer to the head of the course list
- * @param head - Kurs listesinin bana iaret eden pointer
- */
-void free_all_courses(Course *head) {
-    Course *temp;
-    while (head != NULL) {
-        temp = head;
-        head = head->next;
-        free(temp); 
-    }
-    printf("Memory for courses cleared.\n");
-}
-
-/**
- * Counts the total number of courses currently in the linked list.
- * u anda bal listede bulunan toplam kurs saysn sayar.
- * * @param head - Pointer to the head of the course list
- * @param head - Kurs listesinin bana iaret eden pointer
- * @return Total number of course nodes
- * @return Toplam kurs dm says
- */
-int count_courses(Course *head) {
-    int count = 0;
-    Course *current = head;
-    while (current != NULL) {
-        count++;
-        current = current->next;
-    }
-    return count;
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "course.h"
+#include "utils.h"
+#include "grade.h"
+#include "enrollment.h"
+#include "index.h"
+#include "bloom.h"
+#include "student.h"
+#include "snapshot.h"
+#include "archive.h"
+
+// Course lookup indexes: normalized code -> Course*, ID -> Course*, dense slot -> Course*.
+// Kurs arama indeksleri: normalize kod -> Course*, ID -> Course*, yoğun indeks -> Course*.
+static HashIndex course_code_index = {NULL, 0, 0};
+static IdIndex course_id_index = {NULL, 0, 0};
+static Course **course_slots = NULL;
+static int course_slot_count = 0;
+static int course_slot_capacity = 0;
+
+// Blocked Bloom filter in front of the ID index; most brand-new IDs are ruled out without a lookup.
+// ID indeksinin önündeki blok Bloom filtresi; yeni ID'lerin çoğu arama yapılmadan elenir.
+static BloomFilter course_id_filter = {NULL, 0, 0, 0, 0};
+
+// Last course node and the list it belongs to; add_course and the CSV loader append here.
+// Son kurs düğümü ve ait olduğu liste; add_course ve CSV yükleyicisi buraya ekler.
+static Course *course_tail = NULL;
+static Course **course_tail_owner = NULL;
+
+// Bumped atomically on every catalog change so cached prerequisite slots get re-resolved.
+// Katalog her değiştiğinde atomik olarak artırılır; önbellekteki ön koşul indeksleri yeniden çözülür.
+static int course_catalog_version = 1;
+
+// Guards the cached prerequisite slots, which enrollment threads resolve and read concurrently.
+// Kayıt iş parçacıklarının eşzamanlı çözüp okuduğu önbellekteki ön koşul indekslerini korur.
+static pthread_mutex_t prereq_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Links a course node after the last one without walking the list. The first append to a different list
+ * finds that list's tail once.
+ * Bir kurs düğümünü listeyi yürümeden sonuncunun arkasına bağlar. Farklı bir listeye yapılan ilk ekleme
+ * o listenin sonunu bir kez bulur.
+ * * @param head_ptr - Double pointer to the head of the course list
+ * @param head_ptr - Kurs listesinin başına işaret eden çift kademeli pointer
+ * @param node - Node to append
+ * @param node - Eklenecek düğüm
+ */
+static void append_course_node(Course **head_ptr, Course *node) {
+    if (head_ptr != course_tail_owner || *head_ptr == NULL) {
+        course_tail = *head_ptr;
+        while (course_tail != NULL && course_tail->next != NULL) course_tail = course_tail->next;
+        course_tail_owner = head_ptr;
+    }
+    node->next = NULL;
+    if (course_tail == NULL) *head_ptr = node;
+    else course_tail->next = node;
+    course_tail = node;
+}
+
+/**
+ * Assigns a dense slot to a course node and registers it in the code and ID indexes.
+ * The slot array grows under prereq_lock, since enrollment threads read it through the prerequisite checks.
+ * Bir kurs düğümüne yoğun indeks atar ve onu kod ve ID indekslerine kaydeder.
+ * Kayıt iş parçacıkları ön koşul kontrolünde okuduğu için indeks dizisi prereq_lock altında büyütülür.
+ * * @param course - Course node stored in the list
+ * @param course - Listede saklanan kurs düğümü
+ * @return 1 if indexed, 0 if the slot array could not grow
+ * @return İndekslendiyse 1, indeks dizisi büyütülemediyse 0 döner
+ */
+static int index_course(Course *course) {
+    char key[INDEX_KEY_LEN];
+
+    pthread_mutex_lock(&prereq_lock);
+    if (course_slot_count == course_slot_capacity) {
+        int new_capacity = (course_slot_capacity == 0) ? 64 : course_slot_capacity * 2;
+        Course **grown = (Course **)realloc(course_slots, new_capacity * sizeof(Course *));
+        if (grown == NULL) {
+            pthread_mutex_unlock(&prereq_lock);
+            printf("Error: Memory allocation failed!\n");
+            return 0;
+        }
+        course_slots = grown;
+        course_slot_capacity = new_capacity;
+    }
+    course->slot = course_slot_count;
+    course_slots[course_slot_count++] = course;
+    pthread_mutex_unlock(&prereq_lock);
+    course->prereq_count = 0;
+    course->prereq_version = 0;
+    course->seats_taken = 0;
+
+    normalize_key(course->code, key, INDEX_KEY_LEN);
+    index_insert(&course_code_index, key, course);
+    id_index_insert(&course_id_index, course->id, course);
+    bloom_insert(&course_id_filter, &course_id_index, course->id);
+    __sync_fetch_and_add(&course_catalog_version, 1);
+    snapshot_touch();
+    return 1;
+}
+
+/**
+ * Moves the course's counted grades in their students' term totals to a new credit value (0 stops counting them).
+ * Kursun sayılan notlarını öğrencilerin dönem toplamlarında yeni kredi değerine taşır (0 sayımı bırakır).
+ * * @param course - Course whose grades are recounted
+ * @param course - Notları yeniden sayılan kurs
+ * @param credits - New credits of the course
+ * @param credits - Kursun yeni kredisi
+ */
+static void recount_course_grades(Course *course, int credits) {
+    Grade *g;
+    for (g = course->first_grade; g != NULL; g = g->next_by_course) {
+        if (g->counted_credits == 0) continue;
+        Student *s = get_student_by_id(g->student_id);
+        student_account_grade(s, g->term, g->counted_credits, g->numeric_grade, -1);
+        g->counted_credits = credits;
+        student_account_grade(s, g->term, credits, g->numeric_grade, 1);
+    }
+}
+
+/**
+ * Removes a course node from the code, ID and slot indexes and detaches its row chains.
+ * Bir kurs düğümünü kod, ID ve yoğun indekslerden çıkarır ve satır zincirlerini çözer.
+ * * @param course - Course node stored in the list
+ * @param course - Listede saklanan kurs düğümü
+ */
+static void unindex_course(Course *course) {
+    char key[INDEX_KEY_LEN];
+    normalize_key(course->code, key, INDEX_KEY_LEN);
+    index_remove(&course_code_index, key, course);
+    id_index_remove(&course_id_index, course->id, course);
+    pthread_mutex_lock(&prereq_lock);
+    if (course->slot >= 0 && course->slot < course_slot_count) course_slots[course->slot] = NULL;
+    pthread_mutex_unlock(&prereq_lock);
+    __sync_fetch_and_add(&course_catalog_version, 1);
+    snapshot_touch();
+
+    // Detach the per-course row chains so remaining rows do not link through a deleted course
+    // Kalan satırlar silinen kurs üzerinden bağlı kalmasın diye kurs zincirlerini çöz
+    recount_course_grades(course, 0);
+    grade_detach_course(course);
+    enrollment_detach_course(course);
+}
+
+/**
+ * Reads the next non-empty code of a comma/semicolon separated prerequisite list and moves the cursor past it.
+ * Virgül/noktalı virgülle ayrılmış ön koşul listesinin boş olmayan sonraki kodunu okur ve imleci ilerletir.
+ * * @param cursor - Position in the list, advanced past the code
+ * @param cursor - Listedeki konum; kodun ötesine ilerletilir
+ * @param token - Receives the trimmed code (100 bytes)
+ * @param token - Kırpılmış kodu alır (100 bayt)
+ * @return 1 if a code was read, 0 at the end of the list
+ * @return Kod okunduysa 1, liste bittiyse 0 döner
+ */
+static int next_prerequisite_code(const char **cursor, char *token) {
+    const char *p = *cursor;
+    while (*p != '\0') {
+        size_t len = strcspn(p, ",;");
+        if (len >= 100) len = 99;
+        memcpy(token, p, len);
+        token[len] = '\0';
+        p += len;
+        if (*p != '\0') p++;
+        trim_whitespace(token);
+        if (strlen(token) > 0) {
+            *cursor = p;
+            return 1;
+        }
+    }
+    *cursor = p;
+    return 0;
+}
+
+/**
+ * Rejects a prerequisite list with more codes than a course can resolve (MAX_PREREQUISITES).
+ * Bir kursun çözebileceğinden (MAX_PREREQUISITES) fazla kod içeren ön koşul listesini reddeder.
+ * * @param course - Course data being added, updated or loaded
+ * @param course - Eklenen, güncellenen veya yüklenen kurs verisi
+ * @return 1 if the list fits, 0 otherwise
+ * @return Liste sığıyorsa 1, aksi halde 0 döner
+ */
+static int validate_prerequisite_count(const Course *course) {
+    char token[100];
+    const char *p = course->prerequisites;
+    int count = 0;
+    while (next_prerequisite_code(&p, token)) count++;
+    if (count > MAX_PREREQUISITES) {
+        printf("Error: Course %s lists %d prerequisites; at most %d are allowed!\n", course->code, count, MAX_PREREQUISITES);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * Resolves the prerequisite codes of a course into dense slots, reusing the cached result
+ * while the catalog is unchanged, and copies them out. Resolving and copying happen under
+ * prereq_lock, so concurrent enrollment threads never write the cache at the same time or
+ * read a half-filled slot list.
+ * Bir kursun ön koşul kodlarını yoğun indekslere çözer; katalog değişmediği sürece
+ * önbellekteki sonucu kullanır ve indeksleri dışarı kopyalar. Çözme ve kopyalama prereq_lock
+ * altında yapılır; eşzamanlı kayıt iş parçacıkları önbelleğe aynı anda yazmaz ve yarım
+ * doldurulmuş bir liste okumaz.
+ * * @param course - Course whose prerequisites are resolved
+ * @param course - Ön koşulları çözülecek kurs
+ * @param slots - Receives the slots (MAX_PREREQUISITES entries, -1 = unknown code)
+ * @param slots - İndeksleri alır (MAX_PREREQUISITES eleman, -1 = bilinmeyen kod)
+ * @return Number of prerequisites
+ * @return Ön koşul sayısı
+ */
+static int resolve_prerequisites(Course *course, int *slots) {
+    char token[100];
+    char key[INDEX_KEY_LEN];
+    int count = 0;
+    const char *p = course->prerequisites;
+
+    pthread_mutex_lock(&prereq_lock);
+    int version = __sync_fetch_and_add(&course_catalog_version, 0);
+    if (course->prereq_version != version) {
+        // add/update/load reject longer lists, so the bound never cuts a list short
+        // add/update/load daha uzun listeleri reddeder; sınır hiçbir listeyi kısaltmaz
+        while (count < MAX_PREREQUISITES && next_prerequisite_code(&p, token)) {
+            normalize_key(token, key, INDEX_KEY_LEN);
+            Course *prereq = (Course *)index_find(&course_code_index, key);
+            course->prereq_slots[count++] = (prereq != NULL) ? prereq->slot : -1;
+        }
+        course->prereq_count = count;
+        course->prereq_version = version;
+    }
+    count = course->prereq_count;
+    memcpy(slots, course->prereq_slots, count * sizeof(int));
+    pthread_mutex_unlock(&prereq_lock);
+    return count;
+}
+
+/**
+ * Copies the code of the course at a dense slot while holding prereq_lock, so a concurrent add or
+ * delete cannot move the slot array underneath the reader.
+ * Yoğun indeksteki kursun kodunu prereq_lock altında kopyalar; eşzamanlı ekleme ya da silme indeks
+ * dizisini okuyanın altından taşıyamaz.
+ * * @param slot - Dense course index
+ * @param slot - Yoğun kurs indeksi
+ * @param code - Receives the course code (may be NULL)
+ * @param code - Kurs kodunu alır (NULL olabilir)
+ * @return 1 if a course sits at the slot, 0 otherwise
+ * @return İndekste bir kurs varsa 1, yoksa 0 döner
+ */
+static int slot_course_code(int slot, char *code) {
+    int found = 0;
+    pthread_mutex_lock(&prereq_lock);
+    if (slot >= 0 && slot < course_slot_count && course_slots[slot] != NULL) {
+        if (code != NULL) strcpy(code, course_slots[slot]->code);
+        found = 1;
+    }
+    pthread_mutex_unlock(&prereq_lock);
+    return found;
+}
+
+/**
+ * Finds a student's best score in each of the given prerequisite slots, live and archived rows alike.
+ * Bir öğrencinin verilen ön koşul indekslerindeki en iyi puanını canlı ve arşiv satırlarından bulur.
+ * * @param student_id - ID of the student
+ * @param student_id - Öğrencinin ID'si
+ * @param g_head - Head of the grade list (walked only for unknown students)
+ * @param g_head - Not listesinin başı (yalnızca bilinmeyen öğrencilerde yürünür)
+ * @param slots - Prerequisite slots
+ * @param slots - Ön koşul indeksleri
+ * @param count - Number of slots
+ * @param count - İndeks sayısı
+ * @param best - Receives the best score per slot (-1 if never graded)
+ * @param best - İndeks başına en iyi puanı alır (hiç not yoksa -1)
+ */
+static void collect_prerequisite_scores(int student_id, Grade *g_head, const int *slots, int count, float *best) {
+    Student *s = get_student_by_id(student_id);
+    const Grade *g;
+    int a, i, k;
+    for (k = 0; k < count; k++) best[k] = -1.0f;
+    for (g = (s != NULL) ? s->first_grade : g_head; g != NULL; g = (s != NULL) ? g->next_by_student : g->next) {
+        if (g->student_id != student_id) continue;
+        Course *c = (Course *)id_index_find(&course_id_index, g->course_id);
+        if (c == NULL) continue;
+        for (k = 0; k < count; k++) {
+            if (slots[k] == c->slot && g->numeric_grade > best[k]) best[k] = g->numeric_grade;
+        }
+    }
+    for (a = 0; a < archive_count(); a++) {
+        const Grade *rows;
+        int n = archive_student_grades(archive_get(a), student_id, &rows);
+        for (i = 0; i < n; i++) {
+            Course *c = (Course *)id_index_find(&course_id_index, rows[i].course_id);
+            if (c == NULL) continue;
+            for (k = 0; k < count; k++) {
+                if (slots[k] == c->slot && rows[i].numeric_grade > best[k]) best[k] = rows[i].numeric_grade;
+            }
+        }
+    }
+}
+
+/**
+ * Checks whether a course ID is taken, asking the Bloom filter before the exact ID index.
+ * Bir kurs ID'sinin kullanımda olup olmadığını, tam ID indeksinden önce Bloom filtresine sorarak kontrol eder.
+ * * @param id - ID to check
+ * @param id - Kontrol edilecek ID
+ * @return 1 if the ID exists, 0 otherwise
+ * @return ID varsa 1, yoksa 0 döner
+ */
+static int course_id_exists(int id) {
+    if (!bloom_may_contain(&course_id_filter, id)) return 0;
+    if (get_course_by_id(id) != NULL) return 1;
+    bloom_note_false_positive(&course_id_filter);
+    return 0;
+}
+
+/**
+ * Adds a new course to the system after validating data and checking for duplicate IDs.
+ * Verileri doğruladıktan ve mükerrer ID kontrolü yaptıktan sonra sisteme yeni bir ders ekler.
+ * * @param head_ptr - Double pointer to the head of the course linked list [cite: 98]
+ * @param head_ptr - Kurs bağlı listesinin başına işaret eden çift kademeli pointer [cite: 98]
+ * @param new_data - Pointer to the structure containing the new course details
+ * @param new_data - Yeni ders detaylarını içeren yapıya işaret eden pointer
+ * @return 1 if addition is successful, 0 if validation fails or ID already exists [cite: 533]
+ * @return Ekleme başarılıysa 1, doğrulama başarısızsa veya ID zaten varsa 0 döner [cite: 533]
+ */
+int add_course(Course **head_ptr, const Course *new_data) {
+    if (new_data == NULL) {
+        printf("Error: Invalid course data!\n");
+        return 0;
+    }
+    
+    if (!validate_positive_int(new_data->id)) {
+        printf("Error: Course ID must be positive!\n");
+        return 0;
+    }
+    
+    if (!validate_positive_int(new_data->credits)) {
+        printf("Error: Credits must be positive!\n");
+        return 0;
+    }
+    
+    if (!validate_positive_int(new_data->capacity)) {
+        printf("Error: Capacity must be positive!\n");
+        return 0;
+    }
+    
+    if (!validate_prerequisite_count(new_data)) return 0;
+    
+    if (course_id_exists(new_data->id)) {
+        printf("Error: Course with ID %d already exists!\n", new_data->id);
+        return 0;
+    }
+    
+    Course *new_node = (Course *)malloc(sizeof(Course));
+    if (new_node == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+    
+    *new_node = *new_data;
+    new_node->first_grade = new_node->last_grade = NULL;
+    new_node->first_enrollment = new_node->last_enrollment = NULL;
+    if (!index_course(new_node)) {
+        free(new_node);
+        return 0;
+    }
+    append_course_node(head_ptr, new_node);
+    grade_relink_course(new_node);
+    enrollment_relink_course(new_node);
+    
+    printf("Success: Course '%s' added successfully!\n", new_data->name);
+    return 1;
+}
+
+/**
+ * Searches for a course in the linked list using its unique integer ID.
+ * Benzersiz tam sayı ID'sini kullanarak bağlı listede bir kursu arar.
+ * * @param head - Pointer to the head of the course list
+ * @param head - Kurs listesinin başına işaret eden pointer
+ * @param id - The unique identifier of the course to find [cite: 40]
+ * @param id - Bulunacak kursun benzersiz tanımlayıcısı [cite: 40]
+ * @return Pointer to the course node if found, NULL otherwise
+ * @return Kurs düğümü bulunursa adresi, aksi takdirde NULL döner
+ */
+Course* find_course_by_id(Course *head, int id) {
+    if (head == NULL) return NULL;
+    return get_course_by_id(id);
+}
+
+/**
+ * Looks up a course by ID through the ID index, without needing the list head.
+ * Liste başına ihtiyaç duymadan ID indeksi üzerinden kurs arar.
+ * * @param id - The unique identifier of the course
+ * @param id - Kursun benzersiz tanımlayıcısı
+ * @return Pointer to the course node or NULL
+ * @return Kurs düğümünün adresi veya NULL
+ */
+Course* get_course_by_id(int id) {
+    return (Course *)id_index_find(&course_id_index, id);
+}
+
+/**
+ * Searches for a course in the linked list using its unique string code (e.g., "CS101").
+ * Benzersiz ders kodunu (örn. "CS101") kullanarak bağlı listede bir kursu arar.
+ * * @param head - Pointer to the head of the course list
+ * @param head - Kurs listesinin başına işaret eden pointer
+ * @param code - The string code of the course to find
+ * @param code - Bulunacak kursun dizgi formatındaki kodu
+ * @return Pointer to the course node if found, NULL otherwise
+ * @return Kurs düğümü bulunursa adresi, aksi takdirde NULL döner
+ */
+Course* find_course_by_code(Course *head, const char *code) {
+    char key[INDEX_KEY_LEN];
+    if (head == NULL || code == NULL) return NULL;
+    normalize_key(code, key, INDEX_KEY_LEN);
+    return (Course *)index_find(&course_code_index, key);
+}
+
+/**
+ * Updates the fields of an existing course node with new validated information.
+ * Mevcut bir kurs düğümünün alanlarını doğrulanmış yeni bilgilerle günceller.
+ * * @param course_to_update - Pointer to the course node stored in the system [cite: 38]
+ * @param course_to_update - Sistemde kayıtlı olan güncellenecek kurs düğümü pointer'ı [cite: 38]
+ * @param new_data - Pointer to the structure containing updated details
+ * @param new_data - Güncellenmiş detayları içeren yapıya işaret eden pointer
+ * @return 1 if update is successful, 0 if validation fails
+ * @return Güncelleme başarılıysa 1, doğrulama başarısızsa 0 döner
+ */
+int update_course(Course *course_to_update, const Course *new_data) {
+    if (course_to_update == NULL || new_data == NULL) {
+        printf("Error: Invalid parameters!\n");
+        return 0;
+    }
+    
+    if (!validate_positive_int(new_data->credits)) {
+        printf("Error: Credits must be positive!\n");
+        return 0;
+    }
+    
+    if (!validate_positive_int(new_data->capacity)) {
+        printf("Error: Capacity must be positive!\n");
+        return 0;
+    }
+    
+    if (!validate_prerequisite_count(new_data)) return 0;
+    
+    // Ders kodu değişirse kod indeksini yeniden anahtarla
+    char key[INDEX_KEY_LEN];
+    normalize_key(course_to_update->code, key, INDEX_KEY_LEN);
+    index_remove(&course_code_index, key, course_to_update);
+    strcpy(course_to_update->code, new_data->code);
+    normalize_key(course_to_update->code, key, INDEX_KEY_LEN);
+    index_insert(&course_code_index, key, course_to_update);
+    strcpy(course_to_update->name, new_data->name);
+    if (new_data->credits != course_to_update->credits) recount_course_grades(course_to_update, new_data->credits);
+    course_to_update->credits = new_data->credits;
+    course_to_update->capacity = new_data->capacity;
+    strcpy(course_to_update->department, new_data->department);
+    strcpy(course_to_update->prerequisites, new_data->prerequisites);
+    __sync_fetch_and_add(&course_catalog_version, 1);
+    snapshot_touch();
+    
+    printf("Success: Course information updated!\n");
+    return 1;
+}
+
+/**
+ * Deletes a course from the linked list and frees the allocated memory.
+ * Bağlı listeden bir kursu siler ve ayrılan belleği serbest bırakır.
+ * * @param head_ptr - Double pointer to the head of the course list [cite: 39]
+ * @param head_ptr - Kurs listesinin başına işaret eden çift kademeli pointer [cite: 39]
+ * @param id - The unique ID of the course to be removed
+ * @param id - Silinecek kursun benzersiz ID'si
+ * @return 1 if deletion is successful, 0 if course is not found
+ * @return Silme başarılıysa 1, kurs bulunamazsa 0 döner
+ */
+int delete_course(Course **head_ptr, int id) {
+    Course *current = *head_ptr;
+    Course *prev = NULL;
+    
+    if (current == NULL) {
+        printf("Error: Course list is empty!\n");
+        return 0;
+    }
+    
+    if (current->id == id) {
+        *head_ptr = current->next;
+        if (current == course_tail) course_tail = NULL;
+        unindex_course(current);
+        free(current);
+        printf("Success: Course with ID %d deleted.\n", id);
+        return 1;
+    }
+    
+    while (current != NULL && current->id != id) {
+        prev = current;
+        current = current->next;
+    }
+    
+    if (current == NULL) {
+        printf("Error: Course with ID %d not found!\n", id);
+        return 0;
+    }
+    
+    prev->next = current->next;
+    if (current == course_tail) course_tail = prev;
+    unindex_course(current);
+    free(current);
+    printf("Success: Course with ID %d deleted.\n", id);
+    return 1;
+}
+
+/**
+ * Reads course records from a CSV file and populates the linked list[cite: 144].
+ * CSV dosyasındaki kurs kayıtlarını okur ve bağlı listeyi doldurur[cite: 144].
+ * * @param head_ptr - Double pointer to receive the head of the loaded list [cite: 93]
+ * @param head_ptr - Yüklenen listenin başını alacak çift kademeli pointer [cite: 93]
+ * @return 1 if loading is successful, 0 if file cannot be opened
+ * @return Yükleme başarılıysa 1, dosya açılamazsa 0 döner
+ */
+int load_courses_from_csv(Course **head_ptr) {
+    const char *filename = "data/courses.csv";
+    FILE *file = fopen(filename, "r");
+    
+    if (file == NULL) {
+    	filename = "courses.csv";
+        file = fopen(filename, "r");
+        if (file == NULL) {
+            printf("Warning: Could not open courses.csv. Starting empty.\n");
+            return 0;
+        }
+    }
+    
+    char line[512];
+    char *tokens[10];
+    int count = 0;
+    fgets(line, sizeof(line), file);
+    
+    while (fgets(line, sizeof(line), file)) {
+        remove_newline(line);
+        int token_count = split_csv_line(line, tokens, 7);
+        if (token_count >= 6) {
+            Course temp;
+            temp.id = atoi(tokens[0]);
+            strcpy(temp.code, tokens[1]);
+            strcpy(temp.name, tokens[2]);
+            temp.credits = atoi(tokens[3]);
+            temp.capacity = atoi(tokens[4]);
+            strcpy(temp.department, tokens[5]);
+            if (token_count >= 7) strcpy(temp.prerequisites, tokens[6]);
+            else strcpy(temp.prerequisites, "");
+            if (!validate_prerequisite_count(&temp)) continue;
+            
+            Course *new_node = (Course *)malloc(sizeof(Course));
+            if (new_node) {
+                *new_node = temp;
+                new_node->first_grade = new_node->last_grade = NULL;
+                new_node->first_enrollment = new_node->last_enrollment = NULL;
+                if (!index_course(new_node)) {
+                    free(new_node);
+                    continue;
+                }
+                append_course_node(head_ptr, new_node);
+                grade_relink_course(new_node);
+                enrollment_relink_course(new_node);
+                count++;
+            }
+        }
+    }
+    fclose(file);
+    printf("Success: Loaded %d courses from CSV.\n", count);
+    return 1;
+}
+
+/**
+ * Writes the entire course list into a formatted CSV file for persistence[cite: 92].
+ * Tüm kurs listesini kalıcılık sağlamak için formatlı bir CSV dosyasına yazar[cite: 92].
+ * * @param head - Pointer to the head of the course list
+ * @param head - Kurs listesinin başına işaret eden pointer
+ * @param filename - String representing the path to the save file
+ * @param filename - Kayıt dosyasının yolunu temsil eden dizgi
+ * @return 1 if save is successful, 0 if file cannot be opened
+ * @return Kayıt başarılıysa 1, dosya açılamazsa 0 döner
+ */
+int save_courses_to_csv(Course *head, const char *filename) {
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) {
+        printf("Error: Could not open file for writing!\n");
+        return 0;
+    }
+    
+    fprintf(file, "course_id,course_code,course_name,credits,capacity,department,prerequisites\n");
+    Course *current = head;
+    int count = 0;
+    while (current != NULL) {
+        fprintf(file, "%d,%s,%s,%d,%d,%s,%s\n",
+                current->id, current->code, current->name, 
+                current->credits, current->capacity, 
+                current->department, current->prerequisites);
+        current = current->next;
+        count++;
+    }
+    fclose(file);
+    printf("Success: Saved %d courses to CSV.\n", count);
+    return 1;
+}
+
+/**
+ * Prints all courses in the system in a readable table format[cite: 80].
+ * Sistemdeki tüm kursları okunabilir bir tablo formatında yazdırır[cite: 80].
+ * * @param head - Pointer to the head of the course list
+ * @param head - Kurs listesinin başına işaret eden pointer
+ */
+void display_all_courses(Course *head) {
+    printf("\n====================================================================================================\n");
+    printf("                                            COURSE LIST\n");
+    printf("====================================================================================================\n");
+    printf("%-6s %-8s %-35s %-4s %-5s %-20s %s\n", "ID", "Code", "Name", "Crd", "Cap", "Department", "Prereqs");
+    printf("----------------------------------------------------------------------------------------------------\n");
+
+    Course *current = head;
+    int count = 0;
+    while (current != NULL) {
+        printf("%-6d %-8s %-35s %-4d %-5d %-20s %s\n", 
+               current->id, current->code, current->name, 
+               current->credits, current->capacity, current->department,
+               (strlen(current->prerequisites) > 1) ? current->prerequisites : "None");
+        current = current->next;
+        count++;
+    }
+    printf("====================================================================================================\n");
+    printf("Total Courses: %d\n", count);
+}
+
+/**
+ * Displays full details of a specific course node[cite: 41].
+ * Belirli bir kurs düğümünün tüm detaylarını görüntüler[cite: 41].
+ * * @param course - Pointer to the course structure to display
+ * @param course - Görüntülenecek kurs yapısına işaret eden pointer
+ */
+void display_course_details(Course *course) {
+    if (course == NULL) {
+        printf("Error: Course not found!\n");
+        return;
+    }
+    printf("\n========================================\n");
+    printf("         COURSE DETAILS                 \n");
+    printf("========================================\n");
+    printf("ID:            %d\n", course->id);
+    printf("Code:          %s\n", course->code);
+    printf("Name:          %s\n", course->name);
+    printf("Credits:       %d\n", course->credits);
+    printf("Capacity:      %d\n", course->capacity);
+    printf("Department:    %s\n", course->department);
+    printf("Prerequisites: %s\n", (strlen(course->prerequisites) > 0) ? course->prerequisites : "None");
+    printf("========================================\n");
+}
+
+/**
+ * Checks if a course has any defined prerequisite requirements[cite: 43].
+ * Bir kursun tanımlanmış herhangi bir ön koşul gereksinimi olup olmadığını kontrol eder[cite: 43].
+ * * @param course - Pointer to the course structure
+ * @param course - Kurs yapısına işaret eden pointer
+ * @return 1 if prerequisites exist, 0 otherwise
+ * @return Ön koşullar varsa 1, aksi takdirde 0 döner
+ */
+int has_prerequisites(Course *course) {
+    if (course == NULL) return 0;
+    return (strlen(course->prerequisites) > 0);
+}
+
+/**
+ * Verifies if a student has passed all prerequisites for a specific course[cite: 54].
+ * Bir öğrencinin belirli bir kurs için tüm ön koşulları geçip geçmediğini doğrular[cite: 54].
+ * * @param student_id - ID of the student attempting to enroll
+ * @param student_id - Kaydolmaya çalışan öğrencinin ID'si
+ * @param course - Pointer to the course with potential prerequisites
+ * @param course - Olası ön koşulları olan kursa işaret eden pointer
+ * @param grade_head_void - Generic pointer to the head of the grade list
+ * @param grade_head_void - Not listesinin başına işaret eden genel pointer
+ * @param enrollment_head_void - Generic pointer to the head of the enrollment list
+ * @param enrollment_head_void - Kayıt listesinin başına işaret eden genel pointer
+ * @return 1 if all prerequisites are met, 0 otherwise
+ * @return Tüm ön koşullar sağlanmışsa 1, aksi takdirde 0 döner
+ */
+int check_prerequisites(int student_id, Course *course, void *grade_head_void, void *enrollment_head_void) {
+    (void)enrollment_head_void;
+    if (course == NULL) return 0;
+    if (!has_prerequisites(course)) return 1;
+    
+    int slots[MAX_PREREQUISITES];
+    float best[MAX_PREREQUISITES];
+    char code[sizeof(course->code)];
+    int count = resolve_prerequisites(course, slots);
+    if (count == 0) return 1;
+    
+    // Yalnızca ön koşul dersleri izlenir; kayıt başına indeks boyutunda dizi ayrılmaz
+    collect_prerequisite_scores(student_id, (Grade *)grade_head_void, slots, count, best);
+    
+    int i;
+    for (i = 0; i < count; i++) {
+        if (!slot_course_code(slots[i], code)) {
+            printf("Error: Prerequisite of %s is not in the course catalog: %s\n", course->code, course->prerequisites);
+            return 0;
+        }
+        if (best[i] < 60.0) {
+            printf("Error: Student has not completed prerequisite: %s\n", code);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Checks a course's prerequisites against a best-grade array built by collect_best_grades, without printing.
+ * Lets batch callers collect a student's grades once and test many courses against them.
+ * Bir kursun ön koşullarını collect_best_grades ile doldurulmuş en iyi not dizisine göre, çıktı vermeden kontrol eder.
+ * Toplu işlemlerin öğrencinin notlarını bir kez toplayıp birçok kursu bunlarla sınamasını sağlar.
+ * * @param course - Course to check
+ * @param course - Kontrol edilecek kurs
+ * @param best - Slot-indexed best grades of one student
+ * @param best - Bir öğrencinin yoğun indeksli en iyi notları
+ * @return 1 if all prerequisites are met, 0 otherwise
+ * @return Tüm ön koşullar sağlanmışsa 1, aksi takdirde 0 döner
+ */
+int prerequisites_met(Course *course, struct Grade **best) {
+    int slots[MAX_PREREQUISITES];
+    int i, count;
+    if (course == NULL) return 0;
+    if (!has_prerequisites(course)) return 1;
+    count = resolve_prerequisites(course, slots);
+    for (i = 0; i < count; i++) {
+        int slot = slots[i];
+        if (!slot_course_code(slot, NULL)) return 0;
+        if (best[slot] == NULL || best[slot]->numeric_grade < 60.0) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Fills a slot-indexed array with the student's best grade in each course (single pass over grades).
+ * Öğrencinin her dersteki en yüksek notunu yoğun indeksli bir diziye yazar (notlar üzerinde tek geçiş).
+ * * @param student_id - ID of the student
+ * @param student_id - Öğrencinin ID'si
+ * @param g_head - Head of the grade list
+ * @param g_head - Not listesinin başı
+ * @param best - Zeroed array of get_course_slot_count() entries
+ * @param best - get_course_slot_count() elemanlı, sıfırlanmış dizi
+ * @return Number of graded courses found
+ * @return Notu bulunan ders sayısı
+ */
+int collect_best_grades(int student_id, struct Grade *g_head, struct Grade **best) {
+    int found = 0;
+    Student *s = get_student_by_id(student_id);
+    Grade *g;
+    for (g = (s != NULL) ? s->first_grade : g_head; g != NULL; g = (s != NULL) ? g->next_by_student : g->next) {
+        if (g->student_id != student_id) continue;
+        Course *c = (Course *)id_index_find(&course_id_index, g->course_id);
+        if (c == NULL) continue;
+        if (best[c->slot] == NULL) found++;
+        if (best[c->slot] == NULL || g->numeric_grade > best[c->slot]->numeric_grade) best[c->slot] = g;
+    }
+    // Archived semesters count too; callers only read through best[]
+    // Arşivlenmiş dönemler de sayılır; çağıranlar best[] üzerinden yalnızca okur
+    int a, i;
+    for (a = 0; a < archive_count(); a++) {
+        const Grade *rows;
+        int count = archive_student_grades(archive_get(a), student_id, &rows);
+        for (i = 0; i < count; i++) {
+            Course *c = (Course *)id_index_find(&course_id_index, rows[i].course_id);
+            if (c == NULL) continue;
+            if (best[c->slot] == NULL) found++;
+            if (best[c->slot] == NULL || rows[i].numeric_grade > best[c->slot]->numeric_grade) best[c->slot] = (Grade *)&rows[i];
+        }
+    }
+    return found;
+}
+
+/**
+ * Frees all dynamically allocated memory within the course linked list[cite: 162].
+ * Kurs bağlı listesi içindeki dinamik olarak ayrılmış tüm belleği serbest bırakır[cite: 162].
+ * * @param head - Pointer to the head of the course list
+ * @param head - Kurs listesinin başına işaret eden pointer
+ */
+void free_all_courses(Course *head) {
+    Course *temp;
+    while (head != NULL) {
+        temp = head;
+        head = head->next;
+        free(temp); 
+    }
+    course_tail = NULL;
+    course_tail_owner = NULL;
+    index_clear(&course_code_index);
+    id_index_clear(&course_id_index);
+    bloom_clear(&course_id_filter);
+    pthread_mutex_lock(&prereq_lock);
+    free(course_slots);
+    course_slots = NULL;
+    course_slot_count = 0;
+    course_slot_capacity = 0;
+    pthread_mutex_unlock(&prereq_lock);
+    __sync_fetch_and_add(&course_catalog_version, 1);
+    printf("Memory for courses cleared.\n");
+}
+
+/**
+ * Counts the total number of courses currently in the linked list.
+ * Şu anda bağlı listede bulunan toplam kurs sayısını sayar.
+ * * @param head - Pointer to the head of the course list
+ * @param head - Kurs listesinin başına işaret eden pointer
+ * @return Total number of course nodes
+ * @return Toplam kurs düğümü sayısı
+ */
+int count_courses(Course *head) {
+    int count = 0;
+    Course *current = head;
+    while (current != NULL) {
+        count++;
+        current = current->next;
+    }
+    return count;
+}
+
+/**
+ * Returns the number of dense course slots handed out so far (size for slot-indexed arrays).
+ * Şimdiye kadar dağıtılan yoğun kurs indeksi sayısını döndürür (indeksli diziler için boyut).
+ * * @return Slot count
+ * @return İndeks sayısı
+ */
+int get_course_slot_count(void) {
+    return course_slot_count;
+}
+
+/**
+ * Returns the course stored at a dense slot.
+ * Yoğun indekste saklanan kursu döndürür.
+ * * @param slot - Dense course index
+ * @param slot - Yoğun kurs indeksi
+ * @return Course pointer or NULL if the slot is empty or out of range
+ * @return Kurs pointer'ı, indeks boş veya aralık dışıysa NULL
+ */
+Course* get_course_by_slot(int slot) {
+    if (slot < 0 || slot >= course_slot_count) return NULL;
+    return course_slots[slot];
+}
+
+/**
+ * Prints the duplicate-ID filter statistics of the course table.
+ * Kurs tablosunun mükerrer ID filtresi istatistiklerini yazdırır.
+ */
+void display_course_filter_stats(void) {
+    bloom_print_stats("Courses", &course_id_filter, course_id_index.size);
+}
@@ -1,32 +1,52 @@
-#ifndef COURSE_H
-#define COURSE_H
-
-#include <stdio.h>
-#include <stdlib.h>
-
-typedef struct Course {
-    int id;
-    char code[20];
-    char name[100];
-    int credits;
-    int capacity;
-    char department[50];
-    char prerequisites[100];
-    struct Course *next;
-} Course;
-
-int load_courses_from_csv(Course **head_ptr);
-int save_courses_to_csv(Course *head, const char *filename);
-int add_course(Course **head_ptr, const Course *new_course);
-int update_course(Course *course_to_update, const Course *new_data);
-int delete_course(Course **head_ptr, int id);
-Course* find_course_by_id(Course *head, int id);
-Course* find_course_by_code(Course *head, const char *code);
-void display_all_courses(Course *head);
-void display_course_details(Course *course);
-int has_prerequisites(Course *course);
-int check_prerequisites(int student_id, Course *course, void *grade_head, void *enrollment_head);
-void free_all_courses(Course *head);
-int count_courses(Course *head);
-
-#endif
+#ifndef COURSE_H
+#define COURSE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_PREREQUISITES 8   // Longest prerequisite list; courses listing more are rejected
+
+struct Grade;
+struct Enrollment;
+
+typedef struct Course {
+    int id;
+    char code[20];
+    char name[100];
+    int credits;
+    int capacity;
+    char department[50];
+    char prerequisites[100];
+    int slot;                                // Dense course index assigned on insert
+    int prereq_slots[MAX_PREREQUISITES];     // Resolved prerequisite slots (-1 = unknown code)
+    int prereq_count;
+    int prereq_version;                      // Catalog version the slots were resolved against
+    int seats_taken;                         // Active ("Enrolled") rows, reserved by compare-and-swap
+    struct Grade *first_grade;               // Per-course grade chain (Grade.next_by_course)
+    struct Enrollment *first_enrollment;     // Per-course enrollment chain (Enrollment.next_by_course)
+    struct Grade *last_grade;                // Tail of the grade chain, for O(1) appends
+    struct Enrollment *last_enrollment;      // Tail of the enrollment chain
+    struct Course *next;
+} Course;
+
+int load_courses_from_csv(Course **head_ptr);
+int save_courses_to_csv(Course *head, const char *filename);
+int add_course(Course **head_ptr, const Course *new_course);
+int update_course(Course *course_to_update, const Course *new_data);
+int delete_course(Course **head_ptr, int id);
+Course* find_course_by_id(Course *head, int id);
+Course* get_course_by_id(int id);
+Course* find_course_by_code(Course *head, const char *code);
+void display_all_courses(Course *head);
+void display_course_details(Course *course);
+int has_prerequisites(Course *course);
+int check_prerequisites(int student_id, Course *course, void *grade_head, void *enrollment_head);
+void display_course_filter_stats(void);
+void free_all_courses(Course *head);
+int count_courses(Course *head);
+int get_course_slot_count(void);
+Course* get_course_by_slot(int slot);
+int collect_best_grades(int student_id, struct Grade *g_head, struct Grade **best);
+int prerequisites_met(Course *course, struct Grade **best);
+
+#endif
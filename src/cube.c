@@ -0,0 +1,437 @@
+// cube.c - Not Küpü Modülü (Bölüm × Dönem × Ders Özetleri)
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "cube.h"
+#include "course.h"
+#include "archive.h"
+#include "utils.h"
+
+#define CUBE_INITIAL_CELLS 256
+
+// One (course, term) cell; the department comes from the course when a roll-up reads the cell,
+// so moving a course to another department needs no update here.
+// Bir (ders, dönem) hücresi; bölüm, bir özet hücreyi okurken dersten alınır; bu yüzden bir dersin
+// başka bölüme taşınması burada güncelleme gerektirmez.
+typedef struct CubeCell {
+    int course_id;
+    int term;
+    int used;
+    CubeStats stats;
+} CubeCell;
+
+// Open-addressing table of cells keyed by (course_id, term)
+// (course_id, term) anahtarlı hücrelerin açık adresli tablosu
+typedef struct CubeTable {
+    CubeCell *cells;
+    int capacity;                // Power of two
+    int used;
+} CubeTable;
+
+// Slice of the grade rows aggregated by one worker into its own table
+// Bir işçinin kendi tablosunda topladığı not satırları dilimi
+typedef struct CubeChunk {
+    const Grade **rows;
+    long begin;
+    long end;
+    CubeTable table;
+    int failed;
+} CubeChunk;
+
+// Cells of every in-memory and archived grade; maintained by grade mutations once built.
+// Bellekteki ve arşivlenmiş tüm notların hücreleri; kurulduktan sonra not değişiklikleriyle güncellenir.
+static CubeTable cube = {NULL, 0, 0};
+static int cube_built = 0;
+
+static const char *dimension_names[] = {"Department", "Semester", "Course", "All"};
+
+static unsigned int cell_slot(int course_id, int term, int capacity) {
+    unsigned int h = (unsigned int)course_id * 2654435761u ^ (unsigned int)term * 40503u;
+    return (h ^ (h >> 15)) & (unsigned int)(capacity - 1);
+}
+
+static void table_free(CubeTable *table) {
+    free(table->cells);
+    table->cells = NULL;
+    table->capacity = table->used = 0;
+}
+
+/**
+ * Finds the cell of (course_id, term), inserting an empty one if needed; grows the table at 70% load.
+ * (course_id, term) hücresini bulur, gerekirse boş bir hücre ekler; tablo %70 dolulukta büyütülür.
+ * * @return The cell, or NULL if memory allocation fails
+ * @return Hücre, bellek hatasında NULL
+ */
+static CubeCell* table_cell(CubeTable *table, int course_id, int term) {
+    unsigned int slot;
+    int i;
+
+    if (table->cells == NULL || (table->used + 1) * 10 > table->capacity * 7) {
+        int capacity = (table->capacity > 0) ? table->capacity * 2 : CUBE_INITIAL_CELLS;
+        CubeCell *cells = (CubeCell *)calloc(capacity, sizeof(CubeCell));
+        if (cells == NULL) return NULL;
+        for (i = 0; i < table->capacity; i++) {
+            if (!table->cells[i].used) continue;
+            slot = cell_slot(table->cells[i].course_id, table->cells[i].term, capacity);
+            while (cells[slot].used) slot = (slot + 1) & (unsigned int)(capacity - 1);
+            cells[slot] = table->cells[i];
+        }
+        free(table->cells);
+        table->cells = cells;
+        table->capacity = capacity;
+    }
+    slot = cell_slot(course_id, term, table->capacity);
+    while (table->cells[slot].used) {
+        if (table->cells[slot].course_id == course_id && table->cells[slot].term == term) return &table->cells[slot];
+        slot = (slot + 1) & (unsigned int)(table->capacity - 1);
+    }
+    table->cells[slot].used = 1;
+    table->cells[slot].course_id = course_id;
+    table->cells[slot].term = term;
+    table->used++;
+    return &table->cells[slot];
+}
+
+static void stats_add(CubeStats *stats, float numeric, int sign) {
+    stats->count += sign;
+    stats->sum += sign * (double)numeric;
+    stats->sum_sq += sign * (double)numeric * numeric;
+    if (numeric >= CUBE_PASS_SCORE) stats->passed += sign;
+    stats->bands[numeric_to_band(numeric)] += sign;
+}
+
+static void stats_merge(CubeStats *total, const CubeStats *part) {
+    int b;
+    total->count += part->count;
+    total->sum += part->sum;
+    total->sum_sq += part->sum_sq;
+    total->passed += part->passed;
+    for (b = 0; b < GRADE_BANDS; b++) total->bands[b] += part->bands[b];
+}
+
+/**
+ * Worker entry point: aggregates the chunk's rows into the chunk's own table.
+ * İşçi giriş noktası: parçanın satırlarını parçanın kendi tablosunda toplar.
+ * * @param arg - CubeChunk to process
+ * @param arg - İşlenecek CubeChunk
+ * @return Always NULL
+ * @return Her zaman NULL
+ */
+static void* cube_worker(void *arg) {
+    CubeChunk *chunk = (CubeChunk *)arg;
+    long i;
+    for (i = chunk->begin; i < chunk->end; i++) {
+        const Grade *g = chunk->rows[i];
+        CubeCell *cell = table_cell(&chunk->table, g->course_id, g->term);
+        if (cell == NULL) {
+            chunk->failed = 1;
+            break;
+        }
+        stats_add(&cell->stats, g->numeric_grade, 1);
+    }
+    return NULL;
+}
+
+/**
+ * Picks the worker count: one per CUBE_MIN_CHUNK grades, capped by the online CPUs.
+ * İşçi sayısını seçer: her CUBE_MIN_CHUNK not için bir, çevrimiçi CPU sayısıyla sınırlı.
+ * * @param rows - Number of grades
+ * @param rows - Not sayısı
+ * @return Number of threads to use (at least 1)
+ * @return Kullanılacak iş parçacığı sayısı (en az 1)
+ */
+static int cube_thread_count(long rows) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    long threads = rows / CUBE_MIN_CHUNK;
+    if (cpus < 1) cpus = 1;
+    if (threads > cpus) threads = cpus;
+    if (threads > CUBE_MAX_THREADS) threads = CUBE_MAX_THREADS;
+    return threads < 1 ? 1 : (int)threads;
+}
+
+/**
+ * Builds the cube in one pass over the in-memory grades and the archived semesters. The rows are
+ * split into chunks aggregated on worker threads into private tables, which are then merged.
+ * From then on every grade mutation updates its cell; the cube is only rebuilt after it is invalidated.
+ * Küpü bellekteki notlar ve arşivlenmiş dönemler üzerinde tek geçişte kurar. Satırlar parçalara
+ * bölünür, işçi iş parçacıklarında özel tablolarda toplanır ve sonra birleştirilir. Bundan sonra
+ * her not değişikliği kendi hücresini günceller; küp yalnızca geçersiz kılındıktan sonra yeniden kurulur.
+ * * @param head - Head of the grade list
+ * @param head - Not listesinin başı
+ */
+void grade_cube_build(Grade *head) {
+    CubeChunk chunks[CUBE_MAX_THREADS];
+    pthread_t threads[CUBE_MAX_THREADS];
+    int started[CUBE_MAX_THREADS];
+    long rows = 0, i = 0;
+    int a, t, failed = 0;
+    Grade *g;
+
+    grade_cube_invalidate();
+    for (g = head; g != NULL; g = g->next) rows++;
+    for (a = 0; a < archive_count(); a++) rows += archive_get(a)->grade_count;
+
+    const Grade **flat = (const Grade **)malloc((rows > 0 ? rows : 1) * sizeof(Grade *));
+    if (flat == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return;
+    }
+    for (g = head; g != NULL; g = g->next) flat[i++] = g;
+    for (a = 0; a < archive_count(); a++) {
+        const SemesterArchive *archive = archive_get(a);
+        int j;
+        for (j = 0; j < archive->grade_count; j++) flat[i++] = &archive->grades[j];
+    }
+
+    int count = cube_thread_count(rows);
+    for (t = 0; t < count; t++) {
+        memset(&chunks[t], 0, sizeof(CubeChunk));
+        chunks[t].rows = flat;
+        chunks[t].begin = rows * t / count;
+        chunks[t].end = rows * (t + 1) / count;
+        started[t] = (count > 1 && pthread_create(&threads[t], NULL, cube_worker, &chunks[t]) == 0);
+        if (!started[t]) cube_worker(&chunks[t]);
+    }
+    for (t = 0; t < count; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+        if (chunks[t].failed) failed = 1;
+        for (a = 0; a < chunks[t].table.capacity && !failed; a++) {
+            CubeCell *part = &chunks[t].table.cells[a];
+            if (!part->used) continue;
+            CubeCell *cell = table_cell(&cube, part->course_id, part->term);
+            if (cell == NULL) failed = 1;
+            else stats_merge(&cell->stats, &part->stats);
+        }
+        table_free(&chunks[t].table);
+    }
+    free(flat);
+
+    if (failed) {
+        table_free(&cube);
+        printf("Error: Memory allocation failed while building the grade cube!\n");
+        return;
+    }
+    cube_built = 1;
+}
+
+/**
+ * Adds (sign = 1) or removes (sign = -1) a grade in its cell. Does nothing until the cube is built.
+ * Bir notu hücresine ekler (sign = 1) veya çıkarır (sign = -1). Küp kurulana kadar bir şey yapmaz.
+ * * @param grade - Grade being linked, unlinked or rescored
+ * @param grade - Bağlanan, çıkarılan veya puanı değişen not
+ * @param sign - 1 to add, -1 to remove
+ * @param sign - Eklemek için 1, çıkarmak için -1
+ */
+void grade_cube_account(const Grade *grade, int sign) {
+    if (!cube_built) return;
+    CubeCell *cell = table_cell(&cube, grade->course_id, grade->term);
+    if (cell == NULL) {
+        grade_cube_invalidate();
+        return;
+    }
+    stats_add(&cell->stats, grade->numeric_grade, sign);
+}
+
+/**
+ * Drops the cube; the next roll-up rebuilds it. Used when the grade list is freed or archives change.
+ * Küpü bırakır; sonraki özet onu yeniden kurar. Not listesi boşaltıldığında veya arşivler değiştiğinde kullanılır.
+ */
+void grade_cube_invalidate(void) {
+    table_free(&cube);
+    cube_built = 0;
+}
+
+int grade_cube_is_built(void) {
+    return cube_built;
+}
+
+/**
+ * Returns the number of non-empty (course, term) cells.
+ * Boş olmayan (ders, dönem) hücrelerinin sayısını döner.
+ */
+int grade_cube_cell_count(void) {
+    int i, count = 0;
+    for (i = 0; i < cube.capacity; i++) {
+        if (cube.cells[i].used && cube.cells[i].stats.count > 0) count++;
+    }
+    return count;
+}
+
+/**
+ * Resets a filter so that it selects the whole cube.
+ * Bir filtreyi tüm küpü seçecek şekilde sıfırlar.
+ * * @param filter - Filter to reset
+ * @param filter - Sıfırlanacak filtre
+ */
+void cube_filter_clear(CubeFilter *filter) {
+    memset(filter, 0, sizeof(CubeFilter));
+    filter->from_term = TERM_NONE;
+    filter->to_term = TERM_NONE;
+}
+
+static int compare_rows_by_key(const void *a, const void *b) {
+    const CubeRow *x = (const CubeRow *)a;
+    const CubeRow *y = (const CubeRow *)b;
+    return (x->key > y->key) - (x->key < y->key);
+}
+
+static int compare_rows_by_label(const void *a, const void *b) {
+    const CubeRow *x = (const CubeRow *)a;
+    const CubeRow *y = (const CubeRow *)b;
+    int diff = strcmp(x->label, y->label);
+    if (diff != 0) return diff;
+    return (x->key > y->key) - (x->key < y->key);
+}
+
+/**
+ * Rolls the cube up along one dimension: the cells the filter selects are grouped by department,
+ * semester or course (or into one row) and their figures added. Only cells are read, never grades;
+ * the cube is built first if needed.
+ * Küpü bir boyut boyunca özetler: filtrenin seçtiği hücreler bölüm, dönem veya derse göre (ya da
+ * tek satırda) gruplanır ve değerleri toplanır. Yalnızca hücreler okunur, notlar okunmaz; gerekirse
+ * küp önce kurulur.
+ * * @param head - Head of the grade list (used only when the cube must be built)
+ * @param head - Not listesinin başı (yalnızca küp kurulacaksa kullanılır)
+ * @param by - Dimension to group by
+ * @param by - Gruplanacak boyut
+ * @param filter - Slice to read (NULL = everything)
+ * @param filter - Okunacak dilim (NULL = her şey)
+ * @param rows - Receives a malloc'd array of rows sorted by label (semesters in calendar order); caller frees
+ * @param rows - Etikete göre sıralı (dönemler takvim sırasıyla) malloc'lanmış satır dizisini alır; çağıran serbest bırakır
+ * @return Number of rows, or -1 on failure
+ * @return Satır sayısı, hata durumunda -1
+ */
+int grade_cube_rollup(Grade *head, CubeDimension by, const CubeFilter *filter, CubeRow **rows) {
+    int i, count = 0, merged = 0;
+
+    *rows = NULL;
+    if (!cube_built) grade_cube_build(head);
+    if (!cube_built) return -1;
+
+    CubeRow *out = (CubeRow *)malloc((cube.used > 0 ? cube.used : 1) * sizeof(CubeRow));
+    if (out == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return -1;
+    }
+    for (i = 0; i < cube.capacity; i++) {
+        CubeCell *cell = &cube.cells[i];
+        if (!cell->used || cell->stats.count <= 0) continue;
+        Course *c = get_course_by_id(cell->course_id);
+        const char *department = (c != NULL) ? c->department : "(unknown)";
+        if (filter != NULL) {
+            if (filter->course_id != 0 && cell->course_id != filter->course_id) continue;
+            if (filter->from_term != TERM_NONE && cell->term < filter->from_term) continue;
+            if (filter->to_term != TERM_NONE && cell->term > filter->to_term) continue;
+            if (filter->department[0] != '\0' && strcasecmp(filter->department, department) != 0) continue;
+        }
+        CubeRow *row = &out[count++];
+        row->key = 0;
+        row->stats = cell->stats;
+        if (by == CUBE_BY_DEPARTMENT) {
+            snprintf(row->label, sizeof(row->label), "%s", department);
+        } else if (by == CUBE_BY_TERM) {
+            row->key = cell->term;
+            if (cell->term == TERM_NONE) snprintf(row->label, sizeof(row->label), "(none)");
+            else term_to_semester(cell->term, row->label, sizeof(row->label));
+        } else if (by == CUBE_BY_COURSE) {
+            row->key = cell->course_id;
+            if (c != NULL) snprintf(row->label, sizeof(row->label), "%s", c->code);
+            else snprintf(row->label, sizeof(row->label), "#%d", cell->course_id);
+        } else {
+            snprintf(row->label, sizeof(row->label), "All");
+        }
+    }
+
+    // Aynı gruptaki satırlar sıralama sonrası yan yana gelir ve birleştirilir
+    qsort(out, count, sizeof(CubeRow), (by == CUBE_BY_TERM) ? compare_rows_by_key : compare_rows_by_label);
+    for (i = 0; i < count; i++) {
+        if (merged > 0 && out[merged - 1].key == out[i].key && strcmp(out[merged - 1].label, out[i].label) == 0) {
+            stats_merge(&out[merged - 1].stats, &out[i].stats);
+        } else {
+            out[merged++] = out[i];
+        }
+    }
+    *rows = out;
+    return merged;
+}
+
+float cube_stats_mean(const CubeStats *stats) {
+    return (stats->count > 0) ? (float)(stats->sum / stats->count) : 0.0f;
+}
+
+float cube_stats_stddev(const CubeStats *stats) {
+    if (stats->count <= 0) return 0.0f;
+    double mean = stats->sum / stats->count;
+    double variance = stats->sum_sq / stats->count - mean * mean;
+    return (variance > 0) ? (float)sqrt(variance) : 0.0f;
+}
+
+float cube_stats_pass_rate(const CubeStats *stats) {
+    return (stats->count > 0) ? 100.0f * stats->passed / stats->count : 0.0f;
+}
+
+/**
+ * Prints one roll-up with the average, standard deviation, pass rate and letter histogram per row.
+ * Bir özeti her satır için ortalama, standart sapma, geçme oranı ve harf dağılımıyla yazdırır.
+ * * @param head - Head of the grade list
+ * @param head - Not listesinin başı
+ * @param by - Dimension to group by
+ * @param by - Gruplanacak boyut
+ * @param filter - Slice to read (NULL = everything)
+ * @param filter - Okunacak dilim (NULL = her şey)
+ */
+void display_cube_rollup(Grade *head, CubeDimension by, const CubeFilter *filter) {
+    CubeRow *rows;
+    CubeStats total;
+    char from[20], to[20];
+    int i, b;
+
+    int count = grade_cube_rollup(head, by, filter, &rows);
+    if (count < 0) return;
+
+    printf("\n==============================================================================================\n");
+    printf("   Grade Cube by %s\n", dimension_names[by]);
+    if (filter != NULL && (filter->department[0] != '\0' || filter->course_id != 0 ||
+                           filter->from_term != TERM_NONE || filter->to_term != TERM_NONE)) {
+        if (filter->from_term != TERM_NONE) term_to_semester(filter->from_term, from, sizeof(from));
+        else strcpy(from, "first");
+        if (filter->to_term != TERM_NONE) term_to_semester(filter->to_term, to, sizeof(to));
+        else strcpy(to, "last");
+        printf("   Department: %s | Semesters: %s .. %s | Course: ",
+               filter->department[0] != '\0' ? filter->department : "all", from, to);
+        if (filter->course_id != 0) printf("%d\n", filter->course_id);
+        else printf("all\n");
+    }
+    printf("==============================================================================================\n");
+    printf("%-22s %6s %6s %6s %6s ", "Group", "Grades", "Avg", "StdDev", "Pass%");
+    for (b = GRADE_BANDS - 1; b >= 0; b--) printf(" %4s", band_letter(b));
+    printf("\n----------------------------------------------------------------------------------------------\n");
+
+    memset(&total, 0, sizeof(total));
+    for (i = 0; i < count; i++) {
+        CubeStats *s = &rows[i].stats;
+        printf("%-22.22s %6ld %6.2f %6.2f %6.1f ", rows[i].label, s->count, cube_stats_mean(s),
+               cube_stats_stddev(s), cube_stats_pass_rate(s));
+        for (b = GRADE_BANDS - 1; b >= 0; b--) printf(" %4ld", s->bands[b]);
+        printf("\n");
+        stats_merge(&total, s);
+    }
+    if (count == 0) {
+        printf("No grades in this slice.\n");
+    } else if (count > 1) {
+        printf("----------------------------------------------------------------------------------------------\n");
+        printf("%-22s %6ld %6.2f %6.2f %6.1f ", "Total", total.count, cube_stats_mean(&total),
+               cube_stats_stddev(&total), cube_stats_pass_rate(&total));
+        for (b = GRADE_BANDS - 1; b >= 0; b--) printf(" %4ld", total.bands[b]);
+        printf("\n");
+    }
+    printf("==============================================================================================\n");
+    free(rows);
+}
@@ -0,0 +1,62 @@
+// cube.h - Not Küpü Modülü (Bölüm × Dönem × Ders Özetleri)
+
+#ifndef CUBE_H
+#define CUBE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "grade.h"
+
+#define CUBE_PASS_SCORE 50.0f
+#define CUBE_MAX_THREADS 8
+#define CUBE_MIN_CHUNK 4096      // Grades per worker before another thread is worth starting
+
+// Pre-aggregated figures of a set of grades
+// Bir not kümesinin önceden toplanmış değerleri
+typedef struct CubeStats {
+    long count;
+    double sum;
+    double sum_sq;
+    long passed;                 // numeric_grade >= CUBE_PASS_SCORE
+    long bands[GRADE_BANDS];     // Letter histogram, FF ... AA
+} CubeStats;
+
+// Dimension a roll-up groups by
+// Bir özetin gruplandığı boyut
+typedef enum CubeDimension {
+    CUBE_BY_DEPARTMENT = 0,
+    CUBE_BY_TERM,
+    CUBE_BY_COURSE,
+    CUBE_BY_ALL                  // One row for everything the filter selects
+} CubeDimension;
+
+// Slice of the cube a roll-up reads; empty or zero fields select everything
+// Bir özetin okuduğu küp dilimi; boş veya sıfır alanlar her şeyi seçer
+typedef struct CubeFilter {
+    char department[50];
+    int from_term;               // TERM_NONE = no lower bound
+    int to_term;                 // TERM_NONE = no upper bound
+    int course_id;               // 0 = every course
+} CubeFilter;
+
+// One row of a roll-up
+// Bir özetin bir satırı
+typedef struct CubeRow {
+    char label[100];
+    int key;                     // Term (CUBE_BY_TERM) or course ID (CUBE_BY_COURSE)
+    CubeStats stats;
+} CubeRow;
+
+void grade_cube_build(Grade *head);
+void grade_cube_account(const Grade *grade, int sign);
+void grade_cube_invalidate(void);
+int grade_cube_is_built(void);
+int grade_cube_cell_count(void);
+void cube_filter_clear(CubeFilter *filter);
+int grade_cube_rollup(Grade *head, CubeDimension by, const CubeFilter *filter, CubeRow **rows);
+float cube_stats_mean(const CubeStats *stats);
+float cube_stats_stddev(const CubeStats *stats);
+float cube_stats_pass_rate(const CubeStats *stats);
+void display_cube_rollup(Grade *head, CubeDimension by, const CubeFilter *filter);
+
+#endif
@@ -1,122 +1,202 @@
-#include <stdio.h>
-#include <string.h>
-#include "curriculum.h"
-#include "utils.h"
-
-/**
- * Checks if a student has successfully passed a specific course (Grade >= 50 and not FF).
- * Bir rencinin belirli bir dersi baaryla geip gemediini kontrol eder (Not >= 50 ve FF deil).
- * * @param student_id - The ID of the student to check
- * @param student_id - Kontrol edilecek rencinin ID'si
- * @param course_id - The ID of the course to verify
- * @param course_id - Dorulanacak kursun ID'si
- * @param g_head - Pointer to the head of the grade list
- * @param g_head - Not listesinin bana iaret eden pointer
- * @return 1 if the student passed, 0 if failed or not taken
- * @return renci getiyse 1, kaldysa veya dersi almadysa 0 dner
- */
-int has_passed_course(int student_id, int course_id, Grade *g_head) {
-    Grade *current = g_head;
-    while (current != NULL) {
-        if (current->student_id == student_id && current->course_id == course_id) {
-            // Passing grade is assumed as 50 and must not be FF
-            // Geme notu 50 kabul edelim ve FF olmamal
-            if (current->numeric_grade >= 50.0 && strcmp(current->letter_grade, "FF") != 0) {
-                return 1; // Passed / Geti
-            }
-        }
-        current = current->next;
-    }
-    return 0; // Not passed or not taken / Gemedi veya hi almad
-}
-
-/**
- * Analyzes and displays a student's progress towards graduation, including credits and required courses.
- * Bir rencinin mezuniyet ilerlemesini, kredilerini ve zorunlu derslerini analiz eder ve grntler.
- * * @param student_id - The ID of the student to analyze
- * @param student_id - Analizi yaplacak rencinin ID'si
- * @param s_head - Pointer to the head of the student list
- * @param s_head - renci listesinin bana iaret eden pointer
- * @param g_head - Pointer to the head of the grade list
- * @param g_head - Not listesinin bana iaret eden pointer
- * @param c_head - Pointer to the head of the course list
- * @param c_head - Kurs listesinin bana iaret eden pointer
- */
-void check_graduation_status(int student_id, Student *s_head, Grade *g_head, Course *c_head) {
-    Student *s = find_student_by_id(s_head, student_id);
-    if (s == NULL) {
-        printf("Student not found.\n");
-        return;
-    }
-
-    printf("\n============================================================\n");
-    printf("              DEGREE PROGRESS REPORT (BONUS)\n");
-    printf("============================================================\n");
-    printf("Student: %s %s (ID: %d)\n", s->first_name, s->last_name, s->id);
-    printf("Major:   %s\n", s->major);
-    printf("------------------------------------------------------------\n");
-
-    // --- 1. REQUIRED COURSE CHECK / ZORUNLU DERS KONTROL ---
-    // Example Scenario: Required courses for CS department
-    // rnek Senaryo: CS Blm iin u dersler zorunlu olsun:
-    const char *required_codes[] = {"CS101", "CS102", "MATH101", "CS201", "CS202"};
-    int num_required = 5;
-    int missing_count = 0;
-    int i;
-    printf("\n[CHECK 1] Required Courses:\n");
-    printf("%-10s %-30s %-10s\n", "Code", "Status", "Grade");
-    printf("---------------------------------------------------\n");
-
-    for (i = 0; i < num_required; i++) {
-        Course *c = find_course_by_code(c_head, required_codes[i]);
-        if (c == NULL) {
-            printf("%-10s %-30s\n", required_codes[i], "System Error: Course def missing");
-            continue;
-        }
-
-        Grade *g = find_student_course_grade(g_head, s->id, c->id);
-        
-        if (g != NULL && g->numeric_grade >= 50) {
-            printf("%-10s %-30s %.2f (%s)\n", required_codes[i], "[OK] Completed", g->numeric_grade, g->letter_grade);
-        } else {
-            printf("%-10s %-30s %s\n", required_codes[i], "[MISSING] Not Passed", "-");
-            missing_count++;
-        }
-    }
-
-    // --- 2. CREDIT CHECK / KRED KONTROL ---
-    // Assuming 120 credits required for graduation
-    // Mezuniyet iin toplam 120 kredi gerektiini varsayalm
-    int required_credits = 120; 
-    int total_credits = 0;
-    
-    Grade *curr_g = g_head;
-    while(curr_g != NULL) {
-        if(curr_g->student_id == s->id && curr_g->numeric_grade >= 50) {
-            Course *crs = find_course_by_id(c_head, curr_g->course_id);
-            if(crs) total_credits += crs->credits;
-        }
-        curr_g = curr_g->next;
-    }
-
-    printf("\n[CHECK 2] Credit Requirements:\n");
-    printf("Total Credits Earned: %d / %d Required\n", total_credits, required_credits);
-    
-    if (total_credits >= required_credits) {
-        printf("Status: [OK] Credit requirement met.\n");
-    } else {
-        printf("Status: [FAIL] Need %d more credits.\n", required_credits - total_credits);
-        missing_count++; 
-    }
-
-    // --- FINAL OUTCOME / SONU ---
-    printf("\n============================================================\n");
-    if (missing_count == 0 && total_credits >= required_credits) {
-        printf("GRADUATION STATUS: >>> ELIGIBLE FOR GRADUATION <<<\n");
-        printf("Congratulations! All requirements are met.\n");
-    } else {
-        printf("GRADUATION STATUS: >>> NOT ELIGIBLE <<<\n");
-        printf("There are missing requirements. Student cannot graduate yet.\n");
-    }
-    printf("============================================================\n");
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "curriculum.h"
+#include "utils.h"
+#include "archive.h"
+
+// Example Scenario: Required courses for CS department
+// Örnek Senaryo: CS Bölümü için şu dersler zorunlu olsun:
+static const char *required_codes[REQUIRED_COURSE_COUNT] = {"CS101", "CS102", "MATH101", "CS201", "CS202"};
+
+/**
+ * Checks if a student has successfully passed a specific course (Grade >= 50 and not FF).
+ * Bir öğrencinin belirli bir dersi başarıyla geçip geçmediğini kontrol eder (Not >= 50 ve FF değil).
+ * * @param student_id - The ID of the student to check
+ * @param student_id - Kontrol edilecek öğrencinin ID'si
+ * @param course_id - The ID of the course to verify
+ * @param course_id - Doğrulanacak kursun ID'si
+ * @param g_head - Pointer to the head of the grade list
+ * @param g_head - Not listesinin başına işaret eden pointer
+ * @return 1 if the student passed, 0 if failed or not taken
+ * @return Öğrenci geçtiyse 1, kaldıysa veya dersi almadıysa 0 döner
+ */
+int has_passed_course(int student_id, int course_id, Grade *g_head) {
+    Grade *current = g_head;
+    while (current != NULL) {
+        if (current->student_id == student_id && current->course_id == course_id) {
+            // Passing grade is assumed as 50 and must not be FF
+            // Geçme notu 50 kabul edelim ve FF olmamalı
+            if (current->numeric_grade >= 50.0 && strcmp(current->letter_grade, "FF") != 0) {
+                return 1; // Passed / Geçti
+            }
+        }
+        current = current->next;
+    }
+    return 0; // Not passed or not taken / Geçmedi veya hiç almadı
+}
+
+/**
+ * Analyzes and displays a student's progress towards graduation, including credits and required courses.
+ * Bir öğrencinin mezuniyet ilerlemesini, kredilerini ve zorunlu derslerini analiz eder ve görüntüler.
+ * * @param student_id - The ID of the student to analyze
+ * @param student_id - Analizi yapılacak öğrencinin ID'si
+ * @param s_head - Pointer to the head of the student list
+ * @param s_head - Öğrenci listesinin başına işaret eden pointer
+ * @param g_head - Pointer to the head of the grade list
+ * @param g_head - Not listesinin başına işaret eden pointer
+ * @param c_head - Pointer to the head of the course list
+ * @param c_head - Kurs listesinin başına işaret eden pointer
+ */
+void check_graduation_status(int student_id, Student *s_head, Grade *g_head, Course *c_head) {
+    Student *s = find_student_by_id(s_head, student_id);
+    if (s == NULL) {
+        printf("Student not found.\n");
+        return;
+    }
+
+    printf("\n============================================================\n");
+    printf("              DEGREE PROGRESS REPORT (BONUS)\n");
+    printf("============================================================\n");
+    printf("Student: %s %s (ID: %d)\n", s->first_name, s->last_name, s->id);
+    printf("Major:   %s\n", s->major);
+    printf("------------------------------------------------------------\n");
+
+    // --- 1. REQUIRED COURSE CHECK / ZORUNLU DERS KONTROLÜ ---
+    int num_required = REQUIRED_COURSE_COUNT;
+    int missing_count = 0;
+    int i;
+
+    // Best grade per dense course index, built in a single pass over the grades
+    // Yoğun kurs indeksine göre en iyi notlar, notlar üzerinde tek geçişte oluşturulur
+    int slot_count = get_course_slot_count();
+    Grade **best = (Grade **)calloc(slot_count > 0 ? slot_count : 1, sizeof(Grade *));
+    if (best == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return;
+    }
+    collect_best_grades(s->id, g_head, best);
+    printf("\n[CHECK 1] Required Courses:\n");
+    printf("%-10s %-30s %-10s\n", "Code", "Status", "Grade");
+    printf("---------------------------------------------------\n");
+
+    for (i = 0; i < num_required; i++) {
+        Course *c = find_course_by_code(c_head, required_codes[i]);
+        if (c == NULL) {
+            printf("%-10s %-30s\n", required_codes[i], "System Error: Course def missing");
+            continue;
+        }
+
+        Grade *g = best[c->slot];
+        
+        if (g != NULL && g->numeric_grade >= PASSING_SCORE) {
+            printf("%-10s %-30s %.2f (%s)\n", required_codes[i], "[OK] Completed", g->numeric_grade, g->letter_grade);
+        } else {
+            printf("%-10s %-30s %s\n", required_codes[i], "[MISSING] Not Passed", "-");
+            missing_count++;
+        }
+    }
+
+    // --- 2. CREDIT CHECK / KREDİ KONTROLÜ ---
+    // Assuming 120 credits required for graduation
+    // Mezuniyet için toplam 120 kredi gerektiğini varsayalım
+    int required_credits = GRADUATION_CREDITS;
+    int total_credits = 0;
+    
+    for (i = 0; i < slot_count; i++) {
+        Course *crs = get_course_by_slot(i);
+        if (crs != NULL && best[i] != NULL && best[i]->numeric_grade >= PASSING_SCORE) {
+            total_credits += crs->credits;
+        }
+    }
+    free(best);
+
+    printf("\n[CHECK 2] Credit Requirements:\n");
+    printf("Total Credits Earned: %d / %d Required\n", total_credits, required_credits);
+    
+    if (total_credits >= required_credits) {
+        printf("Status: [OK] Credit requirement met.\n");
+    } else {
+        printf("Status: [FAIL] Need %d more credits.\n", required_credits - total_credits);
+        missing_count++; 
+    }
+
+    // --- FINAL OUTCOME / SONUÇ ---
+    printf("\n============================================================\n");
+    if (missing_count == 0 && total_credits >= required_credits) {
+        printf("GRADUATION STATUS: >>> ELIGIBLE FOR GRADUATION <<<\n");
+        printf("Congratulations! All requirements are met.\n");
+    } else {
+        printf("GRADUATION STATUS: >>> NOT ELIGIBLE <<<\n");
+        printf("There are missing requirements. Student cannot graduate yet.\n");
+    }
+    printf("============================================================\n");
+}
+
+/**
+ * Best score of a student in one course over the snapshot's grades and the mapped archives.
+ * Bir öğrencinin bir dersteki en iyi notu; görüntünün notları ve eşlenmiş arşivler üzerinden.
+ * * @return Best numeric grade, or -1 if the course was never graded
+ * @return En iyi sayısal not; ders hiç notlanmadıysa -1
+ */
+static float snapshot_best_score(const Snapshot *snap, int student_id, int course_id) {
+    const Grade *g;
+    float best = -1.0f;
+    int a, i, count = snapshot_student_grades(snap, student_id, &g);
+
+    for (i = 0; i < count; i++) {
+        if (g[i].course_id == course_id && g[i].numeric_grade > best) best = g[i].numeric_grade;
+    }
+    // Archives are immutable once mapped, so they are read without a snapshot copy
+    // Arşivler eşlendikten sonra değişmez; görüntü kopyası olmadan okunur
+    for (a = 0; a < archive_count(); a++) {
+        count = archive_student_grades(archive_get(a), student_id, &g);
+        for (i = 0; i < count; i++) {
+            if (g[i].course_id == course_id && g[i].numeric_grade > best) best = g[i].numeric_grade;
+        }
+    }
+    return best;
+}
+
+/**
+ * Audits a student's graduation requirements from a snapshot, with the same rules as
+ * check_graduation_status, so a report thread never walks the live lists.
+ * Bir öğrencinin mezuniyet koşullarını check_graduation_status ile aynı kurallarla bir
+ * görüntüden denetler; rapor iş parçacığı canlı listeleri hiç yürümez.
+ * * @param snap - Snapshot to read (SNAPSHOT_STUDENT scope of the same student)
+ * @param snap - Okunacak görüntü (aynı öğrencinin SNAPSHOT_STUDENT kapsamı)
+ * @param student_id - The ID of the student to audit
+ * @param student_id - Denetlenecek öğrencinin ID'si
+ * @param out - Receives the audit
+ * @param out - Denetim sonucunu alır
+ * @return 1 if the student is in the snapshot, 0 otherwise
+ * @return Öğrenci görüntüde varsa 1, yoksa 0 döner
+ */
+int audit_graduation_snapshot(const Snapshot *snap, int student_id, GraduationAudit *out) {
+    int i, j;
+
+    memset(out, 0, sizeof(GraduationAudit));
+    if (snapshot_find_student(snap, student_id) == NULL) return 0;
+
+    for (i = 0; i < REQUIRED_COURSE_COUNT; i++) {
+        // The snapshot holds every course the student was graded in; others were never passed
+        // Görüntü öğrencinin notlandığı her dersi tutar; diğerleri hiç geçilmemiştir
+        float score = -1.0f;
+        for (j = 0; j < snap->course_count; j++) {
+            if (strcmp(snap->courses[j].code, required_codes[i]) == 0) {
+                score = snapshot_best_score(snap, student_id, snap->courses[j].id);
+                break;
+            }
+        }
+        out->required_codes[i] = required_codes[i];
+        out->required_scores[i] = (score >= PASSING_SCORE) ? score : -1.0f;
+        if (score < PASSING_SCORE) out->missing_count++;
+    }
+    for (j = 0; j < snap->course_count; j++) {
+        if (snapshot_best_score(snap, student_id, snap->courses[j].id) >= PASSING_SCORE) {
+            out->credits_earned += snap->courses[j].credits;
+        }
+    }
+    if (out->credits_earned < GRADUATION_CREDITS) out->missing_count++;
+    return 1;
+}
@@ -1,11 +1,26 @@
-#ifndef CURRICULUM_H
-#define CURRICULUM_H
-
-#include "student.h"
-#include "course.h"
-#include "grade.h"
-
-// Mfredat ve Mezuniyet Kontrol Fonksiyonu
-void check_graduation_status(int student_id, Student *s_head, Grade *g_head, Course *c_head);
-
-#endif
+#ifndef CURRICULUM_H
+#define CURRICULUM_H
+
+#include "student.h"
+#include "course.h"
+#include "grade.h"
+#include "snapshot.h"
+
+#define GRADUATION_CREDITS 120       // Credits required for graduation
+#define REQUIRED_COURSE_COUNT 5      // Courses every student must pass
+#define PASSING_SCORE 50.0f          // Lowest numeric grade that counts as passed
+
+// Graduation audit of one student, computed from a snapshot for report threads
+// Rapor iş parçacıkları için bir görüntüden hesaplanan, bir öğrencinin mezuniyet denetimi
+typedef struct GraduationAudit {
+    const char *required_codes[REQUIRED_COURSE_COUNT];
+    float required_scores[REQUIRED_COURSE_COUNT];   // Best passing score, or -1 if not passed
+    int credits_earned;
+    int missing_count;                              // Unmet requirements, the credit check included
+} GraduationAudit;
+
+// Müfredat ve Mezuniyet Kontrolü Fonksiyonu
+void check_graduation_status(int student_id, Student *s_head, Grade *g_head, Course *c_head);
+int audit_graduation_snapshot(const Snapshot *snap, int student_id, GraduationAudit *out);
+
+#endif
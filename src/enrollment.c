@@ -1,504 +1,1599 @@
-// enrollment.c - Kayt Modl (TAMAMLANMI)
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include "enrollment.h"
-#include "utils.h"
-#include "course.h"
-#include "student.h"
-
-/**
- * Adds a new enrollment record to the system after validating the data.
- * Verileri doruladktan sonra sisteme yeni bir kayt (enrollment) ekler.
- * * @param head_ptr - Double pointer to the head of the enrollment list
- * @param head_ptr - Kayt listesinin bana iaret eden ift kademeli pointer
- * @param new_data - Pointer to the structure containing new enrollment information
- * @param new_data - Yeni kayt bilgilerini ieren yapya iaret eden pointer
- * @return 1 if successful, 0 if validation fails or ID already exists
- * @return Baarlysa 1, dorulama baarszsa veya ID zaten varsa 0 dner
- */
-int add_enrollment(Enrollment **head_ptr, const Enrollment *new_data) {
-    if (new_data == NULL) {
-        printf("Error: Invalid enrollment data!\n");
-        return 0;
-    }
-    
-    // Validasyon
-    if (!validate_positive_int(new_data->id)) {
-        printf("Error: Enrollment ID must be positive!\n");
-        return 0;
-    }
-    
-    // Ayn ID var m
-    if (find_enrollment_by_id(*head_ptr, new_data->id) != NULL) {
-        printf("Error: Enrollment with ID %d already exists!\n", new_data->id);
-        return 0;
-    }
-    
-    // Yeni node
-    Enrollment *new_node = (Enrollment *)malloc(sizeof(Enrollment));
-    if (new_node == NULL) {
-        printf("Error: Memory allocation failed!\n");
-        return 0;
-    }
-    
-    // Verileri kopyala
-    new_node->id = new_data->id;
-    new_node->student_id = new_data->student_id;
-    new_node->course_id = new_data->course_id;
-    new_node->professor_id = new_data->professor_id;
-    strcpy(new_node->semester, new_data->semester);
-    strcpy(new_node->date, new_data->date);
-    strcpy(new_node->status, new_data->status);
-    new_node->next = NULL;
-    
-    // Listeye ekle
-    if (*head_ptr == NULL) {
-        *head_ptr = new_node;
-    } else {
-        Enrollment *current = *head_ptr;
-        while (current->next != NULL) {
-            current = current->next;
-        }
-        current->next = new_node;
-    }
-    
-    printf("Success: Enrollment added successfully!\n");
-    return 1;
-}
-
-/**
- * Searches for an enrollment record in the list by its unique ID.
- * Benzersiz ID numarasna gre bir kayt kaydn listede arar.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- * @param id - The unique identifier of the enrollment to find
- * @param id - Bulunacak kaydn benzersiz tanmlaycs
- * @return Pointer to the enrollment node if found, NULL otherwise
- * @return Kayt dm bulunursa adresi, aksi takdirde NULL dner
- */
-Enrollment* find_enrollment_by_id(Enrollment *head, int id) {
-    Enrollment *current = head;
-    
-    while (current != NULL) {
-        if (current->id == id) {
-            return current;
-        }
-        current = current->next;
-    }
-    
-    return NULL;
-}
-
-/**
- * Checks if a specific student is currently enrolled in a specific course.
- * Belirli bir rencinin belirli bir kursa kaytl olup olmadn kontrol eder.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- * @param student_id - ID of the student to check
- * @param student_id - Kontrol edilecek rencinin ID'si
- * @param course_id - ID of the course to check
- * @param course_id - Kontrol edilecek kursun ID'si
- * @return 1 if the student is enrolled or completed, 0 otherwise
- * @return renci kaytlysa veya tamamlamsa 1, aksi takdirde 0 dner
- */
-int is_student_enrolled(Enrollment *head, int student_id, int course_id) {
-    Enrollment *current = head;
-    
-    while (current != NULL) {
-        if (current->student_id == student_id && 
-            current->course_id == course_id &&
-            (strcmp(current->status, "Enrolled") == 0 || 
-             strcmp(current->status, "Completed") == 0)) {
-            return 1;  // Zaten kaytl
-        }
-        current = current->next;
-    }
-    
-    return 0;  // Kaytl deil
-}
-
-/**
- * Counts the number of active enrollments for a specific course.
- * Belirli bir kurs iin aktif kaytlarn saysn hesaplar.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- * @param course_id - ID of the course to count enrollments for
- * @param course_id - Kaytlar saylacak kursun ID'si
- * @return Total number of students with "Enrolled" status
- * @return "Enrolled" durumundaki toplam renci says
- */
-int get_enrollment_count(Enrollment *head, int course_id) {
-    int count = 0;
-    Enrollment *current = head;
-    
-    while (current != NULL) {
-        if (current->course_id == course_id && 
-            strcmp(current->status, "Enrolled") == 0) {
-            count++;
-        }
-        current = current->next;
-    }
-    
-    return count;
-}
-
-/**
- * Permanently deletes an enrollment record from the linked list by its ID.
- * Bir kayt kaydn ID'sine gre bal listeden kalc olarak siler.
- * * @param head_ptr - Double pointer to the head of the enrollment list
- * @param head_ptr - Kayt listesinin bana iaret eden ift kademeli pointer
- * @param id - The unique ID of the enrollment to delete
- * @param id - Silinecek kaydn benzersiz ID'si
- * @return 1 if deletion is successful, 0 if record is not found
- * @return Silme baarlysa 1, kayt bulunamazsa 0 dner
- */
-int delete_enrollment(Enrollment **head_ptr, int id) {
-    Enrollment *current = *head_ptr;
-    Enrollment *prev = NULL;
-    
-    if (current == NULL) {
-        printf("Error: Enrollment list is empty!\n");
-        return 0;
-    }
-    
-    // lk node
-    if (current->id == id) {
-        *head_ptr = current->next;
-        printf("Success: Enrollment with ID %d deleted.\n", id);
-        free(current);
-        return 1;
-    }
-    
-    // Ortada/sonda
-    while (current != NULL && current->id != id) {
-        prev = current;
-        current = current->next;
-    }
-    
-    if (current == NULL) {
-        printf("Error: Enrollment with ID %d not found!\n", id);
-        return 0;
-    }
-    
-    prev->next = current->next;
-    printf("Success: Enrollment with ID %d deleted.\n", id);
-    free(current);
-    return 1;
-}
-
-/**
- * Changes a student's enrollment status to "Dropped" for a specific course.
- * Belirli bir kurs iin rencinin kayt durumunu "Dropped" olarak deitirir.
- * * @param head_ptr - Double pointer to the head of the enrollment list
- * @param head_ptr - Kayt listesinin bana iaret eden ift kademeli pointer
- * @param student_id - ID of the student dropping the course
- * @param student_id - Kursu brakan rencinin ID'si
- * @param course_id - ID of the course being dropped
- * @param course_id - Braklan kursun ID'si
- * @return 1 if successfully dropped, 0 if no active enrollment is found
- * @return Baaryla brakldysa 1, aktif kayt bulunamazsa 0 dner
- */
-int drop_enrollment(Enrollment **head_ptr, int student_id, int course_id) {
-    Enrollment *current = *head_ptr;
-    
-    while (current != NULL) {
-        if (current->student_id == student_id && 
-            current->course_id == course_id &&
-            strcmp(current->status, "Enrolled") == 0) {
-            
-            // Status'u "Dropped" yap
-            strcpy(current->status, "Dropped");
-            printf("Success: Student dropped from course.\n");
-            return 1;
-        }
-        current = current->next;
-    }
-    
-    printf("Error: Active enrollment not found!\n");
-    return 0;
-}
-
-/**
- * Loads enrollment records from a CSV file into the linked list.
- * CSV dosyasndaki kayt verilerini okur ve bal listeye ykler.
- * * @param head_ptr - Double pointer to receive the head of the loaded list
- * @param head_ptr - Yklenen listenin ban alacak ift kademeli pointer
- * @return 1 if loading is successful, 0 if file cannot be opened
- * @return Ykleme baarlysa 1, dosya alamazsa 0 dner
- */
-int load_enrollments_from_csv(Enrollment **head_ptr) {
-    const char *filename = "data/enrollments.csv";
-    FILE *file = fopen(filename, "r");
-    
-    if (file == NULL) {
-    	filename = "enrollments.csv";
-        file = fopen(filename, "r");
-        if (file == NULL) {
-            printf("Warning: Could not open enrollments.csv. Starting empty.\n");
-            return 0;
-        }
-    }
-    
-    char line[512];
-    char *tokens[10];
-    int count = 0;
-    
-    fgets(line, sizeof(line), file);
-    
-    while (fgets(line, sizeof(line), file)) {
-        remove_newline(line);
-        
-        int token_count = split_csv_line(line, tokens, 7);
-        
-        if (token_count >= 7) {
-            Enrollment temp;
-            
-            temp.id = atoi(tokens[0]);
-            temp.student_id = atoi(tokens[1]);
-            temp.course_id = atoi(tokens[2]);
-            temp.professor_id = atoi(tokens[3]);
-            strcpy(temp.semester, tokens[4]);
-            strcpy(temp.date, tokens[5]);
-            strcpy(temp.status, tokens[6]);
-            
-            Enrollment *new_node = (Enrollment *)malloc(sizeof(Enrollment));
-            if (new_node) {
-                *new_node = temp;
-                new_node->next = NULL;
-                
-                if (*head_ptr == NULL) {
-                    *head_ptr = new_node;
-                } else {
-                    Enrollment *curr = *head_ptr;
-                    while (curr->next != NULL) curr = curr->next;
-                    curr->next = new_node;
-                }
-                count++;
-            }
-        }
-    }
-    
-    fclose(file);
-    printf("Success: Loaded %d enrollments from CSV.\n", count);
-    return 1;
-}
-
-/**
- * Saves all enrollment records from the linked list into a CSV file.
- * Bal listedeki tm kayt verilerini bir CSV dosyasna kaydeder.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- * @param filename - Destination file path string
- * @param filename - Hedef dosya yolu dizgisi
- * @return 1 if save is successful, 0 if file cannot be opened
- * @return Kayt baarlysa 1, dosya alamazsa 0 dner
- */
-int save_enrollments_to_csv(Enrollment *head, const char *filename) {
-    FILE *file = fopen(filename, "w");
-    if (file == NULL) {
-        printf("Error: Could not open file for writing!\n");
-        return 0;
-    }
-    
-    fprintf(file, "enrollment_id,student_id,course_id,professor_id,semester,enrollment_date,status\n");
-    
-    Enrollment *current = head;
-    int count = 0;
-    
-    while (current != NULL) {
-        fprintf(file, "%d,%d,%d,%d,%s,%s,%s\n",
-                current->id,
-                current->student_id,
-                current->course_id,
-                current->professor_id,
-                current->semester,
-                current->date,
-                current->status);
-        current = current->next;
-        count++;
-    }
-    
-    fclose(file);
-    printf("Success: Saved %d enrollments to CSV.\n", count);
-    return 1;
-}
-
-/**
- * Lists all course enrollments for a specific student in a table format.
- * Belirli bir rencinin tm ders kaytlarn tablo formatnda listeler.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- * @param student_id - ID of the student whose enrollments will be displayed
- * @param student_id - Kaytlar grntlenecek rencinin ID'si
- */
-void display_student_enrollments(Enrollment *head, int student_id) {
-    printf("\n========================================================================\n");
-    printf("  Enrollments for Student ID: %d\n", student_id);
-    printf("========================================================================\n");
-    printf("%-10s %-10s %-10s %-15s %-12s %-10s\n", 
-           "Enr.ID", "CourseID", "ProfID", "Semester", "Date", "Status");
-    printf("------------------------------------------------------------------------\n");
-    
-    Enrollment *current = head;
-    int found = 0;
-    
-    while (current != NULL) {
-        if (current->student_id == student_id) {
-            printf("%-10d %-10d %-10d %-15s %-12s %-10s\n",
-                   current->id,
-                   current->course_id,
-                   current->professor_id,
-                   current->semester,
-                   current->date,
-                   current->status);
-            found = 1;
-        }
-        current = current->next;
-    }
-    
-    if (!found) {
-        printf("No enrollments found for this student.\n");
-    }
-    
-    printf("========================================================================\n");
-}
-
-/**
- * Displays a list of all students enrolled in a specific course.
- * Belirli bir kursa kaytl olan tm rencilerin listesini grntler.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- * @param course_id - ID of the course whose roster will be displayed
- * @param course_id - Listesi grntlenecek kursun ID'si
- */
-void display_course_roster(Enrollment *head, int course_id) {
-    printf("\n====================================================\n");
-    printf("  Course Roster for Course ID: %d\n", course_id);
-    printf("====================================================\n");
-    printf("%-10s %-10s %-15s %-10s\n", 
-           "Enr.ID", "StudentID", "Semester", "Status");
-    printf("----------------------------------------------------\n");
-    
-    Enrollment *current = head;
-    int found = 0;
-    
-    while (current != NULL) {
-        if (current->course_id == course_id) {
-            printf("%-10d %-10d %-15s %-10s\n",
-                   current->id,
-                   current->student_id,
-                   current->semester,
-                   current->status);
-            found = 1;
-        }
-        current = current->next;
-    }
-    
-    if (!found) {
-        printf("No students enrolled in this course.\n");
-    }
-    
-    printf("====================================================\n");
-}
-
-/**
- * Prints all enrollment records in the system in a comprehensive table.
- * Sistemdeki tm kayt verilerini kapsaml bir tablo formatnda yazdrr.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- */
-void display_all_enrollments(Enrollment *head) {
-    if (head == NULL) {
-        printf("\nNo enrollments to display.\n");
-        return;
-    }
-    
-    printf("\n======================================================================================\n");
-    printf("                                ENROLLMENT LIST                                       \n");
-    printf("======================================================================================\n");
-    printf("%-10s %-10s %-10s %-10s %-15s %-12s %-10s\n", 
-           "Enr.ID", "StudentID", "CourseID", "ProfID", "Semester", "Date", "Status");
-    printf("--------------------------------------------------------------------------------------\n");
-    
-    Enrollment *current = head;
-    int count = 0;
-    
-    while (current != NULL) {
-        printf("%-10d %-10d %-10d %-10d %-15s %-12s %-10s\n",
-               current->id,
-               current->student_id,
-               current->course_id,
-               current->professor_id,
-               current->semester,
-               current->date,
-               current->status);
-        current = current->next;
-        count++;
-    }
-    
-    printf("======================================================================================\n");
-    printf("Total Enrollments: %d\n", count);
-    printf("======================================================================================\n");
-}
-
-/**
- * Frees all memory allocated for the enrollment linked list.
- * Kayt bal listesi iin ayrlan tm bellei serbest brakr.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- */
-void free_all_enrollments(Enrollment *head) {
-    Enrollment *temp;
-    
-    while (head != NULL) {
-    	temp = head;
-        head = head->next;
-        free(temp);
-    }
-    
-    printf("Memory for enrollments cleared.\n");
-}
-
-/**
- * Returns the total count of enrollment records in the system.
- * Sistemdeki toplam kayt kayd saysn dndrr.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- * @return Total number of enrollment nodes
- * @return Toplam kayt dm says
- */
-int count_enrollments(Enrollment *head) {
-    int count = 0;
-    Enrollment *current = head;
-    
-    while (current != NULL) {
-        count++;
-        current = current->next;
-    }
-    
-    return count;
-}
-
-/**
- * Finds the highest enrollment ID in the list and returns the next sequential ID.
- * Listedeki en yksek kayt ID'sini bulur ve bir sonraki sral ID'yi dndrr.
- * * @param head - Pointer to the head of the enrollment list
- * @param head - Kayt listesinin bana iaret eden pointer
- * @return The next available integer ID for a new enrollment
- * @return Yeni bir kayt iin kullanlabilir bir sonraki tam say ID
- */
-int get_next_enrollment_id(Enrollment *head) {
-    int max_id = 0;
-    Enrollment *current = head;
-    
-    while (current != NULL) {
-        if (current->id > max_id) {
-            max_id = current->id;
-        }
-        current = current->next;
-    }
-    
-    return max_id + 1;
-}
+// enrollment.c - Kayıt Modülü (TAMAMLANMIŞ)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "enrollment.h"
+#include "utils.h"
+#include "course.h"
+#include "student.h"
+#include "professor.h"
+#include "section.h"
+#include "index.h"
+#include "bloom.h"
+#include "snapshot.h"
+#include "waitlist.h"
+#include "grade.h"
+#include "archive.h"
+#include "join.h"
+
+// ===============================================
+// PER-STUDENT / PER-COURSE CHAINS (ZİNCİRLER)
+// ===============================================
+
+// ID -> Enrollment* index.
+// ID -> Enrollment* indeksi.
+static IdIndex enrollment_id_index = {NULL, 0, 0};
+
+// Blocked Bloom filter in front of the ID index; most brand-new IDs are ruled out without a lookup.
+// ID indeksinin önündeki blok Bloom filtresi; yeni ID'lerin çoğu arama yapılmadan elenir.
+static BloomFilter enrollment_id_filter = {NULL, 0, 0, 0, 0};
+
+// Enrollments sorted by (term, id) and by (day, id) for range queries; rebuilt on the first query after a change.
+// Aralık sorguları için (dönem, id) ve (gün, id) sırasına dizilmiş kayıtlar; bir değişiklikten sonraki ilk sorguda yeniden kurulur.
+static Enrollment **enrollment_term_order = NULL;
+static Enrollment **enrollment_day_order = NULL;
+static int enrollment_order_count = 0;
+static int enrollment_order_capacity = 0;
+static int enrollment_order_dirty = 1;
+
+// ===============================================
+// CONCURRENT ENROLLMENT (EŞZAMANLI KAYIT)
+// ===============================================
+
+#define ENROLL_LOCK_STRIPES 64
+
+// Short lock around list/chain/index mutations; striped per-student locks around duplicate checks.
+// Liste/zincir/indeks değişiklikleri için kısa kilit; tekrar kayıt kontrolleri için öğrenciye göre şeritli kilitler.
+static pthread_mutex_t enrollment_list_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t enroll_student_locks[ENROLL_LOCK_STRIPES];
+
+// Enrollment chains of students, courses and professors that are not loaded, filed under the missing ID.
+// Yüklü olmayan öğrenci, kurs ve profesörlerin kayıt zincirleri; eksik ID altında tutulur.
+static ChainIndex orphan_enrollments_by_student = { { NULL, 0, 0 }, { NULL, 0, 0 }, offsetof(Enrollment, next_by_student) };
+static ChainIndex orphan_enrollments_by_course = { { NULL, 0, 0 }, { NULL, 0, 0 }, offsetof(Enrollment, next_by_course) };
+static ChainIndex orphan_enrollments_by_professor = { { NULL, 0, 0 }, { NULL, 0, 0 }, offsetof(Enrollment, next_by_professor) };
+static pthread_once_t enroll_locks_once = PTHREAD_ONCE_INIT;
+
+/**
+ * Initializes the striped student locks (runs once).
+ * Şeritli öğrenci kilitlerini başlatır (bir kez çalışır).
+ */
+static void init_enroll_locks(void) {
+    int i;
+    for (i = 0; i < ENROLL_LOCK_STRIPES; i++) pthread_mutex_init(&enroll_student_locks[i], NULL);
+}
+
+/**
+ * Takes a free seat with one compare-and-swap on the course's counter; never exceeds capacity.
+ * Kursun sayacı üzerinde tek bir compare-and-swap ile boş bir koltuk alır; kapasite asla aşılmaz.
+ * * @param c - Course to reserve in
+ * @param c - Yer ayrılacak kurs
+ * @return 1 if a seat was reserved, 0 if the course is full
+ * @return Koltuk ayrıldıysa 1, kurs doluysa 0 döner
+ */
+static int reserve_course_seat(Course *c) {
+    int taken;
+    do {
+        taken = c->seats_taken;
+        if (taken >= c->capacity) return 0;
+    } while (!__sync_bool_compare_and_swap(&c->seats_taken, taken, taken + 1));
+    return 1;
+}
+
+/**
+ * Gives a seat back to the course's counter.
+ * Bir koltuğu kursun sayacına geri verir.
+ * * @param c - Course whose seat is released
+ * @param c - Koltuğu bırakılan kurs
+ */
+static void release_course_seat(Course *c) {
+    __sync_fetch_and_sub(&c->seats_taken, 1);
+}
+
+/**
+ * Registers an enrollment in the ID index, appends it at the tails of its student's, course's and professor's
+ * chains (kept in insertion order; a missing parent gets it in its orphan chain) and counts it in its
+ * professor/course/semester section and course seats.
+ * Bir kaydı ID indeksine kaydeder, öğrencisinin, kursunun ve profesörünün zincirlerinin son düğümüne ekler
+ * (ekleme sırası korunur; olmayan sahibin yetim zincirine eklenir) ve profesör/ders/dönem şubesinde ve kurs
+ * koltuklarında sayar.
+ * * @param enrollment - Enrollment node already linked into the main list
+ * @param enrollment - Ana listeye eklenmiş kayıt düğümü
+ * @param seat_reserved - 1 if the caller already took the seat with reserve_course_seat
+ * @param seat_reserved - Çağıran koltuğu reserve_course_seat ile zaten aldıysa 1
+ */
+static void link_enrollment(Enrollment *enrollment, int seat_reserved) {
+    id_index_insert(&enrollment_id_index, enrollment->id, enrollment);
+    bloom_insert(&enrollment_id_filter, &enrollment_id_index, enrollment->id);
+    Student *s = get_student_by_id(enrollment->student_id);
+    Course *c = get_course_by_id(enrollment->course_id);
+    Professor *p = get_professor_by_id(enrollment->professor_id);
+
+    enrollment->next_by_student = NULL;
+    enrollment->next_by_course = NULL;
+    enrollment->next_by_professor = NULL;
+    enrollment->term = semester_to_term(enrollment->semester);
+    enrollment->day = date_to_day(enrollment->date);
+    enrollment_order_dirty = 1;
+    snapshot_touch();
+    if (s != NULL) {
+        if (s->last_enrollment != NULL) s->last_enrollment->next_by_student = enrollment;
+        else s->first_enrollment = enrollment;
+        s->last_enrollment = enrollment;
+    } else {
+        chain_index_append(&orphan_enrollments_by_student, enrollment->student_id, enrollment);
+    }
+    if (c != NULL) {
+        if (c->last_enrollment != NULL) c->last_enrollment->next_by_course = enrollment;
+        else c->first_enrollment = enrollment;
+        c->last_enrollment = enrollment;
+        if (!seat_reserved && strcmp(enrollment->status, "Enrolled") == 0) __sync_fetch_and_add(&c->seats_taken, 1);
+    } else {
+        chain_index_append(&orphan_enrollments_by_course, enrollment->course_id, enrollment);
+    }
+    if (p != NULL) {
+        if (p->last_enrollment != NULL) p->last_enrollment->next_by_professor = enrollment;
+        else p->first_enrollment = enrollment;
+        p->last_enrollment = enrollment;
+    } else {
+        chain_index_append(&orphan_enrollments_by_professor, enrollment->professor_id, enrollment);
+    }
+    section_add_enrollment(enrollment);
+}
+
+/**
+ * Removes an enrollment from the ID index, its student's, course's and professor's chains (or their orphan
+ * chains) and its section.
+ * Bir kaydı ID indeksinden, öğrencisinin, kursunun ve profesörünün zincirlerinden (veya yetim
+ * zincirlerinden) ve şubesinden çıkarır.
+ * * @param enrollment - Enrollment node about to be deleted
+ * @param enrollment - Silinecek kayıt düğümü
+ */
+static void unlink_enrollment(Enrollment *enrollment) {
+    Enrollment *prev, *current;
+    id_index_remove(&enrollment_id_index, enrollment->id, enrollment);
+    enrollment_order_dirty = 1;
+    snapshot_touch();
+    Student *s = get_student_by_id(enrollment->student_id);
+    Course *c = get_course_by_id(enrollment->course_id);
+    Professor *p = get_professor_by_id(enrollment->professor_id);
+
+    if (s != NULL) {
+        for (prev = NULL, current = s->first_enrollment; current != NULL && current != enrollment; current = current->next_by_student) prev = current;
+        if (current != NULL) {
+            if (prev != NULL) prev->next_by_student = enrollment->next_by_student;
+            else s->first_enrollment = enrollment->next_by_student;
+            if (s->last_enrollment == enrollment) s->last_enrollment = prev;
+        }
+    } else {
+        chain_index_remove(&orphan_enrollments_by_student, enrollment->student_id, enrollment);
+    }
+    if (c != NULL) {
+        for (prev = NULL, current = c->first_enrollment; current != NULL && current != enrollment; current = current->next_by_course) prev = current;
+        if (current != NULL) {
+            if (prev != NULL) prev->next_by_course = enrollment->next_by_course;
+            else c->first_enrollment = enrollment->next_by_course;
+            if (c->last_enrollment == enrollment) c->last_enrollment = prev;
+        }
+        if (strcmp(enrollment->status, "Enrolled") == 0) release_course_seat(c);
+    } else {
+        chain_index_remove(&orphan_enrollments_by_course, enrollment->course_id, enrollment);
+    }
+    if (p != NULL) {
+        for (prev = NULL, current = p->first_enrollment; current != NULL && current != enrollment; current = current->next_by_professor) prev = current;
+        if (current != NULL) {
+            if (prev != NULL) prev->next_by_professor = enrollment->next_by_professor;
+            else p->first_enrollment = enrollment->next_by_professor;
+            if (p->last_enrollment == enrollment) p->last_enrollment = prev;
+        }
+    } else {
+        chain_index_remove(&orphan_enrollments_by_professor, enrollment->professor_id, enrollment);
+    }
+    enrollment->next_by_student = NULL;
+    enrollment->next_by_course = NULL;
+    enrollment->next_by_professor = NULL;
+    section_remove_enrollment(enrollment);
+}
+
+// Last node of the enrollment list, so appends do not walk the list; head_ptr of the list it belongs to.
+// Kayıt listesinin son düğümü (eklemeler listeyi yürümez) ve ait olduğu listenin head_ptr'ı.
+static Enrollment *enrollment_tail = NULL;
+static Enrollment **enrollment_tail_owner = NULL;
+
+/**
+ * Appends a node to the end of the main list in O(1). The tail is found by a walk only when a different
+ * list is appended to (tests keep several lists); the caller holds enrollment_list_lock.
+ * Bir düğümü ana listenin sonuna O(1) sürede ekler. Son düğüm yalnızca başka bir listeye eklenirken
+ * yürünerek bulunur (testler birden çok liste tutar); çağıran enrollment_list_lock'u tutar.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param node - Node to append
+ * @param node - Eklenecek düğüm
+ */
+static void append_enrollment_node(Enrollment **head_ptr, Enrollment *node) {
+    if (head_ptr != enrollment_tail_owner || *head_ptr == NULL) {
+        enrollment_tail = *head_ptr;
+        while (enrollment_tail != NULL && enrollment_tail->next != NULL) enrollment_tail = enrollment_tail->next;
+        enrollment_tail_owner = head_ptr;
+    }
+    node->next = NULL;
+    node->prev = enrollment_tail;
+    if (enrollment_tail == NULL) *head_ptr = node;
+    else enrollment_tail->next = node;
+    enrollment_tail = node;
+}
+
+/**
+ * Unlinks an enrollment from the main list through its prev pointer and frees it.
+ * Bir kaydı prev pointer'ı üzerinden ana listeden çıkarır ve serbest bırakır.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param enrollment - Node to remove
+ * @param enrollment - Silinecek düğüm
+ */
+static void remove_enrollment_node(Enrollment **head_ptr, Enrollment *enrollment) {
+    if (enrollment == enrollment_tail) enrollment_tail = enrollment->prev;
+    if (enrollment->prev != NULL) enrollment->prev->next = enrollment->next;
+    else *head_ptr = enrollment->next;
+    if (enrollment->next != NULL) enrollment->next->prev = enrollment->prev;
+    unlink_enrollment(enrollment);
+    free(enrollment);
+}
+
+/**
+ * Checks whether a enrollment ID is taken, asking the Bloom filter before the exact ID index.
+ * Bir kayıt ID'sinin kullanımda olup olmadığını, tam ID indeksinden önce Bloom filtresine sorarak kontrol eder.
+ * * @param id - ID to check
+ * @param id - Kontrol edilecek ID
+ * @return 1 if the ID exists, 0 otherwise
+ * @return ID varsa 1, yoksa 0 döner
+ */
+static int enrollment_id_exists(int id) {
+    if (!bloom_may_contain(&enrollment_id_filter, id)) return 0;
+    if (id_index_find(&enrollment_id_index, id) != NULL) return 1;
+    bloom_note_false_positive(&enrollment_id_filter);
+    return 0;
+}
+
+// ===============================================
+// ID SEQUENCE (ID DİZİSİ)
+// ===============================================
+
+// Next enrollment ID to hand out; seeded at load, persisted on save and never moved backwards.
+// Verilecek sonraki kayıt ID'si; yüklemede belirlenir, kaydederken saklanır ve asla geri gitmez.
+static int enrollment_sequence = 1;
+
+/**
+ * Moves the sequence past an ID that is now in use.
+ * Diziyi kullanımdaki bir ID'nin ötesine taşır.
+ * * @param id - ID of a enrollment added or loaded into the list
+ * @param id - Listeye eklenen veya yüklenen kayıt ID'si
+ */
+static void reserve_enrollment_id(int id) {
+    int seen = enrollment_sequence;
+    // Compare-and-swap: get_next_enrollment_id may move the sequence at the same time
+    // Compare-and-swap: get_next_enrollment_id diziyi aynı anda ilerletebilir
+    while (id >= seen) {
+        int prior = __sync_val_compare_and_swap(&enrollment_sequence, seen, id + 1);
+        if (prior == seen) break;
+        seen = prior;
+    }
+}
+
+/**
+ * Validates and inserts an enrollment node; the caller holds enrollment_list_lock.
+ * Bir kayıt düğümünü doğrulayıp ekler; çağıran enrollment_list_lock'u tutar.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param new_data - Pointer to the structure containing new enrollment information
+ * @param new_data - Yeni kayıt bilgilerini içeren yapıya işaret eden pointer
+ * @param seat_reserved - 1 if the course seat was already reserved
+ * @param seat_reserved - Kurs koltuğu önceden ayrıldıysa 1
+ * @return 1 if successful, 0 if validation fails or ID already exists
+ * @return Başarılıysa 1, doğrulama başarısızsa veya ID zaten varsa 0 döner
+ */
+static int insert_enrollment(Enrollment **head_ptr, const Enrollment *new_data, int seat_reserved) {
+    if (new_data == NULL) {
+        printf("Error: Invalid enrollment data!\n");
+        return 0;
+    }
+    
+    // Validasyon
+    if (!validate_positive_int(new_data->id)) {
+        printf("Error: Enrollment ID must be positive!\n");
+        return 0;
+    }
+    
+    // Aynı ID var mı
+    if (enrollment_id_exists(new_data->id)) {
+        printf("Error: Enrollment with ID %d already exists!\n", new_data->id);
+        return 0;
+    }
+    
+    // Yeni node
+    Enrollment *new_node = (Enrollment *)malloc(sizeof(Enrollment));
+    if (new_node == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+    
+    // Verileri kopyala
+    new_node->id = new_data->id;
+    new_node->student_id = new_data->student_id;
+    new_node->course_id = new_data->course_id;
+    new_node->professor_id = new_data->professor_id;
+    strcpy(new_node->semester, new_data->semester);
+    strcpy(new_node->date, new_data->date);
+    strcpy(new_node->status, new_data->status);
+    
+    // Listeye ekle (son düğüm tutulur; yürüme yok)
+    append_enrollment_node(head_ptr, new_node);
+    link_enrollment(new_node, seat_reserved);
+    reserve_enrollment_id(new_node->id);
+    
+    printf("Success: Enrollment added successfully!\n");
+    return 1;
+}
+
+/**
+ * Adds a new enrollment record to the system after validating the data.
+ * Verileri doğruladıktan sonra sisteme yeni bir kayıt (enrollment) ekler.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param new_data - Pointer to the structure containing new enrollment information
+ * @param new_data - Yeni kayıt bilgilerini içeren yapıya işaret eden pointer
+ * @return 1 if successful, 0 if validation fails or ID already exists
+ * @return Başarılıysa 1, doğrulama başarısızsa veya ID zaten varsa 0 döner
+ */
+int add_enrollment(Enrollment **head_ptr, const Enrollment *new_data) {
+    pthread_mutex_lock(&enrollment_list_lock);
+    int result = insert_enrollment(head_ptr, new_data, 0);
+    pthread_mutex_unlock(&enrollment_list_lock);
+    return result;
+}
+
+/**
+ * Commits a batch of pre-validated enrollments in one pass: the list lock is taken once, rows are appended
+ * at the kept tail and each seat is still taken by compare-and-swap, so concurrent single enrollments stay safe.
+ * Rows need student, course, professor and semester; ID, date and status are filled in here.
+ * Önceden doğrulanmış bir kayıt grubunu tek geçişte işler: liste kilidi bir kez alınır, satırlar tutulan son
+ * düğümün arkasına eklenir ve her koltuk yine compare-and-swap ile alınır; eşzamanlı tekil kayıtlar güvenli kalır.
+ * Satırlarda öğrenci, kurs, profesör ve dönem dolu olmalıdır; ID, tarih ve durum burada doldurulur.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param rows - Enrollments to add; the id of a row that could not be added is set to 0
+ * @param rows - Eklenecek kayıtlar; eklenemeyen satırın id'si 0 yapılır
+ * @param count - Number of rows
+ * @param count - Satır sayısı
+ * @return Number of enrollments added
+ * @return Eklenen kayıt sayısı
+ */
+int append_enrollments(Enrollment **head_ptr, Enrollment *rows, int count) {
+    char today[20];
+    int i, added = 0;
+    get_current_date(today);
+
+    pthread_mutex_lock(&enrollment_list_lock);
+    for (i = 0; i < count; i++) {
+        Course *c = get_course_by_id(rows[i].course_id);
+        if (c == NULL || !reserve_course_seat(c)) {
+            rows[i].id = 0;
+            continue;
+        }
+        Enrollment *node = (Enrollment *)malloc(sizeof(Enrollment));
+        if (node == NULL) {
+            release_course_seat(c);
+            rows[i].id = 0;
+            continue;
+        }
+        rows[i].id = get_next_enrollment_id(*head_ptr);
+        strcpy(rows[i].date, today);
+        strcpy(rows[i].status, "Enrolled");
+        *node = rows[i];
+        append_enrollment_node(head_ptr, node);
+        link_enrollment(node, 1);
+        reserve_enrollment_id(node->id);
+        added++;
+    }
+    pthread_mutex_unlock(&enrollment_list_lock);
+
+    for (i = 0; i < count; i++) {
+        if (rows[i].id != 0) waitlist_remove(rows[i].student_id, rows[i].course_id);
+    }
+    return added;
+}
+
+/**
+ * Searches for an enrollment record in the list by its unique ID.
+ * Benzersiz ID numarasına göre bir kayıt kaydını listede arar.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param id - The unique identifier of the enrollment to find
+ * @param id - Bulunacak kaydın benzersiz tanımlayıcısı
+ * @return Pointer to the enrollment node if found, NULL otherwise
+ * @return Kayıt düğümü bulunursa adresi, aksi takdirde NULL döner
+ */
+Enrollment* find_enrollment_by_id(Enrollment *head, int id) {
+    if (head == NULL) return NULL;
+    return (Enrollment *)id_index_find(&enrollment_id_index, id);
+}
+
+/**
+ * Checks if a specific student is currently enrolled in a specific course. The hot chain is read
+ * under enrollment_list_lock, so other threads may enroll meanwhile.
+ * Belirli bir öğrencinin belirli bir kursa kayıtlı olup olmadığını kontrol eder. Sıcak zincir
+ * enrollment_list_lock altında okunur; bu sırada başka iş parçacıkları kayıt yapabilir.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param student_id - ID of the student to check
+ * @param student_id - Kontrol edilecek öğrencinin ID'si
+ * @param course_id - ID of the course to check
+ * @param course_id - Kontrol edilecek kursun ID'si
+ * @return 1 if the student is enrolled or completed, 0 otherwise
+ * @return Öğrenci kayıtlıysa veya tamamlamışsa 1, aksi takdirde 0 döner
+ */
+int is_student_enrolled(Enrollment *head, int student_id, int course_id) {
+    Student *s = get_student_by_id(student_id);
+    int a, i, found = 0;
+    
+    // Zincir, başka iş parçacıklarının eklemeleriyle aynı anda yürünmemesi için kilit altında okunur
+    pthread_mutex_lock(&enrollment_list_lock);
+    Enrollment *current = (s != NULL) ? s->first_enrollment : head;
+    while (current != NULL && !found) {
+        found = (current->student_id == student_id && 
+                 current->course_id == course_id &&
+                 (strcmp(current->status, "Enrolled") == 0 || 
+                  strcmp(current->status, "Completed") == 0));
+        current = (s != NULL) ? current->next_by_student : current->next;
+    }
+    pthread_mutex_unlock(&enrollment_list_lock);
+    if (found) return 1;  // Zaten kayıtlı
+
+    // Arşivlenmiş dönemlerde tamamlanan dersler de sayılır
+    for (a = 0; a < archive_count(); a++) {
+        const Enrollment *rows;
+        int count = archive_student_enrollments(archive_get(a), student_id, &rows);
+        for (i = 0; i < count; i++) {
+            if (rows[i].course_id == course_id && strcmp(rows[i].status, "Completed") == 0) return 1;
+        }
+    }
+    
+    return 0;  // Kayıtlı değil
+}
+
+/**
+ * Counts the number of active enrollments for a specific course.
+ * Belirli bir kurs için aktif kayıtların sayısını hesaplar.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param course_id - ID of the course to count enrollments for
+ * @param course_id - Kayıtları sayılacak kursun ID'si
+ * @return Total number of students with "Enrolled" status
+ * @return "Enrolled" durumundaki toplam öğrenci sayısı
+ */
+int get_enrollment_count(Enrollment *head, int course_id) {
+    int count = 0;
+    Course *c = get_course_by_id(course_id);
+    if (c != NULL) return c->seats_taken;
+    Enrollment *current = head;
+    
+    while (current != NULL) {
+        if (current->course_id == course_id && 
+            strcmp(current->status, "Enrolled") == 0) {
+            count++;
+        }
+        current = current->next;
+    }
+    
+    return count;
+}
+
+/**
+ * Permanently deletes an enrollment record from the linked list by its ID.
+ * Bir kayıt kaydını ID'sine göre bağlı listeden kalıcı olarak siler.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param id - The unique ID of the enrollment to delete
+ * @param id - Silinecek kaydın benzersiz ID'si
+ * @return 1 if deletion is successful, 0 if record is not found
+ * @return Silme başarılıysa 1, kayıt bulunamazsa 0 döner
+ */
+int delete_enrollment(Enrollment **head_ptr, int id) {
+    if (*head_ptr == NULL) {
+        printf("Error: Enrollment list is empty!\n");
+        return 0;
+    }
+    
+    pthread_mutex_lock(&enrollment_list_lock);
+    Enrollment *current = find_enrollment_by_id(*head_ptr, id);
+    if (current == NULL) {
+        pthread_mutex_unlock(&enrollment_list_lock);
+        printf("Error: Enrollment with ID %d not found!\n", id);
+        return 0;
+    }
+    
+    remove_enrollment_node(head_ptr, current);
+    pthread_mutex_unlock(&enrollment_list_lock);
+    printf("Success: Enrollment with ID %d deleted.\n", id);
+    return 1;
+}
+
+/**
+ * Deletes every enrollment of a student by walking the student's chain (O(k), no table scan).
+ * Bir öğrencinin tüm kayıtlarını öğrenci zinciri üzerinden siler (O(k), tablo taranmaz).
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param student_id - ID of the student
+ * @param student_id - Öğrencinin ID'si
+ * @return Number of deleted enrollments
+ * @return Silinen kayıt sayısı
+ */
+int delete_student_enrollments(Enrollment **head_ptr, int student_id) {
+    Student *s = get_student_by_id(student_id);
+    int count = 0;
+    if (s == NULL) return 0;
+    pthread_mutex_lock(&enrollment_list_lock);
+    while (s->first_enrollment != NULL) {
+        remove_enrollment_node(head_ptr, s->first_enrollment);
+        count++;
+    }
+    pthread_mutex_unlock(&enrollment_list_lock);
+    return count;
+}
+
+/**
+ * Deletes every enrollment of a course by walking the course's chain.
+ * Bir kursun tüm kayıtlarını kurs zinciri üzerinden siler.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ * @return Number of deleted enrollments
+ * @return Silinen kayıt sayısı
+ */
+int delete_course_enrollments(Enrollment **head_ptr, int course_id) {
+    Course *c = get_course_by_id(course_id);
+    int count = 0;
+    if (c == NULL) return 0;
+    pthread_mutex_lock(&enrollment_list_lock);
+    while (c->first_enrollment != NULL) {
+        remove_enrollment_node(head_ptr, c->first_enrollment);
+        count++;
+    }
+    pthread_mutex_unlock(&enrollment_list_lock);
+    return count;
+}
+
+/**
+ * Deletes every enrollment of a semester in one pass over the list (used when the semester is archived).
+ * The caller holds the list lock (enrollment_lock_list) across its own walk of the semester.
+ * Bir dönemin tüm kayıtlarını liste üzerinde tek geçişte siler (dönem arşivlenirken kullanılır).
+ * Çağıran, dönemi kendi taramasıyla birlikte liste kilidini (enrollment_lock_list) tutarak çağırır.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param semester - Semester string
+ * @param semester - Dönem dizgisi
+ * @return Number of deleted enrollments
+ * @return Silinen kayıt sayısı
+ */
+int delete_semester_enrollments(Enrollment **head_ptr, const char *semester) {
+    int count = 0;
+    Enrollment *current = *head_ptr;
+    while (current != NULL) {
+        Enrollment *next = current->next;
+        if (strcmp(current->semester, semester) == 0) {
+            remove_enrollment_node(head_ptr, current);
+            count++;
+        }
+        current = next;
+    }
+    return count;
+}
+
+/**
+ * Deletes every enrollment taught by a professor by walking the professor's chain.
+ * Bir profesörün verdiği tüm kayıtları profesör zinciri üzerinden siler.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param professor_id - ID of the professor
+ * @param professor_id - Profesörün ID'si
+ * @return Number of deleted enrollments
+ * @return Silinen kayıt sayısı
+ */
+int delete_professor_enrollments(Enrollment **head_ptr, int professor_id) {
+    Professor *p = get_professor_by_id(professor_id);
+    int count = 0;
+    if (p == NULL) return 0;
+    pthread_mutex_lock(&enrollment_list_lock);
+    while (p->first_enrollment != NULL) {
+        remove_enrollment_node(head_ptr, p->first_enrollment);
+        count++;
+    }
+    pthread_mutex_unlock(&enrollment_list_lock);
+    return count;
+}
+
+/**
+ * Validates and registers a student in a course: student, course and professor must exist,
+ * the student must not already be enrolled, a seat must be free and prerequisites met.
+ * Safe to call from many threads: the seat is taken with a compare-and-swap on the course counter
+ * and duplicate checks run under a striped per-student lock, so a course is never over-enrolled.
+ * Bir öğrenciyi kursa doğrulayarak kaydeder: öğrenci, kurs ve profesör mevcut olmalı,
+ * öğrenci zaten kayıtlı olmamalı, boş kontenjan bulunmalı ve ön koşullar sağlanmalıdır.
+ * Birçok iş parçacığından çağrılabilir: koltuk kurs sayacında compare-and-swap ile alınır ve
+ * tekrar kontrolleri öğrenciye göre şeritli kilit altında yapılır; kurs kapasitesi asla aşılmaz.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param grade_head - Generic pointer to the grade list head (for prerequisites)
+ * @param grade_head - Not listesinin başına işaret eden genel pointer (ön koşullar için)
+ * @param student_id - ID of the student
+ * @param student_id - Öğrencinin ID'si
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ * @param professor_id - ID of the professor teaching the section
+ * @param professor_id - Şubeyi veren profesörün ID'si
+ * @param semester - Semester string, e.g. "2024-FALL"
+ * @param semester - Dönem dizgisi, örn. "2024-FALL"
+ * @param enrollment_id - Receives the new enrollment ID (may be NULL)
+ * @param enrollment_id - Yeni kayıt ID'sini alır (NULL olabilir)
+ * @return ENROLL_OK or the reason the enrollment was refused
+ * @return ENROLL_OK veya kaydın reddedilme nedeni
+ */
+EnrollResult enroll_student(Enrollment **head_ptr, void *grade_head, int student_id, int course_id,
+                            int professor_id, const char *semester, int *enrollment_id) {
+    if (get_student_by_id(student_id) == NULL) return ENROLL_NO_STUDENT;
+    Course *c = get_course_by_id(course_id);
+    if (c == NULL) return ENROLL_NO_COURSE;
+    if (get_professor_by_id(professor_id) == NULL) return ENROLL_NO_PROFESSOR;
+
+    // Same student -> same stripe: duplicate check and insert cannot interleave for one student
+    // Aynı öğrenci -> aynı şerit: bir öğrenci için tekrar kontrolü ve ekleme iç içe geçemez
+    pthread_once(&enroll_locks_once, init_enroll_locks);
+    pthread_mutex_t *stripe = &enroll_student_locks[(unsigned int)student_id % ENROLL_LOCK_STRIPES];
+    EnrollResult result = ENROLL_OK;
+
+    pthread_mutex_lock(stripe);
+    if (is_student_enrolled(*head_ptr, student_id, course_id)) {
+        result = ENROLL_ALREADY_ENROLLED;
+    } else if (!check_prerequisites(student_id, c, grade_head, *head_ptr)) {
+        result = ENROLL_PREREQUISITE;
+    } else if (!reserve_course_seat(c)) {
+        result = ENROLL_COURSE_FULL;
+    } else {
+        Enrollment e;
+        e.id = get_next_enrollment_id(*head_ptr);
+        e.student_id = student_id;
+        e.course_id = course_id;
+        e.professor_id = professor_id;
+        snprintf(e.semester, sizeof(e.semester), "%s", semester);
+        get_current_date(e.date);
+        strcpy(e.status, "Enrolled");
+        e.next = NULL;
+
+        pthread_mutex_lock(&enrollment_list_lock);
+        int added = insert_enrollment(head_ptr, &e, 1);
+        pthread_mutex_unlock(&enrollment_list_lock);
+        if (added) {
+            if (enrollment_id != NULL) *enrollment_id = e.id;
+            waitlist_remove(student_id, course_id);
+        } else {
+            release_course_seat(c);
+            result = ENROLL_FAILED;
+        }
+    }
+    pthread_mutex_unlock(stripe);
+    return result;
+}
+
+/**
+ * Returns a short English description of an enrollment result.
+ * Bir kayıt sonucunun kısa İngilizce açıklamasını döndürür.
+ * * @param result - Result returned by enroll_student
+ * @param result - enroll_student tarafından döndürülen sonuç
+ * @return Constant message string
+ * @return Sabit mesaj dizgisi
+ */
+const char* enroll_result_message(EnrollResult result) {
+    switch (result) {
+        case ENROLL_OK: return "Enrolled";
+        case ENROLL_NO_STUDENT: return "Student not found";
+        case ENROLL_NO_COURSE: return "Course not found";
+        case ENROLL_NO_PROFESSOR: return "Professor not found";
+        case ENROLL_ALREADY_ENROLLED: return "Student already enrolled in this course";
+        case ENROLL_COURSE_FULL: return "Course full";
+        case ENROLL_PREREQUISITE: return "Prerequisite not met";
+        default: return "Enrollment could not be added";
+    }
+}
+
+/**
+ * Enrolls the highest-priority waitlisted student into a freed seat. Entries that can no longer
+ * be enrolled (student deleted, already enrolled, ...) are discarded; a seat taken meanwhile requeues the entry.
+ * Boşalan koltuğa en öncelikli bekleyen öğrenciyi kaydeder. Artık kaydedilemeyen kayıtlar
+ * (silinmiş öğrenci, zaten kayıtlı, ...) atılır; koltuk bu arada dolduysa kayıt sıraya geri konur.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param course_id - Course with a freed seat
+ * @param course_id - Koltuğu boşalan kurs
+ */
+static void promote_from_waitlist(Enrollment **head_ptr, int course_id) {
+    WaitlistEntry next;
+    int enrollment_id;
+
+    while (waitlist_pop(course_id, &next)) {
+        EnrollResult result = enroll_student(head_ptr, NULL, next.student_id, course_id,
+                                             next.professor_id, next.semester, &enrollment_id);
+        if (result == ENROLL_OK) {
+            printf("Success: Student %d promoted from the waitlist (enrollment %d).\n", next.student_id, enrollment_id);
+            return;
+        }
+        if (result == ENROLL_COURSE_FULL) {
+            waitlist_requeue(&next);
+            return;
+        }
+    }
+}
+
+/**
+ * Changes a student's enrollment status to "Dropped" for a specific course.
+ * Belirli bir kurs için öğrencinin kayıt durumunu "Dropped" olarak değiştirir.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param student_id - ID of the student dropping the course
+ * @param student_id - Kursu bırakan öğrencinin ID'si
+ * @param course_id - ID of the course being dropped
+ * @param course_id - Bırakılan kursun ID'si
+ * @return 1 if successfully dropped, 0 if no active enrollment is found
+ * @return Başarıyla bırakıldıysa 1, aktif kayıt bulunamazsa 0 döner
+ */
+int drop_enrollment(Enrollment **head_ptr, int student_id, int course_id) {
+    Student *s = get_student_by_id(student_id);
+    Course *c = get_course_by_id(course_id);
+    pthread_mutex_lock(&enrollment_list_lock);
+    Enrollment *current = (s != NULL) ? s->first_enrollment : *head_ptr;
+    
+    while (current != NULL) {
+        if (current->student_id == student_id && 
+            current->course_id == course_id &&
+            strcmp(current->status, "Enrolled") == 0) {
+            
+            // Status'u "Dropped" yap
+            strcpy(current->status, "Dropped");
+            section_update_status(current, "Enrolled");
+            if (c != NULL) release_course_seat(c);
+            snapshot_touch();
+            pthread_mutex_unlock(&enrollment_list_lock);
+            printf("Success: Student dropped from course.\n");
+            promote_from_waitlist(head_ptr, course_id);
+            return 1;
+        }
+        current = (s != NULL) ? current->next_by_student : current->next;
+    }
+    pthread_mutex_unlock(&enrollment_list_lock);
+    
+    printf("Error: Active enrollment not found!\n");
+    return 0;
+}
+
+// ===============================================
+// SEMESTER ROLLOVER (DÖNEM SONU DEVRİ)
+// ===============================================
+
+#define ROLLOVER_SHOWN_FLAGS 10
+
+/**
+ * qsort comparator: enrollment pointers by ascending ID.
+ * qsort karşılaştırıcısı: kayıt pointer'ları artan ID'ye göre.
+ */
+static int compare_enrollment_ids(const void *a, const void *b) {
+    int x = (*(Enrollment * const *)a)->id, y = (*(Enrollment * const *)b)->id;
+    return (x > y) - (x < y);
+}
+
+// Keys and output of the rollover join: selected enrollments against the grades' enrollment IDs
+// Devir birleştirmesinin anahtarları ve çıktısı: seçilen kayıtlar ile notların kayıt ID'leri
+static int rollover_row_key(const void *row) {
+    return (*(Enrollment * const *)row)->id;
+}
+
+static int rollover_grade_key(const void *row) {
+    return ((const Grade *)row)->enrollment_id;
+}
+
+static void emit_rollover_row(const void *left, const void *right, void *ctx) {
+    Enrollment *e = *(Enrollment * const *)left;
+    RolloverSummary *result = (RolloverSummary *)ctx;
+    // Birden çok notu olan kayıt bir kez işlenir
+    if (strcmp(e->status, "Enrolled") != 0) return;
+    Course *c = get_course_by_id(e->course_id);
+
+    strcpy(e->status, (right != NULL) ? "Completed" : "Incomplete");
+    section_update_status(e, "Enrolled");
+    if (c != NULL) release_course_seat(c);
+    if (right != NULL) result->completed++;
+    else result->incomplete++;
+}
+
+/**
+ * Closes a term: every "Enrolled" row of the semester whose grade exists becomes "Completed" and every
+ * ungraded one is flagged "Incomplete". The selected enrollments are left-outer hash-joined with the
+ * grades on the enrollment ID, so the cost is linear in both lists; seats and section counters follow
+ * the new statuses and the whole change is written as one journal entry.
+ * Bir dönemi kapatır: dönemin notu olan her "Enrolled" kaydı "Completed" olur, notu olmayanlar
+ * "Incomplete" olarak işaretlenir. Seçilen kayıtlar notlarla kayıt ID'si üzerinden sol dış hash
+ * birleştirmesiyle eşlenir; maliyet iki listede de doğrusaldır. Koltuklar ve şube sayaçları yeni
+ * durumları izler ve tüm değişiklik tek bir günlük kaydı olarak yazılır.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param g_head - Pointer to the head of the grade list
+ * @param g_head - Not listesinin başına işaret eden pointer
+ * @param semester - Semester to close, e.g. "2024-FALL" (NULL or "" closes every semester)
+ * @param semester - Kapatılacak dönem, örn. "2024-FALL" (NULL veya "" tüm dönemleri kapatır)
+ * @param summary - Receives the row counts (may be NULL)
+ * @param summary - Satır sayılarını alır (NULL olabilir)
+ * @return 1 if successful, 0 on allocation failure
+ * @return Başarılıysa 1, bellek hatasında 0 döner
+ */
+int rollover_semester(Enrollment *head, struct Grade *g_head, const char *semester, RolloverSummary *summary) {
+    RolloverSummary result = {0, 0, 0};
+    int every_semester = (semester == NULL || semester[0] == '\0');
+    int row_capacity = 256, i;
+    Enrollment **rows = (Enrollment **)malloc(row_capacity * sizeof(Enrollment *));
+    if (rows == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    pthread_mutex_lock(&enrollment_list_lock);
+    int rows_sorted = 1;
+    Enrollment *current;
+    for (current = head; current != NULL; current = current->next) {
+        if (strcmp(current->status, "Enrolled") != 0) continue;
+        if (!every_semester && strcmp(current->semester, semester) != 0) continue;
+        if (result.examined == row_capacity) {
+            Enrollment **grown = (Enrollment **)realloc(rows, row_capacity * 2 * sizeof(Enrollment *));
+            if (grown == NULL) {
+                pthread_mutex_unlock(&enrollment_list_lock);
+                printf("Error: Memory allocation failed!\n");
+                free(rows);
+                return 0;
+            }
+            rows = grown;
+            row_capacity *= 2;
+        }
+        if (result.examined > 0 && current->id < rows[result.examined - 1]->id) rows_sorted = 0;
+        rows[result.examined++] = current;
+    }
+    if (!rows_sorted) qsort(rows, result.examined, sizeof(Enrollment *), compare_enrollment_ids);
+
+    // Hash join: küçük taraf (genellikle dönemin kayıtları) kurulur, diğeri bir kez taranır
+    JoinSide selected = join_array(rows, result.examined, sizeof(Enrollment *), rollover_row_key);
+    JoinSide grades = join_chain(g_head, offsetof(Grade, next), rollover_grade_key);
+    if (hash_join(&selected, &grades, JOIN_LEFT_OUTER, emit_rollover_row, &result) < 0) {
+        pthread_mutex_unlock(&enrollment_list_lock);
+        free(rows);
+        return 0;
+    }
+    if (result.examined > 0) snapshot_touch();
+    pthread_mutex_unlock(&enrollment_list_lock);
+
+    // Tüm devir tek günlük satırıdır: özet, tamamlanan ve işaretlenen kayıt ID'leri
+    FILE *journal = journal_begin_entry("ROLLOVER");
+    if (journal != NULL) {
+        fprintf(journal, "semester=%s examined=%d completed=%d incomplete=%d|completed:",
+                every_semester ? "ALL" : semester, result.examined, result.completed, result.incomplete);
+        for (i = 0; i < result.examined; i++) {
+            if (rows[i]->status[0] == 'C') fprintf(journal, " %d", rows[i]->id);
+        }
+        fprintf(journal, "|incomplete:");
+        for (i = 0; i < result.examined; i++) {
+            if (rows[i]->status[0] == 'I') fprintf(journal, " %d", rows[i]->id);
+        }
+        journal_end_entry(journal);
+    } else {
+        printf("Warning: Could not write %s; the rollover was not journaled.\n", JOURNAL_FILE);
+    }
+
+    int shown = 0;
+    for (i = 0; i < result.examined && shown < ROLLOVER_SHOWN_FLAGS; i++) {
+        if (rows[i]->status[0] != 'I') continue;
+        printf("Flagged: enrollment %d (student %d, course %d) has no grade -> Incomplete\n",
+               rows[i]->id, rows[i]->student_id, rows[i]->course_id);
+        shown++;
+    }
+    if (result.incomplete > shown) printf("... and %d more (see %s)\n", result.incomplete - shown, JOURNAL_FILE);
+    printf("Success: Rollover of %s: %d enrollments, %d completed, %d flagged incomplete.\n",
+           every_semester ? "all semesters" : semester, result.examined, result.completed, result.incomplete);
+
+    if (summary != NULL) *summary = result;
+    free(rows);
+    return 1;
+}
+
+// ===============================================
+// TERM / DATE RANGE QUERIES (DÖNEM / TARİH ARALIĞI SORGULARI)
+// ===============================================
+
+static int compare_enrollment_terms(const void *a, const void *b) {
+    const Enrollment *x = *(Enrollment * const *)a;
+    const Enrollment *y = *(Enrollment * const *)b;
+    if (x->term != y->term) return (x->term > y->term) - (x->term < y->term);
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+static int compare_enrollment_days(const void *a, const void *b) {
+    const Enrollment *x = *(Enrollment * const *)a;
+    const Enrollment *y = *(Enrollment * const *)b;
+    if (x->day != y->day) return (x->day > y->day) - (x->day < y->day);
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+/**
+ * Rebuilds both sorted orders, archived enrollments included, if the list or the archives changed since
+ * the last query. Caller holds enrollment_list_lock.
+ * Liste veya arşivler son sorgudan beri değiştiyse iki sıralı diziyi arşivlenmiş kayıtlarla birlikte
+ * yeniden kurar. Çağıran enrollment_list_lock'u tutar.
+ * @return 1 if the orders are current, 0 on allocation failure
+ * @return Diziler güncelse 1, bellek hatasında 0 döner
+ */
+static int refresh_enrollment_orders(Enrollment *head) {
+    Enrollment *e;
+    int a, i, count = 0;
+    if (!enrollment_order_dirty) return 1;
+
+    for (e = head; e != NULL; e = e->next) count++;
+    for (a = 0; a < archive_count(); a++) count += archive_get(a)->enrollment_count;
+    if (count > enrollment_order_capacity) {
+        Enrollment **by_term = (Enrollment **)realloc(enrollment_term_order, count * sizeof(Enrollment *));
+        if (by_term == NULL) return 0;
+        enrollment_term_order = by_term;
+        Enrollment **by_day = (Enrollment **)realloc(enrollment_day_order, count * sizeof(Enrollment *));
+        if (by_day == NULL) return 0;
+        enrollment_day_order = by_day;
+        enrollment_order_capacity = count;
+    }
+    enrollment_order_count = 0;
+    for (e = head; e != NULL; e = e->next) {
+        enrollment_term_order[enrollment_order_count] = e;
+        enrollment_day_order[enrollment_order_count++] = e;
+    }
+    // Arşivlenmiş dönemlerin kayıtları (salt okunur satırlar)
+    for (a = 0; a < archive_count(); a++) {
+        const SemesterArchive *archive = archive_get(a);
+        for (i = 0; i < archive->enrollment_count; i++) {
+            e = (Enrollment *)&archive->enrollments[i];
+            enrollment_term_order[enrollment_order_count] = e;
+            enrollment_day_order[enrollment_order_count++] = e;
+        }
+    }
+    qsort(enrollment_term_order, enrollment_order_count, sizeof(Enrollment *), compare_enrollment_terms);
+    qsort(enrollment_day_order, enrollment_order_count, sizeof(Enrollment *), compare_enrollment_days);
+    enrollment_order_dirty = 0;
+    return 1;
+}
+
+/**
+ * Marks the range orders stale; the archive module calls this when semesters are mapped or unmapped.
+ * Aralık dizilerini eskimiş olarak işaretler; arşiv modülü dönemler eşlendiğinde veya kaldırıldığında çağırır.
+ */
+void enrollment_range_orders_invalidate(void) {
+    pthread_mutex_lock(&enrollment_list_lock);
+    enrollment_order_dirty = 1;
+    pthread_mutex_unlock(&enrollment_list_lock);
+}
+
+/**
+ * Binary-searches one sorted order for the run of keys in [from, to].
+ * Sıralı dizilerden birinde [from, to] aralığındaki anahtarları ikili aramayla bulur.
+ */
+static int find_enrollment_range(Enrollment *head, int by_day, int from, int to, Enrollment ***first) {
+    int lo, hi, start;
+    pthread_mutex_lock(&enrollment_list_lock);
+    if (!refresh_enrollment_orders(head)) {
+        pthread_mutex_unlock(&enrollment_list_lock);
+        printf("Error: Memory allocation failed!\n");
+        return -1;
+    }
+    Enrollment **order = by_day ? enrollment_day_order : enrollment_term_order;
+
+    lo = 0; hi = enrollment_order_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if ((by_day ? order[mid]->day : order[mid]->term) < from) lo = mid + 1;
+        else hi = mid;
+    }
+    start = lo;
+    hi = enrollment_order_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if ((by_day ? order[mid]->day : order[mid]->term) <= to) lo = mid + 1;
+        else hi = mid;
+    }
+    pthread_mutex_unlock(&enrollment_list_lock);
+    *first = order + start;
+    return lo - start;
+}
+
+/**
+ * Returns the enrollments whose term lies in [from_term, to_term], ordered by term, then ID.
+ * Archived enrollments are included and are read-only. The returned run stays valid until the
+ * enrollment list or the archives change.
+ * Dönemi [from_term, to_term] aralığında olan kayıtları önce döneme, sonra ID'ye göre sıralı döndürür.
+ * Arşivlenmiş kayıtlar da dahildir ve salt okunurdur. Dönen dizi kayıt listesi veya arşivler değişene kadar geçerlidir.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param from_term - First term ordinal (see semester_to_term)
+ * @param from_term - İlk dönem sıra numarası (bkz. semester_to_term)
+ * @param to_term - Last term ordinal, inclusive
+ * @param to_term - Son dönem sıra numarası (dahil)
+ * @param first - Receives the first matching enrollment pointer
+ * @param first - İlk eşleşen kayıt pointer'ını alır
+ * @return Number of matching enrollments (-1 on allocation failure)
+ * @return Eşleşen kayıt sayısı (bellek hatasında -1)
+ */
+int enrollments_in_term_range(Enrollment *head, int from_term, int to_term, Enrollment ***first) {
+    return find_enrollment_range(head, 0, from_term, to_term, first);
+}
+
+/**
+ * Returns the enrollments made between two day numbers (inclusive), ordered by date, then ID.
+ * Archived enrollments are included and are read-only. The returned run stays valid until the
+ * enrollment list or the archives change.
+ * İki gün numarası arasında (dahil) yapılmış kayıtları önce tarihe, sonra ID'ye göre sıralı döndürür.
+ * Arşivlenmiş kayıtlar da dahildir ve salt okunurdur. Dönen dizi kayıt listesi veya arşivler değişene kadar geçerlidir.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param from_day - First day number (see date_to_day)
+ * @param from_day - İlk gün numarası (bkz. date_to_day)
+ * @param to_day - Last day number, inclusive
+ * @param to_day - Son gün numarası (dahil)
+ * @param first - Receives the first matching enrollment pointer
+ * @param first - İlk eşleşen kayıt pointer'ını alır
+ * @return Number of matching enrollments (-1 on allocation failure)
+ * @return Eşleşen kayıt sayısı (bellek hatasında -1)
+ */
+int enrollments_in_date_range(Enrollment *head, int from_day, int to_day, Enrollment ***first) {
+    return find_enrollment_range(head, 1, from_day, to_day, first);
+}
+
+/**
+ * Prints per-semester enrollment counts by status for a range of terms.
+ * Bir dönem aralığı için dönem başına, duruma göre kayıt sayılarını yazdırır.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param from_term - First term ordinal
+ * @param from_term - İlk dönem sıra numarası
+ * @param to_term - Last term ordinal, inclusive
+ * @param to_term - Son dönem sıra numarası (dahil)
+ */
+void display_enrollment_term_summary(Enrollment *head, int from_term, int to_term) {
+    Enrollment **rows;
+    char semester[20];
+    int i, j, count = enrollments_in_term_range(head, from_term, to_term, &rows);
+    if (count < 0) return;
+
+    printf("\n%-12s %8s %10s %10s %11s %8s\n", "Semester", "Enrolled", "Completed", "Dropped", "Incomplete", "Total");
+    printf("----------------------------------------------------------------\n");
+    for (i = 0; i < count; i = j) {
+        int enrolled = 0, completed = 0, dropped = 0, incomplete = 0;
+        for (j = i; j < count && rows[j]->term == rows[i]->term; j++) {
+            if (strcmp(rows[j]->status, "Enrolled") == 0) enrolled++;
+            else if (strcmp(rows[j]->status, "Completed") == 0) completed++;
+            else if (strcmp(rows[j]->status, "Dropped") == 0) dropped++;
+            else if (strcmp(rows[j]->status, "Incomplete") == 0) incomplete++;
+        }
+        term_to_semester(rows[i]->term, semester, sizeof(semester));
+        printf("%-12s %8d %10d %10d %11d %8d\n", semester, enrolled, completed, dropped, incomplete, j - i);
+    }
+    if (count == 0) printf("No enrollments in this range.\n");
+}
+
+/**
+ * Lists the enrollments made between two dates, oldest first.
+ * İki tarih arasında yapılmış kayıtları en eskiden başlayarak listeler.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param from_day - First day number
+ * @param from_day - İlk gün numarası
+ * @param to_day - Last day number, inclusive
+ * @param to_day - Son gün numarası (dahil)
+ */
+void display_enrollments_in_date_range(Enrollment *head, int from_day, int to_day) {
+    Enrollment **rows;
+    char from[20], to[20];
+    int i, count = enrollments_in_date_range(head, from_day, to_day, &rows);
+    if (count < 0) return;
+
+    day_to_date(from_day, from);
+    day_to_date(to_day, to);
+    printf("\n========================================================================\n");
+    printf("   Enrollments %s .. %s\n", from, to);
+    printf("========================================================================\n");
+    printf("%-8s %-10s %-10s %-12s %-12s %-10s\n", "ID", "Student", "Course", "Semester", "Date", "Status");
+    printf("------------------------------------------------------------------------\n");
+    for (i = 0; i < count; i++) {
+        printf("%-8d %-10d %-10d %-12s %-12s %-10s\n", rows[i]->id, rows[i]->student_id,
+               rows[i]->course_id, rows[i]->semester, rows[i]->date, rows[i]->status);
+    }
+    printf("------------------------------------------------------------------------\n");
+    printf("Total Enrollments: %d\n", count);
+}
+
+/**
+ * Loads enrollment records from a CSV file into the linked list.
+ * CSV dosyasındaki kayıt verilerini okur ve bağlı listeye yükler.
+ * * @param head_ptr - Double pointer to receive the head of the loaded list
+ * @param head_ptr - Yüklenen listenin başını alacak çift kademeli pointer
+ * @return 1 if loading is successful, 0 if file cannot be opened
+ * @return Yükleme başarılıysa 1, dosya açılamazsa 0 döner
+ */
+int load_enrollments_from_csv(Enrollment **head_ptr) {
+    const char *filename = "data/enrollments.csv";
+    FILE *file = fopen(filename, "r");
+    
+    if (file == NULL) {
+    	filename = "enrollments.csv";
+        file = fopen(filename, "r");
+        if (file == NULL) {
+            printf("Warning: Could not open enrollments.csv. Starting empty.\n");
+            return 0;
+        }
+    }
+    
+    char line[512];
+    char *tokens[10];
+    int count = 0;
+    
+    fgets(line, sizeof(line), file);
+    
+    while (fgets(line, sizeof(line), file)) {
+        remove_newline(line);
+        
+        int token_count = split_csv_line(line, tokens, 7);
+        
+        if (token_count >= 7 && !archive_is_frozen(tokens[4])) {
+            Enrollment temp;
+            
+            temp.id = atoi(tokens[0]);
+            temp.student_id = atoi(tokens[1]);
+            temp.course_id = atoi(tokens[2]);
+            temp.professor_id = atoi(tokens[3]);
+            strcpy(temp.semester, tokens[4]);
+            strcpy(temp.date, tokens[5]);
+            strcpy(temp.status, tokens[6]);
+            
+            Enrollment *new_node = (Enrollment *)malloc(sizeof(Enrollment));
+            if (new_node) {
+                *new_node = temp;
+                append_enrollment_node(head_ptr, new_node);
+                link_enrollment(new_node, 0);
+                reserve_enrollment_id(new_node->id);
+                count++;
+            }
+        }
+    }
+    
+    fclose(file);
+    enrollment_sequence = load_sequence("enrollments", enrollment_sequence);
+    load_waitlists_from_csv(WAITLIST_FILE);
+    printf("Success: Loaded %d enrollments from CSV.\n", count);
+    return 1;
+}
+
+/**
+ * Saves all enrollment records from the linked list into a CSV file.
+ * Bağlı listedeki tüm kayıt verilerini bir CSV dosyasına kaydeder.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param filename - Destination file path string
+ * @param filename - Hedef dosya yolu dizgisi
+ * @return 1 if save is successful, 0 if file cannot be opened
+ * @return Kayıt başarılıysa 1, dosya açılamazsa 0 döner
+ */
+int save_enrollments_to_csv(Enrollment *head, const char *filename) {
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) {
+        printf("Error: Could not open file for writing!\n");
+        return 0;
+    }
+    
+    fprintf(file, "enrollment_id,student_id,course_id,professor_id,semester,enrollment_date,status\n");
+    
+    Enrollment *current = head;
+    int count = 0;
+    
+    while (current != NULL) {
+        fprintf(file, "%d,%d,%d,%d,%s,%s,%s\n",
+                current->id,
+                current->student_id,
+                current->course_id,
+                current->professor_id,
+                current->semester,
+                current->date,
+                current->status);
+        current = current->next;
+        count++;
+    }
+    
+    fclose(file);
+    save_sequence("enrollments", enrollment_sequence);
+    save_waitlists_to_csv(WAITLIST_FILE);
+    printf("Success: Saved %d enrollments to CSV.\n", count);
+    return 1;
+}
+
+/**
+ * Lists all course enrollments for a specific student in a table format.
+ * Belirli bir öğrencinin tüm ders kayıtlarını tablo formatında listeler.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param student_id - ID of the student whose enrollments will be displayed
+ * @param student_id - Kayıtları görüntülenecek öğrencinin ID'si
+ */
+void display_student_enrollments(Enrollment *head, int student_id) {
+    printf("\n========================================================================\n");
+    printf("  Enrollments for Student ID: %d\n", student_id);
+    printf("========================================================================\n");
+    printf("%-10s %-10s %-10s %-15s %-12s %-10s\n", 
+           "Enr.ID", "CourseID", "ProfID", "Semester", "Date", "Status");
+    printf("------------------------------------------------------------------------\n");
+    
+    Student *s = get_student_by_id(student_id);
+    Enrollment *current = (s != NULL) ? s->first_enrollment : head;
+    int found = 0, a, i;
+
+    // Önce arşivlenmiş (eski) dönemler, sonra güncel kayıtlar
+    for (a = 0; a < archive_count(); a++) {
+        const Enrollment *rows;
+        int count = archive_student_enrollments(archive_get(a), student_id, &rows);
+        for (i = 0; i < count; i++) {
+            printf("%-10d %-10d %-10d %-15s %-12s %-10s\n", rows[i].id, rows[i].course_id, rows[i].professor_id,
+                   rows[i].semester, rows[i].date, rows[i].status);
+            found = 1;
+        }
+    }
+    
+    while (current != NULL) {
+        if (current->student_id == student_id) {
+            printf("%-10d %-10d %-10d %-15s %-12s %-10s\n",
+                   current->id,
+                   current->course_id,
+                   current->professor_id,
+                   current->semester,
+                   current->date,
+                   current->status);
+            found = 1;
+        }
+        current = (s != NULL) ? current->next_by_student : current->next;
+    }
+    
+    if (!found) {
+        printf("No enrollments found for this student.\n");
+    }
+    
+    printf("========================================================================\n");
+}
+
+// State of the roster join (enrollments with their students)
+// Ders listesi birleştirmesinin durumu (kayıtlar ve öğrencileri)
+typedef struct RosterJoin {
+    int course_id;
+    int found;
+} RosterJoin;
+
+static int roster_student_key(const void *row) {
+    return ((const Enrollment *)row)->student_id;
+}
+
+static void* roster_student_lookup(int id) {
+    return get_student_by_id(id);
+}
+
+static void emit_roster_row(const void *left, const void *right, void *ctx) {
+    const Enrollment *e = (const Enrollment *)left;
+    const Student *s = (const Student *)right;
+    RosterJoin *roster = (RosterJoin *)ctx;
+    char name[101];
+
+    if (e->course_id != roster->course_id) return;
+    if (s != NULL) snprintf(name, sizeof(name), "%s %s", s->first_name, s->last_name);
+    else strcpy(name, "?");
+    printf("%-10d %-10d %-25.25s %-15s %-10s\n", e->id, e->student_id, name, e->semester, e->status);
+    roster->found = 1;
+}
+
+/**
+ * Displays a list of all students enrolled in a specific course. The course's enrollments are
+ * joined with the students through the student ID index, so the cost is linear in the roster;
+ * rows of archived semesters come first, found by binary search in each archive's course order.
+ * Belirli bir kursa kayıtlı olan tüm öğrencilerin listesini görüntüler. Dersin kayıtları öğrenci
+ * ID indeksi üzerinden öğrencilerle birleştirilir; maliyet liste uzunluğuyla doğrusaldır.
+ * Arşivlenmiş dönemlerin satırları, her arşivin ders sırasında ikili aramayla bulunup önce gelir.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @param course_id - ID of the course whose roster will be displayed
+ * @param course_id - Listesi görüntülenecek kursun ID'si
+ */
+void display_course_roster(Enrollment *head, int course_id) {
+    RosterJoin roster = {course_id, 0};
+    int a;
+
+    printf("\n==========================================================================\n");
+    printf("  Course Roster for Course ID: %d\n", course_id);
+    printf("==========================================================================\n");
+    printf("%-10s %-10s %-25s %-15s %-10s\n", 
+           "Enr.ID", "StudentID", "Name", "Semester", "Status");
+    printf("--------------------------------------------------------------------------\n");
+    
+    // Silinmiş bir dersin kayıtları için tüm liste taranır
+    Course *c = get_course_by_id(course_id);
+    JoinSide enrollments = (c != NULL) ?
+        join_chain(c->first_enrollment, offsetof(Enrollment, next_by_course), roster_student_key) :
+        join_chain(head, offsetof(Enrollment, next), roster_student_key);
+    JoinSide students = join_index(roster_student_lookup);
+    // Arşivlenmiş dönemlerin satırları (daha eski) önce, dersin arşiv sırasından
+    for (a = 0; a < archive_count(); a++) {
+        const Enrollment **rows;
+        int i, count = archive_course_enrollments(archive_get(a), course_id, &rows);
+        for (i = 0; i < count; i++) emit_roster_row(rows[i], get_student_by_id(rows[i]->student_id), &roster);
+    }
+    hash_join(&enrollments, &students, JOIN_LEFT_OUTER, emit_roster_row, &roster);
+    
+    if (!roster.found) {
+        printf("No students enrolled in this course.\n");
+    }
+    
+    printf("==========================================================================\n");
+}
+
+/**
+ * Prints all enrollment records in the system in a comprehensive table.
+ * Sistemdeki tüm kayıt verilerini kapsamlı bir tablo formatında yazdırır.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ */
+void display_all_enrollments(Enrollment *head) {
+    if (head == NULL) {
+        printf("\nNo enrollments to display.\n");
+        return;
+    }
+    
+    printf("\n======================================================================================\n");
+    printf("                                ENROLLMENT LIST                                       \n");
+    printf("======================================================================================\n");
+    printf("%-10s %-10s %-10s %-10s %-15s %-12s %-10s\n", 
+           "Enr.ID", "StudentID", "CourseID", "ProfID", "Semester", "Date", "Status");
+    printf("--------------------------------------------------------------------------------------\n");
+    
+    Enrollment *current = head;
+    int count = 0;
+    
+    while (current != NULL) {
+        printf("%-10d %-10d %-10d %-10d %-15s %-12s %-10s\n",
+               current->id,
+               current->student_id,
+               current->course_id,
+               current->professor_id,
+               current->semester,
+               current->date,
+               current->status);
+        current = current->next;
+        count++;
+    }
+    
+    printf("======================================================================================\n");
+    printf("Total Enrollments: %d\n", count);
+    printf("======================================================================================\n");
+}
+
+// ===============================================
+// ORPHAN CHAINS (YETİM ZİNCİRLER)
+// ===============================================
+
+/**
+ * Takes the enrollment list lock for a caller outside this module that walks or edits the list, its chains
+ * or the section headcounts (archiving, workload reports).
+ * Listeyi, zincirlerini veya şube sayılarını tarayan ya da değiştiren modül dışı bir çağıran için kayıt
+ * listesi kilidini alır (arşivleme, iş yükü raporları).
+ */
+void enrollment_lock_list(void) {
+    pthread_mutex_lock(&enrollment_list_lock);
+}
+
+/**
+ * Releases the lock taken by enrollment_lock_list.
+ * enrollment_lock_list ile alınan kilidi bırakır.
+ */
+void enrollment_unlock_list(void) {
+    pthread_mutex_unlock(&enrollment_list_lock);
+}
+
+/**
+ * Moves a deleted student's enrollment chain into the orphan chains.
+ * Silinen öğrencinin kayıt zincirini yetim zincirlere taşır.
+ * * @param s - Student about to be freed
+ * @param s - Serbest bırakılacak öğrenci
+ */
+void enrollment_detach_student(Student *s) {
+    pthread_mutex_lock(&enrollment_list_lock);
+    Enrollment *e = s->first_enrollment;
+    while (e != NULL) {
+        Enrollment *next = e->next_by_student;
+        chain_index_append(&orphan_enrollments_by_student, s->id, e);
+        e = next;
+    }
+    s->first_enrollment = s->last_enrollment = NULL;
+    pthread_mutex_unlock(&enrollment_list_lock);
+}
+
+/**
+ * Moves a deleted course's enrollment chain into the orphan chains.
+ * Silinen kursun kayıt zincirini yetim zincirlere taşır.
+ * * @param c - Course about to be freed
+ * @param c - Serbest bırakılacak kurs
+ */
+void enrollment_detach_course(Course *c) {
+    pthread_mutex_lock(&enrollment_list_lock);
+    Enrollment *e = c->first_enrollment;
+    while (e != NULL) {
+        Enrollment *next = e->next_by_course;
+        chain_index_append(&orphan_enrollments_by_course, c->id, e);
+        e = next;
+    }
+    c->first_enrollment = c->last_enrollment = NULL;
+    pthread_mutex_unlock(&enrollment_list_lock);
+}
+
+/**
+ * Moves a deleted professor's enrollment chain into the orphan chains.
+ * Silinen profesörün kayıt zincirini yetim zincirlere taşır.
+ * * @param p - Professor about to be freed
+ * @param p - Serbest bırakılacak profesör
+ */
+void enrollment_detach_professor(Professor *p) {
+    pthread_mutex_lock(&enrollment_list_lock);
+    Enrollment *e = p->first_enrollment;
+    while (e != NULL) {
+        Enrollment *next = e->next_by_professor;
+        chain_index_append(&orphan_enrollments_by_professor, p->id, e);
+        e = next;
+    }
+    p->first_enrollment = p->last_enrollment = NULL;
+    pthread_mutex_unlock(&enrollment_list_lock);
+}
+
+/**
+ * Hands the orphan enrollments of a student ID back to a newly added student.
+ * Bir öğrenci ID'sinin yetim kayıtlarını yeni eklenen öğrenciye geri verir.
+ * * @param s - Student just added
+ * @param s - Yeni eklenen öğrenci
+ */
+void enrollment_relink_student(Student *s) {
+    void *last;
+    pthread_mutex_lock(&enrollment_list_lock);
+    s->first_enrollment = (Enrollment *)chain_index_take(&orphan_enrollments_by_student, s->id, &last);
+    s->last_enrollment = (Enrollment *)last;
+    pthread_mutex_unlock(&enrollment_list_lock);
+    if (s->first_enrollment != NULL) snapshot_touch();
+}
+
+/**
+ * Hands the orphan enrollments of a course ID back to a newly added course and takes a seat for each
+ * "Enrolled" row among them.
+ * Bir kurs ID'sinin yetim kayıtlarını yeni eklenen kursa geri verir ve aralarındaki her "Enrolled"
+ * satır için bir koltuk ayırır.
+ * * @param c - Course just added
+ * @param c - Yeni eklenen kurs
+ */
+void enrollment_relink_course(Course *c) {
+    void *last;
+    Enrollment *e;
+    pthread_mutex_lock(&enrollment_list_lock);
+    c->first_enrollment = (Enrollment *)chain_index_take(&orphan_enrollments_by_course, c->id, &last);
+    c->last_enrollment = (Enrollment *)last;
+    for (e = c->first_enrollment; e != NULL; e = e->next_by_course) {
+        if (strcmp(e->status, "Enrolled") == 0) __sync_fetch_and_add(&c->seats_taken, 1);
+    }
+    pthread_mutex_unlock(&enrollment_list_lock);
+    if (c->first_enrollment != NULL) snapshot_touch();
+}
+
+/**
+ * Hands the orphan enrollments of a professor ID back to a newly added professor.
+ * Bir profesör ID'sinin yetim kayıtlarını yeni eklenen profesöre geri verir.
+ * * @param p - Professor just added
+ * @param p - Yeni eklenen profesör
+ */
+void enrollment_relink_professor(Professor *p) {
+    void *last;
+    pthread_mutex_lock(&enrollment_list_lock);
+    p->first_enrollment = (Enrollment *)chain_index_take(&orphan_enrollments_by_professor, p->id, &last);
+    p->last_enrollment = (Enrollment *)last;
+    pthread_mutex_unlock(&enrollment_list_lock);
+}
+
+/**
+ * Frees all memory allocated for the enrollment linked list.
+ * Kayıt bağlı listesi için ayrılan tüm belleği serbest bırakır.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ */
+void free_all_enrollments(Enrollment *head) {
+    Enrollment *temp;
+    
+    while (head != NULL) {
+    	temp = head;
+        head = head->next;
+        // Sahip öğrenci/kurs hâlâ bellekteyse zincir başlarını sıfırla
+        Student *s = get_student_by_id(temp->student_id);
+        Course *c = get_course_by_id(temp->course_id);
+        Professor *p = get_professor_by_id(temp->professor_id);
+        if (s != NULL) s->first_enrollment = s->last_enrollment = NULL;
+        if (c != NULL) {
+            c->first_enrollment = c->last_enrollment = NULL;
+            c->seats_taken = 0;
+        }
+        if (p != NULL) p->first_enrollment = p->last_enrollment = NULL;
+        free(temp);
+    }
+    enrollment_tail = NULL;
+    enrollment_tail_owner = NULL;
+    chain_index_clear(&orphan_enrollments_by_student);
+    chain_index_clear(&orphan_enrollments_by_course);
+    chain_index_clear(&orphan_enrollments_by_professor);
+    id_index_clear(&enrollment_id_index);
+    bloom_clear(&enrollment_id_filter);
+    free(enrollment_term_order);
+    free(enrollment_day_order);
+    enrollment_term_order = enrollment_day_order = NULL;
+    enrollment_order_count = enrollment_order_capacity = 0;
+    enrollment_order_dirty = 1;
+    section_clear();
+    archive_file_sections();
+    waitlist_clear();
+    
+    printf("Memory for enrollments cleared.\n");
+}
+
+/**
+ * Returns the total count of enrollment records in the system.
+ * Sistemdeki toplam kayıt kaydı sayısını döndürür.
+ * * @param head - Pointer to the head of the enrollment list
+ * @param head - Kayıt listesinin başına işaret eden pointer
+ * @return Total number of enrollment nodes
+ * @return Toplam kayıt düğümü sayısı
+ */
+int count_enrollments(Enrollment *head) {
+    int count = 0;
+    Enrollment *current = head;
+    
+    while (current != NULL) {
+        count++;
+        current = current->next;
+    }
+    
+    return count;
+}
+
+/**
+ * Hands out the next enrollment ID in O(1). IDs of deleted enrollments are never reused.
+ * Sonraki kayıt ID'sini O(1) sürede verir. Silinen kayıtların ID'leri tekrar kullanılmaz.
+ * * @param head - Pointer to the head of the enrollment list (unused, kept for API compatibility)
+ * @param head - Kayıt listesinin başına işaret eden pointer (kullanılmaz, API uyumluluğu için)
+ * @return The next available integer ID
+ * @return Kullanılabilir bir sonraki tam sayı ID
+ */
+int get_next_enrollment_id(Enrollment *head) {
+    (void)head;
+    return __sync_fetch_and_add(&enrollment_sequence, 1);
+}
+
+/**
+ * Prints the duplicate-ID filter statistics of the enrollment table.
+ * Kayıt tablosunun mükerrer ID filtresi istatistiklerini yazdırır.
+ */
+void display_enrollment_filter_stats(void) {
+    bloom_print_stats("Enrollments", &enrollment_id_filter, enrollment_id_index.size);
+}
@@ -1,33 +1,88 @@
-#ifndef ENROLLMENT_H
-#define ENROLLMENT_H
-
-#include <stdio.h>
-#include <stdlib.h>
-
-typedef struct Enrollment {
-    int id;
-    int student_id;
-    int course_id;
-    int professor_id;
-    char semester[20];
-    char date[20];
-    char status[20];
-    struct Enrollment *next;
-} Enrollment;
-
-int load_enrollments_from_csv(Enrollment **head_ptr);
-int save_enrollments_to_csv(Enrollment *head, const char *filename);
-int add_enrollment(Enrollment **head_ptr, const Enrollment *new_enrollment);
-int delete_enrollment(Enrollment **head_ptr, int id);
-int drop_enrollment(Enrollment **head_ptr, int student_id, int course_id);
-Enrollment* find_enrollment_by_id(Enrollment *head, int id);
-int is_student_enrolled(Enrollment *head, int student_id, int course_id);
-int get_enrollment_count(Enrollment *head, int course_id);
-void display_student_enrollments(Enrollment *head, int student_id);
-void display_course_roster(Enrollment *head, int course_id);
-void display_all_enrollments(Enrollment *head);
-void free_all_enrollments(Enrollment *head);
-int count_enrollments(Enrollment *head);
-int get_next_enrollment_id(Enrollment *head);
-
-#endif
+#ifndef ENROLLMENT_H
+#define ENROLLMENT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct Enrollment {
+    int id;
+    int student_id;
+    int course_id;
+    int professor_id;
+    char semester[20];
+    char date[20];
+    char status[20];
+    int term;                             // semester_to_term(semester), set when linked
+    int day;                              // date_to_day(date), set when linked
+    struct Enrollment *next_by_student;   // Next enrollment of the same student
+    struct Enrollment *next_by_course;    // Next enrollment of the same course
+    struct Enrollment *next_by_professor; // Next enrollment taught by the same professor
+    struct Enrollment *prev;              // Previous node of the main list
+    struct Enrollment *next;
+} Enrollment;
+
+// Outcome of enroll_student
+// enroll_student sonucu
+typedef enum EnrollResult {
+    ENROLL_OK = 0,
+    ENROLL_NO_STUDENT,
+    ENROLL_NO_COURSE,
+    ENROLL_NO_PROFESSOR,
+    ENROLL_ALREADY_ENROLLED,
+    ENROLL_COURSE_FULL,
+    ENROLL_PREREQUISITE,
+    ENROLL_FAILED
+} EnrollResult;
+
+struct Grade;
+struct Student;
+struct Course;
+struct Professor;
+
+// Row counts of a semester rollover
+// Dönem sonu devrinin satır sayıları
+typedef struct RolloverSummary {
+    int examined;      // "Enrolled" rows of the semester
+    int completed;     // Graded -> "Completed"
+    int incomplete;    // Ungraded -> flagged "Incomplete"
+} RolloverSummary;
+
+int load_enrollments_from_csv(Enrollment **head_ptr);
+int save_enrollments_to_csv(Enrollment *head, const char *filename);
+int add_enrollment(Enrollment **head_ptr, const Enrollment *new_enrollment);
+int append_enrollments(Enrollment **head_ptr, Enrollment *rows, int count);
+int delete_enrollment(Enrollment **head_ptr, int id);
+int delete_student_enrollments(Enrollment **head_ptr, int student_id);
+int delete_course_enrollments(Enrollment **head_ptr, int course_id);
+int delete_semester_enrollments(Enrollment **head_ptr, const char *semester);
+int delete_professor_enrollments(Enrollment **head_ptr, int professor_id);
+EnrollResult enroll_student(Enrollment **head_ptr, void *grade_head, int student_id, int course_id,
+                            int professor_id, const char *semester, int *enrollment_id);
+const char* enroll_result_message(EnrollResult result);
+int drop_enrollment(Enrollment **head_ptr, int student_id, int course_id);
+int rollover_semester(Enrollment *head, struct Grade *g_head, const char *semester, RolloverSummary *summary);
+Enrollment* find_enrollment_by_id(Enrollment *head, int id);
+int is_student_enrolled(Enrollment *head, int student_id, int course_id);
+int get_enrollment_count(Enrollment *head, int course_id);
+void display_student_enrollments(Enrollment *head, int student_id);
+void display_course_roster(Enrollment *head, int course_id);
+void display_all_enrollments(Enrollment *head);
+int enrollments_in_term_range(Enrollment *head, int from_term, int to_term, Enrollment ***first);
+void enrollment_range_orders_invalidate(void);
+int enrollments_in_date_range(Enrollment *head, int from_day, int to_day, Enrollment ***first);
+void display_enrollment_term_summary(Enrollment *head, int from_term, int to_term);
+void display_enrollments_in_date_range(Enrollment *head, int from_day, int to_day);
+void display_enrollment_filter_stats(void);
+void enrollment_lock_list(void);
+void enrollment_unlock_list(void);
+void enrollment_detach_student(struct Student *s);
+void enrollment_detach_course(struct Course *c);
+void enrollment_detach_professor(struct Professor *p);
+void enrollment_relink_student(struct Student *s);
+void enrollment_relink_course(struct Course *c);
+void enrollment_relink_professor(struct Professor *p);
+void free_all_enrollments(Enrollment *head);
+int count_enrollments(Enrollment *head);
+int get_next_enrollment_id(Enrollment *head);
+
+#endif
@@ -1,693 +1,1737 @@
-// grade.c - Not Modl (TAMAMLANMI)
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include "grade.h"
-#include "utils.h"
-#include "course.h"
-
-// ===============================================
-// LETTER GRADE CONVERSION (OTOMATK HARF HESAPLAMA)
-// ===============================================
-
-/**
- * Converts a numeric score (0-100) into a standard letter grade.
- * Saysal bir puan (0-100) standart bir harf notuna dntrr.
- * * @param numeric - The numeric score to be converted
- * @param numeric - Dntrlecek saysal puan
- * @param letter_buffer - Buffer to store the resulting letter grade (e.g., "AA")
- * @param letter_buffer - Sonu harf notunun saklanaca alan (rn. "AA")
- */
-void numeric_to_letter(float numeric, char *letter_buffer) {
-    if (numeric >= 90.0) {
-        strcpy(letter_buffer, "AA");
-    } else if (numeric >= 85.0) {
-        strcpy(letter_buffer, "BA");
-    } else if (numeric >= 80.0) {
-        strcpy(letter_buffer, "BB");
-    } else if (numeric >= 75.0) {
-        strcpy(letter_buffer, "CB");
-    } else if (numeric >= 70.0) {
-        strcpy(letter_buffer, "CC");
-    } else if (numeric >= 65.0) {
-        strcpy(letter_buffer, "DC");
-    } else if (numeric >= 60.0) {
-        strcpy(letter_buffer, "DD");
-    } else if (numeric >= 50.0) {
-        strcpy(letter_buffer, "FD");
-    } else {
-        strcpy(letter_buffer, "FF");
-    }
-}
-
-/**
- * Converts a letter grade to its corresponding 4.0 scale points.
- * Bir harf notunu 4.0'lk sistemdeki karlk gelen puanna dntrr.
- * * @param letter - The letter grade string (e.g., "AA", "BA")
- * @param letter - Harf notu dizgisi (rn. "AA", "BA")
- * @return Point value of the grade (0 to 4)
- * @return Notun puan karl (0 ile 4 aras)
- */
-int letter_to_points(const char *letter) {
-    if (strcmp(letter, "AA") == 0) return 4;
-    if (strcmp(letter, "BA") == 0) return 3;
-    if (strcmp(letter, "BB") == 0) return 3;
-    if (strcmp(letter, "CB") == 0) return 2;
-    if (strcmp(letter, "CC") == 0) return 2;
-    if (strcmp(letter, "DC") == 0) return 1;
-    if (strcmp(letter, "DD") == 0) return 1;
-    return 0;  // FF, FD
-}
-
-// ===============================================
-// CRUD - CREATE
-// ===============================================
-
-/**
- * Adds a new grade record to the list and automatically calculates the letter grade.
- * Listeye yeni bir not kayd ekler ve harf notunu otomatik olarak hesaplar.
- * * @param head_ptr - Double pointer to the head of the grade list
- * @param head_ptr - Not listesinin bana iaret eden ift kademeli pointer
- * @param new_data - Pointer to the structure containing new grade data
- * @param new_data - Yeni not verilerini ieren yapya iaret eden pointer
- * @return 1 if successful, 0 if validation fails or ID already exists
- * @return Baarlysa 1, dorulama baarszsa veya ID zaten varsa 0 dner
- */
-int add_grade(Grade **head_ptr, const Grade *new_data) {
-    if (new_data == NULL) {
-        printf("Error: Invalid grade data!\n");
-        return 0;
-    }
-    
-    // Validasyon
-    if (!validate_positive_int(new_data->id)) {
-        printf("Error: Grade ID must be positive!\n");
-        return 0;
-    }
-    
-    if (new_data->numeric_grade < 0.0 || new_data->numeric_grade > 100.0) {
-        printf("Error: Numeric grade must be between 0 and 100!\n");
-        return 0;
-    }
-    
-    // Ayn ID var m
-    if (find_grade_by_id(*head_ptr, new_data->id) != NULL) {
-        printf("Error: Grade with ID %d already exists!\n", new_data->id);
-        return 0;
-    }
-    
-    // Yeni node
-    Grade *new_node = (Grade *)malloc(sizeof(Grade));
-    if (new_node == NULL) {
-        printf("Error: Memory allocation failed!\n");
-        return 0;
-    }
-    
-    // Verileri kopyala
-    new_node->id = new_data->id;
-    new_node->enrollment_id = new_data->enrollment_id;
-    new_node->student_id = new_data->student_id;
-    new_node->course_id = new_data->course_id;
-    new_node->numeric_grade = new_data->numeric_grade;
-    strcpy(new_node->semester, new_data->semester);
-    
-    // Harf notunu otomatik hesapla
-    numeric_to_letter(new_data->numeric_grade, new_node->letter_grade);
-    
-    new_node->next = NULL;
-    
-    // Listeye ekle
-    if (*head_ptr == NULL) {
-        *head_ptr = new_node;
-    } else {
-        Grade *current = *head_ptr;
-        while (current->next != NULL) {
-            current = current->next;
-        }
-        current->next = new_node;
-    }
-    
-    printf("Success: Grade added (%.2f -> %s)!\n", 
-           new_data->numeric_grade, new_node->letter_grade);
-    return 1;
-}
-
-// ===============================================
-// CRUD - READ
-// ===============================================
-
-/**
- * Finds a specific grade record using its unique ID.
- * Benzersiz ID'sini kullanarak belirli bir not kaydn bulur.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @param id - The unique identifier of the grade to find
- * @param id - Bulunacak notun benzersiz tanmlaycs
- * @return Pointer to the grade node if found, NULL otherwise
- * @return Not dm bulunursa adresi, aksi takdirde NULL dner
- */
-Grade* find_grade_by_id(Grade *head, int id) {
-    Grade *current = head;
-    
-    while (current != NULL) {
-        if (current->id == id) {
-            return current;
-        }
-        current = current->next;
-    }
-    
-    return NULL;
-}
-
-/**
- * Searches for a grade record associated with a specific enrollment.
- * Belirli bir kaytla (enrollment) ilikili not kaydn arar.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @param enrollment_id - The ID of the enrollment record
- * @param enrollment_id - Kayt (enrollment) kaydnn ID'si
- * @return Pointer to the grade node or NULL
- * @return Not dm adresi veya NULL dner
- */
-Grade* find_grade_by_enrollment(Grade *head, int enrollment_id) {
-    Grade *current = head;
-    
-    while (current != NULL) {
-        if (current->enrollment_id == enrollment_id) {
-            return current;
-        }
-        current = current->next;
-    }
-    
-    return NULL;
-}
-
-/**
- * Retrieves the grade for a specific student in a specific course.
- * Belirli bir rencinin belirli bir kurstaki notunu getirir.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @param student_id - ID of the student
- * @param student_id - rencinin ID'si
- * @param course_id - ID of the course
- * @param course_id - Kursun ID'si
- * @return Pointer to the matched grade or NULL
- * @return Eleen notun adresi veya NULL dner
- */
-Grade* find_student_course_grade(Grade *head, int student_id, int course_id) {
-    Grade *current = head;
-    
-    while (current != NULL) {
-        if (current->student_id == student_id && current->course_id == course_id) {
-            return current;
-        }
-        current = current->next;
-    }
-    
-    return NULL;
-}
-
-// ===============================================
-// CRUD - UPDATE
-// ===============================================
-
-/**
- * Updates the numeric and letter grade of an existing record.
- * Mevcut bir kaydn saysal ve harf notunu gnceller.
- * * @param grade_to_update - Pointer to the grade node to modify
- * @param grade_to_update - Deitirilecek not dmne iaret eden pointer
- * @param new_numeric - The new numeric grade value
- * @param new_numeric - Yeni saysal not deeri
- * @param new_letter - Optional new letter grade (if NULL, it's auto-calculated)
- * @param new_letter - stee bal yeni harf notu (NULL ise otomatik hesaplanr)
- * @return 1 if successful, 0 otherwise
- * @return Baarlysa 1, aksi takdirde 0 dner
- */
-int update_grade(Grade *grade_to_update, float new_numeric, const char *new_letter) {
-    if (grade_to_update == NULL) {
-        printf("Error: Invalid grade!\n");
-        return 0;
-    }
-    
-    if (new_numeric < 0.0 || new_numeric > 100.0) {
-        printf("Error: Numeric grade must be between 0 and 100!\n");
-        return 0;
-    }
-    
-    grade_to_update->numeric_grade = new_numeric;
-    
-    // Eer harf notu verilmediyse otomatik hesapla
-    if (new_letter == NULL || strlen(new_letter) == 0) {
-        numeric_to_letter(new_numeric, grade_to_update->letter_grade);
-    } else {
-        strcpy(grade_to_update->letter_grade, new_letter);
-    }
-    
-    printf("Success: Grade updated to %.2f (%s)!\n", 
-           new_numeric, grade_to_update->letter_grade);
-    return 1;
-}
-
-// ===============================================
-// CRUD - DELETE
-// ===============================================
-
-/**
- * Removes a grade record from the list by its ID.
- * Bir not kaydn ID'sine gre listeden kaldrr.
- * * @param head_ptr - Double pointer to the head of the grade list
- * @param head_ptr - Not listesinin bana iaret eden ift kademeli pointer
- * @param id - The unique ID of the grade to delete
- * @param id - Silinecek notun benzersiz ID'si
- * @return 1 if successfully deleted, 0 if not found
- * @return Baaryla silindiyse 1, bulunamadysa 0 dner
- */
-int delete_grade(Grade **head_ptr, int id) {
-    Grade *current = *head_ptr;
-    Grade *prev = NULL;
-    
-    if (current == NULL) {
-        printf("Error: Grade list is empty!\n");
-        return 0;
-    }
-    
-    // lk node
-    if (current->id == id) {
-        *head_ptr = current->next;
-        printf("Success: Grade with ID %d deleted.\n", id);
-        free(current);
-        return 1;
-    }
-    
-    // Ortada/sonda
-    while (current != NULL && current->id != id) {
-        prev = current;
-        current = current->next;
-    }
-    
-    if (current == NULL) {
-        printf("Error: Grade with ID %d not found!\n", id);
-        return 0;
-    }
-    
-    prev->next = current->next;
-    printf("Success: Grade with ID %d deleted.\n", id);
-    free(current);
-    return 1;
-}
-
-// ===============================================
-// FILE OPERATIONS
-// ===============================================
-
-/**
- * Loads grade data from the CSV file into the linked list.
- * CSV dosyasndaki not verilerini bal listeye ykler.
- * * @param head_ptr - Double pointer to receive the head of the list
- * @param head_ptr - Listenin ban alacak ift kademeli pointer
- * @return 1 if successful, 0 if file cannot be opened
- * @return Baarlysa 1, dosya alamazsa 0 dner
- */
-int load_grades_from_csv(Grade **head_ptr) {
-    const char *filename = "data/grades.csv";
-    FILE *file = fopen(filename, "r");
-    
-    if (file == NULL) {
-    	filename = "grades.csv";
-        file = fopen(filename, "r");
-        if (file == NULL) {
-            printf("Warning: Could not open grades.csv. Starting empty.\n");
-            return 0;
-        }
-    }
-    
-    char line[512];
-    char *tokens[10];
-    int count = 0;
-    
-    fgets(line, sizeof(line), file);
-    
-    while (fgets(line, sizeof(line), file)) {
-        remove_newline(line);
-        
-        int token_count = split_csv_line(line, tokens, 7);
-        
-        if (token_count >= 7) {
-            Grade temp;
-            
-            temp.id = atoi(tokens[0]);
-            temp.enrollment_id = atoi(tokens[1]);
-            temp.student_id = atoi(tokens[2]);
-            temp.course_id = atoi(tokens[3]);
-            strcpy(temp.letter_grade, tokens[4]);
-            temp.numeric_grade = atof(tokens[5]);
-            strcpy(temp.semester, tokens[6]);
-            
-            Grade *new_node = (Grade *)malloc(sizeof(Grade));
-            if (new_node) {
-                *new_node = temp;
-                new_node->next = NULL;
-                
-                if (*head_ptr == NULL) {
-                    *head_ptr = new_node;
-                } else {
-                    Grade *curr = *head_ptr;
-                    while (curr->next != NULL) curr = curr->next;
-                    curr->next = new_node;
-                }
-                count++;
-            }
-        }
-    }
-    
-    fclose(file);
-    printf("Success: Loaded %d grades from CSV.\n", count);
-    return 1;
-}
-
-/**
- * Saves all current grade records to a specified CSV file.
- * Mevcut tm not kaytlarn belirtilen bir CSV dosyasna kaydeder.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @param filename - String containing the destination file path
- * @param filename - Hedef dosya yolunu ieren dizgi
- * @return 1 if successful, 0 otherwise
- * @return Baarlysa 1, aksi takdirde 0 dner
- */
-int save_grades_to_csv(Grade *head, const char *filename) {
-    FILE *file = fopen(filename, "w");
-    if (file == NULL) {
-        printf("Error: Could not open file for writing!\n");
-        return 0;
-    }
-    
-    fprintf(file, "grade_id,enrollment_id,student_id,course_id,letter_grade,numeric_grade,semester\n");
-    
-    Grade *current = head;
-    int count = 0;
-    
-    while (current != NULL) {
-        fprintf(file, "%d,%d,%d,%d,%s,%.2f,%s\n",
-                current->id,
-                current->enrollment_id,
-                current->student_id,
-                current->course_id,
-                current->letter_grade,
-                current->numeric_grade,
-                current->semester);
-        current = current->next;
-        count++;
-    }
-    
-    fclose(file);
-    printf("Success: Saved %d grades to CSV.\n", count);
-    return 1;
-}
-
-// ===============================================
-// DISPLAY OPERATIONS
-// ===============================================
-
-/**
- * Prints all grades and the numeric average for a specific student.
- * Belirli bir renci iin tm notlar ve saysal ortalamay yazdrr.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @param student_id - ID of the student
- * @param student_id - rencinin ID'si
- */
-void display_student_grades(Grade *head, int student_id) {
-    printf("\n============================================================================\n");
-    printf("  Grades for Student ID: %d\n", student_id);
-    printf("============================================================================\n");
-    printf("%-10s %-10s %-10s %-10s %-15s\n", 
-           "GradeID", "CourseID", "Letter", "Numeric", "Semester");
-    printf("----------------------------------------------------------------------------\n");
-    
-    Grade *current = head;
-    int found = 0;
-    float sum = 0;
-    int count = 0;
-    
-    while (current != NULL) {
-        if (current->student_id == student_id) {
-            printf("%-10d %-10d %-10s %-10.2f %-15s\n",
-                   current->id,
-                   current->course_id,
-                   current->letter_grade,
-                   current->numeric_grade,
-                   current->semester);
-            sum += current->numeric_grade;
-            count++;
-            found = 1;
-        }
-        current = current->next;
-    }
-    
-    printf("============================================================================\n");
-    if (found) {
-        printf("Average Numeric Grade: %.2f\n", sum / count);
-    } else {
-        printf("No grades found for this student.\n");
-    }
-    printf("============================================================================\n");
-}
-
-/**
- * Lists all student grades recorded for a specific course.
- * Belirli bir kurs iin kaydedilmi tm renci notlarn listeler.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @param course_id - ID of the course
- * @param course_id - Kursun ID'si
- */
-void display_course_grades(Grade *head, int course_id) {
-    printf("\n============================================================================\n");
-    printf("  Grade Distribution for Course ID: %d\n", course_id);
-    printf("============================================================================\n");
-    printf("%-10s %-10s %-10s %-15s\n", 
-           "StudentID", "Letter", "Numeric", "Semester");
-    printf("----------------------------------------------------------------------------\n");
-    
-    Grade *current = head;
-    int found = 0;
-    
-    while (current != NULL) {
-        if (current->course_id == course_id) {
-            printf("%-10d %-10s %-10.2f %-15s\n",
-                   current->student_id,
-                   current->letter_grade,
-                   current->numeric_grade,
-                   current->semester);
-            found = 1;
-        }
-        current = current->next;
-    }
-    
-    if (!found) {
-        printf("No grades found for this course.\n");
-    }
-    
-    printf("============================================================================\n");
-}
-
-/**
- * Prints a complete table of all grades currently in the system memory.
- * Sistem belleindeki tm notlarn tam bir tablosunu yazdrr.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- */
-void display_all_grades(Grade *head) {
-    Grade *current;
-    int count = 0;
-    
-    if (head == NULL) {
-        printf("\nNo grades to display.\n");
-        return;
-    }
-    
-    printf("\n=====================================================================\n");
-    printf("                           GRADE LIST                                \n");
-    printf("=====================================================================\n");
-    printf("%-6s %-6s %-8s %-8s %-6s %-7s %-12s\n", 
-           "GrdID", "EnrID", "StudID", "CrsID", "Letter", "Numeric", "Semester");
-    printf("---------------------------------------------------------------------\n");
-    
-    current = head;
-    
-    while (current != NULL) {
-        printf("%-6d %-6d %-8d %-8d %-6.6s %-7.2f %-12.12s\n",
-               current->id,
-               current->enrollment_id,
-               current->student_id,
-               current->course_id,
-               current->letter_grade,
-               current->numeric_grade,
-               current->semester);
-        current = current->next;
-        count++;
-    }
-    
-    printf("=====================================================================\n");
-    printf("Total Grades: %d\n", count);
-    printf("=====================================================================\n");
-}
-
-// ===============================================
-// STATISTICS
-// ===============================================
-
-/**
- * Calculates the mean numeric grade for all students in a course.
- * Bir kurstaki tm renciler iin ortalama saysal notu hesaplar.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @param course_id - ID of the course
- * @param course_id - Kursun ID'si
- * @return The average numeric score
- * @return Ortalama saysal puan
- */
-float calculate_course_average(Grade *head, int course_id) {
-    float sum = 0;
-    int count = 0;
-    
-    Grade *current = head;
-    while (current != NULL) {
-        if (current->course_id == course_id) {
-            sum += current->numeric_grade;
-            count++;
-        }
-        current = current->next;
-    }
-    
-    if (count == 0) return 0.0;
-    return sum / count;
-}
-
-/**
- * Shows comprehensive statistics including average, min, max, and grade distribution.
- * Ortalama, min, max ve not dalm dahil kapsaml istatistikleri gsterir.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @param course_id - ID of the course
- * @param course_id - Kursun ID'si
- */
-void display_grade_statistics(Grade *head, int course_id) {
-    float sum = 0, min = 100, max = 0;
-    int count = 0;
-    
-    // Sayalar sfrla
-    int count_AA = 0, count_BA = 0, count_BB = 0, count_CB = 0;
-    int count_CC = 0, count_DC = 0, count_DD = 0, count_FD = 0, count_FF = 0;
-
-    Grade *curr = head;
-
-    printf("\n========================================\n");
-    printf("   Grade Statistics for Course %d\n", course_id);
-    printf("========================================\n");
-
-    while (curr != NULL) {
-        if (curr->course_id == course_id) {
-            float score = curr->numeric_grade; // Saysal notu al
-            
-            // 1. Genel statistikler
-            if (score < min) min = score;
-            if (score > max) max = score;
-            sum += score;
-            count++;
-
-            // 2. Dalm SAYISAL nota gre yap
-            if (score >= 90) count_AA++;
-            else if (score >= 85) count_BA++;
-            else if (score >= 80) count_BB++;
-            else if (score >= 75) count_CB++;
-            else if (score >= 70) count_CC++;
-            else if (score >= 60) count_DC++;
-            else if (score >= 50) count_DD++;
-            else if (score >= 40) count_FD++;
-            else count_FF++;
-        }
-        curr = curr->next;
-    }
-
-    if (count > 0) {
-        printf("Total Students: %d\n", count);
-        printf("Average:        %.2f\n", sum / count);
-        printf("Minimum:        %.2f\n", min);
-        printf("Maximum:        %.2f\n", max);
-        printf("----------------------------------------\n");
-        printf("GRADE DISTRIBUTION:\n");
-        printf("AA: %-4d  BA: %-4d  BB: %-4d  CB: %-4d\n", count_AA, count_BA, count_BB, count_CB);
-        printf("CC: %-4d  DC: %-4d  DD: %-4d  FD: %-4d\n", count_CC, count_DC, count_DD, count_FD);
-        printf("FF: %-4d\n", count_FF);
-    } else {
-        printf("No grades recorded for this course.\n");
-    }
-    printf("========================================\n");
-}
-
-// ===============================================
-// UTILITY
-// ===============================================
-
-/**
- * Frees all memory allocated for the grade linked list.
- * Not bal listesi iin ayrlan tm bellei serbest brakr.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- */
-void free_all_grades(Grade *head) {
-    Grade *temp;
-    
-    while (head != NULL) {
-        temp = head;
-        head = head->next;
-        free(temp);
-    }
-    
-    printf("Memory for grades cleared.\n");
-}
-
-/**
- * Counts the total number of grade records in the linked list.
- * Bal listedeki toplam not kayd saysn hesaplar.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @return Total record count
- * @return Toplam kayt says
- */
-int count_grades(Grade *head) {
-    int count = 0;
-    Grade *current = head;
-    
-    while (current != NULL) {
-        count++;
-        current = current->next;
-    }
-    
-    return count;
-}
-
-/**
- * Determines the next sequential unique ID for a new grade entry.
- * Yeni bir not girii iin bir sonraki sral benzersiz ID'yi belirler.
- * * @param head - Pointer to the head of the grade list
- * @param head - Not listesinin bana iaret eden pointer
- * @return The next available integer ID
- * @return Mevcut bir sonraki tam say ID
- */
-int get_next_grade_id(Grade *head) {
-    int max_id = 0;
-    Grade *current = head;
-    
-    while (current != NULL) {
-        if (current->id > max_id) {
-            max_id = current->id;
-        }
-        current = current->next;
-    }
-    
-    return max_id + 1;
-}
+// grade.c - Not Modülü (TAMAMLANMIŞ)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "grade.h"
+#include "utils.h"
+#include "course.h"
+#include "student.h"
+#include "index.h"
+#include "bloom.h"
+#include "snapshot.h"
+#include "enrollment.h"
+#include "archive.h"
+#include "cube.h"
+#include "gradestats.h"
+
+// ===============================================
+// PER-STUDENT / PER-COURSE CHAINS (ZİNCİRLER)
+// ===============================================
+
+// ID -> Grade* index.
+// ID -> Grade* indeksi.
+static IdIndex grade_id_index = {NULL, 0, 0};
+
+// Blocked Bloom filter in front of the ID index; most brand-new IDs are ruled out without a lookup.
+// ID indeksinin önündeki blok Bloom filtresi; yeni ID'lerin çoğu arama yapılmadan elenir.
+static BloomFilter grade_id_filter = {NULL, 0, 0, 0, 0};
+
+// Grades sorted by (term, id) for range queries; rebuilt on the first query after a change.
+// Aralık sorguları için (dönem, id) sırasına dizilmiş notlar; bir değişiklikten sonraki ilk sorguda yeniden kurulur.
+static Grade **grade_term_order = NULL;
+static int grade_term_count = 0;
+static int grade_term_capacity = 0;
+static int grade_term_dirty = 1;
+
+// Chains of grades whose student or course is not loaded, filed under the missing ID until it is added again.
+// Öğrencisi veya kursu yüklü olmayan notların zincirleri; eksik ID yeniden eklenene kadar onun altında tutulur.
+static ChainIndex orphan_grades_by_student = { { NULL, 0, 0 }, { NULL, 0, 0 }, offsetof(Grade, next_by_student) };
+static ChainIndex orphan_grades_by_course = { { NULL, 0, 0 }, { NULL, 0, 0 }, offsetof(Grade, next_by_course) };
+
+/**
+ * Counts a grade's credits in its student's term totals when both its student and course exist.
+ * Notun kredisini, öğrencisi ve kursu varsa öğrencinin dönem toplamlarına sayar.
+ * * @param grade - Grade node not counted yet
+ * @param grade - Henüz sayılmamış not düğümü
+ */
+static void count_grade_credits(Grade *grade) {
+    Student *s = get_student_by_id(grade->student_id);
+    Course *c = get_course_by_id(grade->course_id);
+    grade->counted_credits = (s != NULL && c != NULL) ? c->credits : 0;
+    if (grade->counted_credits > 0) student_account_grade(s, grade->term, grade->counted_credits, grade->numeric_grade, 1);
+}
+
+/**
+ * Adds (sign = 1) or removes (sign = -1) a grade in its student's per-term totals, in the grade cube
+ * and in its course's distribution sketches.
+ * A grade counts toward the totals only if its student and course exist when it is linked;
+ * counted_credits remembers what was added.
+ * Bir notu öğrencisinin dönem toplamlarına, not küpüne ve dersinin dağılım özetlerine ekler (sign = 1)
+ * veya çıkarır (sign = -1).
+ * Not, toplamlara yalnızca bağlandığında öğrencisi ve kursu varsa sayılır; counted_credits eklenen krediyi hatırlar.
+ * * @param grade - Grade node
+ * @param grade - Not düğümü
+ * @param sign - 1 to add, -1 to remove
+ * @param sign - Eklemek için 1, çıkarmak için -1
+ */
+static void account_grade(Grade *grade, int sign) {
+    Student *s = get_student_by_id(grade->student_id);
+    grade_cube_account(grade, sign);
+    grade_stats_account(grade, sign);
+    if (sign > 0) {
+        count_grade_credits(grade);
+    } else if (grade->counted_credits > 0) {
+        if (s != NULL) student_account_grade(s, grade->term, grade->counted_credits, grade->numeric_grade, -1);
+        grade->counted_credits = 0;
+    }
+}
+
+/**
+ * Changes a grade's score, keeping its student's term totals in step.
+ * Bir notun puanını değiştirir; öğrencisinin dönem toplamlarını da günceller.
+ */
+static void set_grade_score(Grade *grade, float numeric_grade) {
+    account_grade(grade, -1);
+    grade->numeric_grade = numeric_grade;
+    account_grade(grade, 1);
+}
+
+/**
+ * Registers a grade in the ID index and appends it at the tails of its student's and course's chains
+ * (kept in insertion order). A missing student or course gets the grade in its orphan chain instead.
+ * Bir notu ID indeksine kaydeder ve öğrencisinin ve kursunun zincirlerinin son düğümüne ekler (ekleme
+ * sırası korunur). Öğrencisi veya kursu yoksa not, onun yetim zincirine eklenir.
+ * * @param grade - Grade node already linked into the main list
+ * @param grade - Ana listeye eklenmiş not düğümü
+ */
+static void link_grade(Grade *grade) {
+    id_index_insert(&grade_id_index, grade->id, grade);
+    bloom_insert(&grade_id_filter, &grade_id_index, grade->id);
+    Student *s = get_student_by_id(grade->student_id);
+    Course *c = get_course_by_id(grade->course_id);
+
+    grade->next_by_student = NULL;
+    grade->next_by_course = NULL;
+    grade->term = semester_to_term(grade->semester);
+    grade_term_dirty = 1;
+    account_grade(grade, 1);
+    snapshot_touch();
+    if (s != NULL) {
+        if (s->last_grade != NULL) s->last_grade->next_by_student = grade;
+        else s->first_grade = grade;
+        s->last_grade = grade;
+    } else {
+        chain_index_append(&orphan_grades_by_student, grade->student_id, grade);
+    }
+    if (c != NULL) {
+        if (c->last_grade != NULL) c->last_grade->next_by_course = grade;
+        else c->first_grade = grade;
+        c->last_grade = grade;
+    } else {
+        chain_index_append(&orphan_grades_by_course, grade->course_id, grade);
+    }
+}
+
+/**
+ * Removes a grade from the ID index and its student's and course's chains (or their orphan chains).
+ * Bir notu ID indeksinden, öğrencisinin ve kursunun zincirlerinden (veya yetim zincirlerinden) çıkarır.
+ * * @param grade - Grade node about to be deleted
+ * @param grade - Silinecek not düğümü
+ */
+static void unlink_grade(Grade *grade) {
+    Grade *prev, *current;
+    id_index_remove(&grade_id_index, grade->id, grade);
+    grade_term_dirty = 1;
+    account_grade(grade, -1);
+    snapshot_touch();
+    Student *s = get_student_by_id(grade->student_id);
+    Course *c = get_course_by_id(grade->course_id);
+
+    if (s != NULL) {
+        for (prev = NULL, current = s->first_grade; current != NULL && current != grade; current = current->next_by_student) prev = current;
+        if (current != NULL) {
+            if (prev != NULL) prev->next_by_student = grade->next_by_student;
+            else s->first_grade = grade->next_by_student;
+            if (s->last_grade == grade) s->last_grade = prev;
+        }
+    } else {
+        chain_index_remove(&orphan_grades_by_student, grade->student_id, grade);
+    }
+    if (c != NULL) {
+        for (prev = NULL, current = c->first_grade; current != NULL && current != grade; current = current->next_by_course) prev = current;
+        if (current != NULL) {
+            if (prev != NULL) prev->next_by_course = grade->next_by_course;
+            else c->first_grade = grade->next_by_course;
+            if (c->last_grade == grade) c->last_grade = prev;
+        }
+    } else {
+        chain_index_remove(&orphan_grades_by_course, grade->course_id, grade);
+    }
+    grade->next_by_student = NULL;
+    grade->next_by_course = NULL;
+}
+
+// Last node of the grade list and the head pointer it was found from; every append goes through here.
+// Not listesinin son düğümü ve bulunduğu baş pointer'ı; tüm eklemeler buradan geçer.
+static Grade *grade_tail = NULL;
+static Grade **grade_tail_owner = NULL;
+
+/**
+ * Appends a grade after the kept tail in O(1), setting its prev pointer. Only a list other than the one
+ * last appended to is walked, once, to find its end.
+ * Bir notu tutulan son düğümün arkasına O(1) sürede ekler ve prev pointer'ını ayarlar. Yalnızca en son
+ * eklenenden farklı bir liste, sonunu bulmak için bir kez yürünür.
+ * * @param head_ptr - Double pointer to the head of the grade list
+ * @param head_ptr - Not listesinin başına işaret eden çift kademeli pointer
+ * @param grade - Node to append
+ * @param grade - Eklenecek düğüm
+ */
+static void append_grade_node(Grade **head_ptr, Grade *grade) {
+    if (head_ptr != grade_tail_owner || *head_ptr == NULL) {
+        grade_tail = *head_ptr;
+        while (grade_tail != NULL && grade_tail->next != NULL) grade_tail = grade_tail->next;
+        grade_tail_owner = head_ptr;
+    }
+    grade->next = NULL;
+    grade->prev = grade_tail;
+    if (grade_tail == NULL) *head_ptr = grade;
+    else grade_tail->next = grade;
+    grade_tail = grade;
+}
+
+/**
+ * Unlinks a grade from the main list through its prev pointer and frees it.
+ * Bir notu prev pointer'ı üzerinden ana listeden çıkarır ve serbest bırakır.
+ * * @param head_ptr - Double pointer to the head of the grade list
+ * @param head_ptr - Not listesinin başına işaret eden çift kademeli pointer
+ * @param grade - Node to remove
+ * @param grade - Silinecek düğüm
+ */
+static void remove_grade_node(Grade **head_ptr, Grade *grade) {
+    if (grade == grade_tail) grade_tail = grade->prev;
+    if (grade->prev != NULL) grade->prev->next = grade->next;
+    else *head_ptr = grade->next;
+    if (grade->next != NULL) grade->next->prev = grade->prev;
+    unlink_grade(grade);
+    free(grade);
+}
+
+/**
+ * Checks whether a grade ID is taken, asking the Bloom filter before the exact ID index.
+ * Bir not ID'sinin kullanımda olup olmadığını, tam ID indeksinden önce Bloom filtresine sorarak kontrol eder.
+ * * @param id - ID to check
+ * @param id - Kontrol edilecek ID
+ * @return 1 if the ID exists, 0 otherwise
+ * @return ID varsa 1, yoksa 0 döner
+ */
+static int grade_id_exists(int id) {
+    if (!bloom_may_contain(&grade_id_filter, id)) return 0;
+    if (id_index_find(&grade_id_index, id) != NULL) return 1;
+    bloom_note_false_positive(&grade_id_filter);
+    return 0;
+}
+
+// ===============================================
+// LETTER GRADE CONVERSION (OTOMATİK HARF HESAPLAMA)
+// ===============================================
+
+/**
+ * Converts a numeric score (0-100) into a standard letter grade.
+ * Sayısal bir puanı (0-100) standart bir harf notuna dönüştürür.
+ * * @param numeric - The numeric score to be converted
+ * @param numeric - Dönüştürülecek sayısal puan
+ * @param letter_buffer - Buffer to store the resulting letter grade (e.g., "AA")
+ * @param letter_buffer - Sonuç harf notunun saklanacağı alan (örn. "AA")
+ */
+void numeric_to_letter(float numeric, char *letter_buffer) {
+    if (numeric >= 90.0) {
+        strcpy(letter_buffer, "AA");
+    } else if (numeric >= 85.0) {
+        strcpy(letter_buffer, "BA");
+    } else if (numeric >= 80.0) {
+        strcpy(letter_buffer, "BB");
+    } else if (numeric >= 75.0) {
+        strcpy(letter_buffer, "CB");
+    } else if (numeric >= 70.0) {
+        strcpy(letter_buffer, "CC");
+    } else if (numeric >= 65.0) {
+        strcpy(letter_buffer, "DC");
+    } else if (numeric >= 60.0) {
+        strcpy(letter_buffer, "DD");
+    } else if (numeric >= 50.0) {
+        strcpy(letter_buffer, "FD");
+    } else {
+        strcpy(letter_buffer, "FF");
+    }
+}
+
+/**
+ * Converts a letter grade to its corresponding 4.0 scale points.
+ * Bir harf notunu 4.0'lık sistemdeki karşılık gelen puanına dönüştürür.
+ * * @param letter - The letter grade string (e.g., "AA", "BA")
+ * @param letter - Harf notu dizgisi (örn. "AA", "BA")
+ * @return Point value of the grade (0 to 4)
+ * @return Notun puan karşılığı (0 ile 4 arası)
+ */
+int letter_to_points(const char *letter) {
+    if (strcmp(letter, "AA") == 0) return 4;
+    if (strcmp(letter, "BA") == 0) return 3;
+    if (strcmp(letter, "BB") == 0) return 3;
+    if (strcmp(letter, "CB") == 0) return 2;
+    if (strcmp(letter, "CC") == 0) return 2;
+    if (strcmp(letter, "DC") == 0) return 1;
+    if (strcmp(letter, "DD") == 0) return 1;
+    return 0;  // FF, FD
+}
+
+// Letter of each score band; band = number of cut-offs (50, 60, 65, ..., 90) the score reaches.
+// Her puan bandının harfi; bant = puanın ulaştığı eşik (50, 60, 65, ..., 90) sayısı.
+static const char band_letters[9][3] = {"FF", "FD", "DD", "DC", "CC", "CB", "BB", "BA", "AA"};
+
+/**
+ * Checks whether a letter belongs to the current scale; legacy files also carry A-, B+ style letters.
+ * Bir harfin geçerli ölçekte olup olmadığını kontrol eder; eski dosyalarda A-, B+ gibi harfler de bulunur.
+ * * @param letter - Letter grade
+ * @param letter - Harf notu
+ * @return 1 if it is one of FF ... AA, 0 otherwise
+ * @return FF ... AA'dan biriyse 1, değilse 0 döner
+ */
+static int is_scale_letter(const char *letter) {
+    int band;
+    for (band = 0; band < 9; band++) {
+        if (strcmp(letter, band_letters[band]) == 0) return 1;
+    }
+    return 0;
+}
+
+#define LETTER_BATCH 256
+
+/**
+ * Computes the letter band (0 = FF ... 8 = AA) of each score with branch-free comparisons.
+ * Her puanın harf bandını (0 = FF ... 8 = AA) dallanmasız karşılaştırmalarla hesaplar.
+ */
+static void score_bands(const float *x, unsigned char *band, int n) {
+    int j;
+    for (j = 0; j < n; j++) {
+        band[j] = (unsigned char)((x[j] >= 50.0f) + (x[j] >= 60.0f) + (x[j] >= 65.0f) + (x[j] >= 70.0f) +
+                                  (x[j] >= 75.0f) + (x[j] >= 80.0f) + (x[j] >= 85.0f) + (x[j] >= 90.0f));
+    }
+}
+
+/**
+ * Returns the letter band of one score (0 = FF ... 8 = AA), matching numeric_to_letter.
+ * Tek bir puanın harf bandını döner (0 = FF ... 8 = AA); numeric_to_letter ile aynıdır.
+ * * @param numeric - Score (0-100)
+ * @param numeric - Puan (0-100)
+ * @return Band index
+ * @return Bant indeksi
+ */
+int numeric_to_band(float numeric) {
+    unsigned char band;
+    score_bands(&numeric, &band, 1);
+    return band;
+}
+
+/**
+ * Returns the letter grade of a band.
+ * Bir bandın harf notunu döner.
+ * * @param band - Band index (0 = FF ... 8 = AA)
+ * @param band - Bant indeksi (0 = FF ... 8 = AA)
+ * @return Letter grade, "?" for an invalid band
+ * @return Harf notu, geçersiz bantta "?"
+ */
+const char* band_letter(int band) {
+    return (band >= 0 && band < GRADE_BANDS) ? band_letters[band] : "?";
+}
+
+/**
+ * Converts many numeric scores to letter grades at once. Bands are computed with branch-free
+ * comparisons over a contiguous block (vectorized by the compiler); gives the same letters as numeric_to_letter.
+ * Birçok sayısal puanı tek seferde harf notuna çevirir. Bantlar bitişik bir blok üzerinde dallanmasız
+ * karşılaştırmalarla hesaplanır (derleyici vektörleştirir); numeric_to_letter ile aynı harfleri verir.
+ * * @param numeric - Contiguous array of scores
+ * @param numeric - Bitişik puan dizisi
+ * @param letters - Receives one letter grade per score
+ * @param letters - Her puan için bir harf notu alır
+ * @param count - Number of scores
+ * @param count - Puan sayısı
+ */
+void numeric_to_letter_batch(const float *numeric, char (*letters)[5], int count) {
+    unsigned char band[LETTER_BATCH];
+    int base, j;
+
+    for (base = 0; base < count; base += LETTER_BATCH) {
+        int n = (count - base < LETTER_BATCH) ? count - base : LETTER_BATCH;
+        score_bands(numeric + base, band, n);
+        for (j = 0; j < n; j++) memcpy(letters[base + j], band_letters[band[j]], 3);
+    }
+}
+
+// ===============================================
+// ID SEQUENCE (ID DİZİSİ)
+// ===============================================
+
+// Next grade ID to hand out; seeded at load, persisted on save and never moved backwards.
+// Verilecek sonraki not ID'si; yüklemede belirlenir, kaydederken saklanır ve asla geri gitmez.
+static int grade_sequence = 1;
+
+/**
+ * Moves the sequence past an ID that is now in use.
+ * Diziyi kullanımdaki bir ID'nin ötesine taşır.
+ * * @param id - ID of a grade added or loaded into the list
+ * @param id - Listeye eklenen veya yüklenen not ID'si
+ */
+static void reserve_grade_id(int id) {
+    int seen = grade_sequence;
+    // get_next_grade_id diziyi eş zamanlı artırabilir; değer yalnızca CAS ile ileri alınır
+    while (id >= seen) {
+        int prior = __sync_val_compare_and_swap(&grade_sequence, seen, id + 1);
+        if (prior == seen) break;
+        seen = prior;
+    }
+}
+
+// ===============================================
+// CRUD - CREATE
+// ===============================================
+
+/**
+ * Adds a new grade record to the list and automatically calculates the letter grade.
+ * Listeye yeni bir not kaydı ekler ve harf notunu otomatik olarak hesaplar.
+ * * @param head_ptr - Double pointer to the head of the grade list
+ * @param head_ptr - Not listesinin başına işaret eden çift kademeli pointer
+ * @param new_data - Pointer to the structure containing new grade data
+ * @param new_data - Yeni not verilerini içeren yapıya işaret eden pointer
+ * @return 1 if successful, 0 if validation fails or ID already exists
+ * @return Başarılıysa 1, doğrulama başarısızsa veya ID zaten varsa 0 döner
+ */
+int add_grade(Grade **head_ptr, const Grade *new_data) {
+    if (new_data == NULL) {
+        printf("Error: Invalid grade data!\n");
+        return 0;
+    }
+    
+    // Validasyon
+    if (!validate_positive_int(new_data->id)) {
+        printf("Error: Grade ID must be positive!\n");
+        return 0;
+    }
+    
+    if (new_data->numeric_grade < 0.0 || new_data->numeric_grade > 100.0) {
+        printf("Error: Numeric grade must be between 0 and 100!\n");
+        return 0;
+    }
+    
+    // Aynı ID var mı
+    if (grade_id_exists(new_data->id)) {
+        printf("Error: Grade with ID %d already exists!\n", new_data->id);
+        return 0;
+    }
+    
+    // Yeni node
+    Grade *new_node = (Grade *)malloc(sizeof(Grade));
+    if (new_node == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+    
+    // Verileri kopyala
+    new_node->id = new_data->id;
+    new_node->enrollment_id = new_data->enrollment_id;
+    new_node->student_id = new_data->student_id;
+    new_node->course_id = new_data->course_id;
+    new_node->numeric_grade = new_data->numeric_grade;
+    strcpy(new_node->semester, new_data->semester);
+    
+    // Harf notunu otomatik hesapla
+    numeric_to_letter(new_data->numeric_grade, new_node->letter_grade);
+    
+    
+    // Listeye ekle (son düğüm tutulur; yürüme yok)
+    append_grade_node(head_ptr, new_node);
+    link_grade(new_node);
+    reserve_grade_id(new_node->id);
+    
+    printf("Success: Grade added (%.2f -> %s)!\n", 
+           new_data->numeric_grade, new_node->letter_grade);
+    return 1;
+}
+
+// ===============================================
+// CRUD - READ
+// ===============================================
+
+/**
+ * Finds a specific grade record using its unique ID.
+ * Benzersiz ID'sini kullanarak belirli bir not kaydını bulur.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ * @param id - The unique identifier of the grade to find
+ * @param id - Bulunacak notun benzersiz tanımlayıcısı
+ * @return Pointer to the grade node if found, NULL otherwise
+ * @return Not düğümü bulunursa adresi, aksi takdirde NULL döner
+ */
+Grade* find_grade_by_id(Grade *head, int id) {
+    if (head == NULL) return NULL;
+    return (Grade *)id_index_find(&grade_id_index, id);
+}
+
+/**
+ * Searches for a grade record associated with a specific enrollment.
+ * Belirli bir kayıtla (enrollment) ilişkili not kaydını arar.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ * @param enrollment_id - The ID of the enrollment record
+ * @param enrollment_id - Kayıt (enrollment) kaydının ID'si
+ * @return Pointer to the grade node or NULL
+ * @return Not düğümü adresi veya NULL döner
+ */
+Grade* find_grade_by_enrollment(Grade *head, int enrollment_id) {
+    Grade *current = head;
+    
+    while (current != NULL) {
+        if (current->enrollment_id == enrollment_id) {
+            return current;
+        }
+        current = current->next;
+    }
+    
+    return NULL;
+}
+
+/**
+ * Retrieves the grade for a specific student in a specific course.
+ * Belirli bir öğrencinin belirli bir kurstaki notunu getirir.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ * @param student_id - ID of the student
+ * @param student_id - Öğrencinin ID'si
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ * @return Pointer to the matched grade or NULL
+ * @return Eşleşen notun adresi veya NULL döner
+ */
+Grade* find_student_course_grade(Grade *head, int student_id, int course_id) {
+    Student *s = get_student_by_id(student_id);
+    Grade *current = (s != NULL) ? s->first_grade : head;
+    
+    while (current != NULL) {
+        if (current->student_id == student_id && current->course_id == course_id) {
+            return current;
+        }
+        current = (s != NULL) ? current->next_by_student : current->next;
+    }
+    
+    return NULL;
+}
+
+// ===============================================
+// CRUD - UPDATE
+// ===============================================
+
+/**
+ * Updates the numeric and letter grade of an existing record.
+ * Mevcut bir kaydın sayısal ve harf notunu günceller.
+ * * @param grade_to_update - Pointer to the grade node to modify
+ * @param grade_to_update - Değiştirilecek not düğümüne işaret eden pointer
+ * @param new_numeric - The new numeric grade value
+ * @param new_numeric - Yeni sayısal not değeri
+ * @param new_letter - Optional new letter grade (if NULL, it's auto-calculated)
+ * @param new_letter - İsteğe bağlı yeni harf notu (NULL ise otomatik hesaplanır)
+ * @return 1 if successful, 0 otherwise
+ * @return Başarılıysa 1, aksi takdirde 0 döner
+ */
+int update_grade(Grade *grade_to_update, float new_numeric, const char *new_letter) {
+    if (grade_to_update == NULL) {
+        printf("Error: Invalid grade!\n");
+        return 0;
+    }
+    
+    if (new_numeric < 0.0 || new_numeric > 100.0) {
+        printf("Error: Numeric grade must be between 0 and 100!\n");
+        return 0;
+    }
+    
+    set_grade_score(grade_to_update, new_numeric);
+    
+    // Eğer harf notu verilmediyse otomatik hesapla
+    if (new_letter == NULL || strlen(new_letter) == 0) {
+        numeric_to_letter(new_numeric, grade_to_update->letter_grade);
+    } else {
+        strcpy(grade_to_update->letter_grade, new_letter);
+    }
+    snapshot_touch();
+    
+    printf("Success: Grade updated to %.2f (%s)!\n", 
+           new_numeric, grade_to_update->letter_grade);
+    return 1;
+}
+
+// ===============================================
+// BULK GRADE IMPORT (TOPLU NOT YÜKLEME)
+// ===============================================
+
+// One parsed row of a grade sheet.
+// Not çizelgesinin ayrıştırılmış bir satırı.
+typedef struct GradeImportRow {
+    int line;
+    int student_id;
+    int course_id;
+    float numeric;
+} GradeImportRow;
+
+/**
+ * Orders sheet rows by course, then file line, so later rows of the same student win.
+ * Çizelge satırlarını derse, sonra dosya satırına göre sıralar; aynı öğrencinin sonraki satırı geçerli olur.
+ */
+static int compare_import_rows(const void *a, const void *b) {
+    const GradeImportRow *x = (const GradeImportRow *)a;
+    const GradeImportRow *y = (const GradeImportRow *)b;
+    if (x->course_id != y->course_id) return (x->course_id < y->course_id) ? -1 : 1;
+    return x->line - y->line;
+}
+
+/**
+ * Posts a grade sheet (student_id,course_id,numeric rows; header optional) in one pass.
+ * Each course's enrollments and grades are indexed by student once, rows are upserted on the
+ * (student, course) key, letters are converted in one batch and every affected student's GPA is
+ * recomputed once at the end instead of after every grade.
+ * Bir not çizelgesini (student_id,course_id,numeric satırları; başlık isteğe bağlı) tek geçişte işler.
+ * Her dersin kayıtları ve notları öğrenciye göre bir kez indekslenir, satırlar (öğrenci, ders) anahtarıyla
+ * eklenir ya da güncellenir, harfler tek seferde çevrilir ve etkilenen her öğrencinin GPA'i
+ * her nottan sonra değil, sonda bir kez hesaplanır.
+ * * @param head_ptr - Double pointer to the head of the grade list
+ * @param head_ptr - Not listesinin başına işaret eden çift kademeli pointer
+ * @param c_head - Head of the course list (for GPA credits)
+ * @param c_head - Kurs listesinin başı (GPA kredileri için)
+ * @param filename - Grade sheet path
+ * @param filename - Not çizelgesinin yolu
+ * @param course_id - Only accept rows of this course (0 accepts any course)
+ * @param course_id - Yalnızca bu dersin satırlarını kabul et (0 her dersi kabul eder)
+ * @param summary - Receives the row counts (may be NULL)
+ * @param summary - Satır sayılarını alır (NULL olabilir)
+ * @return 1 if the sheet was processed, 0 if it cannot be read
+ * @return Çizelge işlendiyse 1, okunamazsa 0 döner
+ */
+int import_grades_from_csv(Grade **head_ptr, Course *c_head, const char *filename, int course_id,
+                           GradeImportSummary *summary) {
+    FILE *file = fopen(filename, "r");
+    GradeImportSummary result = {0, 0, 0, 0, 0};
+    (void)c_head;
+    if (file == NULL) {
+        printf("Error: Could not open %s!\n", filename);
+        return 0;
+    }
+
+    int capacity = 512, n = 0, line_no = 0, i, j;
+    GradeImportRow *rows = (GradeImportRow *)malloc(capacity * sizeof(GradeImportRow));
+    char line[256];
+    char *tokens[4];
+
+    while (rows != NULL && fgets(line, sizeof(line), file)) {
+        line_no++;
+        remove_newline(line);
+        trim_whitespace(line);
+        if (line[0] == '\0') continue;
+        if (line_no == 1 && !isdigit((unsigned char)line[0])) continue;   // Başlık satırı
+        result.rows++;
+
+        if (split_csv_line(line, tokens, 3) < 3) {
+            printf("Error: Line %d: expected student_id,course_id,numeric.\n", line_no);
+            result.rejected++;
+            continue;
+        }
+        float value = (float)atof(tokens[2]);
+        int row_course = atoi(tokens[1]);
+        if (value < 0.0 || value > 100.0) {
+            printf("Error: Line %d: numeric grade must be between 0 and 100.\n", line_no);
+            result.rejected++;
+            continue;
+        }
+        if (course_id > 0 && row_course != course_id) {
+            printf("Error: Line %d: row belongs to course %d, not %d.\n", line_no, row_course, course_id);
+            result.rejected++;
+            continue;
+        }
+        if (n == capacity) {
+            GradeImportRow *grown = (GradeImportRow *)realloc(rows, capacity * 2 * sizeof(GradeImportRow));
+            if (grown == NULL) {
+                printf("Error: Memory allocation failed; rows after line %d skipped.\n", line_no - 1);
+                break;
+            }
+            rows = grown;
+            capacity *= 2;
+        }
+        rows[n].line = line_no;
+        rows[n].student_id = atoi(tokens[0]);
+        rows[n].course_id = row_course;
+        rows[n].numeric = value;
+        n++;
+    }
+    fclose(file);
+
+    char (*letters)[5] = (char (*)[5])malloc((n > 0 ? n : 1) * sizeof(*letters));
+    float *sorted = (float *)malloc((n > 0 ? n : 1) * sizeof(float));
+    int *touched = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    if (rows == NULL || letters == NULL || sorted == NULL || touched == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(rows); free(letters); free(sorted); free(touched);
+        return 0;
+    }
+
+    // Satırlar derse göre gruplanır; puanlar aynı sırayla bitişik bir diziye alınıp tek seferde harfe çevrilir
+    qsort(rows, n, sizeof(GradeImportRow), compare_import_rows);
+    for (i = 0; i < n; i++) sorted[i] = rows[i].numeric;
+    numeric_to_letter_batch(sorted, letters, n);
+
+    IdIndex enrolled = {NULL, 0, 0};
+    IdIndex graded = {NULL, 0, 0};
+    IdIndex seen_students = {NULL, 0, 0};
+    int touched_count = 0;
+
+    // Satırlar yalnızca dönem toplamlarını günceller; GPA'ler sonda tek geçişte hesaplanır
+    student_defer_gpa(1);
+    for (i = 0; i < n; i = j) {
+        int cid = rows[i].course_id;
+        Course *c = get_course_by_id(cid);
+        for (j = i; j < n && rows[j].course_id == cid; j++);
+        if (c == NULL) {
+            printf("Error: Course %d not found; %d row(s) skipped.\n", cid, j - i);
+            result.rejected += j - i;
+            continue;
+        }
+
+        // Dersin kayıt ve not zincirleri öğrenciye göre bir kez indekslenir
+        Enrollment *e;
+        Grade *g;
+        for (e = c->first_enrollment; e != NULL; e = e->next_by_course) {
+            if (strcmp(e->status, "Enrolled") == 0 || strcmp(e->status, "Completed") == 0) {
+                id_index_insert(&enrolled, e->student_id, e);
+            }
+        }
+        for (g = c->first_grade; g != NULL; g = g->next_by_course) {
+            if (id_index_find(&graded, g->student_id) == NULL) id_index_insert(&graded, g->student_id, g);
+        }
+
+        int k;
+        for (k = i; k < j; k++) {
+            int sid = rows[k].student_id;
+            e = (Enrollment *)id_index_find(&enrolled, sid);
+            if (e == NULL) {
+                printf("Error: Line %d: student %d is not enrolled in course %d.\n", rows[k].line, sid, cid);
+                result.rejected++;
+                continue;
+            }
+            g = (Grade *)id_index_find(&graded, sid);
+            if (g != NULL) {
+                set_grade_score(g, sorted[k]);
+                memcpy(g->letter_grade, letters[k], 3);
+                result.updated++;
+            } else {
+                g = (Grade *)malloc(sizeof(Grade));
+                if (g == NULL) {
+                    printf("Error: Memory allocation failed!\n");
+                    result.rejected++;
+                    continue;
+                }
+                g->id = get_next_grade_id(*head_ptr);
+                g->enrollment_id = e->id;
+                g->student_id = sid;
+                g->course_id = cid;
+                g->numeric_grade = sorted[k];
+                memcpy(g->letter_grade, letters[k], 3);
+                strcpy(g->semester, e->semester);
+                append_grade_node(head_ptr, g);
+                link_grade(g);
+                reserve_grade_id(g->id);
+                id_index_insert(&graded, sid, g);
+                result.inserted++;
+            }
+            if (id_index_find(&seen_students, sid) == NULL) {
+                id_index_insert(&seen_students, sid, g);
+                touched[touched_count++] = sid;
+            }
+        }
+        id_index_clear(&enrolled);
+        id_index_clear(&graded);
+    }
+    student_defer_gpa(0);
+    id_index_clear(&seen_students);
+    snapshot_touch();
+
+    // GPA'ler sonda, etkilenen her öğrenci için bir kez hesaplanır
+    for (i = 0; i < touched_count; i++) {
+        Student *s = get_student_by_id(touched[i]);
+        if (s != NULL) student_set_gpa(s, student_cumulative_gpa(s, TERM_LATEST));
+    }
+    result.students_updated = touched_count;
+
+    printf("Success: Imported %d grade rows: %d added, %d updated, %d rejected; %d GPA(s) recomputed.\n",
+           result.rows, result.inserted, result.updated, result.rejected, result.students_updated);
+    if (summary != NULL) *summary = result;
+    free(rows); free(letters); free(sorted); free(touched);
+    return 1;
+}
+
+// ===============================================
+// COURSE CURVE (DERS EĞRİSİ)
+// ===============================================
+
+/**
+ * qsort comparator for floats (ascending).
+ * Float değerler için qsort karşılaştırıcısı (artan).
+ */
+static int compare_floats(const void *a, const void *b) {
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Mean and population standard deviation of a contiguous score buffer.
+ * Bitişik bir puan tamponunun ortalaması ve popülasyon standart sapması.
+ */
+static void score_moments(const float *x, int n, float *mean, float *stddev) {
+    double sum = 0.0, sum_sq = 0.0;
+    int i;
+    for (i = 0; i < n; i++) {
+        sum += x[i];
+        sum_sq += (double)x[i] * x[i];
+    }
+    double m = (n > 0) ? sum / n : 0.0;
+    double var = (n > 0) ? sum_sq / n - m * m : 0.0;
+    *mean = (float)m;
+    *stddev = (float)((var > 0.0) ? sqrt(var) : 0.0);
+}
+
+/**
+ * Score at a percentile (0-100) of a buffer, interpolating between neighbours; sorts a copy.
+ * Bir tamponun yüzdelik dilimindeki (0-100) puan, komşular arasında enterpolasyonla; bir kopyayı sıralar.
+ */
+static float score_percentile(const float *x, int n, float percentile) {
+    float *sorted = (float *)malloc((n > 0 ? n : 1) * sizeof(float));
+    float result = 0.0f;
+    if (sorted == NULL || n == 0) {
+        free(sorted);
+        return 0.0f;
+    }
+    memcpy(sorted, x, n * sizeof(float));
+    qsort(sorted, n, sizeof(float), compare_floats);
+    if (percentile < 0.0f) percentile = 0.0f;
+    if (percentile > 100.0f) percentile = 100.0f;
+    float rank = percentile / 100.0f * (n - 1);
+    int lower = (int)rank;
+    int upper = (lower + 1 < n) ? lower + 1 : lower;
+    result = sorted[lower] + (rank - lower) * (sorted[upper] - sorted[lower]);
+    free(sorted);
+    return result;
+}
+
+/**
+ * Counts how many scores fall into each letter band.
+ * Her harf bandına kaç puan düştüğünü sayar.
+ */
+static void count_bands(const float *x, unsigned char *band, int n, int counts[GRADE_BANDS]) {
+    int i;
+    memset(counts, 0, GRADE_BANDS * sizeof(int));
+    score_bands(x, band, n);
+    for (i = 0; i < n; i++) counts[band[i]]++;
+}
+
+/**
+ * Curves every grade of a course in one pass: scores are gathered into a contiguous buffer, the
+ * moments or percentile the method needs are computed, one linear transform (clamped to 0-100)
+ * and the letter conversion run over the whole buffer, and each affected student's GPA is
+ * recomputed once. With dry_run only the report is filled; no grade changes.
+ * Bir dersin tüm notlarına tek geçişte eğri uygular: puanlar bitişik bir tampona alınır, yöntemin
+ * gerektirdiği momentler veya yüzdelik hesaplanır, tek bir doğrusal dönüşüm (0-100 ile sınırlı) ve
+ * harf çevirimi tüm tampon üzerinde çalışır ve etkilenen her öğrencinin GPA'i bir kez hesaplanır.
+ * dry_run ile yalnızca rapor doldurulur; hiçbir not değişmez.
+ * * @param c_head - Head of the course list (for GPA credits)
+ * @param c_head - Kurs listesinin başı (GPA kredileri için)
+ * @param course_id - Course to curve
+ * @param course_id - Eğri uygulanacak ders
+ * @param spec - Method and its parameters
+ * @param spec - Yöntem ve parametreleri
+ * @param dry_run - 1 to preview the new distribution without writing it
+ * @param dry_run - Yeni dağılımı yazmadan önizlemek için 1
+ * @param report - Receives the before/after distribution
+ * @param report - Önceki/sonraki dağılımı alır
+ * @return 1 if successful, 0 if the course is missing, has no grades or the spec is invalid
+ * @return Başarılıysa 1, ders yoksa, notu yoksa veya tanım geçersizse 0 döner
+ */
+int curve_course_grades(Course *c_head, int course_id, const CurveSpec *spec, int dry_run, CurveReport *report) {
+    Course *c = get_course_by_id(course_id);
+    Grade *g;
+    int n = 0, i;
+
+    memset(report, 0, sizeof(CurveReport));
+    if (c == NULL) {
+        printf("Error: Course not found!\n");
+        return 0;
+    }
+    for (g = c->first_grade; g != NULL; g = g->next_by_course) n++;
+    if (n == 0) {
+        printf("Error: Course %s has no grades to curve.\n", c->code);
+        return 0;
+    }
+
+    Grade **rows = (Grade **)malloc(n * sizeof(Grade *));
+    float *scores = (float *)malloc(n * sizeof(float));
+    float *curved = (float *)malloc(n * sizeof(float));
+    unsigned char *band = (unsigned char *)malloc(n);
+    char (*letters)[5] = (char (*)[5])malloc(n * sizeof(*letters));
+    if (rows == NULL || scores == NULL || curved == NULL || band == NULL || letters == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(rows); free(scores); free(curved); free(band); free(letters);
+        return 0;
+    }
+    for (g = c->first_grade, i = 0; g != NULL; g = g->next_by_course, i++) {
+        rows[i] = g;
+        scores[i] = g->numeric_grade;
+    }
+
+    report->count = n;
+    report->slope = 1.0f;
+    score_moments(scores, n, &report->old_mean, &report->old_stddev);
+    switch (spec->method) {
+        case CURVE_SHIFT:
+            report->offset = spec->amount;
+            break;
+        case CURVE_SCALE_TO_MEAN:
+            if (report->old_mean <= 0.0f || spec->amount < 0.0f || spec->amount > 100.0f) {
+                printf("Error: Target mean must be 0-100 and the course mean above 0.\n");
+                free(rows); free(scores); free(curved); free(band); free(letters);
+                return 0;
+            }
+            report->slope = spec->amount / report->old_mean;
+            break;
+        case CURVE_PERCENTILE:
+            report->pivot = score_percentile(scores, n, spec->percentile);
+            report->offset = (spec->amount > report->pivot) ? spec->amount - report->pivot : 0.0f;
+            break;
+        default:
+            printf("Error: Unknown curve method!\n");
+            free(rows); free(scores); free(curved); free(band); free(letters);
+            return 0;
+    }
+
+    // Tek doğrusal dönüşüm, dallanmasız sınırlama ile tüm tampona uygulanır
+    float slope = report->slope, offset = report->offset;
+    for (i = 0; i < n; i++) {
+        float y = slope * scores[i] + offset;
+        y = (y < 0.0f) ? 0.0f : y;
+        curved[i] = (y > 100.0f) ? 100.0f : y;
+    }
+    score_moments(curved, n, &report->new_mean, &report->new_stddev);
+    count_bands(scores, band, n, report->before);
+    count_bands(curved, band, n, report->after);
+
+    if (!dry_run) {
+        IdIndex seen_students = {NULL, 0, 0};
+        numeric_to_letter_batch(curved, letters, n);
+        for (i = 0; i < n; i++) {
+            set_grade_score(rows[i], curved[i]);
+            memcpy(rows[i]->letter_grade, letters[i], 3);
+        }
+        snapshot_touch();
+        for (i = 0; i < n; i++) {
+            int sid = rows[i]->student_id;
+            if (id_index_find(&seen_students, sid) != NULL) continue;
+            id_index_insert(&seen_students, sid, rows[i]);
+            Student *s = get_student_by_id(sid);
+            if (s != NULL) student_set_gpa(s, calculate_student_gpa(sid, NULL, c_head));
+            report->students_updated++;
+        }
+        id_index_clear(&seen_students);
+        report->applied = 1;
+        printf("Success: Curved %d grades of %s; %d GPA(s) recomputed.\n", n, c->code, report->students_updated);
+    }
+
+    free(rows); free(scores); free(curved); free(band); free(letters);
+    return 1;
+}
+
+/**
+ * Prints the transform and the before/after letter distribution of a curve.
+ * Bir eğrinin dönüşümünü ve önceki/sonraki harf dağılımını yazdırır.
+ * * @param report - Report filled by curve_course_grades
+ * @param report - curve_course_grades tarafından doldurulan rapor
+ */
+void display_curve_report(const CurveReport *report) {
+    int b;
+    printf("\n========================================\n");
+    printf("   COURSE CURVE %s\n", report->applied ? "(APPLIED)" : "(PREVIEW)");
+    printf("========================================\n");
+    printf("Grades:        %d\n", report->count);
+    printf("Transform:     new = %.3f x old %+.2f (0-100)\n", report->slope, report->offset);
+    printf("Mean:          %.2f -> %.2f\n", report->old_mean, report->new_mean);
+    printf("Std. Dev.:     %.2f -> %.2f\n", report->old_stddev, report->new_stddev);
+    printf("----------------------------------------\n");
+    printf("%-8s %8s %8s\n", "Letter", "Before", "After");
+    for (b = GRADE_BANDS - 1; b >= 0; b--) {
+        printf("%-8s %8d %8d\n", band_letters[b], report->before[b], report->after[b]);
+    }
+    printf("========================================\n");
+}
+
+// ===============================================
+// CRUD - DELETE
+// ===============================================
+
+/**
+ * Removes a grade record from the list by its ID.
+ * Bir not kaydını ID'sine göre listeden kaldırır.
+ * * @param head_ptr - Double pointer to the head of the grade list
+ * @param head_ptr - Not listesinin başına işaret eden çift kademeli pointer
+ * @param id - The unique ID of the grade to delete
+ * @param id - Silinecek notun benzersiz ID'si
+ * @return 1 if successfully deleted, 0 if not found
+ * @return Başarıyla silindiyse 1, bulunamadıysa 0 döner
+ */
+int delete_grade(Grade **head_ptr, int id) {
+    if (*head_ptr == NULL) {
+        printf("Error: Grade list is empty!\n");
+        return 0;
+    }
+    
+    Grade *current = find_grade_by_id(*head_ptr, id);
+    if (current == NULL) {
+        printf("Error: Grade with ID %d not found!\n", id);
+        return 0;
+    }
+    
+    remove_grade_node(head_ptr, current);
+    printf("Success: Grade with ID %d deleted.\n", id);
+    return 1;
+}
+
+/**
+ * Deletes every grade of a student by walking the student's chain (O(k), no table scan).
+ * Bir öğrencinin tüm notlarını öğrenci zinciri üzerinden siler (O(k), tablo taranmaz).
+ * * @param head_ptr - Double pointer to the head of the grade list
+ * @param head_ptr - Not listesinin başına işaret eden çift kademeli pointer
+ * @param student_id - ID of the student
+ * @param student_id - Öğrencinin ID'si
+ * @return Number of deleted grades
+ * @return Silinen not sayısı
+ */
+int delete_student_grades(Grade **head_ptr, int student_id) {
+    Student *s = get_student_by_id(student_id);
+    int count = 0;
+    if (s == NULL) return 0;
+    while (s->first_grade != NULL) {
+        remove_grade_node(head_ptr, s->first_grade);
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Deletes every grade of a course by walking the course's chain.
+ * Bir kursun tüm notlarını kurs zinciri üzerinden siler.
+ * * @param head_ptr - Double pointer to the head of the grade list
+ * @param head_ptr - Not listesinin başına işaret eden çift kademeli pointer
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ * @return Number of deleted grades
+ * @return Silinen not sayısı
+ */
+int delete_course_grades(Grade **head_ptr, int course_id) {
+    Course *c = get_course_by_id(course_id);
+    int count = 0;
+    if (c == NULL) return 0;
+    while (c->first_grade != NULL) {
+        remove_grade_node(head_ptr, c->first_grade);
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Deletes every grade of a semester in one pass over the list (used when the semester is archived).
+ * Bir dönemin tüm notlarını liste üzerinde tek geçişte siler (dönem arşivlenirken kullanılır).
+ * * @param head_ptr - Double pointer to the head of the grade list
+ * @param head_ptr - Not listesinin başına işaret eden çift kademeli pointer
+ * @param semester - Semester string
+ * @param semester - Dönem dizgisi
+ * @return Number of deleted grades
+ * @return Silinen not sayısı
+ */
+int delete_semester_grades(Grade **head_ptr, const char *semester) {
+    Grade *current = *head_ptr;
+    int count = 0;
+    while (current != NULL) {
+        Grade *next = current->next;
+        if (strcmp(current->semester, semester) == 0) {
+            remove_grade_node(head_ptr, current);
+            count++;
+        }
+        current = next;
+    }
+    return count;
+}
+
+/**
+ * Deletes the grades recorded for one enrollment, searching only the student's chain.
+ * Bir kayda ait notları yalnızca öğrencinin zincirinde arayarak siler.
+ * * @param head_ptr - Double pointer to the head of the grade list
+ * @param head_ptr - Not listesinin başına işaret eden çift kademeli pointer
+ * @param student_id - Student of the enrollment
+ * @param student_id - Kaydın öğrencisi
+ * @param enrollment_id - ID of the enrollment
+ * @param enrollment_id - Kaydın ID'si
+ * @return Number of deleted grades
+ * @return Silinen not sayısı
+ */
+int delete_enrollment_grades(Grade **head_ptr, int student_id, int enrollment_id) {
+    Student *s = get_student_by_id(student_id);
+    int count = 0;
+    if (s == NULL) return 0;
+
+    Grade *g = s->first_grade;
+    while (g != NULL) {
+        Grade *next = g->next_by_student;
+        if (g->enrollment_id == enrollment_id) {
+            remove_grade_node(head_ptr, g);
+            count++;
+        }
+        g = next;
+    }
+    return count;
+}
+
+// ===============================================
+// FILE OPERATIONS
+// ===============================================
+
+/**
+ * Loads grade data from the CSV file into the linked list.
+ * CSV dosyasındaki not verilerini bağlı listeye yükler.
+ * * @param head_ptr - Double pointer to receive the head of the list
+ * @param head_ptr - Listenin başını alacak çift kademeli pointer
+ * @return 1 if successful, 0 if file cannot be opened
+ * @return Başarılıysa 1, dosya açılamazsa 0 döner
+ */
+int load_grades_from_csv(Grade **head_ptr) {
+    const char *filename = "data/grades.csv";
+    FILE *file = fopen(filename, "r");
+    
+    if (file == NULL) {
+    	filename = "grades.csv";
+        file = fopen(filename, "r");
+        if (file == NULL) {
+            printf("Warning: Could not open grades.csv. Starting empty.\n");
+            return 0;
+        }
+    }
+    
+    char line[512];
+    char *tokens[10];
+    int count = 0, legacy = 0;
+    
+    fgets(line, sizeof(line), file);
+    
+    while (fgets(line, sizeof(line), file)) {
+        remove_newline(line);
+        
+        int token_count = split_csv_line(line, tokens, 7);
+        
+        if (token_count >= 7 && !archive_is_frozen(tokens[6])) {
+            Grade temp;
+            
+            temp.id = atoi(tokens[0]);
+            temp.enrollment_id = atoi(tokens[1]);
+            temp.student_id = atoi(tokens[2]);
+            temp.course_id = atoi(tokens[3]);
+            strcpy(temp.letter_grade, tokens[4]);
+            temp.numeric_grade = atof(tokens[5]);
+            strcpy(temp.semester, tokens[6]);
+            // Eski ölçekteki harfler (A-, B+ ...) sayısal nottan yeniden türetilir; sayısal not esastır
+            if (!is_scale_letter(temp.letter_grade)) {
+                numeric_to_letter(temp.numeric_grade, temp.letter_grade);
+                legacy++;
+            }
+            
+            Grade *new_node = (Grade *)malloc(sizeof(Grade));
+            if (new_node) {
+                *new_node = temp;
+                append_grade_node(head_ptr, new_node);
+                link_grade(new_node);
+                reserve_grade_id(new_node->id);
+                count++;
+            }
+        }
+    }
+    
+    fclose(file);
+    grade_sequence = load_sequence("grades", grade_sequence);
+    printf("Success: Loaded %d grades from CSV.\n", count);
+    if (legacy > 0) printf("Note: %d legacy letter grade(s) re-derived from their numeric scores.\n", legacy);
+    return 1;
+}
+
+/**
+ * Saves all current grade records to a specified CSV file.
+ * Mevcut tüm not kayıtlarını belirtilen bir CSV dosyasına kaydeder.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ * @param filename - String containing the destination file path
+ * @param filename - Hedef dosya yolunu içeren dizgi
+ * @return 1 if successful, 0 otherwise
+ * @return Başarılıysa 1, aksi takdirde 0 döner
+ */
+int save_grades_to_csv(Grade *head, const char *filename) {
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) {
+        printf("Error: Could not open file for writing!\n");
+        return 0;
+    }
+    
+    fprintf(file, "grade_id,enrollment_id,student_id,course_id,letter_grade,numeric_grade,semester\n");
+    
+    Grade *current = head;
+    int count = 0;
+    
+    while (current != NULL) {
+        fprintf(file, "%d,%d,%d,%d,%s,%.2f,%s\n",
+                current->id,
+                current->enrollment_id,
+                current->student_id,
+                current->course_id,
+                current->letter_grade,
+                current->numeric_grade,
+                current->semester);
+        current = current->next;
+        count++;
+    }
+    
+    fclose(file);
+    save_sequence("grades", grade_sequence);
+    printf("Success: Saved %d grades to CSV.\n", count);
+    return 1;
+}
+
+// ===============================================
+// DISPLAY OPERATIONS
+// ===============================================
+
+/**
+ * Prints all grades and the numeric average for a specific student.
+ * Belirli bir öğrenci için tüm notları ve sayısal ortalamayı yazdırır.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ * @param student_id - ID of the student
+ * @param student_id - Öğrencinin ID'si
+ */
+void display_student_grades(Grade *head, int student_id) {
+    printf("\n============================================================================\n");
+    printf("  Grades for Student ID: %d\n", student_id);
+    printf("============================================================================\n");
+    printf("%-10s %-10s %-10s %-10s %-15s\n", 
+           "GradeID", "CourseID", "Letter", "Numeric", "Semester");
+    printf("----------------------------------------------------------------------------\n");
+    
+    Student *s = get_student_by_id(student_id);
+    Grade *current = (s != NULL) ? s->first_grade : head;
+    int found = 0;
+    float sum = 0;
+    int count = 0;
+    
+    while (current != NULL) {
+        if (current->student_id == student_id) {
+            printf("%-10d %-10d %-10s %-10.2f %-15s\n",
+                   current->id,
+                   current->course_id,
+                   current->letter_grade,
+                   current->numeric_grade,
+                   current->semester);
+            sum += current->numeric_grade;
+            count++;
+            found = 1;
+        }
+        current = (s != NULL) ? current->next_by_student : current->next;
+    }
+    
+    printf("============================================================================\n");
+    if (found) {
+        printf("Average Numeric Grade: %.2f\n", sum / count);
+    } else {
+        printf("No grades found for this student.\n");
+    }
+    printf("============================================================================\n");
+}
+
+/**
+ * Lists all student grades recorded for a specific course, archived semesters included.
+ * Belirli bir kurs için kaydedilmiş tüm öğrenci notlarını, arşivlenmiş dönemler dahil listeler.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ */
+void display_course_grades(Grade *head, int course_id) {
+    printf("\n============================================================================\n");
+    printf("  Grade Distribution for Course ID: %d\n", course_id);
+    printf("============================================================================\n");
+    printf("%-10s %-10s %-10s %-15s\n", 
+           "StudentID", "Letter", "Numeric", "Semester");
+    printf("----------------------------------------------------------------------------\n");
+    
+    Course *c = get_course_by_id(course_id);
+    Grade *current = (c != NULL) ? c->first_grade : head;
+    int found = 0, a, i;
+    
+    // Arşivlenmiş dönemlerin notları önce
+    for (a = 0; a < archive_count(); a++) {
+        const Grade **rows;
+        int count = archive_course_grades(archive_get(a), course_id, &rows);
+        for (i = 0; i < count; i++) {
+            printf("%-10d %-10s %-10.2f %-15s\n", rows[i]->student_id, rows[i]->letter_grade,
+                   rows[i]->numeric_grade, rows[i]->semester);
+            found = 1;
+        }
+    }
+    while (current != NULL) {
+        if (current->course_id == course_id) {
+            printf("%-10d %-10s %-10.2f %-15s\n",
+                   current->student_id,
+                   current->letter_grade,
+                   current->numeric_grade,
+                   current->semester);
+            found = 1;
+        }
+        current = (c != NULL) ? current->next_by_course : current->next;
+    }
+    
+    if (!found) {
+        printf("No grades found for this course.\n");
+    }
+    
+    printf("============================================================================\n");
+}
+
+/**
+ * Prints a complete table of all grades currently in the system memory.
+ * Sistem belleğindeki tüm notların tam bir tablosunu yazdırır.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ */
+void display_all_grades(Grade *head) {
+    Grade *current;
+    int count = 0;
+    
+    if (head == NULL) {
+        printf("\nNo grades to display.\n");
+        return;
+    }
+    
+    printf("\n=====================================================================\n");
+    printf("                           GRADE LIST                                \n");
+    printf("=====================================================================\n");
+    printf("%-6s %-6s %-8s %-8s %-6s %-7s %-12s\n", 
+           "GrdID", "EnrID", "StudID", "CrsID", "Letter", "Numeric", "Semester");
+    printf("---------------------------------------------------------------------\n");
+    
+    current = head;
+    
+    while (current != NULL) {
+        printf("%-6d %-6d %-8d %-8d %-6.6s %-7.2f %-12.12s\n",
+               current->id,
+               current->enrollment_id,
+               current->student_id,
+               current->course_id,
+               current->letter_grade,
+               current->numeric_grade,
+               current->semester);
+        current = current->next;
+        count++;
+    }
+    
+    printf("=====================================================================\n");
+    printf("Total Grades: %d\n", count);
+    printf("=====================================================================\n");
+}
+
+// ===============================================
+// STATISTICS
+// ===============================================
+
+/**
+ * Returns the mean numeric grade of a course from its distribution sketch, without walking the grades.
+ * Bir dersin ortalama sayısal notunu, notları dolaşmadan dağılım özetinden döner.
+ * * @param head - Pointer to the head of the grade list (unused, kept for API compatibility)
+ * @param head - Not listesinin başına işaret eden pointer (kullanılmaz, API uyumluluğu için)
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ * @return The average numeric score
+ * @return Ortalama sayısal puan
+ */
+float calculate_course_average(Grade *head, int course_id) {
+    GradeSummary summary;
+    (void)head;
+    course_grade_summary(course_id, &summary);
+    return summary.mean;
+}
+
+/**
+ * Shows the count, mean, standard deviation, quartiles, outliers and letter distribution of a course.
+ * Everything is read from the course's distribution sketch, so the cost does not grow with the grades.
+ * Bir dersin not sayısını, ortalamasını, standart sapmasını, çeyreklerini, aykırı değerlerini ve harf
+ * dağılımını gösterir. Hepsi dersin dağılım özetinden okunur; maliyet not sayısıyla artmaz.
+ * * @param head - Pointer to the head of the grade list (unused, kept for API compatibility)
+ * @param head - Not listesinin başına işaret eden pointer (kullanılmaz, API uyumluluğu için)
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ */
+void display_grade_statistics(Grade *head, int course_id) {
+    GradeSummary summary;
+    (void)head;
+
+    printf("\n========================================\n");
+    printf("   Grade Statistics for Course %d\n", course_id);
+    printf("========================================\n");
+
+    if (course_grade_summary(course_id, &summary)) {
+        printf("Total Students: %ld\n", summary.count);
+        printf("Average:        %.2f\n", summary.mean);
+        printf("Std. Deviation: %.2f\n", summary.stddev);
+        printf("Minimum:        %.2f\n", summary.min);
+        printf("Q1:             %.2f\n", summary.q1);
+        printf("Median:         %.2f\n", summary.median);
+        printf("Q3:             %.2f\n", summary.q3);
+        printf("Maximum:        %.2f\n", summary.max);
+        printf("Outliers:       %ld below %.2f, %ld above %.2f\n", summary.outliers_low, summary.lower_fence,
+               summary.outliers_high, summary.upper_fence);
+        printf("----------------------------------------\n");
+        printf("GRADE DISTRIBUTION:\n");
+        printf("AA: %-4ld  BA: %-4ld  BB: %-4ld  CB: %-4ld\n", summary.bands[8], summary.bands[7], summary.bands[6], summary.bands[5]);
+        printf("CC: %-4ld  DC: %-4ld  DD: %-4ld  FD: %-4ld\n", summary.bands[4], summary.bands[3], summary.bands[2], summary.bands[1]);
+        printf("FF: %-4ld\n", summary.bands[0]);
+        if (!summary.exact) printf("(Quartiles within %.2f points: read from a histogram)\n", SKETCH_BIN_WIDTH / 2);
+    } else {
+        printf("No grades recorded for this course.\n");
+    }
+    printf("========================================\n");
+}
+
+/**
+ * Prints a course's distribution summary for each semester it was taught and for all semesters.
+ * Bir dersin dağılım özetini verildiği her dönem ve tüm dönemler için yazdırır.
+ * * @param head - Pointer to the head of the grade list (unused, kept for API compatibility)
+ * @param head - Not listesinin başına işaret eden pointer (kullanılmaz, API uyumluluğu için)
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ */
+void display_grade_distribution(Grade *head, int course_id) {
+    GradeSummary summary;
+    int terms[MAX_COURSE_TERMS];
+    char semester[20];
+    int i, exact = 1;
+    (void)head;
+
+    Course *c = get_course_by_id(course_id);
+    printf("\n=========================================================================================\n");
+    printf("   Grade Distribution for Course %d%s%s\n", course_id, c ? " - " : "", c ? c->code : "");
+    printf("=========================================================================================\n");
+    if (!course_grade_summary(course_id, &summary)) {
+        printf("No grades recorded for this course.\n");
+        printf("=========================================================================================\n");
+        return;
+    }
+    printf("%-14s %6s %6s %6s %6s %6s %6s %6s %6s %9s\n", "Semester", "Grades", "Mean", "StdDev",
+           "Min", "Q1", "Median", "Q3", "Max", "Outliers");
+    printf("-----------------------------------------------------------------------------------------\n");
+    int term_count = course_grade_terms(course_id, terms, MAX_COURSE_TERMS);
+    for (i = 0; i < term_count; i++) {
+        GradeSummary section;
+        section_grade_summary(course_id, terms[i], &section);
+        if (terms[i] == TERM_NONE) strcpy(semester, "(none)");
+        else term_to_semester(terms[i], semester, sizeof(semester));
+        printf("%-14s %6ld %6.2f %6.2f %6.2f %6.2f %6.2f %6.2f %6.2f %9ld\n", semester, section.count, section.mean,
+               section.stddev, section.min, section.q1, section.median, section.q3, section.max,
+               section.outliers_low + section.outliers_high);
+        exact &= section.exact;
+    }
+    printf("-----------------------------------------------------------------------------------------\n");
+    printf("%-14s %6ld %6.2f %6.2f %6.2f %6.2f %6.2f %6.2f %6.2f %9ld\n", "All semesters", summary.count, summary.mean,
+           summary.stddev, summary.min, summary.q1, summary.median, summary.q3, summary.max,
+           summary.outliers_low + summary.outliers_high);
+    printf("=========================================================================================\n");
+    if (!exact || !summary.exact) printf("(Quartiles within %.2f points: read from a histogram)\n", SKETCH_BIN_WIDTH / 2);
+}
+
+// ===============================================
+// TERM RANGE QUERIES (DÖNEM ARALIĞI SORGULARI)
+// ===============================================
+
+static int compare_grade_terms(const void *a, const void *b) {
+    const Grade *x = *(Grade * const *)a;
+    const Grade *y = *(Grade * const *)b;
+    if (x->term != y->term) return (x->term > y->term) - (x->term < y->term);
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+/**
+ * Returns the grades whose term lies in [from_term, to_term], found by binary search in the term index.
+ * Grades of archived semesters are included; those rows are read-only and must not be modified.
+ * The returned run is ordered by term, then ID, and stays valid until the grade list or the archives change.
+ * Dönemi [from_term, to_term] aralığında olan notları dönem indeksinde ikili aramayla bulur.
+ * Arşivlenmiş dönemlerin notları da dahildir; bu satırlar salt okunurdur ve değiştirilmemelidir.
+ * Dönen dizi önce döneme, sonra ID'ye göre sıralıdır ve not listesi veya arşivler değişene kadar geçerlidir.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ * @param from_term - First term ordinal (see semester_to_term)
+ * @param from_term - İlk dönem sıra numarası (bkz. semester_to_term)
+ * @param to_term - Last term ordinal, inclusive
+ * @param to_term - Son dönem sıra numarası (dahil)
+ * @param first - Receives the first matching grade pointer
+ * @param first - İlk eşleşen not pointer'ını alır
+ * @return Number of matching grades (-1 on allocation failure)
+ * @return Eşleşen not sayısı (bellek hatasında -1)
+ */
+int grades_in_term_range(Grade *head, int from_term, int to_term, Grade ***first) {
+    Grade *g;
+    int lo, hi, start;
+
+    if (grade_term_dirty) {
+        int a, j, count = 0;
+        for (g = head; g != NULL; g = g->next) count++;
+        for (a = 0; a < archive_count(); a++) count += archive_get(a)->grade_count;
+        if (count > grade_term_capacity) {
+            Grade **grown = (Grade **)realloc(grade_term_order, count * sizeof(Grade *));
+            if (grown == NULL) {
+                printf("Error: Memory allocation failed!\n");
+                return -1;
+            }
+            grade_term_order = grown;
+            grade_term_capacity = count;
+        }
+        grade_term_count = 0;
+        for (g = head; g != NULL; g = g->next) grade_term_order[grade_term_count++] = g;
+        // Arşivlenmiş dönemlerin notları (salt okunur satırlar)
+        for (a = 0; a < archive_count(); a++) {
+            const SemesterArchive *archive = archive_get(a);
+            for (j = 0; j < archive->grade_count; j++) grade_term_order[grade_term_count++] = (Grade *)&archive->grades[j];
+        }
+        qsort(grade_term_order, grade_term_count, sizeof(Grade *), compare_grade_terms);
+        grade_term_dirty = 0;
+    }
+
+    // İlk term >= from_term
+    lo = 0; hi = grade_term_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (grade_term_order[mid]->term < from_term) lo = mid + 1;
+        else hi = mid;
+    }
+    start = lo;
+    // İlk term > to_term
+    hi = grade_term_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (grade_term_order[mid]->term <= to_term) lo = mid + 1;
+        else hi = mid;
+    }
+    *first = grade_term_order + start;
+    return lo - start;
+}
+
+/**
+ * Marks the term index stale; the archive module calls this when semesters are mapped or unmapped.
+ * Dönem indeksini eskimiş olarak işaretler; arşiv modülü dönemler eşlendiğinde veya kaldırıldığında çağırır.
+ */
+void grade_term_index_invalidate(void) {
+    grade_term_dirty = 1;
+}
+
+/**
+ * Prints per-semester grade counts and score statistics for a range of terms, archived semesters included.
+ * Bir dönem aralığı için dönem başına not sayılarını ve puan istatistiklerini, arşivlenmiş dönemler dahil yazdırır.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ * @param from_term - First term ordinal
+ * @param from_term - İlk dönem sıra numarası
+ * @param to_term - Last term ordinal, inclusive
+ * @param to_term - Son dönem sıra numarası (dahil)
+ */
+void display_term_range_report(Grade *head, int from_term, int to_term) {
+    Grade **rows;
+    char from[20], to[20], semester[20];
+    int i, j, total = 0;
+    int count = grades_in_term_range(head, from_term, to_term, &rows);
+    if (count < 0) return;
+
+    term_to_semester(from_term, from, sizeof(from));
+    term_to_semester(to_term, to, sizeof(to));
+    printf("\n========================================\n");
+    printf("   Grades %s .. %s\n", from, to);
+    printf("========================================\n");
+    printf("%-12s %7s %8s %8s %8s\n", "Semester", "Grades", "Average", "Min", "Max");
+    printf("----------------------------------------------\n");
+    for (i = 0; i < count; i = j) {
+        float sum = 0, min = 100, max = 0;
+        for (j = i; j < count && rows[j]->term == rows[i]->term; j++) {
+            float score = rows[j]->numeric_grade;
+            sum += score;
+            if (score < min) min = score;
+            if (score > max) max = score;
+        }
+        term_to_semester(rows[i]->term, semester, sizeof(semester));
+        printf("%-12s %7d %8.2f %8.2f %8.2f\n", semester, j - i, sum / (j - i), min, max);
+        total += j - i;
+    }
+    if (total == 0) printf("No grades recorded in this range.\n");
+    else printf("----------------------------------------------\nTotal grades: %d\n", total);
+    printf("========================================\n");
+}
+
+// ===============================================
+// ORPHAN CHAINS (YETİM ZİNCİRLER)
+// ===============================================
+
+/**
+ * Moves a deleted student's grade chain into the orphan chains and stops counting its grades;
+ * the caller clears the student's term totals.
+ * Silinen öğrencinin not zincirini yetim zincirlere taşır ve notlarını saymayı bırakır;
+ * öğrencinin dönem toplamlarını çağıran temizler.
+ * * @param s - Student about to be freed
+ * @param s - Serbest bırakılacak öğrenci
+ */
+void grade_detach_student(Student *s) {
+    Grade *g = s->first_grade;
+    while (g != NULL) {
+        Grade *next = g->next_by_student;
+        g->counted_credits = 0;
+        chain_index_append(&orphan_grades_by_student, s->id, g);
+        g = next;
+    }
+    s->first_grade = s->last_grade = NULL;
+}
+
+/**
+ * Moves a deleted course's grade chain into the orphan chains; its grades must already be uncounted.
+ * Silinen kursun not zincirini yetim zincirlere taşır; notları önceden sayımdan çıkarılmış olmalıdır.
+ * * @param c - Course about to be freed
+ * @param c - Serbest bırakılacak kurs
+ */
+void grade_detach_course(Course *c) {
+    Grade *g = c->first_grade;
+    while (g != NULL) {
+        Grade *next = g->next_by_course;
+        chain_index_append(&orphan_grades_by_course, c->id, g);
+        g = next;
+    }
+    c->first_grade = c->last_grade = NULL;
+}
+
+/**
+ * Hands the orphan grades of a student ID back to a newly added student and counts them in its term totals.
+ * Bir öğrenci ID'sinin yetim notlarını yeni eklenen öğrenciye geri verir ve dönem toplamlarına sayar.
+ * * @param s - Student just added
+ * @param s - Yeni eklenen öğrenci
+ */
+void grade_relink_student(Student *s) {
+    void *last;
+    Grade *g = (Grade *)chain_index_take(&orphan_grades_by_student, s->id, &last);
+    if (g == NULL) return;
+    s->first_grade = g;
+    s->last_grade = (Grade *)last;
+    for (; g != NULL; g = g->next_by_student) {
+        if (g->counted_credits == 0) count_grade_credits(g);
+    }
+    snapshot_touch();
+}
+
+/**
+ * Hands the orphan grades of a course ID back to a newly added course; grades whose student exists
+ * are counted again.
+ * Bir kurs ID'sinin yetim notlarını yeni eklenen kursa geri verir; öğrencisi olan notlar yeniden sayılır.
+ * * @param c - Course just added
+ * @param c - Yeni eklenen kurs
+ */
+void grade_relink_course(Course *c) {
+    void *last;
+    Grade *g = (Grade *)chain_index_take(&orphan_grades_by_course, c->id, &last);
+    if (g == NULL) return;
+    c->first_grade = g;
+    c->last_grade = (Grade *)last;
+    for (; g != NULL; g = g->next_by_course) {
+        if (g->counted_credits == 0) count_grade_credits(g);
+    }
+    snapshot_touch();
+}
+
+// ===============================================
+// UTILITY
+// ===============================================
+
+/**
+ * Frees all memory allocated for the grade linked list.
+ * Not bağlı listesi için ayrılan tüm belleği serbest bırakır.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ */
+void free_all_grades(Grade *head) {
+    Grade *temp;
+    
+    while (head != NULL) {
+        temp = head;
+        head = head->next;
+        // Sahip öğrenci/kurs hâlâ bellekteyse zincir başlarını sıfırla
+        Student *s = get_student_by_id(temp->student_id);
+        Course *c = get_course_by_id(temp->course_id);
+        if (s != NULL) {
+            s->first_grade = s->last_grade = NULL;
+            student_clear_terms(s);
+        }
+        if (c != NULL) c->first_grade = c->last_grade = NULL;
+        free(temp);
+    }
+    grade_tail = NULL;
+    grade_tail_owner = NULL;
+    chain_index_clear(&orphan_grades_by_student);
+    chain_index_clear(&orphan_grades_by_course);
+    id_index_clear(&grade_id_index);
+    bloom_clear(&grade_id_filter);
+    free(grade_term_order);
+    grade_term_order = NULL;
+    grade_term_count = grade_term_capacity = 0;
+    grade_term_dirty = 1;
+    grade_cube_invalidate();
+    grade_stats_clear();
+    
+    printf("Memory for grades cleared.\n");
+}
+
+/**
+ * Counts the total number of grade records in the linked list.
+ * Bağlı listedeki toplam not kaydı sayısını hesaplar.
+ * * @param head - Pointer to the head of the grade list
+ * @param head - Not listesinin başına işaret eden pointer
+ * @return Total record count
+ * @return Toplam kayıt sayısı
+ */
+int count_grades(Grade *head) {
+    int count = 0;
+    Grade *current = head;
+    
+    while (current != NULL) {
+        count++;
+        current = current->next;
+    }
+    
+    return count;
+}
+
+/**
+ * Hands out the next grade ID in O(1). IDs of deleted grades are never reused.
+ * Sonraki not ID'sini O(1) sürede verir. Silinen kayıtların ID'leri tekrar kullanılmaz.
+ * * @param head - Pointer to the head of the grade list (unused, kept for API compatibility)
+ * @param head - Not listesinin başına işaret eden pointer (kullanılmaz, API uyumluluğu için)
+ * @return The next available integer ID
+ * @return Kullanılabilir bir sonraki tam sayı ID
+ */
+int get_next_grade_id(Grade *head) {
+    (void)head;
+    return __sync_fetch_and_add(&grade_sequence, 1);
+}
+
+/**
+ * Prints the duplicate-ID filter statistics of the grade table.
+ * Not tablosunun mükerrer ID filtresi istatistiklerini yazdırır.
+ */
+void display_grade_filter_stats(void) {
+    bloom_print_stats("Grades", &grade_id_filter, grade_id_index.size);
+}
@@ -1,37 +1,103 @@
-#ifndef GRADE_H
-#define GRADE_H
-
-#include <stdio.h>
-#include <stdlib.h>
-
-typedef struct Grade {
-    int id;
-    int enrollment_id;
-    int student_id;
-    int course_id;
-    char letter_grade[5];
-    float numeric_grade;
-    char semester[20];
-    struct Grade *next;
-} Grade;
-
-int load_grades_from_csv(Grade **head_ptr);
-int save_grades_to_csv(Grade *head, const char *filename);
-int add_grade(Grade **head_ptr, const Grade *new_grade);
-int update_grade(Grade *grade_to_update, float new_numeric, const char *new_letter);
-int delete_grade(Grade **head_ptr, int id);
-Grade* find_grade_by_id(Grade *head, int id);
-Grade* find_grade_by_enrollment(Grade *head, int enrollment_id);
-Grade* find_student_course_grade(Grade *head, int student_id, int course_id);
-void numeric_to_letter(float numeric, char *letter_buffer);
-int letter_to_points(const char *letter);
-void display_student_grades(Grade *head, int student_id);
-void display_course_grades(Grade *head, int course_id);
-void display_all_grades(Grade *head);
-float calculate_course_average(Grade *head, int course_id);
-void display_grade_statistics(Grade *head, int course_id);
-void free_all_grades(Grade *head);
-int count_grades(Grade *head);
-int get_next_grade_id(Grade *head);
-
-#endif
+#ifndef GRADE_H
+#define GRADE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct Grade {
+    int id;
+    int enrollment_id;
+    int student_id;
+    int course_id;
+    char letter_grade[5];
+    float numeric_grade;
+    char semester[20];
+    int term;                        // semester_to_term(semester), set when linked
+    int counted_credits;             // Credits added to the student's term totals (0 = not counted)
+    struct Grade *next_by_student;   // Next grade of the same student
+    struct Grade *next_by_course;    // Next grade of the same course
+    struct Grade *prev;              // Previous node of the main list
+    struct Grade *next;
+} Grade;
+
+struct Course;
+struct Student;
+
+// Row counts of a bulk grade import
+// Toplu not yüklemesinin satır sayıları
+typedef struct GradeImportSummary {
+    int rows;
+    int inserted;
+    int updated;
+    int rejected;
+    int students_updated;    // GPAs recomputed once at the end
+} GradeImportSummary;
+
+#define GRADE_BANDS 9            // Letter bands FF, FD, DD, DC, CC, CB, BB, BA, AA
+
+// How curve_course_grades moves a course's scores
+// curve_course_grades'in bir dersin puanlarını nasıl kaydırdığı
+typedef enum CurveMethod {
+    CURVE_SHIFT = 0,         // Add amount points to every score
+    CURVE_SCALE_TO_MEAN,     // Scale so the course mean becomes amount
+    CURVE_PERCENTILE         // Shift so the score at percentile reaches amount (never lowers scores)
+} CurveMethod;
+
+typedef struct CurveSpec {
+    CurveMethod method;
+    float amount;
+    float percentile;        // CURVE_PERCENTILE only (0-100)
+} CurveSpec;
+
+typedef struct CurveReport {
+    int count;
+    float old_mean, new_mean;
+    float old_stddev, new_stddev;
+    float pivot;             // Score at the percentile (CURVE_PERCENTILE)
+    float slope, offset;     // new = clamp(slope * old + offset, 0, 100)
+    int before[GRADE_BANDS];
+    int after[GRADE_BANDS];
+    int students_updated;
+    int applied;             // 0 for a dry run
+} CurveReport;
+
+int load_grades_from_csv(Grade **head_ptr);
+int save_grades_to_csv(Grade *head, const char *filename);
+int add_grade(Grade **head_ptr, const Grade *new_grade);
+int update_grade(Grade *grade_to_update, float new_numeric, const char *new_letter);
+int import_grades_from_csv(Grade **head_ptr, struct Course *c_head, const char *filename, int course_id,
+                           GradeImportSummary *summary);
+int curve_course_grades(struct Course *c_head, int course_id, const CurveSpec *spec, int dry_run, CurveReport *report);
+void display_curve_report(const CurveReport *report);
+int delete_grade(Grade **head_ptr, int id);
+int delete_student_grades(Grade **head_ptr, int student_id);
+int delete_course_grades(Grade **head_ptr, int course_id);
+int delete_semester_grades(Grade **head_ptr, const char *semester);
+int delete_enrollment_grades(Grade **head_ptr, int student_id, int enrollment_id);
+Grade* find_grade_by_id(Grade *head, int id);
+Grade* find_grade_by_enrollment(Grade *head, int enrollment_id);
+Grade* find_student_course_grade(Grade *head, int student_id, int course_id);
+void numeric_to_letter(float numeric, char *letter_buffer);
+void numeric_to_letter_batch(const float *numeric, char (*letters)[5], int count);
+int numeric_to_band(float numeric);
+const char* band_letter(int band);
+int letter_to_points(const char *letter);
+void display_student_grades(Grade *head, int student_id);
+void display_course_grades(Grade *head, int course_id);
+void display_all_grades(Grade *head);
+float calculate_course_average(Grade *head, int course_id);
+void display_grade_statistics(Grade *head, int course_id);
+void display_grade_distribution(Grade *head, int course_id);
+int grades_in_term_range(Grade *head, int from_term, int to_term, Grade ***first);
+void grade_term_index_invalidate(void);
+void display_term_range_report(Grade *head, int from_term, int to_term);
+void display_grade_filter_stats(void);
+void grade_detach_student(struct Student *s);
+void grade_detach_course(struct Course *c);
+void grade_relink_student(struct Student *s);
+void grade_relink_course(struct Course *c);
+void free_all_grades(Grade *head);
+int count_grades(Grade *head);
+int get_next_grade_id(Grade *head);
+
+#endif
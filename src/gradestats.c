@@ -0,0 +1,501 @@
+// gradestats.c - Ders Not İstatistikleri Modülü (Akan Özetler)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "gradestats.h"
+#include "index.h"
+#include "archive.h"
+
+#define SKETCH_INITIAL_EXACT 8
+
+// One course's sketch over all its grades plus one sketch per semester it was taught
+// Bir dersin tüm notları üzerindeki özeti ve verildiği her dönem için bir özet
+typedef struct SectionSketch {
+    int term;
+    GradeSketch sketch;
+} SectionSketch;
+
+typedef struct CourseStats {
+    int course_id;
+    GradeSketch all;
+    SectionSketch *sections;     // Sorted by term
+    int section_count;
+    int section_capacity;
+    struct CourseStats *next;
+} CourseStats;
+
+// course_id -> CourseStats*; the list owns the nodes.
+// course_id -> CourseStats*; düğümlerin sahibi listedir.
+typedef struct StatsTable {
+    IdIndex index;
+    CourseStats *list;
+} StatsTable;
+
+// In-memory grades, kept current by every grade mutation
+// Bellekteki notlar; her not değişikliğiyle güncel tutulur
+static StatsTable hot_stats = {{NULL, 0, 0}, NULL};
+
+// Grades of the mapped archives, built on the first query after the archives change; queries merge it
+// with hot_stats, so freeing the grade list does not lose archived semesters.
+// Eşlenmiş arşivlerin notları; arşivler değiştikten sonraki ilk sorguda kurulur. Sorgular bunu hot_stats ile
+// birleştirir; not listesinin boşaltılması arşivlenmiş dönemleri kaybettirmez.
+static StatsTable archived_stats = {{NULL, 0, 0}, NULL};
+static int archived_stats_built = 0;
+
+static int score_bin(float score) {
+    if (score < 0.0f) score = 0.0f;
+    if (score > 100.0f) score = 100.0f;
+    return (int)(score / SKETCH_BIN_WIDTH + 0.5f);
+}
+
+/**
+ * Moves a full exact sketch into histogram mode.
+ * Dolmuş bir kesin özeti histogram moduna taşır.
+ * * @return 1 if converted, 0 if memory allocation fails
+ * @return Dönüştürüldüyse 1, bellek hatasında 0 döner
+ */
+static int sketch_to_bins(GradeSketch *sketch) {
+    int i;
+    int *bins = (int *)calloc(SKETCH_BINS, sizeof(int));
+    if (bins == NULL) return 0;
+    for (i = 0; i < sketch->count; i++) bins[score_bin(sketch->exact[i])]++;
+    free(sketch->exact);
+    sketch->exact = NULL;
+    sketch->exact_capacity = 0;
+    sketch->bins = bins;
+    return 1;
+}
+
+/**
+ * Index of the first exact score not less than score.
+ * Puandan küçük olmayan ilk kesin puanın indeksi.
+ */
+static int exact_lower_bound(const GradeSketch *sketch, float score) {
+    int low = 0, high = (int)sketch->count;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (sketch->exact[mid] < score) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+/**
+ * Adds one score: Welford update of the moments, its letter band and its place in the sorted
+ * scores (or its histogram bin once the sketch holds more than SKETCH_EXACT_MAX scores).
+ * Bir puan ekler: momentlerin Welford güncellemesi, harf bandı ve sıralı puanlardaki yeri
+ * (özet SKETCH_EXACT_MAX puanı aşınca histogram kutusu).
+ * * @param sketch - Sketch to update
+ * @param sketch - Güncellenecek özet
+ * @param score - Score to add
+ * @param score - Eklenecek puan
+ */
+void grade_sketch_add(GradeSketch *sketch, float score) {
+    if (sketch->bins == NULL && sketch->count == SKETCH_EXACT_MAX && !sketch_to_bins(sketch)) {
+        printf("Error: Memory allocation failed!\n");
+        return;
+    }
+    if (sketch->bins != NULL) {
+        sketch->bins[score_bin(score)]++;
+    } else {
+        if (sketch->count == sketch->exact_capacity) {
+            int capacity = (sketch->exact_capacity > 0) ? sketch->exact_capacity * 2 : SKETCH_INITIAL_EXACT;
+            float *exact = (float *)realloc(sketch->exact, capacity * sizeof(float));
+            if (exact == NULL) {
+                printf("Error: Memory allocation failed!\n");
+                return;
+            }
+            sketch->exact = exact;
+            sketch->exact_capacity = capacity;
+        }
+        int pos = exact_lower_bound(sketch, score);
+        memmove(&sketch->exact[pos + 1], &sketch->exact[pos], (sketch->count - pos) * sizeof(float));
+        sketch->exact[pos] = score;
+    }
+    sketch->count++;
+    double delta = score - sketch->mean;
+    sketch->mean += delta / sketch->count;
+    sketch->m2 += delta * (score - sketch->mean);
+    sketch->bands[numeric_to_band(score)]++;
+}
+
+/**
+ * Removes one score previously added; unknown scores are ignored. An emptied histogram
+ * sketch returns to exact mode.
+ * Daha önce eklenmiş bir puanı çıkarır; bilinmeyen puanlar yok sayılır. Boşalan bir
+ * histogram özeti kesin moda döner.
+ * * @param sketch - Sketch to update
+ * @param sketch - Güncellenecek özet
+ * @param score - Score to remove
+ * @param score - Çıkarılacak puan
+ */
+void grade_sketch_remove(GradeSketch *sketch, float score) {
+    if (sketch->count <= 0) return;
+    if (sketch->bins != NULL) {
+        int bin = score_bin(score);
+        if (sketch->bins[bin] == 0) return;
+        sketch->bins[bin]--;
+    } else {
+        int pos = exact_lower_bound(sketch, score);
+        if (pos >= sketch->count || sketch->exact[pos] != score) return;
+        memmove(&sketch->exact[pos], &sketch->exact[pos + 1], (sketch->count - pos - 1) * sizeof(float));
+    }
+    sketch->bands[numeric_to_band(score)]--;
+    if (--sketch->count == 0) {
+        sketch->mean = sketch->m2 = 0.0;
+        free(sketch->bins);
+        sketch->bins = NULL;
+        return;
+    }
+    // Welford adımının tersi
+    double mean = sketch->mean - (score - sketch->mean) / sketch->count;
+    sketch->m2 -= (score - mean) * (score - sketch->mean);
+    if (sketch->m2 < 0.0) sketch->m2 = 0.0;
+    sketch->mean = mean;
+}
+
+void grade_sketch_free(GradeSketch *sketch) {
+    free(sketch->exact);
+    free(sketch->bins);
+    memset(sketch, 0, sizeof(GradeSketch));
+}
+
+/**
+ * Merges one sketch into another, as if every score of from had been added to into: moments are
+ * combined with the parallel Welford formula, bands and bins are summed and exact scores are merged
+ * in order while the total fits in exact mode.
+ * Bir özeti diğerine, from'daki her puan into'ya eklenmiş gibi birleştirir: momentler paralel Welford
+ * formülüyle birleştirilir, bantlar ve kutular toplanır; toplam kesin moda sığdıkça kesin puanlar
+ * sırayla birleştirilir.
+ * * @param into - Sketch receiving the scores
+ * @param into - Puanları alan özet
+ * @param from - Sketch to merge (left unchanged)
+ * @param from - Birleştirilecek özet (değişmez)
+ * @return 1 if merged, 0 if memory allocation fails (into is left unchanged)
+ * @return Birleştirildiyse 1, bellek hatasında 0 döner (into değişmez)
+ */
+int grade_sketch_merge(GradeSketch *into, const GradeSketch *from) {
+    long total = into->count + from->count;
+    int b;
+    if (from->count <= 0) return 1;
+
+    if (into->bins == NULL && from->bins == NULL && total <= SKETCH_EXACT_MAX) {
+        float *exact = (float *)malloc(total * sizeof(float));
+        long i = 0, j = 0, k = 0;
+        if (exact == NULL) return 0;
+        while (i < into->count || j < from->count) {
+            if (j >= from->count || (i < into->count && into->exact[i] <= from->exact[j])) exact[k++] = into->exact[i++];
+            else exact[k++] = from->exact[j++];
+        }
+        free(into->exact);
+        into->exact = exact;
+        into->exact_capacity = (int)total;
+    } else {
+        if (into->bins == NULL && !sketch_to_bins(into)) return 0;
+        if (from->bins != NULL) {
+            for (b = 0; b < SKETCH_BINS; b++) into->bins[b] += from->bins[b];
+        } else {
+            long i;
+            for (i = 0; i < from->count; i++) into->bins[score_bin(from->exact[i])]++;
+        }
+    }
+
+    double delta = from->mean - into->mean;
+    into->m2 += from->m2 + delta * delta * ((double)into->count * from->count / total);
+    into->mean += delta * from->count / total;
+    into->count = total;
+    for (b = 0; b < GRADE_BANDS; b++) into->bands[b] += from->bands[b];
+    return 1;
+}
+
+/**
+ * Score at a 0-based rank in a histogram sketch (bin value, within half a bin of the real score).
+ * Histogram özetinde 0 tabanlı bir sıradaki puan (kutu değeri, gerçek puana yarım kutu yakınlıkta).
+ */
+static float bin_rank_value(const GradeSketch *sketch, long rank) {
+    long seen = 0;
+    int b;
+    for (b = 0; b < SKETCH_BINS; b++) {
+        seen += sketch->bins[b];
+        if (seen > rank) return b * SKETCH_BIN_WIDTH;
+    }
+    return 100.0f;
+}
+
+/**
+ * Score at a quantile (0-1), interpolating between the neighbouring ranks.
+ * Bir çeyreklikteki (0-1) puan, komşu sıralar arasında enterpolasyonla.
+ */
+static float sketch_quantile(const GradeSketch *sketch, float q) {
+    float rank = q * (sketch->count - 1);
+    long lower = (long)rank;
+    long upper = (lower + 1 < sketch->count) ? lower + 1 : lower;
+    float a, b;
+    if (sketch->bins != NULL) {
+        a = bin_rank_value(sketch, lower);
+        b = bin_rank_value(sketch, upper);
+    } else {
+        a = sketch->exact[lower];
+        b = sketch->exact[upper];
+    }
+    return a + (rank - lower) * (b - a);
+}
+
+/**
+ * Reads the distribution summary of a sketch. Costs at most one pass over the fixed-size
+ * histogram per quantile, independent of the number of grades.
+ * Bir özetin dağılım özetini okur. Not sayısından bağımsız olarak, her çeyreklik için en fazla
+ * sabit boyutlu histogram üzerinde bir geçiş yapar.
+ * * @param sketch - Sketch to read
+ * @param sketch - Okunacak özet
+ * @param out - Receives the summary (all zero for an empty sketch)
+ * @param out - Özeti alır (boş özette tamamı sıfır)
+ */
+void grade_sketch_summary(const GradeSketch *sketch, GradeSummary *out) {
+    int b;
+    memset(out, 0, sizeof(GradeSummary));
+    out->exact = (sketch->bins == NULL);
+    if (sketch->count <= 0) return;
+
+    out->count = sketch->count;
+    out->mean = (float)sketch->mean;
+    out->stddev = (float)sqrt(sketch->m2 / sketch->count);
+    memcpy(out->bands, sketch->bands, sizeof(out->bands));
+    out->min = sketch_quantile(sketch, 0.0f);
+    out->q1 = sketch_quantile(sketch, 0.25f);
+    out->median = sketch_quantile(sketch, 0.5f);
+    out->q3 = sketch_quantile(sketch, 0.75f);
+    out->max = sketch_quantile(sketch, 1.0f);
+    out->lower_fence = out->q1 - OUTLIER_IQR_FACTOR * (out->q3 - out->q1);
+    out->upper_fence = out->q3 + OUTLIER_IQR_FACTOR * (out->q3 - out->q1);
+
+    if (sketch->bins != NULL) {
+        for (b = 0; b < SKETCH_BINS; b++) {
+            float value = b * SKETCH_BIN_WIDTH;
+            if (value < out->lower_fence) out->outliers_low += sketch->bins[b];
+            else if (value > out->upper_fence) out->outliers_high += sketch->bins[b];
+        }
+    } else {
+        out->outliers_low = exact_lower_bound(sketch, out->lower_fence);
+        for (b = (int)sketch->count - 1; b >= 0 && sketch->exact[b] > out->upper_fence; b--) out->outliers_high++;
+    }
+}
+
+/**
+ * Finds the section sketch of a term with a binary search, inserting an empty one if asked.
+ * Bir dönemin şube özetini ikili aramayla bulur; istenirse boş bir özet ekler.
+ * * @return The section sketch, or NULL if absent (or memory allocation fails)
+ * @return Şube özeti; yoksa (veya bellek hatasında) NULL
+ */
+static GradeSketch* find_section(CourseStats *stats, int term, int create) {
+    int low = 0, high = stats->section_count;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (stats->sections[mid].term < term) low = mid + 1;
+        else high = mid;
+    }
+    if (low < stats->section_count && stats->sections[low].term == term) return &stats->sections[low].sketch;
+    if (!create) return NULL;
+
+    if (stats->section_count == stats->section_capacity) {
+        int capacity = (stats->section_capacity > 0) ? stats->section_capacity * 2 : 4;
+        SectionSketch *sections = (SectionSketch *)realloc(stats->sections, capacity * sizeof(SectionSketch));
+        if (sections == NULL) return NULL;
+        stats->sections = sections;
+        stats->section_capacity = capacity;
+    }
+    memmove(&stats->sections[low + 1], &stats->sections[low], (stats->section_count - low) * sizeof(SectionSketch));
+    memset(&stats->sections[low], 0, sizeof(SectionSketch));
+    stats->sections[low].term = term;
+    stats->section_count++;
+    return &stats->sections[low].sketch;
+}
+
+/**
+ * Adds (sign = 1) or removes (sign = -1) a grade in one table.
+ * Bir notu bir tabloya ekler (sign = 1) veya çıkarır (sign = -1).
+ */
+static void stats_table_account(StatsTable *table, const Grade *grade, int sign) {
+    CourseStats *stats = (CourseStats *)id_index_find(&table->index, grade->course_id);
+    if (stats == NULL) {
+        if (sign < 0) return;
+        stats = (CourseStats *)calloc(1, sizeof(CourseStats));
+        if (stats == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return;
+        }
+        stats->course_id = grade->course_id;
+        id_index_insert(&table->index, stats->course_id, stats);
+        stats->next = table->list;
+        table->list = stats;
+    }
+    GradeSketch *section = find_section(stats, grade->term, sign > 0);
+    if (sign > 0) {
+        grade_sketch_add(&stats->all, grade->numeric_grade);
+        if (section != NULL) grade_sketch_add(section, grade->numeric_grade);
+    } else {
+        grade_sketch_remove(&stats->all, grade->numeric_grade);
+        if (section != NULL) grade_sketch_remove(section, grade->numeric_grade);
+    }
+}
+
+static void stats_table_clear(StatsTable *table) {
+    int i;
+    while (table->list != NULL) {
+        CourseStats *stats = table->list;
+        table->list = stats->next;
+        grade_sketch_free(&stats->all);
+        for (i = 0; i < stats->section_count; i++) grade_sketch_free(&stats->sections[i].sketch);
+        free(stats->sections);
+        free(stats);
+    }
+    id_index_clear(&table->index);
+}
+
+/**
+ * Adds (sign = 1) or removes (sign = -1) a grade in its course's sketch and in the sketch of
+ * its course and semester. Called by the grade module whenever a grade is linked, unlinked or rescored.
+ * Bir notu dersinin özetine ve ders-dönem özetine ekler (sign = 1) veya çıkarır (sign = -1).
+ * Not modülü bir not bağlandığında, çıkarıldığında veya puanı değiştiğinde çağırır.
+ * * @param grade - Grade node
+ * @param grade - Not düğümü
+ * @param sign - 1 to add, -1 to remove
+ * @param sign - Eklemek için 1, çıkarmak için -1
+ */
+void grade_stats_account(const Grade *grade, int sign) {
+    stats_table_account(&hot_stats, grade, sign);
+}
+
+/**
+ * Frees every sketch of the in-memory grades. Archived semesters are kept.
+ * Bellekteki notların tüm özetlerini serbest bırakır. Arşivlenmiş dönemler korunur.
+ */
+void grade_stats_clear(void) {
+    stats_table_clear(&hot_stats);
+}
+
+/**
+ * Drops the sketches of the archived semesters; the next query rebuilds them. Called when archives are
+ * mapped or unmapped.
+ * Arşivlenmiş dönemlerin özetlerini bırakır; sonraki sorgu onları yeniden kurar. Arşivler eşlendiğinde
+ * veya eşlemeleri kaldırıldığında çağrılır.
+ */
+void grade_stats_archive_invalidate(void) {
+    stats_table_clear(&archived_stats);
+    archived_stats_built = 0;
+}
+
+/**
+ * Sketches of a course's archived grades, building them from the mapped archives when needed.
+ * Bir dersin arşivlenmiş notlarının özetleri; gerekirse eşlenmiş arşivlerden kurulur.
+ */
+static CourseStats* archived_course_stats(int course_id) {
+    int a, i;
+    if (!archived_stats_built) {
+        for (a = 0; a < archive_count(); a++) {
+            const SemesterArchive *archive = archive_get(a);
+            for (i = 0; i < archive->grade_count; i++) stats_table_account(&archived_stats, &archive->grades[i], 1);
+        }
+        archived_stats_built = 1;
+    }
+    return (CourseStats *)id_index_find(&archived_stats.index, course_id);
+}
+
+/**
+ * Summarizes a hot and an archived sketch together; only merges when both hold grades.
+ * Bir sıcak ve bir arşiv özetini birlikte özetler; yalnızca ikisinde de not varsa birleştirir.
+ */
+static void combined_summary(const GradeSketch *hot, const GradeSketch *archived, GradeSummary *out) {
+    memset(out, 0, sizeof(GradeSummary));
+    if (archived == NULL || archived->count <= 0) {
+        if (hot != NULL) grade_sketch_summary(hot, out);
+        return;
+    }
+    if (hot == NULL || hot->count <= 0) {
+        grade_sketch_summary(archived, out);
+        return;
+    }
+    GradeSketch combined;
+    memset(&combined, 0, sizeof(GradeSketch));
+    if (grade_sketch_merge(&combined, hot) && grade_sketch_merge(&combined, archived)) {
+        grade_sketch_summary(&combined, out);
+    } else {
+        printf("Error: Memory allocation failed!\n");
+    }
+    grade_sketch_free(&combined);
+}
+
+/**
+ * Summarizes all grades of a course, archived semesters included, without touching the grade list.
+ * Bir dersin tüm notlarını, arşivlenmiş dönemler dahil, not listesine dokunmadan özetler.
+ * * @param course_id - Course ID
+ * @param course_id - Ders ID'si
+ * @param out - Receives the summary
+ * @param out - Özeti alır
+ * @return 1 if the course has grades, 0 otherwise
+ * @return Dersin notu varsa 1, yoksa 0 döner
+ */
+int course_grade_summary(int course_id, GradeSummary *out) {
+    CourseStats *hot = (CourseStats *)id_index_find(&hot_stats.index, course_id);
+    CourseStats *archived = archived_course_stats(course_id);
+    combined_summary(hot != NULL ? &hot->all : NULL, archived != NULL ? &archived->all : NULL, out);
+    return out->count > 0;
+}
+
+/**
+ * Summarizes the grades of a course in one semester, archived or not.
+ * Bir dersin bir dönemdeki notlarını, arşivlenmiş olsun ya da olmasın, özetler.
+ * * @param course_id - Course ID
+ * @param course_id - Ders ID'si
+ * @param term - Packed semester (semester_to_term)
+ * @param term - Paketlenmiş dönem (semester_to_term)
+ * @param out - Receives the summary
+ * @param out - Özeti alır
+ * @return 1 if the section has grades, 0 otherwise
+ * @return Şubenin notu varsa 1, yoksa 0 döner
+ */
+int section_grade_summary(int course_id, int term, GradeSummary *out) {
+    CourseStats *hot = (CourseStats *)id_index_find(&hot_stats.index, course_id);
+    CourseStats *archived = archived_course_stats(course_id);
+    combined_summary((hot != NULL) ? find_section(hot, term, 0) : NULL,
+                     (archived != NULL) ? find_section(archived, term, 0) : NULL, out);
+    return out->count > 0;
+}
+
+/**
+ * Lists the semesters in which a course has grades, archived ones included, in calendar order.
+ * Bir dersin notu olan dönemlerini, arşivlenmişler dahil, takvim sırasıyla listeler.
+ * * @param course_id - Course ID
+ * @param course_id - Ders ID'si
+ * @param terms - Receives the packed semesters
+ * @param terms - Paketlenmiş dönemleri alır
+ * @param max_terms - Capacity of terms
+ * @param max_terms - terms dizisinin kapasitesi
+ * @return Number of semesters written
+ * @return Yazılan dönem sayısı
+ */
+int course_grade_terms(int course_id, int *terms, int max_terms) {
+    CourseStats *hot = (CourseStats *)id_index_find(&hot_stats.index, course_id);
+    CourseStats *archived = archived_course_stats(course_id);
+    int i = 0, j = 0, count = 0;
+    int hot_count = (hot != NULL) ? hot->section_count : 0;
+    int archived_count = (archived != NULL) ? archived->section_count : 0;
+
+    // İki sıralı dönem listesinin birleşimi (boş şubeler atlanır)
+    while ((i < hot_count || j < archived_count) && count < max_terms) {
+        const SectionSketch *next;
+        if (j >= archived_count || (i < hot_count && hot->sections[i].term <= archived->sections[j].term)) {
+            next = &hot->sections[i++];
+            if (j < archived_count && archived->sections[j].term == next->term) {
+                if (next->sketch.count <= 0) next = &archived->sections[j];
+                j++;
+            }
+        } else {
+            next = &archived->sections[j++];
+        }
+        if (next->sketch.count > 0) terms[count++] = next->term;
+    }
+    return count;
+}
@@ -0,0 +1,59 @@
+// gradestats.h - Ders Not İstatistikleri Modülü (Akan Özetler)
+
+#ifndef GRADESTATS_H
+#define GRADESTATS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "grade.h"
+
+#define SKETCH_EXACT_MAX 256     // Scores kept exactly (sorted) up to this many grades
+#define SKETCH_BIN_WIDTH 0.1f    // Histogram resolution beyond that; quantiles are within half a bin
+#define SKETCH_BINS 1001         // 0.0, 0.1, ..., 100.0
+#define OUTLIER_IQR_FACTOR 1.5f  // Tukey fences: Q1 - 1.5 IQR and Q3 + 1.5 IQR
+#define MAX_COURSE_TERMS 128     // Semesters listed per course in distribution reports
+
+// Streaming summary of a set of scores: Welford moments, letter bands and either the exact
+// sorted scores (small sets) or a fixed-width histogram. Supports removal, so grade updates
+// are a remove followed by an add.
+// Bir puan kümesinin akan özeti: Welford momentleri, harf bantları ve ya kesin sıralı puanlar
+// (küçük kümeler) ya da sabit genişlikli bir histogram. Silmeyi destekler; not güncellemesi
+// bir silme ve ardından bir eklemedir.
+typedef struct GradeSketch {
+    long count;
+    double mean;
+    double m2;                   // Sum of squared deviations from the mean
+    long bands[GRADE_BANDS];     // Letter histogram, FF ... AA
+    float *exact;                // Sorted scores while count <= SKETCH_EXACT_MAX (NULL once binned)
+    int exact_capacity;
+    int *bins;                   // SKETCH_BINS counters once the sketch outgrew exact mode
+} GradeSketch;
+
+// Distribution summary read from a sketch
+// Bir özetten okunan dağılım özeti
+typedef struct GradeSummary {
+    long count;
+    float mean;
+    float stddev;                // Population standard deviation, as in the curve report
+    float min, q1, median, q3, max;
+    float lower_fence, upper_fence;
+    long outliers_low;
+    long outliers_high;
+    long bands[GRADE_BANDS];
+    int exact;                   // 1 if the quantiles are exact, 0 if read from the histogram
+} GradeSummary;
+
+void grade_sketch_add(GradeSketch *sketch, float score);
+void grade_sketch_remove(GradeSketch *sketch, float score);
+void grade_sketch_free(GradeSketch *sketch);
+int grade_sketch_merge(GradeSketch *into, const GradeSketch *from);
+void grade_sketch_summary(const GradeSketch *sketch, GradeSummary *out);
+
+void grade_stats_account(const Grade *grade, int sign);
+void grade_stats_clear(void);
+void grade_stats_archive_invalidate(void);
+int course_grade_summary(int course_id, GradeSummary *out);
+int section_grade_summary(int course_id, int term, GradeSummary *out);
+int course_grade_terms(int course_id, int *terms, int max_terms);
+
+#endif
@@ -0,0 +1,517 @@
+// index.c - Hash İndeks Modülü
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "index.h"
+#include "utils.h"
+
+/**
+ * Computes the djb2 hash of a string key.
+ * Bir dizgi anahtarının djb2 hash değerini hesaplar.
+ * * @param str - Key string to hash
+ * @param str - Hash'lenecek anahtar dizgisi
+ * @return Unsigned hash value
+ * @return İşaretsiz hash değeri
+ */
+unsigned long hash_string(const char *str) {
+    unsigned long hash = 5381;
+    int c;
+    while ((c = (unsigned char)*str++) != 0) {
+        hash = ((hash << 5) + hash) + c;
+    }
+    return hash;
+}
+
+/**
+ * Produces a lookup key by trimming whitespace and lowercasing the source string.
+ * Kaynak dizgideki boşlukları temizleyip küçük harfe çevirerek arama anahtarı üretir.
+ * * @param src - Raw field value (e.g. an email address)
+ * @param src - Ham alan değeri (örn. e-posta adresi)
+ * @param dest - Buffer to store the normalized key
+ * @param dest - Normalize edilmiş anahtarın saklanacağı alan
+ * @param max_len - Size of the destination buffer
+ * @param max_len - Hedef alanın boyutu
+ */
+void normalize_key(const char *src, char *dest, int max_len) {
+    int i;
+    if (src == NULL) src = "";
+    strncpy(dest, src, max_len - 1);
+    dest[max_len - 1] = '\0';
+    trim_whitespace(dest);
+    for (i = 0; dest[i] != '\0'; i++) {
+        dest[i] = (char)tolower((unsigned char)dest[i]);
+    }
+}
+
+/**
+ * Builds a normalized "first|last" key used by the name indexes.
+ * İsim indeksleri için normalize edilmiş "isim|soyisim" anahtarını oluşturur.
+ * * @param first - First name
+ * @param first - İsim
+ * @param last - Last name
+ * @param last - Soyisim
+ * @param dest - Buffer to store the combined key
+ * @param dest - Birleşik anahtarın saklanacağı alan
+ * @param max_len - Size of the destination buffer
+ * @param max_len - Hedef alanın boyutu
+ */
+void make_name_key(const char *first, const char *last, char *dest, int max_len) {
+    char first_key[INDEX_KEY_LEN];
+    char last_key[INDEX_KEY_LEN];
+    normalize_key(first, first_key, INDEX_KEY_LEN);
+    normalize_key(last, last_key, INDEX_KEY_LEN);
+    snprintf(dest, max_len, "%s|%s", first_key, last_key);
+}
+
+/**
+ * Doubles the bucket array and redistributes existing nodes, keeping chain order.
+ * Kova dizisini iki katına çıkarır ve mevcut düğümleri zincir sırasını koruyarak dağıtır.
+ * * @param index - Index to resize
+ * @param index - Boyutu değiştirilecek indeks
+ * @param new_count - New number of buckets
+ * @param new_count - Yeni kova sayısı
+ * @return 1 if successful, 0 if memory allocation fails
+ * @return Başarılıysa 1, bellek hatası oluşursa 0 döner
+ */
+static int index_resize(HashIndex *index, int new_count) {
+    IndexNode **new_buckets = (IndexNode **)calloc(new_count, sizeof(IndexNode *));
+    IndexNode **tails = (IndexNode **)calloc(new_count, sizeof(IndexNode *));
+    int i;
+
+    if (new_buckets == NULL || tails == NULL) {
+        free(new_buckets);
+        free(tails);
+        return 0;
+    }
+
+    for (i = 0; i < index->bucket_count; i++) {
+        IndexNode *node = index->buckets[i];
+        while (node != NULL) {
+            IndexNode *next = node->next;
+            int slot = (int)(hash_string(node->key) % (unsigned long)new_count);
+            node->next = NULL;
+            if (tails[slot] == NULL) new_buckets[slot] = node;
+            else tails[slot]->next = node;
+            tails[slot] = node;
+            node = next;
+        }
+    }
+
+    free(index->buckets);
+    free(tails);
+    index->buckets = new_buckets;
+    index->bucket_count = new_count;
+    return 1;
+}
+
+/**
+ * Inserts a key/value pair. Duplicate keys are allowed and kept in insertion order.
+ * Bir anahtar/değer çifti ekler. Aynı anahtar birden fazla kez eklenebilir ve ekleme sırası korunur.
+ * * @param index - Target index (lazily initialized on first insert)
+ * @param index - Hedef indeks (ilk eklemede otomatik başlatılır)
+ * @param key - Normalized key
+ * @param key - Normalize edilmiş anahtar
+ * @param value - Record pointer to associate with the key
+ * @param value - Anahtarla ilişkilendirilecek kayıt pointer'ı
+ * @return 1 if successful, 0 if memory allocation fails
+ * @return Başarılıysa 1, bellek hatası oluşursa 0 döner
+ */
+int index_insert(HashIndex *index, const char *key, void *value) {
+    if (index->buckets == NULL) {
+        index->buckets = (IndexNode **)calloc(INDEX_DEFAULT_BUCKETS, sizeof(IndexNode *));
+        if (index->buckets == NULL) return 0;
+        index->bucket_count = INDEX_DEFAULT_BUCKETS;
+        index->size = 0;
+    } else if (index->size >= index->bucket_count * 2) {
+        index_resize(index, index->bucket_count * 2);
+    }
+
+    IndexNode *node = (IndexNode *)malloc(sizeof(IndexNode));
+    if (node == NULL) return 0;
+
+    strncpy(node->key, key, INDEX_KEY_LEN - 1);
+    node->key[INDEX_KEY_LEN - 1] = '\0';
+    node->value = value;
+    node->next = NULL;
+
+    int slot = (int)(hash_string(node->key) % (unsigned long)index->bucket_count);
+    if (index->buckets[slot] == NULL) {
+        index->buckets[slot] = node;
+    } else {
+        IndexNode *current = index->buckets[slot];
+        while (current->next != NULL) current = current->next;
+        current->next = node;
+    }
+    index->size++;
+    return 1;
+}
+
+/**
+ * Returns the first value stored under a key.
+ * Bir anahtar altında saklanan ilk değeri döndürür.
+ * * @param index - Index to search
+ * @param index - Aranacak indeks
+ * @param key - Normalized key
+ * @param key - Normalize edilmiş anahtar
+ * @return Stored value or NULL if the key is absent
+ * @return Saklanan değer, anahtar yoksa NULL döner
+ */
+void* index_find(HashIndex *index, const char *key) {
+    if (index->buckets == NULL) return NULL;
+
+    int slot = (int)(hash_string(key) % (unsigned long)index->bucket_count);
+    IndexNode *current = index->buckets[slot];
+    while (current != NULL) {
+        if (strcmp(current->key, key) == 0) return current->value;
+        current = current->next;
+    }
+    return NULL;
+}
+
+/**
+ * Collects every value stored under a key (used for duplicate names).
+ * Bir anahtar altında saklanan tüm değerleri toplar (aynı isimler için kullanılır).
+ * * @param index - Index to search
+ * @param index - Aranacak indeks
+ * @param key - Normalized key
+ * @param key - Normalize edilmiş anahtar
+ * @param results - Array receiving the matched values
+ * @param results - Eşleşen değerlerin yazılacağı dizi
+ * @param max_results - Capacity of the results array
+ * @param max_results - Sonuç dizisinin kapasitesi
+ * @return Number of matches written to results
+ * @return Sonuç dizisine yazılan eşleşme sayısı
+ */
+int index_find_all(HashIndex *index, const char *key, void **results, int max_results) {
+    int count = 0;
+    if (index->buckets == NULL) return 0;
+
+    int slot = (int)(hash_string(key) % (unsigned long)index->bucket_count);
+    IndexNode *current = index->buckets[slot];
+    while (current != NULL && count < max_results) {
+        if (strcmp(current->key, key) == 0) results[count++] = current->value;
+        current = current->next;
+    }
+    return count;
+}
+
+/**
+ * Removes the entry matching both key and value.
+ * Hem anahtar hem de değer ile eşleşen kaydı siler.
+ * * @param index - Index to modify
+ * @param index - Değiştirilecek indeks
+ * @param key - Normalized key
+ * @param key - Normalize edilmiş anahtar
+ * @param value - Record pointer to remove
+ * @param value - Silinecek kayıt pointer'ı
+ * @return 1 if removed, 0 if not found
+ * @return Silindiyse 1, bulunamadıysa 0 döner
+ */
+int index_remove(HashIndex *index, const char *key, void *value) {
+    if (index->buckets == NULL) return 0;
+
+    int slot = (int)(hash_string(key) % (unsigned long)index->bucket_count);
+    IndexNode *current = index->buckets[slot];
+    IndexNode *prev = NULL;
+
+    while (current != NULL) {
+        if (current->value == value && strcmp(current->key, key) == 0) {
+            if (prev == NULL) index->buckets[slot] = current->next;
+            else prev->next = current->next;
+            free(current);
+            index->size--;
+            return 1;
+        }
+        prev = current;
+        current = current->next;
+    }
+    return 0;
+}
+
+/**
+ * Frees every node and the bucket array, leaving the index empty.
+ * Tüm düğümleri ve kova dizisini serbest bırakarak indeksi boşaltır.
+ * * @param index - Index to clear
+ * @param index - Temizlenecek indeks
+ */
+void index_clear(HashIndex *index) {
+    int i;
+    if (index->buckets != NULL) {
+        for (i = 0; i < index->bucket_count; i++) {
+            IndexNode *current = index->buckets[i];
+            while (current != NULL) {
+                IndexNode *temp = current;
+                current = current->next;
+                free(temp);
+            }
+        }
+        free(index->buckets);
+    }
+    index->buckets = NULL;
+    index->bucket_count = 0;
+    index->size = 0;
+}
+
+// ===============================================
+// INTEGER ID INDEX
+// ===============================================
+
+/**
+ * Maps an integer ID to a bucket slot.
+ * Bir tam sayı ID'yi kova numarasına dönüştürür.
+ * * @param id - Record ID
+ * @param id - Kayıt ID'si
+ * @param bucket_count - Number of buckets
+ * @param bucket_count - Kova sayısı
+ * @return Bucket slot
+ * @return Kova numarası
+ */
+static int id_slot(int id, int bucket_count) {
+    unsigned int h = (unsigned int)id * 2654435761u;
+    return (int)(h % (unsigned int)bucket_count);
+}
+
+/**
+ * Doubles the bucket array of an ID index and redistributes its nodes.
+ * Bir ID indeksinin kova dizisini iki katına çıkarır ve düğümleri yeniden dağıtır.
+ * * @param index - Index to resize
+ * @param index - Boyutu değiştirilecek indeks
+ * @param new_count - New number of buckets
+ * @param new_count - Yeni kova sayısı
+ * @return 1 if successful, 0 if memory allocation fails
+ * @return Başarılıysa 1, bellek hatası oluşursa 0 döner
+ */
+static int id_index_resize(IdIndex *index, int new_count) {
+    IdIndexNode **new_buckets = (IdIndexNode **)calloc(new_count, sizeof(IdIndexNode *));
+    int i;
+    if (new_buckets == NULL) return 0;
+
+    for (i = 0; i < index->bucket_count; i++) {
+        IdIndexNode *node = index->buckets[i];
+        while (node != NULL) {
+            IdIndexNode *next = node->next;
+            int slot = id_slot(node->id, new_count);
+            node->next = new_buckets[slot];
+            new_buckets[slot] = node;
+            node = next;
+        }
+    }
+
+    free(index->buckets);
+    index->buckets = new_buckets;
+    index->bucket_count = new_count;
+    return 1;
+}
+
+/**
+ * Associates a record pointer with an integer ID.
+ * Bir kayıt pointer'ını tam sayı ID ile ilişkilendirir.
+ * * @param index - Target index (lazily initialized on first insert)
+ * @param index - Hedef indeks (ilk eklemede otomatik başlatılır)
+ * @param id - Record ID
+ * @param id - Kayıt ID'si
+ * @param value - Record pointer
+ * @param value - Kayıt pointer'ı
+ * @return 1 if successful, 0 if memory allocation fails
+ * @return Başarılıysa 1, bellek hatası oluşursa 0 döner
+ */
+int id_index_insert(IdIndex *index, int id, void *value) {
+    if (index->buckets == NULL) {
+        index->buckets = (IdIndexNode **)calloc(INDEX_DEFAULT_BUCKETS, sizeof(IdIndexNode *));
+        if (index->buckets == NULL) return 0;
+        index->bucket_count = INDEX_DEFAULT_BUCKETS;
+        index->size = 0;
+    } else if (index->size >= index->bucket_count * 2) {
+        id_index_resize(index, index->bucket_count * 2);
+    }
+
+    IdIndexNode *node = (IdIndexNode *)malloc(sizeof(IdIndexNode));
+    if (node == NULL) return 0;
+
+    int slot = id_slot(id, index->bucket_count);
+    node->id = id;
+    node->value = value;
+    node->next = index->buckets[slot];
+    index->buckets[slot] = node;
+    index->size++;
+    return 1;
+}
+
+/**
+ * Returns the record stored under an integer ID.
+ * Tam sayı ID altında saklanan kaydı döndürür.
+ * * @param index - Index to search
+ * @param index - Aranacak indeks
+ * @param id - Record ID
+ * @param id - Kayıt ID'si
+ * @return Stored value or NULL
+ * @return Saklanan değer veya NULL
+ */
+void* id_index_find(IdIndex *index, int id) {
+    if (index->buckets == NULL) return NULL;
+
+    IdIndexNode *current = index->buckets[id_slot(id, index->bucket_count)];
+    while (current != NULL) {
+        if (current->id == id) return current->value;
+        current = current->next;
+    }
+    return NULL;
+}
+
+/**
+ * Removes the entry matching both ID and record pointer.
+ * Hem ID hem de kayıt pointer'ı ile eşleşen girdiyi siler.
+ * * @param index - Index to modify
+ * @param index - Değiştirilecek indeks
+ * @param id - Record ID
+ * @param id - Kayıt ID'si
+ * @param value - Record pointer to remove
+ * @param value - Silinecek kayıt pointer'ı
+ * @return 1 if removed, 0 if not found
+ * @return Silindiyse 1, bulunamadıysa 0 döner
+ */
+int id_index_remove(IdIndex *index, int id, void *value) {
+    if (index->buckets == NULL) return 0;
+
+    int slot = id_slot(id, index->bucket_count);
+    IdIndexNode *current = index->buckets[slot];
+    IdIndexNode *prev = NULL;
+
+    while (current != NULL) {
+        if (current->id == id && current->value == value) {
+            if (prev == NULL) index->buckets[slot] = current->next;
+            else prev->next = current->next;
+            free(current);
+            index->size--;
+            return 1;
+        }
+        prev = current;
+        current = current->next;
+    }
+    return 0;
+}
+
+/**
+ * Frees every node of an ID index.
+ * Bir ID indeksinin tüm düğümlerini serbest bırakır.
+ * * @param index - Index to clear
+ * @param index - Temizlenecek indeks
+ */
+void id_index_clear(IdIndex *index) {
+    int i;
+    if (index->buckets != NULL) {
+        for (i = 0; i < index->bucket_count; i++) {
+            IdIndexNode *current = index->buckets[i];
+            while (current != NULL) {
+                IdIndexNode *temp = current;
+                current = current->next;
+                free(temp);
+            }
+        }
+        free(index->buckets);
+    }
+    index->buckets = NULL;
+    index->bucket_count = 0;
+    index->size = 0;
+}
+
+/**
+ * Returns the address of a row's next pointer inside a chain index.
+ * Bir satırın zincir indeksindeki sonraki pointer'ının adresini döndürür.
+ */
+static void **chain_next(const ChainIndex *index, void *row) {
+    return (void **)((char *)row + index->next_offset);
+}
+
+/**
+ * Appends a row to the chain filed under an ID in O(1), starting the chain if there is none.
+ * Bir satırı ID altında tutulan zincirin sonuna O(1) sürede ekler; zincir yoksa başlatır.
+ * * @param index - Chain index
+ * @param index - Zincir indeksi
+ * @param id - ID the chain is filed under
+ * @param id - Zincirin tutulduğu ID
+ * @param row - Row to append (its next pointer is overwritten)
+ * @param row - Eklenecek satır (sonraki pointer'ı üzerine yazılır)
+ */
+void chain_index_append(ChainIndex *index, int id, void *row) {
+    void *last = id_index_find(&index->last, id);
+    *chain_next(index, row) = NULL;
+    if (last != NULL) {
+        *chain_next(index, last) = row;
+        id_index_remove(&index->last, id, last);
+    } else {
+        id_index_insert(&index->first, id, row);
+    }
+    id_index_insert(&index->last, id, row);
+}
+
+/**
+ * Unlinks a row from the chain filed under an ID, dropping the chain when it becomes empty.
+ * Bir satırı ID altında tutulan zincirden çıkarır; zincir boşalırsa onu bırakır.
+ * * @param index - Chain index
+ * @param index - Zincir indeksi
+ * @param id - ID the chain is filed under
+ * @param id - Zincirin tutulduğu ID
+ * @param row - Row to unlink
+ * @param row - Çıkarılacak satır
+ * @return 1 if the row was in the chain, 0 otherwise
+ * @return Satır zincirdeyse 1, değilse 0 döner
+ */
+int chain_index_remove(ChainIndex *index, int id, void *row) {
+    void *prev = NULL;
+    void *current = id_index_find(&index->first, id);
+    while (current != NULL && current != row) {
+        prev = current;
+        current = *chain_next(index, current);
+    }
+    if (current == NULL) return 0;
+
+    void *next = *chain_next(index, row);
+    if (prev != NULL) {
+        *chain_next(index, prev) = next;
+    } else {
+        id_index_remove(&index->first, id, row);
+        if (next != NULL) id_index_insert(&index->first, id, next);
+    }
+    if (next == NULL) {
+        id_index_remove(&index->last, id, row);
+        if (prev != NULL) id_index_insert(&index->last, id, prev);
+    }
+    *chain_next(index, row) = NULL;
+    return 1;
+}
+
+/**
+ * Removes the chain filed under an ID from the index and hands it to the caller.
+ * ID altında tutulan zinciri indeksten çıkarır ve çağırana verir.
+ * * @param index - Chain index
+ * @param index - Zincir indeksi
+ * @param id - ID the chain is filed under
+ * @param id - Zincirin tutulduğu ID
+ * @param last - Receives the last row of the chain (NULL if there is none)
+ * @param last - Zincirin son satırını alır (zincir yoksa NULL)
+ * @return First row of the chain, or NULL
+ * @return Zincirin ilk satırı veya NULL
+ */
+void* chain_index_take(ChainIndex *index, int id, void **last) {
+    void *first = id_index_find(&index->first, id);
+    *last = NULL;
+    if (first == NULL) return NULL;
+    *last = id_index_find(&index->last, id);
+    id_index_remove(&index->first, id, first);
+    id_index_remove(&index->last, id, *last);
+    return first;
+}
+
+/**
+ * Forgets every chain of the index; the rows themselves are not touched.
+ * İndeksteki tüm zincirleri unutur; satırların kendilerine dokunulmaz.
+ * * @param index - Chain index to clear
+ * @param index - Temizlenecek zincir indeksi
+ */
+void chain_index_clear(ChainIndex *index) {
+    id_index_clear(&index->first);
+    id_index_clear(&index->last);
+}
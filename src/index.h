@@ -0,0 +1,69 @@
+// index.h - Hash İndeks Modülü
+
+#ifndef INDEX_H
+#define INDEX_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+#define INDEX_KEY_LEN 128
+#define INDEX_DEFAULT_BUCKETS 64
+
+typedef struct IndexNode {
+    char key[INDEX_KEY_LEN];
+    void *value;
+    struct IndexNode *next;
+} IndexNode;
+
+typedef struct HashIndex {
+    IndexNode **buckets;
+    int bucket_count;
+    int size;
+} HashIndex;
+
+typedef struct IdIndexNode {
+    int id;
+    void *value;
+    struct IdIndexNode *next;
+} IdIndexNode;
+
+typedef struct IdIndex {
+    IdIndexNode **buckets;
+    int bucket_count;
+    int size;
+} IdIndex;
+
+// Row chains filed under an integer ID: first and last row of each, linked through the pointer at next_offset
+// Tam sayı ID altında tutulan satır zincirleri: her birinin ilk ve son satırı, next_offset'teki pointer ile bağlı
+typedef struct ChainIndex {
+    IdIndex first;
+    IdIndex last;
+    size_t next_offset;
+} ChainIndex;
+
+// Anahtar üretimi
+unsigned long hash_string(const char *str);
+void normalize_key(const char *src, char *dest, int max_len);
+void make_name_key(const char *first, const char *last, char *dest, int max_len);
+
+// İndeks işlemleri
+int index_insert(HashIndex *index, const char *key, void *value);
+void* index_find(HashIndex *index, const char *key);
+int index_find_all(HashIndex *index, const char *key, void **results, int max_results);
+int index_remove(HashIndex *index, const char *key, void *value);
+void index_clear(HashIndex *index);
+
+// Tam sayı ID indeksi işlemleri
+int id_index_insert(IdIndex *index, int id, void *value);
+void* id_index_find(IdIndex *index, int id);
+int id_index_remove(IdIndex *index, int id, void *value);
+void id_index_clear(IdIndex *index);
+
+// Zincir indeksi işlemleri
+void chain_index_append(ChainIndex *index, int id, void *row);
+int chain_index_remove(ChainIndex *index, int id, void *row);
+void* chain_index_take(ChainIndex *index, int id, void **last);
+void chain_index_clear(ChainIndex *index);
+
+#endif
@@ -0,0 +1,470 @@
+// integrity.c - Referans Bütünlüğü Modülü
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "integrity.h"
+
+// Active delete policy; orphaning stays the default so existing callers keep their behaviour.
+// Etkin silme politikası; mevcut çağıranların davranışı değişmesin diye varsayılan yetim bırakmaktır.
+static DeleteMode delete_mode = DELETE_ORPHAN;
+
+/**
+ * Selects how student, course and professor deletes treat dependent rows.
+ * Öğrenci, kurs ve profesör silme işlemlerinin bağlı satırlara nasıl davranacağını seçer.
+ * * @param mode - DELETE_ORPHAN, DELETE_RESTRICT or DELETE_CASCADE
+ * @param mode - DELETE_ORPHAN, DELETE_RESTRICT veya DELETE_CASCADE
+ */
+void set_delete_mode(DeleteMode mode) {
+    delete_mode = mode;
+}
+
+/**
+ * Returns the active delete policy.
+ * Etkin silme politikasını döndürür.
+ * * @return Current delete mode
+ * @return Mevcut silme modu
+ */
+DeleteMode get_delete_mode(void) {
+    return delete_mode;
+}
+
+/**
+ * Returns a printable name of a delete policy.
+ * Bir silme politikasının yazdırılabilir adını döndürür.
+ * * @param mode - Delete mode
+ * @param mode - Silme modu
+ * @return Constant name string
+ * @return Sabit ad dizgisi
+ */
+const char* delete_mode_name(DeleteMode mode) {
+    switch (mode) {
+        case DELETE_RESTRICT: return "Restrict";
+        case DELETE_CASCADE: return "Cascade";
+        default: return "Orphan";
+    }
+}
+
+/**
+ * Recomputes the GPA of the students whose grades were removed by a cascade.
+ * Kademeli silme ile notları kaldırılan öğrencilerin not ortalamasını yeniden hesaplar.
+ * * @param student_ids - IDs of the affected students (may repeat)
+ * @param student_ids - Etkilenen öğrencilerin ID'leri (tekrar edebilir)
+ * @param count - Number of IDs
+ * @param count - ID sayısı
+ * @param g_head - Head of the grade list
+ * @param g_head - Not listesinin başı
+ * @param c_head - Head of the course list
+ * @param c_head - Kurs listesinin başı
+ */
+static void refresh_student_gpas(const int *student_ids, int count, Grade *g_head, Course *c_head) {
+    int i;
+    for (i = 0; i < count; i++) {
+        Student *s = get_student_by_id(student_ids[i]);
+        if (s != NULL) student_set_gpa(s, calculate_student_gpa(s->id, g_head, c_head));
+    }
+}
+
+/**
+ * Deletes a student according to the active policy. Dependents are found through the
+ * student's own enrollment and grade chains, so no table is rescanned.
+ * Öğrenciyi etkin politikaya göre siler. Bağlı satırlar öğrencinin kendi kayıt ve not
+ * zincirlerinden bulunur, hiçbir tablo yeniden taranmaz.
+ * * @param s_head - Address of the student list head
+ * @param s_head - Öğrenci listesi başının adresi
+ * @param e_head - Address of the enrollment list head
+ * @param e_head - Kayıt listesi başının adresi
+ * @param g_head - Address of the grade list head
+ * @param g_head - Not listesi başının adresi
+ * @param id - ID of the student to delete
+ * @param id - Silinecek öğrencinin ID'si
+ * @return 1 if deleted, 0 if not found or restricted
+ * @return Silindiyse 1, bulunamazsa veya kısıtlanırsa 0 döner
+ */
+int delete_student_with_policy(Student **s_head, Enrollment **e_head, Grade **g_head, int id) {
+    Student *s = find_student_by_id(*s_head, id);
+
+    if (s != NULL && delete_mode == DELETE_RESTRICT && (s->first_enrollment != NULL || s->first_grade != NULL)) {
+        printf("Error: Student %d still has enrollments or grades (restrict mode).\n", id);
+        return 0;
+    }
+    if (s != NULL && delete_mode == DELETE_CASCADE) {
+        int enrollments = delete_student_enrollments(e_head, id);
+        int grades = delete_student_grades(g_head, id);
+        printf("Cascade: Removed %d enrollments and %d grades of student %d.\n", enrollments, grades, id);
+    }
+    return delete_student(s_head, id);
+}
+
+/**
+ * Deletes a course according to the active policy, walking the course's own row chains.
+ * Kursu etkin politikaya göre siler; kursun kendi satır zincirlerini dolaşır.
+ * * @param c_head - Address of the course list head
+ * @param c_head - Kurs listesi başının adresi
+ * @param e_head - Address of the enrollment list head
+ * @param e_head - Kayıt listesi başının adresi
+ * @param g_head - Address of the grade list head
+ * @param g_head - Not listesi başının adresi
+ * @param id - ID of the course to delete
+ * @param id - Silinecek kursun ID'si
+ * @return 1 if deleted, 0 if not found or restricted
+ * @return Silindiyse 1, bulunamazsa veya kısıtlanırsa 0 döner
+ */
+int delete_course_with_policy(Course **c_head, Enrollment **e_head, Grade **g_head, int id) {
+    Course *c = find_course_by_id(*c_head, id);
+
+    if (c != NULL && delete_mode == DELETE_RESTRICT && (c->first_enrollment != NULL || c->first_grade != NULL)) {
+        printf("Error: Course %d still has enrollments or grades (restrict mode).\n", id);
+        return 0;
+    }
+    if (c != NULL && delete_mode == DELETE_CASCADE) {
+        int affected_count = 0;
+        int *affected = NULL;
+        Grade *g;
+
+        for (g = c->first_grade; g != NULL; g = g->next_by_course) affected_count++;
+        if (affected_count > 0) affected = (int *)malloc(affected_count * sizeof(int));
+        affected_count = 0;
+        if (affected != NULL) {
+            for (g = c->first_grade; g != NULL; g = g->next_by_course) affected[affected_count++] = g->student_id;
+        }
+
+        int enrollments = delete_course_enrollments(e_head, id);
+        int grades = delete_course_grades(g_head, id);
+        printf("Cascade: Removed %d enrollments and %d grades of course %d.\n", enrollments, grades, id);
+        int result = delete_course(c_head, id);
+        refresh_student_gpas(affected, affected_count, *g_head, *c_head);
+        free(affected);
+        return result;
+    }
+    return delete_course(c_head, id);
+}
+
+/**
+ * Deletes a professor according to the active policy. Cascade removes the professor's
+ * enrollments and the grades recorded for them.
+ * Profesörü etkin politikaya göre siler. Kademeli silme profesörün kayıtlarını ve
+ * bu kayıtlara girilen notları kaldırır.
+ * * @param p_head - Address of the professor list head
+ * @param p_head - Profesör listesi başının adresi
+ * @param e_head - Address of the enrollment list head
+ * @param e_head - Kayıt listesi başının adresi
+ * @param g_head - Address of the grade list head
+ * @param g_head - Not listesi başının adresi
+ * @param c_head - Head of the course list (for GPA refresh)
+ * @param c_head - Kurs listesinin başı (not ortalaması güncellemesi için)
+ * @param id - ID of the professor to delete
+ * @param id - Silinecek profesörün ID'si
+ * @return 1 if deleted, 0 if not found or restricted
+ * @return Silindiyse 1, bulunamazsa veya kısıtlanırsa 0 döner
+ */
+int delete_professor_with_policy(Professor **p_head, Enrollment **e_head, Grade **g_head, Course *c_head, int id) {
+    Professor *p = find_professor_by_id(*p_head, id);
+
+    if (p != NULL && delete_mode == DELETE_RESTRICT && p->first_enrollment != NULL) {
+        printf("Error: Professor %d still has enrollments (restrict mode).\n", id);
+        return 0;
+    }
+    if (p != NULL && delete_mode == DELETE_CASCADE) {
+        int affected_count = 0, grades = 0;
+        int *affected = NULL;
+        Enrollment *e;
+
+        for (e = p->first_enrollment; e != NULL; e = e->next_by_professor) affected_count++;
+        if (affected_count > 0) affected = (int *)malloc(affected_count * sizeof(int));
+        affected_count = 0;
+        for (e = p->first_enrollment; e != NULL; e = e->next_by_professor) {
+            int removed = delete_enrollment_grades(g_head, e->student_id, e->id);
+            if (removed > 0 && affected != NULL) affected[affected_count++] = e->student_id;
+            grades += removed;
+        }
+
+        int enrollments = delete_professor_enrollments(e_head, id);
+        refresh_student_gpas(affected, affected_count, *g_head, c_head);
+        free(affected);
+        printf("Cascade: Removed %d enrollments and %d grades of professor %d.\n", enrollments, grades, id);
+    }
+    return delete_professor(p_head, id);
+}
+
+// ===============================================
+// DATA VERIFICATION (VERİ DOĞRULAMA)
+// ===============================================
+
+// Printable names of the anomaly categories, in AnomalyKind order.
+// AnomalyKind sırasıyla anomali kategorilerinin yazdırılabilir adları.
+static const char *anomaly_names[ANOMALY_KIND_COUNT] = {
+    "Enrollment -> missing student",
+    "Enrollment -> missing course",
+    "Enrollment -> missing professor",
+    "Enrollment duplicate ID",
+    "Grade -> missing student",
+    "Grade -> missing course",
+    "Grade -> missing enrollment",
+    "Grade/enrollment student-course mismatch",
+    "Grade numeric out of range",
+    "Grade letter != numeric_to_letter",
+    "Grade duplicate ID"
+};
+
+// One chunk of rows checked by a worker thread into its own report.
+// Bir işçi iş parçacığının kendi raporuna kontrol ettiği satır parçası.
+typedef struct VerifyChunk {
+    Enrollment **enrollments;
+    Grade **grades;
+    long begin;
+    long end;
+    Enrollment *e_head;
+    Grade *g_head;
+    IntegrityReport report;
+} VerifyChunk;
+
+/**
+ * Counts an anomaly and keeps the row ID as a sample while there is room.
+ * Bir anomaliyi sayar ve yer varken satır ID'sini örnek olarak saklar.
+ * * @param report - Report to update
+ * @param report - Güncellenecek rapor
+ * @param kind - Anomaly category
+ * @param kind - Anomali kategorisi
+ * @param row_id - ID of the offending row
+ * @param row_id - Hatalı satırın ID'si
+ */
+static void note_anomaly(IntegrityReport *report, AnomalyKind kind, int row_id) {
+    report->counts[kind]++;
+    if (report->sample_count[kind] < VERIFY_SAMPLES) {
+        report->samples[kind][report->sample_count[kind]++] = row_id;
+    }
+}
+
+/**
+ * Checks one enrollment row against the student, course, professor and enrollment ID indexes.
+ * Bir kayıt satırını öğrenci, kurs, profesör ve kayıt ID indekslerine karşı kontrol eder.
+ * * @param report - Report to update
+ * @param report - Güncellenecek rapor
+ * @param e - Enrollment row
+ * @param e - Kayıt satırı
+ * @param e_head - Head of the enrollment list
+ * @param e_head - Kayıt listesinin başı
+ */
+static void verify_enrollment(IntegrityReport *report, Enrollment *e, Enrollment *e_head) {
+    if (get_student_by_id(e->student_id) == NULL) note_anomaly(report, ANOMALY_ENROLLMENT_NO_STUDENT, e->id);
+    if (get_course_by_id(e->course_id) == NULL) note_anomaly(report, ANOMALY_ENROLLMENT_NO_COURSE, e->id);
+    if (get_professor_by_id(e->professor_id) == NULL) note_anomaly(report, ANOMALY_ENROLLMENT_NO_PROFESSOR, e->id);
+    if (find_enrollment_by_id(e_head, e->id) != e) note_anomaly(report, ANOMALY_ENROLLMENT_DUPLICATE_ID, e->id);
+    report->enrollments_checked++;
+}
+
+/**
+ * Checks one grade row: parents, matching enrollment, range and stored letter.
+ * Bir not satırını kontrol eder: üst kayıtlar, eşleşen kayıt, aralık ve saklanan harf notu.
+ * * @param report - Report to update
+ * @param report - Güncellenecek rapor
+ * @param g - Grade row
+ * @param g - Not satırı
+ * @param e_head - Head of the enrollment list
+ * @param e_head - Kayıt listesinin başı
+ * @param g_head - Head of the grade list
+ * @param g_head - Not listesinin başı
+ */
+static void verify_grade(IntegrityReport *report, Grade *g, Enrollment *e_head, Grade *g_head) {
+    char letter[5];
+    Enrollment *e = find_enrollment_by_id(e_head, g->enrollment_id);
+
+    if (get_student_by_id(g->student_id) == NULL) note_anomaly(report, ANOMALY_GRADE_NO_STUDENT, g->id);
+    if (get_course_by_id(g->course_id) == NULL) note_anomaly(report, ANOMALY_GRADE_NO_COURSE, g->id);
+    if (e == NULL) {
+        note_anomaly(report, ANOMALY_GRADE_NO_ENROLLMENT, g->id);
+    } else if (e->student_id != g->student_id || e->course_id != g->course_id) {
+        note_anomaly(report, ANOMALY_GRADE_ENROLLMENT_MISMATCH, g->id);
+    }
+    if (g->numeric_grade < 0.0 || g->numeric_grade > 100.0) {
+        note_anomaly(report, ANOMALY_GRADE_OUT_OF_RANGE, g->id);
+    }
+    numeric_to_letter(g->numeric_grade, letter);
+    if (strcmp(letter, g->letter_grade) != 0) note_anomaly(report, ANOMALY_GRADE_LETTER_MISMATCH, g->id);
+    if (find_grade_by_id(g_head, g->id) != g) note_anomaly(report, ANOMALY_GRADE_DUPLICATE_ID, g->id);
+    report->grades_checked++;
+}
+
+/**
+ * Worker entry point: checks the rows of one chunk. Lookups only read the ID indexes,
+ * so chunks can run concurrently while no other thread modifies the data.
+ * İşçi giriş noktası: bir parçanın satırlarını kontrol eder. Aramalar yalnızca ID
+ * indekslerini okur; veriyi değiştiren başka iş parçacığı yokken parçalar eşzamanlı çalışabilir.
+ * * @param arg - VerifyChunk to process
+ * @param arg - İşlenecek VerifyChunk
+ * @return Always NULL
+ * @return Her zaman NULL
+ */
+static void* verify_chunk(void *arg) {
+    VerifyChunk *chunk = (VerifyChunk *)arg;
+    long i;
+    for (i = chunk->begin; i < chunk->end; i++) {
+        if (chunk->enrollments != NULL) verify_enrollment(&chunk->report, chunk->enrollments[i], chunk->e_head);
+        else verify_grade(&chunk->report, chunk->grades[i], chunk->e_head, chunk->g_head);
+    }
+    return NULL;
+}
+
+/**
+ * Adds a chunk report into the total, keeping samples in row order.
+ * Bir parça raporunu toplam rapora ekler; örnekleri satır sırasıyla korur.
+ * * @param total - Accumulated report
+ * @param total - Birikimli rapor
+ * @param part - Report of one chunk
+ * @param part - Bir parçanın raporu
+ */
+static void merge_report(IntegrityReport *total, const IntegrityReport *part) {
+    int k, i;
+    for (k = 0; k < ANOMALY_KIND_COUNT; k++) {
+        total->counts[k] += part->counts[k];
+        for (i = 0; i < part->sample_count[k] && total->sample_count[k] < VERIFY_SAMPLES; i++) {
+            total->samples[k][total->sample_count[k]++] = part->samples[k][i];
+        }
+    }
+    total->enrollments_checked += part->enrollments_checked;
+    total->grades_checked += part->grades_checked;
+}
+
+/**
+ * Picks the worker count for a table: one per VERIFY_MIN_CHUNK rows, capped by the online CPUs.
+ * Bir tablo için işçi sayısını seçer: her VERIFY_MIN_CHUNK satır için bir, çevrimiçi CPU sayısıyla sınırlı.
+ * * @param rows - Number of rows
+ * @param rows - Satır sayısı
+ * @return Number of threads to use (at least 1)
+ * @return Kullanılacak iş parçacığı sayısı (en az 1)
+ */
+static int verify_thread_count(long rows) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    long threads = rows / VERIFY_MIN_CHUNK;
+    if (cpus < 1) cpus = 1;
+    if (threads > cpus) threads = cpus;
+    if (threads > VERIFY_MAX_THREADS) threads = VERIFY_MAX_THREADS;
+    return threads < 1 ? 1 : (int)threads;
+}
+
+/**
+ * Splits a flattened table into chunks and checks them on worker threads.
+ * Small tables, or a failed thread start, fall back to checking inline.
+ * Düzleştirilmiş bir tabloyu parçalara böler ve işçi iş parçacıklarında kontrol eder.
+ * Küçük tablolarda veya iş parçacığı başlatılamazsa kontrol aynı iş parçacığında yapılır.
+ * * @param enrollments - Enrollment rows (NULL when checking grades)
+ * @param enrollments - Kayıt satırları (not kontrolünde NULL)
+ * @param grades - Grade rows (NULL when checking enrollments)
+ * @param grades - Not satırları (kayıt kontrolünde NULL)
+ * @param rows - Number of rows
+ * @param rows - Satır sayısı
+ * @param e_head - Head of the enrollment list
+ * @param e_head - Kayıt listesinin başı
+ * @param g_head - Head of the grade list
+ * @param g_head - Not listesinin başı
+ * @param report - Report receiving the merged results
+ * @param report - Birleştirilmiş sonuçları alan rapor
+ */
+static void verify_table(Enrollment **enrollments, Grade **grades, long rows,
+                         Enrollment *e_head, Grade *g_head, IntegrityReport *report) {
+    VerifyChunk chunks[VERIFY_MAX_THREADS];
+    pthread_t threads[VERIFY_MAX_THREADS];
+    int started[VERIFY_MAX_THREADS];
+    int count = verify_thread_count(rows);
+    int t;
+
+    for (t = 0; t < count; t++) {
+        memset(&chunks[t], 0, sizeof(VerifyChunk));
+        chunks[t].enrollments = enrollments;
+        chunks[t].grades = grades;
+        chunks[t].begin = rows * t / count;
+        chunks[t].end = rows * (t + 1) / count;
+        chunks[t].e_head = e_head;
+        chunks[t].g_head = g_head;
+        started[t] = (count > 1 && pthread_create(&threads[t], NULL, verify_chunk, &chunks[t]) == 0);
+        if (!started[t]) verify_chunk(&chunks[t]);
+    }
+    for (t = 0; t < count; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+        merge_report(report, &chunks[t].report);
+    }
+    if (count > report->threads_used) report->threads_used = count;
+}
+
+/**
+ * Verifies referential integrity of enrollments and grades and the stored letter grades.
+ * Parent keys are looked up in the ID indexes the modules already maintain; each child
+ * table is flattened once and checked in parallel chunks.
+ * Kayıt ve notların referans bütünlüğünü ve saklanan harf notlarını doğrular.
+ * Üst anahtarlar modüllerin zaten tuttuğu ID indekslerinde aranır; her alt tablo bir kez
+ * düzleştirilir ve paralel parçalar halinde kontrol edilir.
+ * * @param e_head - Head of the enrollment list
+ * @param e_head - Kayıt listesinin başı
+ * @param g_head - Head of the grade list
+ * @param g_head - Not listesinin başı
+ * @param report - Output report (cleared first)
+ * @param report - Çıktı raporu (önce sıfırlanır)
+ * @return Total number of anomalies, or -1 if memory allocation fails
+ * @return Toplam anomali sayısı, bellek hatasında -1
+ */
+long verify_data(Enrollment *e_head, Grade *g_head, IntegrityReport *report) {
+    long e_rows = count_enrollments(e_head);
+    long g_rows = count_grades(g_head);
+    long i, total = 0;
+    int k;
+
+    memset(report, 0, sizeof(IntegrityReport));
+
+    Enrollment **enrollments = (Enrollment **)malloc((e_rows > 0 ? e_rows : 1) * sizeof(Enrollment *));
+    Grade **grades = (Grade **)malloc((g_rows > 0 ? g_rows : 1) * sizeof(Grade *));
+    if (enrollments == NULL || grades == NULL) {
+        free(enrollments);
+        free(grades);
+        printf("Error: Memory allocation failed!\n");
+        return -1;
+    }
+
+    Enrollment *e = e_head;
+    for (i = 0; e != NULL; e = e->next) enrollments[i++] = e;
+    Grade *g = g_head;
+    for (i = 0; g != NULL; g = g->next) grades[i++] = g;
+
+    verify_table(enrollments, NULL, e_rows, e_head, g_head, report);
+    verify_table(NULL, grades, g_rows, e_head, g_head, report);
+
+    free(enrollments);
+    free(grades);
+
+    for (k = 0; k < ANOMALY_KIND_COUNT; k++) total += report->counts[k];
+    return total;
+}
+
+/**
+ * Prints the categorized anomaly report with sample row IDs.
+ * Kategorilere ayrılmış anomali raporunu örnek satır ID'leriyle yazdırır.
+ * * @param report - Report produced by verify_data
+ * @param report - verify_data tarafından üretilen rapor
+ */
+void display_integrity_report(const IntegrityReport *report) {
+    int k, i;
+    long total = 0;
+
+    printf("\n========================================\n");
+    printf("          DATA VERIFICATION REPORT      \n");
+    printf("========================================\n");
+    printf("Rows checked: %ld enrollments, %ld grades (%d thread%s)\n",
+           report->enrollments_checked, report->grades_checked,
+           report->threads_used, report->threads_used == 1 ? "" : "s");
+    printf("%-42s %8s  %s\n", "Category", "Count", "Sample row IDs");
+    printf("----------------------------------------\n");
+    for (k = 0; k < ANOMALY_KIND_COUNT; k++) {
+        printf("%-42s %8ld ", anomaly_names[k], report->counts[k]);
+        for (i = 0; i < report->sample_count[k]; i++) printf(" %d", report->samples[k][i]);
+        if (report->counts[k] > report->sample_count[k]) printf(" ...");
+        printf("\n");
+        total += report->counts[k];
+    }
+    printf("----------------------------------------\n");
+    printf("Total anomalies: %ld\n", total);
+    printf("========================================\n");
+}
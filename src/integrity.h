@@ -0,0 +1,61 @@
+// integrity.h - Referans Bütünlüğü Modülü
+
+#ifndef INTEGRITY_H
+#define INTEGRITY_H
+
+#include "student.h"
+#include "course.h"
+#include "professor.h"
+#include "enrollment.h"
+#include "grade.h"
+
+// What happens to enrollments and grades that reference a deleted student, course or professor
+// Silinen öğrenci, kurs veya profesöre bağlı kayıt ve notlara ne olacağı
+typedef enum DeleteMode {
+    DELETE_ORPHAN = 0,     // Delete only the parent row (default)
+    DELETE_RESTRICT,       // Refuse while dependent rows exist
+    DELETE_CASCADE         // Delete the dependent rows in the same operation
+} DeleteMode;
+
+void set_delete_mode(DeleteMode mode);
+DeleteMode get_delete_mode(void);
+const char* delete_mode_name(DeleteMode mode);
+
+// Anomaly categories reported by verify_data
+// verify_data tarafından raporlanan anomali kategorileri
+typedef enum AnomalyKind {
+    ANOMALY_ENROLLMENT_NO_STUDENT = 0,
+    ANOMALY_ENROLLMENT_NO_COURSE,
+    ANOMALY_ENROLLMENT_NO_PROFESSOR,
+    ANOMALY_ENROLLMENT_DUPLICATE_ID,
+    ANOMALY_GRADE_NO_STUDENT,
+    ANOMALY_GRADE_NO_COURSE,
+    ANOMALY_GRADE_NO_ENROLLMENT,
+    ANOMALY_GRADE_ENROLLMENT_MISMATCH,
+    ANOMALY_GRADE_OUT_OF_RANGE,
+    ANOMALY_GRADE_LETTER_MISMATCH,
+    ANOMALY_GRADE_DUPLICATE_ID,
+    ANOMALY_KIND_COUNT
+} AnomalyKind;
+
+#define VERIFY_MAX_THREADS 8
+#define VERIFY_MIN_CHUNK 4096      // Rows per thread below which the check runs inline
+#define VERIFY_SAMPLES 5           // Row IDs kept per category for the report
+
+typedef struct IntegrityReport {
+    long counts[ANOMALY_KIND_COUNT];
+    int samples[ANOMALY_KIND_COUNT][VERIFY_SAMPLES];
+    int sample_count[ANOMALY_KIND_COUNT];
+    long enrollments_checked;
+    long grades_checked;
+    int threads_used;
+} IntegrityReport;
+
+long verify_data(Enrollment *e_head, Grade *g_head, IntegrityReport *report);
+void display_integrity_report(const IntegrityReport *report);
+
+int delete_student_with_policy(Student **s_head, Enrollment **e_head, Grade **g_head, int id);
+int delete_course_with_policy(Course **c_head, Enrollment **e_head, Grade **g_head, int id);
+int delete_professor_with_policy(Professor **p_head, Enrollment **e_head, Grade **g_head, Course *c_head, int id);
+
+#endif
@@ -0,0 +1,247 @@
+// join.c - Tablo Birleştirme Modülü (Hash Join)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "join.h"
+
+// Walks the rows of a chain or an array side
+// Bir zincir veya dizi girdisinin satırlarını dolaşır
+typedef struct JoinCursor {
+    const JoinSide *side;
+    const void *row;
+    long index;
+} JoinCursor;
+
+static void cursor_init(JoinCursor *cursor, const JoinSide *side) {
+    cursor->side = side;
+    cursor->row = side->first;
+    cursor->index = 0;
+}
+
+static const void* cursor_next(JoinCursor *cursor) {
+    const JoinSide *side = cursor->side;
+    const void *row;
+    if (side->first != NULL || side->base == NULL) {
+        row = cursor->row;
+        if (row != NULL) cursor->row = *(const void * const *)((const char *)row + side->next_offset);
+        return row;
+    }
+    if (cursor->index >= side->count) return NULL;
+    return (const char *)side->base + side->stride * cursor->index++;
+}
+
+// Walks both sides in step until one ends, so only the smaller side is counted
+// İki tarafı biri bitene kadar birlikte dolaşır; yalnızca küçük taraf sayılır
+static int left_is_smaller(const JoinSide *left, const JoinSide *right, long *smaller_count) {
+    JoinCursor a, b;
+    long count = 0;
+    cursor_init(&a, left);
+    cursor_init(&b, right);
+    while (1) {
+        int left_done = (cursor_next(&a) == NULL);
+        int right_done = (cursor_next(&b) == NULL);
+        *smaller_count = count;
+        if (right_done) return 0;
+        if (left_done) return 1;
+        count++;
+    }
+}
+
+// An index-only side can be probed but not scanned
+// Yalnızca indeksten oluşan bir taraf sorgulanabilir ama taranamaz
+static int index_only(const JoinSide *side) {
+    return side->lookup != NULL && side->first == NULL && side->base == NULL;
+}
+
+static unsigned long key_slot(int key, unsigned long mask) {
+    unsigned long h = (unsigned int)key * 2654435761u;
+    return (h ^ (h >> 16)) & mask;
+}
+
+/**
+ * Describes a linked chain of rows, e.g. a course's enrollments through next_by_course.
+ * Bağlı bir satır zincirini tanımlar; örn. bir dersin kayıtları next_by_course üzerinden.
+ * * @param first - First row (NULL for an empty chain)
+ * @param first - İlk satır (boş zincir için NULL)
+ * @param next_offset - offsetof the pointer to the next row
+ * @param next_offset - Sonraki satır pointer'ının offsetof değeri
+ * @param key - Join key of a row
+ * @param key - Bir satırın birleştirme anahtarı
+ * @return The side description
+ * @return Girdi tanımı
+ */
+JoinSide join_chain(const void *first, size_t next_offset, JoinKeyFn key) {
+    JoinSide side;
+    memset(&side, 0, sizeof(side));
+    side.first = first;
+    side.next_offset = next_offset;
+    side.key = key;
+    return side;
+}
+
+/**
+ * Describes a contiguous array of rows, e.g. the grades of an archived semester.
+ * Bitişik bir satır dizisini tanımlar; örn. arşivlenmiş bir dönemin notları.
+ * * @param base - First row
+ * @param base - İlk satır
+ * @param count - Number of rows
+ * @param count - Satır sayısı
+ * @param stride - Size of one row
+ * @param stride - Bir satırın boyutu
+ * @param key - Join key of a row
+ * @param key - Bir satırın birleştirme anahtarı
+ * @return The side description
+ * @return Girdi tanımı
+ */
+JoinSide join_array(const void *base, long count, size_t stride, JoinKeyFn key) {
+    JoinSide side;
+    memset(&side, 0, sizeof(side));
+    side.base = base;
+    side.count = count;
+    side.stride = stride;
+    side.key = key;
+    return side;
+}
+
+/**
+ * Describes a table only through its unique ID index; the table is probed, never scanned.
+ * Bir tabloyu yalnızca tekil ID indeksiyle tanımlar; tablo taranmaz, yalnızca sorgulanır.
+ * * @param lookup - Returns the row with a key, or NULL
+ * @param lookup - Bir anahtara sahip satırı veya NULL döner
+ * @return The side description
+ * @return Girdi tanımı
+ */
+JoinSide join_index(JoinLookupFn lookup) {
+    JoinSide side;
+    memset(&side, 0, sizeof(side));
+    side.lookup = lookup;
+    return side;
+}
+
+/**
+ * Joins two tables on equal keys and emits each (left, right) pair to a callback.
+ * If one side has a unique index, the other side is scanned once and each row probes the index.
+ * Otherwise the smaller side is loaded into a hash table and the larger side probes it, so the
+ * cost is linear in both tables. Rows come out in the order of the scanned (probe) side; matches
+ * of one probe row keep the build side's order. With JOIN_LEFT_OUTER, left rows without a match
+ * are emitted with right = NULL (at the end if the left side was the build side). A left side that
+ * is only an index cannot be scanned for its unmatched rows, so JOIN_LEFT_OUTER rejects it, as does
+ * a join of two index-only sides.
+ * İki tabloyu eşit anahtarlarda birleştirir ve her (sol, sağ) çiftini bir geri çağırmaya iletir.
+ * Bir tarafta tekil indeks varsa diğer taraf bir kez taranır ve her satır indeksi sorgular.
+ * Aksi halde küçük taraf bir hash tablosuna yüklenir ve büyük taraf onu sorgular; maliyet iki
+ * tabloda da doğrusaldır. Satırlar taranan (sorgulayan) tarafın sırasıyla çıkar; bir satırın
+ * eşleşmeleri kurulan tarafın sırasını korur. JOIN_LEFT_OUTER ile eşleşmeyen sol satırlar
+ * sağ = NULL olarak iletilir (sol taraf kurulan tarafsa en sonda). Yalnızca indeksten oluşan bir sol
+ * taraf eşleşmeyen satırları için taranamaz; JOIN_LEFT_OUTER bunu ve iki indeks tarafının
+ * birleştirilmesini reddeder.
+ * * @param left - Left table
+ * @param left - Sol tablo
+ * @param right - Right table
+ * @param right - Sağ tablo
+ * @param mode - JOIN_INNER or JOIN_LEFT_OUTER
+ * @param mode - JOIN_INNER veya JOIN_LEFT_OUTER
+ * @param emit - Receives every output row
+ * @param emit - Her çıktı satırını alır
+ * @param ctx - Passed through to emit
+ * @param ctx - emit'e aynen iletilir
+ * @return Number of rows emitted, or -1 if the join is not supported or memory allocation fails
+ * @return İletilen satır sayısı; desteklenmeyen birleştirmede veya bellek hatasında -1
+ */
+long hash_join(const JoinSide *left, const JoinSide *right, int mode, JoinEmitFn emit, void *ctx) {
+    JoinCursor cursor;
+    const void *row;
+    long emitted = 0, n, i, j;
+
+    if (index_only(left) && (mode == JOIN_LEFT_OUTER || index_only(right))) {
+        printf("Error: Unsupported join (an index-only side cannot be scanned)!\n");
+        return -1;
+    }
+
+    // İndeksli taraf: diğer taraf bir kez taranır
+    if (right->lookup != NULL) {
+        cursor_init(&cursor, left);
+        while ((row = cursor_next(&cursor)) != NULL) {
+            const void *match = right->lookup(left->key(row));
+            if (match != NULL || mode == JOIN_LEFT_OUTER) {
+                emit(row, match, ctx);
+                emitted++;
+            }
+        }
+        return emitted;
+    }
+    if (left->lookup != NULL && mode == JOIN_INNER) {
+        cursor_init(&cursor, right);
+        while ((row = cursor_next(&cursor)) != NULL) {
+            const void *match = left->lookup(right->key(row));
+            if (match != NULL) {
+                emit(match, row, ctx);
+                emitted++;
+            }
+        }
+        return emitted;
+    }
+
+    int build_left = left_is_smaller(left, right, &n);
+    const JoinSide *build = build_left ? left : right;
+    const JoinSide *probe = build_left ? right : left;
+    unsigned long buckets = 1;
+    while (buckets < (unsigned long)n * 2) buckets <<= 1;
+
+    const void **rows = (const void **)malloc((n > 0 ? n : 1) * sizeof(void *));
+    int *keys = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    long *next = (long *)malloc((n > 0 ? n : 1) * sizeof(long));
+    long *heads = (long *)malloc(buckets * sizeof(long));
+    char *matched = (char *)calloc(n > 0 ? n : 1, 1);
+    if (rows == NULL || keys == NULL || next == NULL || heads == NULL || matched == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(rows); free(keys); free(next); free(heads); free(matched);
+        return -1;
+    }
+
+    // Kurulum: zincirler eklenme sırasını korusun diye sondan başa eklenir
+    cursor_init(&cursor, build);
+    for (i = 0; i < n && (row = cursor_next(&cursor)) != NULL; i++) {
+        rows[i] = row;
+        keys[i] = build->key(row);
+    }
+    for (j = 0; j < (long)buckets; j++) heads[j] = -1;
+    for (i = n - 1; i >= 0; i--) {
+        unsigned long slot = key_slot(keys[i], buckets - 1);
+        next[i] = heads[slot];
+        heads[slot] = i;
+    }
+
+    cursor_init(&cursor, probe);
+    while ((row = cursor_next(&cursor)) != NULL) {
+        int key = probe->key(row);
+        int found = 0;
+        for (j = heads[key_slot(key, buckets - 1)]; j >= 0; j = next[j]) {
+            if (keys[j] != key) continue;
+            if (build_left) emit(rows[j], row, ctx);
+            else emit(row, rows[j], ctx);
+            matched[j] = 1;
+            found = 1;
+            emitted++;
+        }
+        if (!found && !build_left && mode == JOIN_LEFT_OUTER) {
+            emit(row, NULL, ctx);
+            emitted++;
+        }
+    }
+    if (build_left && mode == JOIN_LEFT_OUTER) {
+        for (i = 0; i < n; i++) {
+            if (matched[i]) continue;
+            emit(rows[i], NULL, ctx);
+            emitted++;
+        }
+    }
+
+    free(rows);
+    free(keys);
+    free(next);
+    free(heads);
+    free(matched);
+    return emitted;
+}
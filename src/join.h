@@ -0,0 +1,34 @@
+// join.h - Tablo Birleştirme Modülü (Hash Join)
+
+#ifndef JOIN_H
+#define JOIN_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+#define JOIN_INNER 0             // Emit only matching pairs
+#define JOIN_LEFT_OUTER 1        // Also emit left rows without a match, with right = NULL
+
+typedef int (*JoinKeyFn)(const void *row);
+typedef void* (*JoinLookupFn)(int key);
+typedef void (*JoinEmitFn)(const void *left, const void *right, void *ctx);
+
+// One input of a join: a linked chain, a contiguous array or only a unique index on the key
+// Bir birleştirme girdisi: bağlı bir zincir, bitişik bir dizi veya yalnızca anahtar üzerinde tekil bir indeks
+typedef struct JoinSide {
+    const void *first;           // Chain: first row, followed through next_offset
+    size_t next_offset;
+    const void *base;            // Array (first == NULL): count rows, stride bytes apart
+    long count;
+    size_t stride;
+    JoinKeyFn key;               // Join key of a row (needed unless the side is index-only)
+    JoinLookupFn lookup;         // Unique index on the key; if set, this side is probed instead of hashed
+} JoinSide;
+
+JoinSide join_chain(const void *first, size_t next_offset, JoinKeyFn key);
+JoinSide join_array(const void *base, long count, size_t stride, JoinKeyFn key);
+JoinSide join_index(JoinLookupFn lookup);
+long hash_join(const JoinSide *left, const JoinSide *right, int mode, JoinEmitFn emit, void *ctx);
+
+#endif
@@ -1,60 +1,86 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include "menu.h"
-#include "utils.h"
-#include "student.h"
-#include "course.h"
-#include "professor.h"
-#include "enrollment.h"
-#include "grade.h"
-
-/**
- * Application entry point. Initializes data, starts menu, and handles cleanup.
- * Uygulamann giri noktasdr. Verileri balatr, meny balatr ve temizlik ilemlerini yapar.
- * @return 0 on successful termination / Baarl sonlanmada 0 dner
- */
-int main() {
-    // 1. Initialize pointers to NULL / Pointerlar NULL olarak balat
-    Student *student_head = NULL;
-    Course *course_head = NULL;
-    Professor *professor_head = NULL;
-    Enrollment *enrollment_head = NULL;
-    Grade *grade_head = NULL;
-
-    printf("Loading data...\n");
-
-    // 2. Initial data load from CSV (Using address operator &)
-    // CSV dosyalarndan ilk veri yklemesi (Adres operatr & kullanarak)
-    load_students_from_csv(&student_head);
-    load_courses_from_csv(&course_head);
-    load_professors_from_csv(&professor_head);
-    load_enrollments_from_csv(&enrollment_head); 
-    load_grades_from_csv(&grade_head);
-
-    printf("Data loaded successfully.\n");
-
-    // 3. Start the main menu system / Ana men sistemini balat
-    menu_main(&student_head, &course_head, &professor_head, &enrollment_head, &grade_head);
-
-    // 4. Auto-save current data before exit (Important for persistence)
-    // ktan nce mevcut verileri otomatik kaydet (Kalclk iin nemli)
-    printf("Performing Auto-Save before exit...\n");
-    save_students_to_csv(student_head, "data/students.csv");
-    save_courses_to_csv(course_head, "data/courses.csv");
-    save_professors_to_csv(professor_head, "data/professors.csv");
-    save_enrollments_to_csv(enrollment_head, "data/enrollments.csv");
-    save_grades_to_csv(grade_head, "data/grades.csv");
-    printf("Auto-Save completed.\n");
-
-    // 5. Secure exit and memory cleanup (Prevents leaks)
-    // Gvenli k ve bellek temizlii (Szntlar nler)
-    printf("Cleaning up memory...\n");
-    free_all_students(student_head);
-    free_all_courses(course_head);
-    free_all_professors(professor_head);
-    free_all_enrollments(enrollment_head);
-    free_all_grades(grade_head);
-
-    printf("System exited cleanly.\n");
-    return 0;
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "menu.h"
+#include "utils.h"
+#include "student.h"
+#include "course.h"
+#include "professor.h"
+#include "enrollment.h"
+#include "grade.h"
+#include "integrity.h"
+#include "server.h"
+#include "archive.h"
+#include "cube.h"
+
+/**
+ * Application entry point. Initializes data, starts menu, and handles cleanup.
+ * With "--server [socket_path]" the loaded data is served over a Unix socket instead of the menu.
+ * Uygulamanın giriş noktasıdır. Verileri başlatır, menüyü başlatır ve temizlik işlemlerini yapar.
+ * "--server [soket_yolu]" ile yüklenen veriler menü yerine bir Unix soketi üzerinden sunulur.
+ * @param argc - Argument count / Argüman sayısı
+ * @param argv - Argument values / Argüman değerleri
+ * @return 0 on successful termination / Başarılı sonlanmada 0 döner
+ */
+int main(int argc, char *argv[]) {
+    // 1. Initialize pointers to NULL / Pointerları NULL olarak başlat
+    Student *student_head = NULL;
+    Course *course_head = NULL;
+    Professor *professor_head = NULL;
+    Enrollment *enrollment_head = NULL;
+    Grade *grade_head = NULL;
+
+    printf("Loading data...\n");
+
+    // 2. Initial data load from CSV (Using address operator &)
+    // CSV dosyalarından ilk veri yüklemesi (Adres operatörü & kullanarak)
+    // Archives first, so the CSV loaders skip rows of frozen semesters
+    // Önce arşivler; böylece CSV yükleyicileri dondurulmuş dönemlerin satırlarını atlar
+    archive_load_all();
+    load_students_from_csv(&student_head);
+    load_courses_from_csv(&course_head);
+    load_professors_from_csv(&professor_head);
+    load_enrollments_from_csv(&enrollment_head); 
+    load_grades_from_csv(&grade_head);
+    grade_cube_build(grade_head);
+
+    printf("Data loaded successfully.\n");
+
+    // Quick integrity check on every startup / Her açılışta hızlı bütünlük kontrolü
+    IntegrityReport report;
+    long anomalies = verify_data(enrollment_head, grade_head, &report);
+    if (anomalies > 0) {
+        printf("Warning: %ld data anomalies found. See System Options > Verify Data.\n", anomalies);
+    }
+
+    // 3. Start the main menu system or the socket server / Ana menüyü veya soket sunucusunu başlat
+    if (argc > 1 && strcmp(argv[1], "--server") == 0) {
+        ServerData data = {&student_head, &course_head, &professor_head, &enrollment_head, &grade_head};
+        run_server(argc > 2 ? argv[2] : SERVER_DEFAULT_SOCKET, &data);
+    } else {
+        menu_main(&student_head, &course_head, &professor_head, &enrollment_head, &grade_head);
+    }
+
+    // 4. Auto-save current data before exit (Important for persistence)
+    // Çıkıştan önce mevcut verileri otomatik kaydet (Kalıcılık için önemli)
+    printf("Performing Auto-Save before exit...\n");
+    save_students_to_csv(student_head, "data/students.csv");
+    save_courses_to_csv(course_head, "data/courses.csv");
+    save_professors_to_csv(professor_head, "data/professors.csv");
+    save_enrollments_to_csv(enrollment_head, "data/enrollments.csv");
+    save_grades_to_csv(grade_head, "data/grades.csv");
+    printf("Auto-Save completed.\n");
+
+    // 5. Secure exit and memory cleanup (Prevents leaks)
+    // Güvenli çıkış ve bellek temizliği (Sızıntıları önler)
+    printf("Cleaning up memory...\n");
+    free_all_students(student_head);
+    free_all_courses(course_head);
+    free_all_professors(professor_head);
+    free_all_enrollments(enrollment_head);
+    free_all_grades(grade_head);
+    archive_unload_all();
+
+    printf("System exited cleanly.\n");
+    return 0;
+}
@@ -1,431 +1,705 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include "menu.h"
-#include "utils.h"
-#include "curriculum.h"
-
-// --- ANA MEN ---
-void menu_main(Student **s_head, Course **c_head, Professor **p_head, Enrollment **e_head, Grade **g_head) {
-    int choice;
-    do {
-        printf("\n==========================================\n");
-        printf("      STUDENT INFORMATION SYSTEM\n");
-        printf("==========================================\n");
-        printf("1. Student Management\n");
-        printf("2. Course Management\n");
-        printf("3. Professor Management\n");
-        printf("4. Enrollment Management\n");
-        printf("5. Grade Management\n");
-        printf("6. Reports\n");
-        printf("7. System Options\n");
-        printf("8. Graduation Check (Bonus)\n");
-        printf("0. Exit\n");
-        printf("------------------------------------------\n");
-        choice = get_int_input("Enter your choice: ");
-
-        switch (choice) {
-            case 1: menu_student(s_head, c_head, g_head); break;
-            case 2: menu_course(c_head); break;
-            case 3: menu_professor(p_head, e_head, c_head); break;
-            case 4: menu_enrollment(e_head, *s_head, *c_head, *g_head); break;
-            case 5: menu_grade(g_head, *e_head, *s_head, *c_head); break;
-            case 6: menu_reports(*s_head, *c_head, *p_head, *e_head, *g_head); break;
-            case 7: menu_system_options(s_head, c_head, p_head, e_head, g_head); break;
-            case 8: {
-                int sid = get_int_input("Enter Student ID: ");
-                check_graduation_status(sid, *s_head, *g_head, *c_head);
-                break;
-            }
-            case 0: printf("Exiting system...\n"); break;
-            default: printf("Invalid choice.\n");
-        }
-    } while (choice != 0);
-}
-
-// --- 1. RENC YNETM ---
-void menu_student(Student **head, Course **c_head, Grade **g_head) {
-    int choice;
-    do {
-        printf("\n--- STUDENT MANAGEMENT ---\n");
-        printf("1. Add New Student\n");
-        printf("2. Edit Student Info\n");
-        printf("3. Delete Student\n");
-        printf("4. Search & View Details\n");
-        printf("5. View Transcript\n");
-        printf("6. Display All\n");
-        printf("0. Back\n");
-        choice = get_int_input("Choice: ");
-
-        switch(choice) {
-            case 1: {
-                Student new_s;
-                new_s.id = get_validated_id("Enter Student ID (e.g. 2024001): ");
-                if (new_s.id == 0) break;
-                if (find_student_by_id(*head, new_s.id)) {
-                    printf("Error: ID already exists!\n");
-                    break;
-                }
-                get_string_input("First Name: ", new_s.first_name, 50);
-                get_string_input("Last Name: ", new_s.last_name, 50);
-                do {
-                    get_string_input("Email: ", new_s.email, 100);
-                } while (!validate_email(new_s.email));
-                get_string_input("Phone: ", new_s.phone, 20);
-                new_s.enrollment_year = get_int_input("Enrollment Year: ");
-                get_string_input("Major: ", new_s.major, 100);
-                new_s.gpa = 0.0;
-                new_s.next = NULL;
-                add_student(head, &new_s);
-                break;
-            }
-            case 2: {
-                int id = get_int_input("Student ID to edit (0 to cancel): ");
-                if (id == 0) break;
-                Student *s = find_student_by_id(*head, id);
-                if (s) {
-                    Student temp = *s;
-                    char buf[100];
-                    printf("Editing %s %s. Enter new email (0 to skip): ", s->first_name, s->last_name);
-                    get_string_input("", buf, 100);
-                    if(strcmp(buf, "0") != 0 && validate_email(buf)) {
-                        strcpy(temp.email, buf);
-                    }
-                    update_student(s, &temp);
-                } else {
-                    printf("Error: Student not found.\n");
-                }
-                break;
-            }
-            case 3:
-                delete_student(head, get_int_input("ID to delete: "));
-                break;
-            case 4: {
-                int sid = get_int_input("Enter Student ID: ");
-                Student *s = find_student_by_id(*head, sid);
-                if(s) display_student_details(s, *g_head, *c_head);
-                else printf("Error: Not found.\n");
-                break;
-            }
-            case 5: {
-                int sid = get_int_input("Enter Student ID for Transcript: ");
-                Student *s = find_student_by_id(*head, sid);
-                if(s) display_student_transcript(s, *g_head, *c_head);
-                else printf("Error: Student not found.\n");
-                break;
-            }
-            case 6:
-                display_all_students(*head);
-                break;
-        }
-    } while(choice != 0);
-}
-
-// --- 2. DERS YNETM ---
-void menu_course(Course **head) {
-    int choice;
-    do {
-        printf("\n--- COURSE MANAGEMENT ---\n");
-        printf("1. Add New Course\n");
-        printf("2. Edit Capacity\n");
-        printf("3. Delete Course\n");
-        printf("4. Search & View Details\n");
-        printf("5. Display All\n");
-        printf("0. Back\n");
-        choice = get_int_input("Choice: ");
-
-        switch(choice) {
-            case 1: {
-                Course c;
-                c.id = get_validated_id("Course ID: ");
-                if (c.id == 0) break;
-                if(find_course_by_id(*head, c.id)) {
-                    printf("Error: ID exists!\n");
-                    break;
-                }
-                get_string_input("Code (e.g. CSE102): ", c.code, 20);
-                get_string_input("Name: ", c.name, 100);
-                c.credits = get_int_input("Credits: ");
-                c.capacity = get_int_input("Capacity: ");
-                get_string_input("Prerequisites (0 for none): ", c.prerequisites, 100);
-                if(strcmp(c.prerequisites, "0") == 0) strcpy(c.prerequisites, "");
-                c.next = NULL;
-                add_course(head, &c);
-                break;
-            }
-            case 2: {
-                int id = get_int_input("Course ID: ");
-                Course *c = find_course_by_id(*head, id);
-                if(c) {
-                    Course temp = *c;
-                    temp.capacity = get_int_input("New Capacity: ");
-                    update_course(c, &temp);
-                } else printf("Not found.\n");
-                break;
-            }
-            case 3:
-                delete_course(head, get_int_input("ID to delete: "));
-                break;
-            case 4: {
-                char code[20];
-                get_string_input("Enter Course Code: ", code, 20);
-                Course *c = find_course_by_code(*head, code);
-                if(c) display_course_details(c);
-                else printf("Not found.\n");
-                break;
-            }
-            case 5:
-                display_all_courses(*head);
-                break;
-        }
-    } while(choice != 0);
-}
-
-// --- 3. PROFESR YNETM ---
-void menu_professor(Professor **head, Enrollment **e_head, Course **c_head) {
-    int choice;
-    do {
-        printf("\n--- PROFESSOR MANAGEMENT ---\n");
-        printf("1. Add Professor\n");
-        printf("2. Edit Info\n");
-        printf("3. Delete Professor\n");
-        printf("4. Search & Details\n");
-        printf("5. View Professor's Course Load\n");
-        printf("6. Display All\n");
-        printf("0. Back\n");
-        choice = get_int_input("Choice: ");
-
-        switch(choice) {
-            case 1: {
-                Professor p;
-                p.id = get_validated_id("ID: ");
-                if (p.id == 0) break;
-                get_string_input("First Name: ", p.first_name, 50);
-                get_string_input("Last Name: ", p.last_name, 50);
-                get_string_input("Email: ", p.email, 100);
-                get_string_input("Office: ", p.office, 20);
-                p.next = NULL;
-                add_professor(head, &p);
-                break;
-            }
-            case 2: {
-                int id = get_int_input("Professor ID to edit: ");
-                Professor *p = find_professor_by_id(*head, id);
-                if (p) {
-                    Professor temp = *p;
-                    get_string_input("New Office (0 to skip): ", temp.office, 20);
-                    update_professor(p, &temp);
-                } else printf("Not found.\n");
-                break;
-            }
-            case 3:
-                delete_professor(head, get_int_input("ID to delete: "));
-                break;
-            case 4: {
-                int id = get_int_input("Professor ID: ");
-                Professor *p = find_professor_by_id(*head, id);
-                if(p) display_professor_details(p);
-                else printf("Not found.\n");
-                break;
-            }
-            case 5: {
-                int id = get_int_input("Professor ID: ");
-                Professor *p = find_professor_by_id(*head, id);
-                if(p) display_professor_courses(id, *e_head, *c_head);
-                else printf("Not found.\n");
-                break;
-            }
-            case 6:
-                display_all_professors(*head);
-                break;
-        }
-    } while(choice != 0);
-}
-
-// --- 4. KAYIT YNETM ---
-void menu_enrollment(Enrollment **e_head, Student *s_head, Course *c_head, Grade *g_head) {
-    int choice;
-    do {
-        printf("\n--- ENROLLMENT MANAGEMENT ---\n");
-        printf("1. Enroll Student\n");
-        printf("2. Drop Student\n");
-        printf("3. View Student Enrollments\n");
-        printf("4. View Course Roster\n");
-        printf("0. Back\n");
-        choice = get_int_input("Choice: ");
-
-        switch(choice) {
-            case 1: {
-                int sid = get_int_input("Student ID: ");
-                if (!find_student_by_id(s_head, sid)) {
-                    printf("Error: Student not found.\n");
-                    break;
-                }
-                int cid = get_int_input("Course ID: ");
-                Course *c = find_course_by_id(c_head, cid);
-                if (!c) {
-                    printf("Error: Course not found.\n");
-                    break;
-                }
-                // Kapasite ve nkoul Kontrol
-                if (get_enrollment_count(*e_head, cid) >= c->capacity) {
-                    printf("Error: Course Full!\n");
-                    break;
-                }
-                if (!check_prerequisites(sid, c, g_head, *e_head)) {
-                    printf("Error: Prerequisite not met!\n");
-                    break;
-                }
-                
-                Enrollment e;
-                e.student_id = sid;
-                e.course_id = cid;
-                e.professor_id = get_int_input("Assign Professor ID: ");
-                get_string_input("Semester (e.g. 2024-FALL): ", e.semester, 20);
-                get_current_date(e.date);
-                strcpy(e.status, "Enrolled");
-                e.id = get_next_enrollment_id(*e_head);
-                e.next = NULL;
-                add_enrollment(e_head, &e);
-                break;
-            }
-            case 2: {
-                int sid = get_int_input("Student ID: ");
-                int cid = get_int_input("Course ID: ");
-                drop_enrollment(e_head, sid, cid);
-                break;
-            }
-            case 3:
-                display_student_enrollments(*e_head, get_int_input("Student ID: "));
-                break;
-            case 4:
-                display_course_roster(*e_head, get_int_input("Course ID: "));
-                break;
-        }
-    } while(choice != 0);
-}
-
-// --- 5. NOT YNETM ---
-void menu_grade(Grade **g_head, Enrollment *e_head, Student *s_head, Course *c_head) {
-    int choice;
-    do {
-        printf("\n--- GRADE MANAGEMENT ---\n");
-        printf("1. Record/Update Grade\n");
-        printf("2. View Course Statistics\n");
-        printf("3. Grade Distribution\n");
-        printf("0. Back\n");
-        choice = get_int_input("Choice: ");
-
-        switch(choice) {
-            case 1: {
-                int sid = get_int_input("Student ID: ");
-                int cid = get_int_input("Course ID: ");
-                if (!is_student_enrolled(e_head, sid, cid)) {
-                    printf("Error: Student is not enrolled in this course!\n");
-                    break;
-                }
-                float val = get_float_input("Grade (0-100): ");
-                Grade *existing = find_student_course_grade(*g_head, sid, cid);
-                if (existing) {
-                    update_grade(existing, val, NULL);
-                } else {
-                    Grade g;
-                    g.student_id = sid;
-                    g.course_id = cid;
-                    g.numeric_grade = val;
-                    numeric_to_letter(g.numeric_grade, g.letter_grade);
-                    get_string_input("Semester: ", g.semester, 20);
-                    g.id = get_next_grade_id(*g_head);
-                    g.next = NULL;
-                    add_grade(g_head, &g);
-                }
-                calculate_all_gpas(s_head, *g_head, c_head);
-                break;
-            }
-            case 2:
-                display_grade_statistics(*g_head, get_int_input("Course ID: "));
-                break;
-            case 3:
-                display_grade_distribution(*g_head, get_int_input("Course ID: "));
-                break;
-        }
-    } while(choice != 0);
-}
-
-// --- 6. RAPORLAR ---
-void menu_reports(Student *s_head, Course *c_head, Professor *p_head, Enrollment *e_head, Grade *g_head) {
-    int choice;
-    do {
-        printf("\n--- REPORTS ---\n");
-        printf("1. Transcript\n");
-        printf("2. Course Roster\n");
-        printf("3. Grade Statistics\n");
-        printf("4. Professor Course Load\n");
-        printf("0. Back\n");
-        choice = get_int_input("Choice: ");
-
-        switch(choice) {
-            case 1: {
-                int sid = get_int_input("Enter Student ID: ");
-                Student *s = find_student_by_id(s_head, sid);
-                if(s) display_student_transcript(s, g_head, c_head);
-                else printf("Student not found.\n");
-                break;
-            }
-            case 2:
-                display_course_roster(e_head, get_int_input("Course ID: "));
-                break;
-            case 3:
-                display_grade_statistics(g_head, get_int_input("Course ID: "));
-                break;
-            case 4: {
-                int pid = get_int_input("Professor ID: ");
-                display_professor_courses(pid, e_head, c_head);
-                break;
-            }
-        }
-    } while(choice != 0);
-}
-
-// --- 7. SSTEM SEENEKLER ---
-void menu_system_options(Student **s_head, Course **c_head, Professor **p_head, Enrollment **e_head, Grade **g_head) {
-    int choice;
-    printf("\n--- SYSTEM OPTIONS ---\n");
-    printf("1. Save Data\n");
-    printf("2. Load Sample Data\n");
-    printf("3. Create Backup\n");
-    printf("0. Back\n");
-    choice = get_int_input("Choice: ");
-
-    switch(choice) {
-        case 1:
-            save_students_to_csv(*s_head, "data/students.csv");
-            save_courses_to_csv(*c_head, "data/courses.csv");
-            save_professors_to_csv(*p_head, "data/professors.csv");
-            save_enrollments_to_csv(*e_head, "data/enrollments.csv");
-            save_grades_to_csv(*g_head, "data/grades.csv");
-            printf("Success: All data saved.\n");
-            break;
-        case 2:
-            free_all_students(*s_head); *s_head = NULL;
-            free_all_courses(*c_head); *c_head = NULL;
-            free_all_professors(*p_head); *p_head = NULL;
-            free_all_enrollments(*e_head); *e_head = NULL;
-            free_all_grades(*g_head); *g_head = NULL;
-            load_students_from_csv(s_head);
-            load_courses_from_csv(c_head);
-            load_professors_from_csv(p_head);
-            load_enrollments_from_csv(e_head);
-            load_grades_from_csv(g_head);
-            printf("Success: Sample data loaded from CSV files.\n");
-            break;
-        case 3:
-            save_students_to_csv(*s_head, "data/students_backup.csv");
-            save_courses_to_csv(*c_head, "data/courses_backup.csv");
-            save_professors_to_csv(*p_head, "data/professors_backup.csv");
-            save_enrollments_to_csv(*e_head, "data/enrollments_backup.csv");
-            save_grades_to_csv(*g_head, "data/grades_backup.csv");
-            printf("Success: Backup files created.\n");
-            break;
-    }
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "menu.h"
+#include "utils.h"
+#include "curriculum.h"
+#include "waitlist.h"
+#include "registration.h"
+#include "archive.h"
+#include "ranking.h"
+#include "transcript.h"
+#include "cube.h"
+
+#define SEARCH_MAX_RESULTS 50
+
+// --- ANA MENÜ ---
+void menu_main(Student **s_head, Course **c_head, Professor **p_head, Enrollment **e_head, Grade **g_head) {
+    int choice;
+    do {
+        printf("\n==========================================\n");
+        printf("      STUDENT INFORMATION SYSTEM\n");
+        printf("==========================================\n");
+        printf("1. Student Management\n");
+        printf("2. Course Management\n");
+        printf("3. Professor Management\n");
+        printf("4. Enrollment Management\n");
+        printf("5. Grade Management\n");
+        printf("6. Reports\n");
+        printf("7. System Options\n");
+        printf("8. Graduation Check (Bonus)\n");
+        printf("9. Quick Search (Name/Email Prefix)\n");
+        printf("0. Exit\n");
+        printf("------------------------------------------\n");
+        choice = get_int_input("Enter your choice: ");
+
+        switch (choice) {
+            case 1: menu_student(s_head, c_head, e_head, g_head); break;
+            case 2: menu_course(c_head, e_head, g_head); break;
+            case 3: menu_professor(p_head, e_head, c_head, g_head); break;
+            case 4: menu_enrollment(e_head, *s_head, *c_head, *g_head); break;
+            case 5: menu_grade(g_head, *e_head, *s_head, *c_head); break;
+            case 6: menu_reports(*s_head, *c_head, *p_head, *e_head, *g_head); break;
+            case 7: menu_system_options(s_head, c_head, p_head, e_head, g_head); break;
+            case 8: {
+                int sid = get_int_input("Enter Student ID: ");
+                check_graduation_status(sid, *s_head, *g_head, *c_head);
+                break;
+            }
+            case 9: menu_search(*s_head, *p_head); break;
+            case 0: printf("Exiting system...\n"); break;
+            default: printf("Invalid choice.\n");
+        }
+    } while (choice != 0);
+}
+
+// --- 1. ÖĞRENCİ YÖNETİMİ ---
+void menu_student(Student **head, Course **c_head, Enrollment **e_head, Grade **g_head) {
+    int choice;
+    do {
+        printf("\n--- STUDENT MANAGEMENT ---\n");
+        printf("1. Add New Student\n");
+        printf("2. Edit Student Info\n");
+        printf("3. Delete Student\n");
+        printf("4. Search & View Details\n");
+        printf("5. View Transcript\n");
+        printf("6. Display All\n");
+        printf("7. GPA History By Term\n");
+        printf("0. Back\n");
+        choice = get_int_input("Choice: ");
+
+        switch(choice) {
+            case 1: {
+                Student new_s;
+                new_s.id = get_validated_id("Enter Student ID (e.g. 2024001): ");
+                if (new_s.id == 0) break;
+                if (find_student_by_id(*head, new_s.id)) {
+                    printf("Error: ID already exists!\n");
+                    break;
+                }
+                get_string_input("First Name: ", new_s.first_name, 50);
+                get_string_input("Last Name: ", new_s.last_name, 50);
+                do {
+                    get_string_input("Email: ", new_s.email, 100);
+                } while (!validate_email(new_s.email));
+                get_string_input("Phone: ", new_s.phone, 20);
+                new_s.enrollment_year = get_int_input("Enrollment Year: ");
+                get_string_input("Major: ", new_s.major, 100);
+                new_s.gpa = 0.0;
+                new_s.next = NULL;
+                add_student(head, &new_s);
+                break;
+            }
+            case 2: {
+                int id = get_int_input("Student ID to edit (0 to cancel): ");
+                if (id == 0) break;
+                Student *s = find_student_by_id(*head, id);
+                if (s) {
+                    Student temp = *s;
+                    char buf[100];
+                    printf("Editing %s %s. Enter new email (0 to skip): ", s->first_name, s->last_name);
+                    get_string_input("", buf, 100);
+                    if(strcmp(buf, "0") != 0 && validate_email(buf)) {
+                        strcpy(temp.email, buf);
+                    }
+                    update_student(s, &temp);
+                } else {
+                    printf("Error: Student not found.\n");
+                }
+                break;
+            }
+            case 3:
+                delete_student_with_policy(head, e_head, g_head, get_int_input("ID to delete: "));
+                break;
+            case 4: {
+                int sid = get_int_input("Enter Student ID: ");
+                Student *s = find_student_by_id(*head, sid);
+                if(s) display_student_details(s, *g_head, *c_head);
+                else printf("Error: Not found.\n");
+                break;
+            }
+            case 5: {
+                int sid = get_int_input("Enter Student ID for Transcript: ");
+                Student *s = find_student_by_id(*head, sid);
+                if(s) display_student_transcript(s, *g_head, *c_head);
+                else printf("Error: Student not found.\n");
+                break;
+            }
+            case 6:
+                display_all_students(*head);
+                break;
+            case 7: {
+                Student *s = find_student_by_id(*head, get_int_input("Enter Student ID: "));
+                if (s) display_student_gpa_history(s);
+                else printf("Error: Student not found.\n");
+                break;
+            }
+        }
+    } while(choice != 0);
+}
+
+// --- 2. DERS YÖNETİMİ ---
+void menu_course(Course **head, Enrollment **e_head, Grade **g_head) {
+    int choice;
+    do {
+        printf("\n--- COURSE MANAGEMENT ---\n");
+        printf("1. Add New Course\n");
+        printf("2. Edit Capacity\n");
+        printf("3. Delete Course\n");
+        printf("4. Search & View Details\n");
+        printf("5. Display All\n");
+        printf("0. Back\n");
+        choice = get_int_input("Choice: ");
+
+        switch(choice) {
+            case 1: {
+                Course c;
+                c.id = get_validated_id("Course ID: ");
+                if (c.id == 0) break;
+                if(find_course_by_id(*head, c.id)) {
+                    printf("Error: ID exists!\n");
+                    break;
+                }
+                get_string_input("Code (e.g. CSE102): ", c.code, 20);
+                get_string_input("Name: ", c.name, 100);
+                c.credits = get_int_input("Credits: ");
+                c.capacity = get_int_input("Capacity: ");
+                get_string_input("Prerequisites (0 for none): ", c.prerequisites, 100);
+                if(strcmp(c.prerequisites, "0") == 0) strcpy(c.prerequisites, "");
+                c.next = NULL;
+                add_course(head, &c);
+                break;
+            }
+            case 2: {
+                int id = get_int_input("Course ID: ");
+                Course *c = find_course_by_id(*head, id);
+                if(c) {
+                    Course temp = *c;
+                    temp.capacity = get_int_input("New Capacity: ");
+                    update_course(c, &temp);
+                } else printf("Not found.\n");
+                break;
+            }
+            case 3:
+                delete_course_with_policy(head, e_head, g_head, get_int_input("ID to delete: "));
+                break;
+            case 4: {
+                char code[20];
+                get_string_input("Enter Course Code: ", code, 20);
+                Course *c = find_course_by_code(*head, code);
+                if(c) display_course_details(c);
+                else printf("Not found.\n");
+                break;
+            }
+            case 5:
+                display_all_courses(*head);
+                break;
+        }
+    } while(choice != 0);
+}
+
+// --- 3. PROFESÖR YÖNETİMİ ---
+void menu_professor(Professor **head, Enrollment **e_head, Course **c_head, Grade **g_head) {
+    int choice;
+    do {
+        printf("\n--- PROFESSOR MANAGEMENT ---\n");
+        printf("1. Add Professor\n");
+        printf("2. Edit Info\n");
+        printf("3. Delete Professor\n");
+        printf("4. Search & Details\n");
+        printf("5. View Professor's Course Load\n");
+        printf("6. Display All\n");
+        printf("0. Back\n");
+        choice = get_int_input("Choice: ");
+
+        switch(choice) {
+            case 1: {
+                Professor p;
+                p.id = get_validated_id("ID: ");
+                if (p.id == 0) break;
+                get_string_input("First Name: ", p.first_name, 50);
+                get_string_input("Last Name: ", p.last_name, 50);
+                get_string_input("Email: ", p.email, 100);
+                get_string_input("Office: ", p.office, 20);
+                p.next = NULL;
+                add_professor(head, &p);
+                break;
+            }
+            case 2: {
+                int id = get_int_input("Professor ID to edit: ");
+                Professor *p = find_professor_by_id(*head, id);
+                if (p) {
+                    Professor temp = *p;
+                    get_string_input("New Office (0 to skip): ", temp.office, 20);
+                    update_professor(p, &temp);
+                } else printf("Not found.\n");
+                break;
+            }
+            case 3:
+                delete_professor_with_policy(head, e_head, g_head, *c_head, get_int_input("ID to delete: "));
+                break;
+            case 4: {
+                int id = get_int_input("Professor ID: ");
+                Professor *p = find_professor_by_id(*head, id);
+                if(p) display_professor_details(p);
+                else printf("Not found.\n");
+                break;
+            }
+            case 5: {
+                int id = get_int_input("Professor ID: ");
+                Professor *p = find_professor_by_id(*head, id);
+                if(p) display_professor_courses(id, *e_head, *c_head);
+                else printf("Not found.\n");
+                break;
+            }
+            case 6:
+                display_all_professors(*head);
+                break;
+        }
+    } while(choice != 0);
+}
+
+// --- 4. KAYIT YÖNETİMİ ---
+void menu_enrollment(Enrollment **e_head, Student *s_head, Course *c_head, Grade *g_head) {
+    int choice;
+    do {
+        printf("\n--- ENROLLMENT MANAGEMENT ---\n");
+        printf("1. Enroll Student\n");
+        printf("2. Drop Student\n");
+        printf("3. View Student Enrollments\n");
+        printf("4. View Course Roster\n");
+        printf("5. View Course Waitlist\n");
+        printf("6. Bulk Registration From File\n");
+        printf("0. Back\n");
+        choice = get_int_input("Choice: ");
+
+        switch(choice) {
+            case 1: {
+                int sid = get_int_input("Student ID: ");
+                if (!find_student_by_id(s_head, sid)) {
+                    printf("Error: Student not found.\n");
+                    break;
+                }
+                int cid = get_int_input("Course ID: ");
+                Course *c = find_course_by_id(c_head, cid);
+                if (!c) {
+                    printf("Error: Course not found.\n");
+                    break;
+                }
+                // Kapasite ve Önkoşul Kontrolü (erken uyarı; kesin kontrol enroll_student içinde)
+                if (get_enrollment_count(*e_head, cid) >= c->capacity) {
+                    printf("Course Full! The student will be placed on the waitlist.\n");
+                }
+                if (!check_prerequisites(sid, c, g_head, *e_head)) {
+                    printf("Error: Prerequisite not met!\n");
+                    break;
+                }
+                
+                char semester[20];
+                int pid = get_int_input("Assign Professor ID: ");
+                get_string_input("Semester (e.g. 2024-FALL): ", semester, 20);
+                EnrollResult result = enroll_student(e_head, g_head, sid, cid, pid, semester, NULL);
+                if (result == ENROLL_COURSE_FULL) {
+                    if (waitlist_add(sid, cid, pid, semester) > 0) {
+                        printf("Success: Added to the waitlist at position %d.\n", waitlist_position(sid, cid));
+                    }
+                } else if (result == ENROLL_PREREQUISITE) printf("Error: Prerequisite not met!\n");
+                else if (result != ENROLL_OK) printf("Error: %s.\n", enroll_result_message(result));
+                break;
+            }
+            case 2: {
+                int sid = get_int_input("Student ID: ");
+                int cid = get_int_input("Course ID: ");
+                drop_enrollment(e_head, sid, cid);
+                break;
+            }
+            case 3:
+                display_student_enrollments(*e_head, get_int_input("Student ID: "));
+                break;
+            case 4:
+                display_course_roster(*e_head, get_int_input("Course ID: "));
+                break;
+            case 5:
+                display_course_waitlist(get_int_input("Course ID: "));
+                break;
+            case 6: {
+                char request_file[256];
+                unsigned long seed = 0;
+                get_string_input("Request file (student_id,course_id,professor_id,semester): ", request_file, 256);
+                printf("1. Submission order  2. Lottery\n");
+                RegistrationPolicy policy = (get_int_input("Seat policy: ") == 2) ? REGISTRATION_LOTTERY : REGISTRATION_SUBMISSION;
+                if (policy == REGISTRATION_LOTTERY) seed = (unsigned long)get_int_input("Lottery seed: ");
+                bulk_register_from_csv(e_head, g_head, request_file, REGISTRATION_REPORT_FILE, policy, seed, NULL);
+                break;
+            }
+        }
+    } while(choice != 0);
+}
+
+// --- 5. NOT YÖNETİMİ ---
+void menu_grade(Grade **g_head, Enrollment *e_head, Student *s_head, Course *c_head) {
+    int choice;
+    do {
+        printf("\n--- GRADE MANAGEMENT ---\n");
+        printf("1. Record/Update Grade\n");
+        printf("2. View Course Statistics\n");
+        printf("3. Grade Distribution\n");
+        printf("4. Import Grade Sheet (CSV)\n");
+        printf("5. Curve Course Grades\n");
+        printf("0. Back\n");
+        choice = get_int_input("Choice: ");
+
+        switch(choice) {
+            case 1: {
+                int sid = get_int_input("Student ID: ");
+                int cid = get_int_input("Course ID: ");
+                if (!is_student_enrolled(e_head, sid, cid)) {
+                    printf("Error: Student is not enrolled in this course!\n");
+                    break;
+                }
+                float val = get_float_input("Grade (0-100): ");
+                Grade *existing = find_student_course_grade(*g_head, sid, cid);
+                if (existing) {
+                    update_grade(existing, val, NULL);
+                } else {
+                    Grade g;
+                    Enrollment *e;
+                    Student *s = find_student_by_id(s_head, sid);
+                    g.enrollment_id = 0;
+                    for (e = (s != NULL) ? s->first_enrollment : NULL; e != NULL; e = e->next_by_student) {
+                        if (e->course_id == cid && strcmp(e->status, "Dropped") != 0) g.enrollment_id = e->id;
+                    }
+                    g.student_id = sid;
+                    g.course_id = cid;
+                    g.numeric_grade = val;
+                    numeric_to_letter(g.numeric_grade, g.letter_grade);
+                    get_string_input("Semester: ", g.semester, 20);
+                    g.id = get_next_grade_id(*g_head);
+                    g.next = NULL;
+                    add_grade(g_head, &g);
+                }
+                calculate_all_gpas(s_head, *g_head, c_head);
+                break;
+            }
+            case 2:
+                display_grade_statistics(*g_head, get_int_input("Course ID: "));
+                break;
+            case 3:
+                display_grade_distribution(*g_head, get_int_input("Course ID: "));
+                break;
+            case 4: {
+                char sheet[256];
+                int cid = get_int_input("Course ID (0 = any course in the sheet): ");
+                get_string_input("Grade sheet (student_id,course_id,numeric): ", sheet, 256);
+                import_grades_from_csv(g_head, c_head, sheet, cid, NULL);
+                break;
+            }
+            case 5: {
+                CurveSpec spec;
+                CurveReport report;
+                int cid = get_int_input("Course ID: ");
+                printf("1. Shift by points  2. Scale to target mean  3. Raise a percentile to a target score\n");
+                int method = get_int_input("Curve method: ");
+                if (method < 1 || method > 3) {
+                    printf("Invalid choice.\n");
+                    break;
+                }
+                spec.method = (CurveMethod)(method - 1);
+                spec.percentile = 0.0f;
+                if (spec.method == CURVE_PERCENTILE) spec.percentile = get_float_input("Percentile (0-100): ");
+                spec.amount = get_float_input(spec.method == CURVE_SHIFT ? "Points to add: " :
+                                              spec.method == CURVE_SCALE_TO_MEAN ? "Target mean: " : "Target score: ");
+                // Önce önizleme; onaylanırsa uygulanır
+                if (!curve_course_grades(c_head, cid, &spec, 1, &report)) break;
+                display_curve_report(&report);
+                if (get_int_input("Apply this curve? (1 = yes): ") == 1) {
+                    curve_course_grades(c_head, cid, &spec, 0, &report);
+                }
+                break;
+            }
+        }
+    } while(choice != 0);
+}
+
+// --- 6. RAPORLAR ---
+void menu_reports(Student *s_head, Course *c_head, Professor *p_head, Enrollment *e_head, Grade *g_head) {
+    int choice;
+    do {
+        printf("\n--- REPORTS ---\n");
+        printf("1. Transcript\n");
+        printf("2. Course Roster\n");
+        printf("3. Grade Statistics\n");
+        printf("4. Professor Course Load\n");
+        printf("5. Faculty Workload Summary\n");
+        printf("6. Term Range Report\n");
+        printf("7. Enrollments By Date Range\n");
+        printf("8. Class Ranking (Top-K)\n");
+        printf("9. Dean's List\n");
+        printf("10. Export Full Class Ranking (CSV)\n");
+        printf("11. Batch Transcripts\n");
+        printf("12. Grade Cube (Drill-Down)\n");
+        printf("0. Back\n");
+        choice = get_int_input("Choice: ");
+
+        switch(choice) {
+            case 1: {
+                int sid = get_int_input("Enter Student ID: ");
+                Student *s = find_student_by_id(s_head, sid);
+                if(s) display_student_transcript(s, g_head, c_head);
+                else printf("Student not found.\n");
+                break;
+            }
+            case 2:
+                display_course_roster(e_head, get_int_input("Course ID: "));
+                break;
+            case 3:
+                display_grade_statistics(g_head, get_int_input("Course ID: "));
+                break;
+            case 4: {
+                int pid = get_int_input("Professor ID: ");
+                display_professor_courses(pid, e_head, c_head);
+                break;
+            }
+            case 5:
+                display_faculty_workload(p_head);
+                break;
+            case 6: {
+                char from[20], to[20];
+                get_string_input("From semester (e.g. 2021-SPRING): ", from, 20);
+                get_string_input("To semester (empty = same): ", to, 20);
+                int from_term = semester_to_term(from);
+                int to_term = (strlen(to) == 0) ? from_term : semester_to_term(to);
+                if (from_term == TERM_NONE || to_term == TERM_NONE) {
+                    printf("Error: Semesters must look like 2023-FALL (WINTER, SPRING, SUMMER or FALL).\n");
+                    break;
+                }
+                display_term_range_report(g_head, from_term, to_term);
+                display_enrollment_term_summary(e_head, from_term, to_term);
+                break;
+            }
+            case 7: {
+                char from[20], to[20];
+                get_string_input("From date (YYYY-MM-DD, empty = 30 days ago): ", from, 20);
+                get_string_input("To date (YYYY-MM-DD, empty = today): ", to, 20);
+                int to_day = (strlen(to) == 0) ? current_day() : date_to_day(to);
+                int from_day = (strlen(from) == 0) ? to_day - 30 : date_to_day(from);
+                if (from_day == DAY_NONE || to_day == DAY_NONE) {
+                    printf("Error: Dates must be valid YYYY-MM-DD dates from 1970 on.\n");
+                    break;
+                }
+                display_enrollments_in_date_range(e_head, from_day, to_day);
+                break;
+            }
+            case 8: {
+                char major[100];
+                get_string_input("Major (empty = all): ", major, 100);
+                int year = get_int_input("Enrollment year (0 = all): ");
+                int k = get_int_input("How many students (K): ");
+                if (k < 1 || k > RANKING_MAX_K) {
+                    printf("Error: K must be between 1 and %d.\n", RANKING_MAX_K);
+                    break;
+                }
+                display_class_ranking(s_head, major, year, k);
+                break;
+            }
+            case 9: {
+                char semester[20];
+                get_string_input("Semester (e.g. 2023-FALL): ", semester, 20);
+                int term = semester_to_term(semester);
+                if (term == TERM_NONE) {
+                    printf("Error: Semesters must look like 2023-FALL (WINTER, SPRING, SUMMER or FALL).\n");
+                    break;
+                }
+                display_deans_list(s_head, term, DEANS_LIST_MIN_GPA, DEANS_LIST_MIN_CREDITS);
+                break;
+            }
+            case 10:
+                save_ranking_to_csv(s_head, RANKING_FILE);
+                break;
+            case 11: {
+                printf("1. One file per student (%s)  2. Single file (%s)\n", TRANSCRIPT_DIR, TRANSCRIPT_BATCH_FILE);
+                int layout = get_int_input("Layout: ");
+                if (layout == 1) generate_transcripts(s_head, TRANSCRIPT_PER_STUDENT, TRANSCRIPT_DIR, NULL);
+                else if (layout == 2) generate_transcripts(s_head, TRANSCRIPT_SINGLE_FILE, TRANSCRIPT_BATCH_FILE, NULL);
+                else printf("Invalid choice.\n");
+                break;
+            }
+            case 12:
+                menu_grade_cube(g_head);
+                break;
+        }
+    } while(choice != 0);
+}
+
+// --- 6.12 NOT KÜPÜ (BÖLÜM × DÖNEM × DERS) ---
+void menu_grade_cube(Grade *g_head) {
+    CubeFilter filter;
+    int choice;
+    cube_filter_clear(&filter);
+    do {
+        printf("\n--- GRADE CUBE ---\n");
+        printf("1. By Department\n");
+        printf("2. By Semester\n");
+        printf("3. By Course\n");
+        printf("4. Overall\n");
+        printf("5. Drill Into Department\n");
+        printf("6. Drill Into Semester Range\n");
+        printf("7. Drill Into Course\n");
+        printf("8. Clear Filter\n");
+        printf("0. Back\n");
+        choice = get_int_input("Choice: ");
+
+        switch(choice) {
+            case 1: display_cube_rollup(g_head, CUBE_BY_DEPARTMENT, &filter); break;
+            case 2: display_cube_rollup(g_head, CUBE_BY_TERM, &filter); break;
+            case 3: display_cube_rollup(g_head, CUBE_BY_COURSE, &filter); break;
+            case 4: display_cube_rollup(g_head, CUBE_BY_ALL, &filter); break;
+            case 5:
+                get_string_input("Department (empty = all): ", filter.department, 50);
+                break;
+            case 6: {
+                char from[20], to[20];
+                get_string_input("From semester (empty = first): ", from, 20);
+                get_string_input("To semester (empty = last): ", to, 20);
+                int from_term = (strlen(from) == 0) ? TERM_NONE : semester_to_term(from);
+                int to_term = (strlen(to) == 0) ? TERM_NONE : semester_to_term(to);
+                if ((strlen(from) > 0 && from_term == TERM_NONE) || (strlen(to) > 0 && to_term == TERM_NONE)) {
+                    printf("Error: Semesters must look like 2023-FALL (WINTER, SPRING, SUMMER or FALL).\n");
+                    break;
+                }
+                filter.from_term = from_term;
+                filter.to_term = to_term;
+                break;
+            }
+            case 7:
+                filter.course_id = get_int_input("Course ID (0 = all): ");
+                break;
+            case 8:
+                cube_filter_clear(&filter);
+                printf("Filter cleared.\n");
+                break;
+        }
+    } while(choice != 0);
+}
+
+// --- 7. SİSTEM SEÇENEKLERİ ---
+void menu_system_options(Student **s_head, Course **c_head, Professor **p_head, Enrollment **e_head, Grade **g_head) {
+    int choice;
+    printf("\n--- SYSTEM OPTIONS ---\n");
+    printf("1. Save Data\n");
+    printf("2. Load Sample Data\n");
+    printf("3. Create Backup\n");
+    printf("4. Index Statistics\n");
+    printf("5. Delete Policy (current: %s)\n", delete_mode_name(get_delete_mode()));
+    printf("6. Verify Data\n");
+    printf("7. Semester Rollover\n");
+    printf("8. Archive Closed Semester\n");
+    printf("0. Back\n");
+    choice = get_int_input("Choice: ");
+
+    switch(choice) {
+        case 1:
+            save_students_to_csv(*s_head, "data/students.csv");
+            save_courses_to_csv(*c_head, "data/courses.csv");
+            save_professors_to_csv(*p_head, "data/professors.csv");
+            save_enrollments_to_csv(*e_head, "data/enrollments.csv");
+            save_grades_to_csv(*g_head, "data/grades.csv");
+            printf("Success: All data saved.\n");
+            break;
+        case 2:
+            free_all_students(*s_head); *s_head = NULL;
+            free_all_courses(*c_head); *c_head = NULL;
+            free_all_professors(*p_head); *p_head = NULL;
+            free_all_enrollments(*e_head); *e_head = NULL;
+            free_all_grades(*g_head); *g_head = NULL;
+            archive_load_all();
+            load_students_from_csv(s_head);
+            load_courses_from_csv(c_head);
+            load_professors_from_csv(p_head);
+            load_enrollments_from_csv(e_head);
+            load_grades_from_csv(g_head);
+            grade_cube_build(*g_head);
+            printf("Success: Sample data loaded from CSV files.\n");
+            break;
+        case 3:
+            save_students_to_csv(*s_head, "data/students_backup.csv");
+            save_courses_to_csv(*c_head, "data/courses_backup.csv");
+            save_professors_to_csv(*p_head, "data/professors_backup.csv");
+            save_enrollments_to_csv(*e_head, "data/enrollments_backup.csv");
+            save_grades_to_csv(*g_head, "data/grades_backup.csv");
+            printf("Success: Backup files created.\n");
+            break;
+        case 4:
+            printf("\n%-12s %8s %10s %10s %10s %10s %10s\n", "Table", "IDs", "Bits", "Queries", "Skipped", "False Pos.", "FP Rate");
+            printf("--------------------------------------------------------------------------------\n");
+            display_student_filter_stats();
+            display_course_filter_stats();
+            display_professor_filter_stats();
+            display_enrollment_filter_stats();
+            display_grade_filter_stats();
+            break;
+        case 5: {
+            printf("0. Orphan   - delete only the record (default)\n");
+            printf("1. Restrict - refuse while enrollments/grades reference it\n");
+            printf("2. Cascade  - also delete its enrollments and grades\n");
+            int mode = get_int_input("Delete policy: ");
+            if (mode < DELETE_ORPHAN || mode > DELETE_CASCADE) {
+                printf("Invalid choice.\n");
+                break;
+            }
+            set_delete_mode((DeleteMode)mode);
+            printf("Success: Delete policy set to %s.\n", delete_mode_name(get_delete_mode()));
+            break;
+        }
+        case 6: {
+            IntegrityReport report;
+            if (verify_data(*e_head, *g_head, &report) >= 0) display_integrity_report(&report);
+            break;
+        }
+        case 7: {
+            char semester[20];
+            get_string_input("Semester to close (e.g. 2024-FALL, empty = all): ", semester, 20);
+            rollover_semester(*e_head, *g_head, semester, NULL);
+            break;
+        }
+        case 8: {
+            char semester[20];
+            get_string_input("Semester to archive (e.g. 2023-FALL): ", semester, 20);
+            if (archive_freeze_semester(e_head, g_head, semester)) display_archives();
+            break;
+        }
+    }
+}
+
+// --- 9. HIZLI ARAMA ---
+void menu_search(Student *s_head, Professor *p_head) {
+    char prefix[100];
+    Student *students[SEARCH_MAX_RESULTS];
+    Professor *professors[SEARCH_MAX_RESULTS];
+    int i;
+
+    while (1) {
+        printf("\n--- QUICK SEARCH ---\n");
+        get_string_input("Name/Email prefix (0 to go back): ", prefix, 100);
+        if (strlen(prefix) == 0 || strcmp(prefix, "0") == 0) break;
+
+        int s_count = search_students_by_prefix(s_head, prefix, students, SEARCH_MAX_RESULTS);
+        int p_count = search_professors_by_prefix(p_head, prefix, professors, SEARCH_MAX_RESULTS);
+
+        printf("\n%-10s %-10s %-25s %-30s\n", "Type", "ID", "Name", "Email");
+        printf("--------------------------------------------------------------------------------\n");
+        for (i = 0; i < s_count; i++) {
+            char full_name[100];
+            snprintf(full_name, sizeof(full_name), "%s %s", students[i]->first_name, students[i]->last_name);
+            printf("%-10s %-10d %-25s %-30s\n", "Student", students[i]->id, full_name, students[i]->email);
+        }
+        for (i = 0; i < p_count; i++) {
+            char full_name[100];
+            snprintf(full_name, sizeof(full_name), "%s %s", professors[i]->first_name, professors[i]->last_name);
+            printf("%-10s %-10d %-25s %-30s\n", "Professor", professors[i]->id, full_name, professors[i]->email);
+        }
+        if (s_count + p_count == 0) printf("No matches found.\n");
+        else if (s_count == SEARCH_MAX_RESULTS || p_count == SEARCH_MAX_RESULTS)
+            printf("(Showing first %d matches per type, refine the prefix for more.)\n", SEARCH_MAX_RESULTS);
+    }
+}
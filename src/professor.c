@@ -1,457 +1,698 @@
-// professor.c - Profesr Modl (TAMAMLANMI)
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include "professor.h"
-#include "utils.h"
-#include "enrollment.h"
-#include "course.h"
-
-/**
- * Adds a new professor to the system after validating ID and email.
- * ID ve e-posta dorulamasndan sonra sisteme yeni bir profesr ekler.
- * * @param head_ptr - Double pointer to the head of the professor list
- * @param head_ptr - Profesr listesinin bana iaret eden ift kademeli pointer
- * @param new_data - Pointer to the structure containing new professor data
- * @param new_data - Yeni profesr verilerini ieren yapya iaret eden pointer
- * @return 1 if successful, 0 if validation fails or ID already exists
- * @return Baarlysa 1, dorulama baarszsa veya ID zaten varsa 0 dner
- */
-int add_professor(Professor **head_ptr, const Professor *new_data) {
-    if (new_data == NULL) {
-        printf("Error: Invalid professor data!\n");
-        return 0;
-    }
-    
-    // Validasyon
-    if (!validate_positive_int(new_data->id)) {
-        printf("Error: Professor ID must be positive!\n");
-        return 0;
-    }
-    
-    if (!validate_email(new_data->email)) {
-        printf("Error: Invalid email format!\n");
-        return 0;
-    }
-    
-    // Ayn ID var m
-    if (find_professor_by_id(*head_ptr, new_data->id) != NULL) {
-        printf("Error: Professor with ID %d already exists!\n", new_data->id);
-        return 0;
-    }
-    
-    // Yeni node
-    Professor *new_node = (Professor *)malloc(sizeof(Professor));
-    if (new_node == NULL) {
-        printf("Error: Memory allocation failed!\n");
-        return 0;
-    }
-    
-    // Verileri kopyala
-    new_node->id = new_data->id;
-    strcpy(new_node->first_name, new_data->first_name);
-    strcpy(new_node->last_name, new_data->last_name);
-    strcpy(new_node->email, new_data->email);
-    strcpy(new_node->phone, new_data->phone);
-    strcpy(new_node->department, new_data->department);
-    strcpy(new_node->title, new_data->title);
-    strcpy(new_node->office, new_data->office);
-    new_node->next = NULL;
-    
-    // Listeye ekle
-    if (*head_ptr == NULL) {
-        *head_ptr = new_node;
-    } else {
-        Professor *current = *head_ptr;
-        while (current->next != NULL) {
-            current = current->next;
-        }
-        current->next = new_node;
-    }
-    
-    printf("Success: Professor '%s %s' added successfully!\n", 
-           new_data->first_name, new_data->last_name);
-    return 1;
-}
-
-/**
- * Searches for a professor in the linked list by their unique ID.
- * Benzersiz ID numarasna gre profesr bal listede arar.
- * * @param head - Pointer to the head of the professor list
- * @param head - Profesr listesinin bana iaret eden pointer
- * @param id - Unique identifier of the professor
- * @param id - Profesrn benzersiz tanmlaycs
- * @return Pointer to the professor node if found, NULL otherwise
- * @return Profesr dm bulunursa adresi, aksi takdirde NULL dner
- */
-Professor* find_professor_by_id(Professor *head, int id) {
-    Professor *current = head;
-    
-    while (current != NULL) {
-        if (current->id == id) {
-            return current;
-        }
-        current = current->next;
-    }
-    
-    return NULL;
-}
-
-/**
- * Searches for a professor by matching both first and last names.
- * Hem isim hem de soyisim elemesine gre profesr aramas yapar.
- * * @param head - Pointer to the head of the professor list
- * @param head - Profesr listesinin bana iaret eden pointer
- * @param first_name - First name string to search
- * @param first_name - Aranan isim dizgisi
- * @param last_name - Last name string to search
- * @param last_name - Aranan soyisim dizgisi
- * @return Pointer to the matched professor or NULL
- * @return Eleen profesrn adresi veya NULL dner
- */
-Professor* find_professor_by_name(Professor *head, const char *first_name, const char *last_name) {
-    Professor *current = head;
-    
-    while (current != NULL) {
-        if (strcmp(current->first_name, first_name) == 0 && 
-            strcmp(current->last_name, last_name) == 0) {
-            return current;
-        }
-        current = current->next;
-    }
-    
-    return NULL;
-}
-
-/**
- * Updates an existing professor's details with new validated data.
- * Mevcut bir profesrn bilgilerini dorulanm yeni verilerle gnceller.
- * * @param prof_to_update - Pointer to the professor node to update
- * @param prof_to_update - Gncellenecek profesr dmne iaret eden pointer
- * @param new_data - Structure containing updated information
- * @param new_data - Gncellenmi bilgileri ieren yap
- * @return 1 if successful, 0 if validation fails
- * @return Baarlysa 1, dorulama baarszsa 0 dner
- */
-int update_professor(Professor *prof_to_update, const Professor *new_data) {
-    if (prof_to_update == NULL || new_data == NULL) {
-        printf("Error: Invalid parameters!\n");
-        return 0;
-    }
-    
-    // Validasyon
-    if (!validate_email(new_data->email)) {
-        printf("Error: Invalid email format!\n");
-        return 0;
-    }
-    
-    // Gncelle (ID hari)
-    strcpy(prof_to_update->first_name, new_data->first_name);
-    strcpy(prof_to_update->last_name, new_data->last_name);
-    strcpy(prof_to_update->email, new_data->email);
-    strcpy(prof_to_update->phone, new_data->phone);
-    strcpy(prof_to_update->department, new_data->department);
-    strcpy(prof_to_update->title, new_data->title);
-    strcpy(prof_to_update->office, new_data->office);
-    
-    printf("Success: Professor information updated!\n");
-    return 1;
-}
-
-/**
- * Removes a professor from the list by ID and frees allocated memory.
- * Bir profesr ID'sine gre listeden kaldrr ve ayrlan bellei serbest brakr.
- * * @param head_ptr - Double pointer to the head of the professor list
- * @param head_ptr - Profesr listesinin bana iaret eden ift kademeli pointer
- * @param id - Unique ID of the professor to delete
- * @param id - Silinecek profesrn benzersiz ID'si
- * @return 1 if deletion is successful, 0 if professor not found
- * @return Silme baarlysa 1, profesr bulunamazsa 0 dner
- */
-int delete_professor(Professor **head_ptr, int id) {
-    Professor *current = *head_ptr;
-    Professor *prev = NULL;
-    
-    if (current == NULL) {
-        printf("Error: Professor list is empty!\n");
-        return 0;
-    }
-    
-    // lk node
-    if (current->id == id) {
-        *head_ptr = current->next;
-        printf("Success: Professor with ID %d deleted.\n", id);
-        free(current);
-        return 1;
-    }
-    
-    // Ortada/sonda
-    while (current != NULL && current->id != id) {
-        prev = current;
-        current = current->next;
-    }
-    
-    if (current == NULL) {
-        printf("Error: Professor with ID %d not found!\n", id);
-        return 0;
-    }
-    
-    prev->next = current->next;
-    printf("Success: Professor with ID %d deleted.\n", id);
-    free(current);
-    return 1;
-}
-
-/**
- * Loads professor data from a CSV file into the linked list.
- * CSV dosyasndaki profesr verilerini bal listeye ykler.
- * * @param head_ptr - Double pointer to receive the head of the loaded list
- * @param head_ptr - Yklenen listenin ban alacak ift kademeli pointer
- * @return 1 if loading is successful, 0 if file cannot be opened
- * @return Ykleme baarlysa 1, dosya alamazsa 0 dner
- */
-int load_professors_from_csv(Professor **head_ptr) {
-    const char *filename = "data/professors.csv";
-    FILE *file = fopen(filename, "r");
-    
-    if (file == NULL) {
-    	filename = "professors.csv";
-        file = fopen(filename, "r");
-        if (file == NULL) {
-            printf("Warning: Could not open professors.csv. Starting empty.\n");
-            return 0;
-        }
-    }
-    
-    char line[512];
-    char *tokens[10];
-    int count = 0;
-    
-    fgets(line, sizeof(line), file);
-    
-    while (fgets(line, sizeof(line), file)) {
-        remove_newline(line);
-        
-        int token_count = split_csv_line(line, tokens, 8);
-        
-        if (token_count >= 8) {
-            Professor temp;
-            
-            temp.id = atoi(tokens[0]);
-            strcpy(temp.first_name, tokens[1]);
-            strcpy(temp.last_name, tokens[2]);
-            strcpy(temp.email, tokens[3]);
-            strcpy(temp.phone, tokens[4]);
-            strcpy(temp.department, tokens[5]);
-            strcpy(temp.title, tokens[6]);
-            strcpy(temp.office, tokens[7]);
-            
-            Professor *new_node = (Professor *)malloc(sizeof(Professor));
-            if (new_node) {
-                *new_node = temp;
-                new_node->next = NULL;
-                
-                if (*head_ptr == NULL) {
-                    *head_ptr = new_node;
-                } else {
-                    Professor *curr = *head_ptr;
-                    while (curr->next != NULL) curr = curr->next;
-                    curr->next = new_node;
-                }
-                count++;
-            }
-        }
-    }
-    
-    fclose(file);
-    printf("Success: Loaded %d professors from CSV.\n", count);
-    return 1;
-}
-
-/**
- * Saves all professor records from the linked list to a CSV file.
- * Bal listedeki tm profesr kaytlarn bir CSV dosyasna kaydeder.
- * * @param head - Pointer to the head of the professor list
- * @param head - Profesr listesinin bana iaret eden pointer
- * @param filename - Destination file path string
- * @param filename - Hedef dosya yolu dizgisi
- * @return 1 if successful, 0 if file cannot be opened
- * @return Baarlysa 1, dosya alamazsa 0 dner
- */
-int save_professors_to_csv(Professor *head, const char *filename) {
-    FILE *file = fopen(filename, "w");
-    if (file == NULL) {
-        printf("Error: Could not open file for writing!\n");
-        return 0;
-    }
-    
-    fprintf(file, "professor_id,first_name,last_name,email,phone,department,title,office\n");
-    
-    Professor *current = head;
-    int count = 0;
-    
-    while (current != NULL) {
-        fprintf(file, "%d,%s,%s,%s,%s,%s,%s,%s\n",
-                current->id,
-                current->first_name,
-                current->last_name,
-                current->email,
-                current->phone,
-                current->department,
-                current->title,
-                current->office);
-        current = current->next;
-        count++;
-    }
-    
-    fclose(file);
-    printf("Success: Saved %d professors to CSV.\n", count);
-    return 1;
-}
-
-/**
- * Prints all professor information in a formatted table.
- * Tm profesr bilgilerini formatl bir tabloda yazdrr.
- * * @param head - Pointer to the head of the professor list
- * @param head - Profesr listesinin bana iaret eden pointer
- */
-void display_all_professors(Professor *head) {
-    Professor *current;
-    int count = 0;
-    
-    if (head == NULL) {
-        printf("\nNo professors to display.\n");
-        return;
-    }
-    
-    printf("\n====================================================================================\n");
-    printf("                               PROFESSOR LIST                                       \n");
-    printf("====================================================================================\n");
-    printf("%-5s %-12s %-15s %-28s %-20s %-23s %-8s\n", 
-           "ID", "First", "Last", "Email", "Department", "Title", "Office");
-    printf("------------------------------------------------------------------------------------\n");
-    
-    current = head;
-    
-    while (current != NULL) {
-        printf("%-5d %-12.12s %-15.15s %-28.28s %-20.20s %-23.23s %-8.8s\n",
-               current->id,
-               current->first_name,
-               current->last_name,
-               current->email,
-               current->department,
-               current->title,
-               current->office);
-        current = current->next;
-        count++;
-    }
-    
-    printf("====================================================================================\n");
-    printf("Total Professors: %d\n", count);
-    printf("====================================================================================\n");
-}
-
-/**
- * Displays detailed information about a single professor.
- * Tek bir profesr hakkndaki detayl bilgileri grntler.
- * * @param professor - Pointer to the professor structure
- * @param professor - Profesr yapsna iaret eden pointer
- */
-void display_professor_details(Professor *professor) {
-    if (professor == NULL) {
-        printf("Error: Professor not found!\n");
-        return;
-    }
-    
-    printf("\n========================================\n");
-    printf("       PROFESSOR DETAILS                \n");
-    printf("========================================\n");
-    printf("ID:         %d\n", professor->id);
-    printf("Name:       %s %s\n", professor->first_name, professor->last_name);
-    printf("Email:      %s\n", professor->email);
-    printf("Phone:      %s\n", professor->phone);
-    printf("Department: %s\n", professor->department);
-    printf("Title:      %s\n", professor->title);
-    printf("Office:     %s\n", professor->office);
-    printf("========================================\n");
-}
-
-/**
- * Lists all courses assigned to a specific professor using enrollment data.
- * Kayt verilerini kullanarak belirli bir profesre atanan tm dersleri listeler.
- * * @param professor_id - ID of the professor to check
- * @param professor_id - Kontrol edilecek profesrn ID'si
- * @param enrollment_head_void - Generic pointer to the enrollment list head
- * @param enrollment_head_void - Kayt listesinin bana iaret eden genel pointer
- * @param course_head_void - Generic pointer to the course list head
- * @param course_head_void - Kurs listesinin bana iaret eden genel pointer
- */
-void display_professor_courses(int professor_id, void *enrollment_head_void, void *course_head_void) {
-    Enrollment *enrollment_head = (Enrollment *)enrollment_head_void;
-    Course *course_head = (Course *)course_head_void;
-    
-    printf("\n========================================\n");
-    printf("  Courses taught by Professor ID: %d   \n", professor_id);
-    printf("========================================\n");
-    printf("%-10s %-40s %-15s\n", "Code", "Course Name", "Semester");
-    printf("----------------------------------------\n");
-    
-    Enrollment *e = enrollment_head;
-    int found = 0;
-    
-    while (e != NULL) {
-        if (e->professor_id == professor_id) {
-            Course *c = find_course_by_id(course_head, e->course_id);
-            if (c != NULL) {
-                printf("%-10s %-40s %-15s\n", c->code, c->name, e->semester);
-                found = 1;
-            }
-        }
-        e = e->next;
-    }
-    
-    if (!found) {
-        printf("No courses assigned yet.\n");
-    }
-    
-    printf("========================================\n");
-}
-
-/**
- * Clears all professor nodes from memory at the end of the program.
- * Program sonunda tm profesr dmlerini bellekten temizler.
- * * @param head - Pointer to the head of the professor list
- * @param head - Profesr listesinin bana iaret eden pointer
- */
-void free_all_professors(Professor *head) {
-    Professor *temp;
-    
-    while (head != NULL) {
-        temp = head;
-        head = head->next;
-        free(temp);
-    }
-    
-    printf("Memory for professors cleared.\n");
-}
-
-/**
- * Returns the total count of professors registered in the system.
- * Sistemde kaytl olan toplam profesr saysn dndrr.
- * * @param head - Pointer to the head of the professor list
- * @param head - Profesr listesinin bana iaret eden pointer
- * @return Integer representing total number of professors
- * @return Toplam profesr saysn temsil eden tam say
- */
-int count_professors(Professor *head) {
-    int count = 0;
-    Professor *current = head;
-    
-    while (current != NULL) {
-        count++;
-        current = current->next;
-    }
-    
-    return count;
-}
+// professor.c - Profesör Modülü (TAMAMLANMIŞ)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "professor.h"
+#include "utils.h"
+#include "enrollment.h"
+#include "course.h"
+#include "index.h"
+#include "trie.h"
+#include "bloom.h"
+#include "section.h"
+#include "join.h"
+
+// Secondary indexes over ID, normalized email and "first|last" name keys.
+// ID, normalize e-posta ve "isim|soyisim" anahtarları üzerindeki ikincil indeksler.
+static IdIndex professor_id_index = {NULL, 0, 0};
+static HashIndex professor_email_index = {NULL, 0, 0};
+static HashIndex professor_name_index = {NULL, 0, 0};
+
+// Blocked Bloom filter in front of the ID index; most brand-new IDs are ruled out without a lookup.
+// ID indeksinin önündeki blok Bloom filtresi; yeni ID'lerin çoğu arama yapılmadan elenir.
+static BloomFilter professor_id_filter = {NULL, 0, 0, 0, 0};
+
+// Remembered tail of the professor list, keyed by the head pointer it was found from.
+// Profesör listesinin hatırlanan sonu; bulunduğu baş pointer'ına göre tutulur.
+static Professor *professor_tail = NULL;
+static Professor **professor_tail_owner = NULL;
+
+// Prefix search trie over diacritic-folded first, last, full name and email keys.
+// Aksanlardan arındırılmış isim, soyisim, tam isim ve e-posta anahtarları üzerindeki önek arama ağacı.
+static Trie professor_search_trie = {NULL, 0};
+
+#define PROFESSOR_SEARCH_KEYS 4
+
+/**
+ * Builds the folded search keys of a professor (first, last, "first last", email).
+ * Bir profesörün arama anahtarlarını üretir (isim, soyisim, "isim soyisim", e-posta).
+ * * @param p - Professor node
+ * @param p - Profesör düğümü
+ * @param keys - Output key buffers
+ * @param keys - Anahtarların yazılacağı alanlar
+ */
+static void professor_search_keys(Professor *p, char keys[PROFESSOR_SEARCH_KEYS][INDEX_KEY_LEN]) {
+    char full_name[INDEX_KEY_LEN];
+    snprintf(full_name, INDEX_KEY_LEN, "%s %s", p->first_name, p->last_name);
+    fold_search_text(p->first_name, keys[0], INDEX_KEY_LEN);
+    fold_search_text(p->last_name, keys[1], INDEX_KEY_LEN);
+    fold_search_text(full_name, keys[2], INDEX_KEY_LEN);
+    fold_search_text(p->email, keys[3], INDEX_KEY_LEN);
+}
+
+/**
+ * Registers a professor node in the ID, email, name and prefix search indexes.
+ * Bir profesör düğümünü ID, e-posta, isim ve önek arama indekslerine kaydeder.
+ * * @param p - Professor node stored in the list
+ * @param p - Listede saklanan profesör düğümü
+ */
+static void index_professor(Professor *p) {
+    char key[INDEX_KEY_LEN];
+    id_index_insert(&professor_id_index, p->id, p);
+    bloom_insert(&professor_id_filter, &professor_id_index, p->id);
+    normalize_key(p->email, key, INDEX_KEY_LEN);
+    index_insert(&professor_email_index, key, p);
+    make_name_key(p->first_name, p->last_name, key, INDEX_KEY_LEN);
+    index_insert(&professor_name_index, key, p);
+
+    char keys[PROFESSOR_SEARCH_KEYS][INDEX_KEY_LEN];
+    int i;
+    professor_search_keys(p, keys);
+    for (i = 0; i < PROFESSOR_SEARCH_KEYS; i++) trie_insert(&professor_search_trie, keys[i], p);
+}
+
+/**
+ * Removes a professor node from the ID, email, name and prefix search indexes using its current keys.
+ * Bir profesör düğümünü mevcut anahtarlarıyla ID, e-posta, isim ve önek arama indekslerinden çıkarır.
+ * * @param p - Professor node stored in the list
+ * @param p - Listede saklanan profesör düğümü
+ */
+static void unindex_professor(Professor *p) {
+    char key[INDEX_KEY_LEN];
+    id_index_remove(&professor_id_index, p->id, p);
+    normalize_key(p->email, key, INDEX_KEY_LEN);
+    index_remove(&professor_email_index, key, p);
+    make_name_key(p->first_name, p->last_name, key, INDEX_KEY_LEN);
+    index_remove(&professor_name_index, key, p);
+
+    char keys[PROFESSOR_SEARCH_KEYS][INDEX_KEY_LEN];
+    int i;
+    professor_search_keys(p, keys);
+    for (i = 0; i < PROFESSOR_SEARCH_KEYS; i++) trie_remove(&professor_search_trie, keys[i], p);
+}
+
+/**
+ * Hands a deleted professor's enrollment chain to the enrollment module's orphan chains, to be linked
+ * back if the professor ID is added again.
+ * Silinen profesörün kayıt zincirini kayıt modülünün yetim zincirlerine verir; profesör ID'si yeniden
+ * eklenirse zincir ona geri bağlanır.
+ * * @param p - Professor node about to be freed
+ * @param p - Serbest bırakılacak profesör düğümü
+ */
+static void detach_professor_chain(Professor *p) {
+    enrollment_detach_professor(p);
+}
+
+/**
+ * Appends a professor at the remembered tail in O(1).
+ * Bir profesörü hatırlanan son düğüme O(1) sürede ekler.
+ * * @param head_ptr - Double pointer to the head of the professor list
+ * @param head_ptr - Profesör listesinin başına işaret eden çift kademeli pointer
+ * @param node - Node to append
+ * @param node - Eklenecek düğüm
+ */
+static void append_professor_node(Professor **head_ptr, Professor *node) {
+    if (head_ptr != professor_tail_owner || *head_ptr == NULL) {
+        professor_tail = *head_ptr;
+        while (professor_tail != NULL && professor_tail->next != NULL) professor_tail = professor_tail->next;
+        professor_tail_owner = head_ptr;
+    }
+    node->next = NULL;
+    if (professor_tail == NULL) *head_ptr = node;
+    else professor_tail->next = node;
+    professor_tail = node;
+}
+
+/**
+ * Checks whether a professor ID is taken, asking the Bloom filter before the exact ID index.
+ * Bir profesör ID'sinin kullanımda olup olmadığını, tam ID indeksinden önce Bloom filtresine sorarak kontrol eder.
+ * * @param id - ID to check
+ * @param id - Kontrol edilecek ID
+ * @return 1 if the ID exists, 0 otherwise
+ * @return ID varsa 1, yoksa 0 döner
+ */
+static int professor_id_exists(int id) {
+    if (!bloom_may_contain(&professor_id_filter, id)) return 0;
+    if (get_professor_by_id(id) != NULL) return 1;
+    bloom_note_false_positive(&professor_id_filter);
+    return 0;
+}
+
+/**
+ * Adds a new professor to the system after validating ID and email.
+ * ID ve e-posta doğrulamasından sonra sisteme yeni bir profesör ekler.
+ * * @param head_ptr - Double pointer to the head of the professor list
+ * @param head_ptr - Profesör listesinin başına işaret eden çift kademeli pointer
+ * @param new_data - Pointer to the structure containing new professor data
+ * @param new_data - Yeni profesör verilerini içeren yapıya işaret eden pointer
+ * @return 1 if successful, 0 if validation fails or ID already exists
+ * @return Başarılıysa 1, doğrulama başarısızsa veya ID zaten varsa 0 döner
+ */
+int add_professor(Professor **head_ptr, const Professor *new_data) {
+    if (new_data == NULL) {
+        printf("Error: Invalid professor data!\n");
+        return 0;
+    }
+    
+    // Validasyon
+    if (!validate_positive_int(new_data->id)) {
+        printf("Error: Professor ID must be positive!\n");
+        return 0;
+    }
+    
+    if (!validate_email(new_data->email)) {
+        printf("Error: Invalid email format!\n");
+        return 0;
+    }
+    
+    // Aynı ID var mı
+    if (professor_id_exists(new_data->id)) {
+        printf("Error: Professor with ID %d already exists!\n", new_data->id);
+        return 0;
+    }
+    
+    // Yeni node
+    Professor *new_node = (Professor *)malloc(sizeof(Professor));
+    if (new_node == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+    
+    // Verileri kopyala
+    new_node->id = new_data->id;
+    strcpy(new_node->first_name, new_data->first_name);
+    strcpy(new_node->last_name, new_data->last_name);
+    strcpy(new_node->email, new_data->email);
+    strcpy(new_node->phone, new_data->phone);
+    strcpy(new_node->department, new_data->department);
+    strcpy(new_node->title, new_data->title);
+    strcpy(new_node->office, new_data->office);
+    new_node->first_enrollment = new_node->last_enrollment = NULL;
+    
+    // Listeye ekle (son düğüm tutulur; yürüme yok)
+    append_professor_node(head_ptr, new_node);
+    index_professor(new_node);
+    enrollment_relink_professor(new_node);
+    
+    printf("Success: Professor '%s %s' added successfully!\n", 
+           new_data->first_name, new_data->last_name);
+    return 1;
+}
+
+/**
+ * Searches for a professor in the linked list by their unique ID.
+ * Benzersiz ID numarasına göre profesörü bağlı listede arar.
+ * * @param head - Pointer to the head of the professor list
+ * @param head - Profesör listesinin başına işaret eden pointer
+ * @param id - Unique identifier of the professor
+ * @param id - Profesörün benzersiz tanımlayıcısı
+ * @return Pointer to the professor node if found, NULL otherwise
+ * @return Profesör düğümü bulunursa adresi, aksi takdirde NULL döner
+ */
+Professor* find_professor_by_id(Professor *head, int id) {
+    if (head == NULL) return NULL;
+    return get_professor_by_id(id);
+}
+
+/**
+ * Looks up a professor by ID through the ID index, without needing the list head.
+ * Used by the enrollment module to reach a professor's enrollment chain.
+ * Liste başına ihtiyaç duymadan ID indeksi üzerinden profesör arar.
+ * Kayıt modülü profesörün kayıt zincirine ulaşmak için kullanır.
+ * * @param id - Unique ID of the professor
+ * @param id - Profesörün benzersiz ID'si
+ * @return Pointer to the professor or NULL
+ * @return Profesör yapısının adresi veya NULL
+ */
+Professor* get_professor_by_id(int id) {
+    return (Professor *)id_index_find(&professor_id_index, id);
+}
+
+/**
+ * Searches for a professor by matching both first and last names.
+ * Hem isim hem de soyisim eşleşmesine göre profesör araması yapar.
+ * * @param head - Pointer to the head of the professor list
+ * @param head - Profesör listesinin başına işaret eden pointer
+ * @param first_name - First name string to search
+ * @param first_name - Aranan isim dizgisi
+ * @param last_name - Last name string to search
+ * @param last_name - Aranan soyisim dizgisi
+ * @return Pointer to the matched professor or NULL
+ * @return Eşleşen profesörün adresi veya NULL döner
+ */
+Professor* find_professor_by_name(Professor *head, const char *first_name, const char *last_name) {
+    char key[INDEX_KEY_LEN];
+    if (head == NULL) return NULL;
+    make_name_key(first_name, last_name, key, INDEX_KEY_LEN);
+    return (Professor *)index_find(&professor_name_index, key);
+}
+
+/**
+ * Searches for a professor by email address (case-insensitive).
+ * E-posta adresine göre profesör araması yapar (büyük/küçük harf duyarsız).
+ * * @param head - Pointer to the head of the professor list
+ * @param head - Profesör listesinin başına işaret eden pointer
+ * @param email - Email address to search
+ * @param email - Aranan e-posta adresi
+ * @return Pointer to the matched professor or NULL
+ * @return Eşleşen profesörün adresi veya NULL döner
+ */
+Professor* find_professor_by_email(Professor *head, const char *email) {
+    char key[INDEX_KEY_LEN];
+    if (head == NULL) return NULL;
+    normalize_key(email, key, INDEX_KEY_LEN);
+    return (Professor *)index_find(&professor_email_index, key);
+}
+
+/**
+ * Finds professors whose first name, last name, full name or email starts with a prefix.
+ * Matching ignores case and Turkish/Latin diacritics (e.g. "yil" matches "Yılmaz").
+ * İsmi, soyismi, tam ismi veya e-postası verilen önekle başlayan profesörleri bulur.
+ * Eşleştirme büyük/küçük harf ve Türkçe/Latin aksanlardan bağımsızdır (örn. "yil", "Yılmaz" ile eşleşir).
+ * * @param head - Head of the professor list
+ * @param head - Profesör listesinin başı
+ * @param prefix - Prefix typed by the operator
+ * @param prefix - Operatörün yazdığı önek
+ * @param results - Array receiving the matched professors
+ * @param results - Eşleşen profesörlerin yazılacağı dizi
+ * @param max_results - Capacity of the results array
+ * @param max_results - Sonuç dizisinin kapasitesi
+ * @return Number of matched professors
+ * @return Eşleşen profesör sayısı
+ */
+int search_professors_by_prefix(Professor *head, const char *prefix, Professor **results, int max_results) {
+    char key[INDEX_KEY_LEN];
+    if (head == NULL) return 0;
+    fold_search_text(prefix, key, INDEX_KEY_LEN);
+    return trie_collect_prefix(&professor_search_trie, key, (void **)results, max_results);
+}
+
+/**
+ * Updates an existing professor's details with new validated data.
+ * Mevcut bir profesörün bilgilerini doğrulanmış yeni verilerle günceller.
+ * * @param prof_to_update - Pointer to the professor node to update
+ * @param prof_to_update - Güncellenecek profesör düğümüne işaret eden pointer
+ * @param new_data - Structure containing updated information
+ * @param new_data - Güncellenmiş bilgileri içeren yapı
+ * @return 1 if successful, 0 if validation fails
+ * @return Başarılıysa 1, doğrulama başarısızsa 0 döner
+ */
+int update_professor(Professor *prof_to_update, const Professor *new_data) {
+    if (prof_to_update == NULL || new_data == NULL) {
+        printf("Error: Invalid parameters!\n");
+        return 0;
+    }
+    
+    // Validasyon
+    if (!validate_email(new_data->email)) {
+        printf("Error: Invalid email format!\n");
+        return 0;
+    }
+    
+    // Güncelle (ID hariç) - eski anahtarlar önce indeksten çıkarılır
+    unindex_professor(prof_to_update);
+    strcpy(prof_to_update->first_name, new_data->first_name);
+    strcpy(prof_to_update->last_name, new_data->last_name);
+    strcpy(prof_to_update->email, new_data->email);
+    strcpy(prof_to_update->phone, new_data->phone);
+    strcpy(prof_to_update->department, new_data->department);
+    strcpy(prof_to_update->title, new_data->title);
+    strcpy(prof_to_update->office, new_data->office);
+    index_professor(prof_to_update);
+    
+    printf("Success: Professor information updated!\n");
+    return 1;
+}
+
+/**
+ * Removes a professor from the list by ID and frees allocated memory.
+ * Bir profesörü ID'sine göre listeden kaldırır ve ayrılan belleği serbest bırakır.
+ * * @param head_ptr - Double pointer to the head of the professor list
+ * @param head_ptr - Profesör listesinin başına işaret eden çift kademeli pointer
+ * @param id - Unique ID of the professor to delete
+ * @param id - Silinecek profesörün benzersiz ID'si
+ * @return 1 if deletion is successful, 0 if professor not found
+ * @return Silme başarılıysa 1, profesör bulunamazsa 0 döner
+ */
+int delete_professor(Professor **head_ptr, int id) {
+    Professor *current = *head_ptr;
+    Professor *prev = NULL;
+    
+    if (current == NULL) {
+        printf("Error: Professor list is empty!\n");
+        return 0;
+    }
+    
+    // İlk node
+    if (current->id == id) {
+        *head_ptr = current->next;
+        if (current == professor_tail) professor_tail = NULL;
+        printf("Success: Professor with ID %d deleted.\n", id);
+        unindex_professor(current);
+        detach_professor_chain(current);
+        free(current);
+        return 1;
+    }
+    
+    // Ortada/sonda
+    while (current != NULL && current->id != id) {
+        prev = current;
+        current = current->next;
+    }
+    
+    if (current == NULL) {
+        printf("Error: Professor with ID %d not found!\n", id);
+        return 0;
+    }
+    
+    prev->next = current->next;
+    if (current == professor_tail) professor_tail = prev;
+    printf("Success: Professor with ID %d deleted.\n", id);
+    unindex_professor(current);
+    detach_professor_chain(current);
+    free(current);
+    return 1;
+}
+
+/**
+ * Loads professor data from a CSV file into the linked list.
+ * CSV dosyasındaki profesör verilerini bağlı listeye yükler.
+ * * @param head_ptr - Double pointer to receive the head of the loaded list
+ * @param head_ptr - Yüklenen listenin başını alacak çift kademeli pointer
+ * @return 1 if loading is successful, 0 if file cannot be opened
+ * @return Yükleme başarılıysa 1, dosya açılamazsa 0 döner
+ */
+int load_professors_from_csv(Professor **head_ptr) {
+    const char *filename = "data/professors.csv";
+    FILE *file = fopen(filename, "r");
+    
+    if (file == NULL) {
+    	filename = "professors.csv";
+        file = fopen(filename, "r");
+        if (file == NULL) {
+            printf("Warning: Could not open professors.csv. Starting empty.\n");
+            return 0;
+        }
+    }
+    
+    char line[512];
+    char *tokens[10];
+    int count = 0;
+    
+    fgets(line, sizeof(line), file);
+    
+    while (fgets(line, sizeof(line), file)) {
+        remove_newline(line);
+        
+        int token_count = split_csv_line(line, tokens, 8);
+        
+        if (token_count >= 8) {
+            Professor temp;
+            
+            temp.id = atoi(tokens[0]);
+            strcpy(temp.first_name, tokens[1]);
+            strcpy(temp.last_name, tokens[2]);
+            strcpy(temp.email, tokens[3]);
+            strcpy(temp.phone, tokens[4]);
+            strcpy(temp.department, tokens[5]);
+            strcpy(temp.title, tokens[6]);
+            strcpy(temp.office, tokens[7]);
+            
+            Professor *new_node = (Professor *)malloc(sizeof(Professor));
+            if (new_node) {
+                *new_node = temp;
+                new_node->first_enrollment = new_node->last_enrollment = NULL;
+                append_professor_node(head_ptr, new_node);
+                index_professor(new_node);
+                enrollment_relink_professor(new_node);
+                count++;
+            }
+        }
+    }
+    
+    fclose(file);
+    printf("Success: Loaded %d professors from CSV.\n", count);
+    return 1;
+}
+
+/**
+ * Saves all professor records from the linked list to a CSV file.
+ * Bağlı listedeki tüm profesör kayıtlarını bir CSV dosyasına kaydeder.
+ * * @param head - Pointer to the head of the professor list
+ * @param head - Profesör listesinin başına işaret eden pointer
+ * @param filename - Destination file path string
+ * @param filename - Hedef dosya yolu dizgisi
+ * @return 1 if successful, 0 if file cannot be opened
+ * @return Başarılıysa 1, dosya açılamazsa 0 döner
+ */
+int save_professors_to_csv(Professor *head, const char *filename) {
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) {
+        printf("Error: Could not open file for writing!\n");
+        return 0;
+    }
+    
+    fprintf(file, "professor_id,first_name,last_name,email,phone,department,title,office\n");
+    
+    Professor *current = head;
+    int count = 0;
+    
+    while (current != NULL) {
+        fprintf(file, "%d,%s,%s,%s,%s,%s,%s,%s\n",
+                current->id,
+                current->first_name,
+                current->last_name,
+                current->email,
+                current->phone,
+                current->department,
+                current->title,
+                current->office);
+        current = current->next;
+        count++;
+    }
+    
+    fclose(file);
+    printf("Success: Saved %d professors to CSV.\n", count);
+    return 1;
+}
+
+/**
+ * Prints all professor information in a formatted table.
+ * Tüm profesör bilgilerini formatlı bir tabloda yazdırır.
+ * * @param head - Pointer to the head of the professor list
+ * @param head - Profesör listesinin başına işaret eden pointer
+ */
+void display_all_professors(Professor *head) {
+    Professor *current;
+    int count = 0;
+    
+    if (head == NULL) {
+        printf("\nNo professors to display.\n");
+        return;
+    }
+    
+    printf("\n====================================================================================\n");
+    printf("                               PROFESSOR LIST                                       \n");
+    printf("====================================================================================\n");
+    printf("%-5s %-12s %-15s %-28s %-20s %-23s %-8s\n", 
+           "ID", "First", "Last", "Email", "Department", "Title", "Office");
+    printf("------------------------------------------------------------------------------------\n");
+    
+    current = head;
+    
+    while (current != NULL) {
+        printf("%-5d %-12.12s %-15.15s %-28.28s %-20.20s %-23.23s %-8.8s\n",
+               current->id,
+               current->first_name,
+               current->last_name,
+               current->email,
+               current->department,
+               current->title,
+               current->office);
+        current = current->next;
+        count++;
+    }
+    
+    printf("====================================================================================\n");
+    printf("Total Professors: %d\n", count);
+    printf("====================================================================================\n");
+}
+
+/**
+ * Displays detailed information about a single professor.
+ * Tek bir profesör hakkındaki detaylı bilgileri görüntüler.
+ * * @param professor - Pointer to the professor structure
+ * @param professor - Profesör yapısına işaret eden pointer
+ */
+void display_professor_details(Professor *professor) {
+    if (professor == NULL) {
+        printf("Error: Professor not found!\n");
+        return;
+    }
+    
+    printf("\n========================================\n");
+    printf("       PROFESSOR DETAILS                \n");
+    printf("========================================\n");
+    printf("ID:         %d\n", professor->id);
+    printf("Name:       %s %s\n", professor->first_name, professor->last_name);
+    printf("Email:      %s\n", professor->email);
+    printf("Phone:      %s\n", professor->phone);
+    printf("Department: %s\n", professor->department);
+    printf("Title:      %s\n", professor->title);
+    printf("Office:     %s\n", professor->office);
+    printf("========================================\n");
+}
+
+static int section_course_key(const void *row) {
+    return ((const Section *)row)->course_id;
+}
+
+static void* load_course_lookup(int id) {
+    return get_course_by_id(id);
+}
+
+static void emit_section_row(const void *left, const void *right, void *ctx) {
+    const Section *section = (const Section *)left;
+    const Course *c = (const Course *)right;
+    printf("%-10s %-40s %-15s %8d %9d %7d\n", c->code, c->name, section->semester,
+           section->enrolled_count, section->completed_count, section->dropped_count);
+    (*(int *)ctx)++;
+}
+
+/**
+ * Lists each section (course + semester) taught by a professor once, with live headcounts.
+ * The professor's sections are joined with the courses through the course ID index, under the
+ * enrollment list lock so concurrent enrollments cannot change a count or a chain mid-read.
+ * Bir profesörün verdiği her şubeyi (ders + dönem) canlı öğrenci sayılarıyla bir kez listeler.
+ * Profesörün şubeleri ders ID indeksi üzerinden, eşzamanlı kayıtlar sayacı veya zinciri okuma
+ * sırasında değiştiremesin diye kayıt listesi kilidi altında derslerle birleştirilir.
+ * * @param professor_id - ID of the professor to check
+ * @param professor_id - Kontrol edilecek profesörün ID'si
+ * @param enrollment_head_void - Generic pointer to the enrollment list head (sections are kept by the enrollment module)
+ * @param enrollment_head_void - Kayıt listesinin başına işaret eden genel pointer (şubeler kayıt modülünce tutulur)
+ * @param course_head_void - Generic pointer to the course list head (unused, courses are found through their index)
+ * @param course_head_void - Kurs listesinin başına işaret eden genel pointer (kullanılmaz, dersler indeksten bulunur)
+ */
+void display_professor_courses(int professor_id, void *enrollment_head_void, void *course_head_void) {
+    int found = 0;
+    (void)enrollment_head_void;
+    (void)course_head_void;
+    
+    printf("\n========================================\n");
+    printf("  Courses taught by Professor ID: %d   \n", professor_id);
+    printf("========================================\n");
+    printf("%-10s %-40s %-15s %8s %9s %7s\n", "Code", "Course Name", "Semester", "Enrolled", "Completed", "Dropped");
+    printf("----------------------------------------\n");
+    
+    // Şube sayaçları kayıt iş parçacıklarınca güncellenir; okurken kayıt listesi kilidi tutulur
+    enrollment_lock_list();
+    JoinSide sections = join_chain(get_professor_sections(professor_id), offsetof(Section, next_by_professor),
+                                   section_course_key);
+    JoinSide courses = join_index(load_course_lookup);
+    hash_join(&sections, &courses, JOIN_INNER, emit_section_row, &found);
+    enrollment_unlock_list();
+    
+    if (!found) {
+        printf("No courses assigned yet.\n");
+    }
+    
+    printf("========================================\n");
+}
+
+/**
+ * Prints a teaching-load summary for every professor in a single pass over the section chains.
+ * Şube zincirleri üzerinden tek geçişte tüm profesörler için ders yükü özeti yazdırır.
+ * * @param head - Pointer to the head of the professor list
+ * @param head - Profesör listesinin başına işaret eden pointer
+ */
+void display_faculty_workload(Professor *head) {
+    int total_sections = 0, total_students = 0, total_active = 0;
+    
+    printf("\n========================================\n");
+    printf("         FACULTY WORKLOAD SUMMARY       \n");
+    printf("========================================\n");
+    printf("%-5s %-30s %-25s %8s %8s %8s\n", "ID", "Name", "Department", "Sections", "Students", "Active");
+    printf("----------------------------------------\n");
+    
+    // Sayaçlar kayıt listesi kilidi altında okunur
+    enrollment_lock_list();
+    Professor *current = head;
+    while (current != NULL) {
+        int sections = 0, students = 0, active = 0;
+        Section *section;
+        char full_name[101];
+        
+        for (section = get_professor_sections(current->id); section != NULL; section = section->next_by_professor) {
+            sections++;
+            students += section_headcount(section);
+            active += section->enrolled_count;
+        }
+        
+        snprintf(full_name, sizeof(full_name), "%s %s", current->first_name, current->last_name);
+        printf("%-5d %-30s %-25s %8d %8d %8d\n", current->id, full_name, current->department, sections, students, active);
+        
+        total_sections += sections;
+        total_students += students;
+        total_active += active;
+        current = current->next;
+    }
+    enrollment_unlock_list();
+    
+    printf("----------------------------------------\n");
+    printf("%-62s %8d %8d %8d\n", "TOTAL", total_sections, total_students, total_active);
+    printf("========================================\n");
+}
+
+/**
+ * Clears all professor nodes from memory at the end of the program.
+ * Program sonunda tüm profesör düğümlerini bellekten temizler.
+ * * @param head - Pointer to the head of the professor list
+ * @param head - Profesör listesinin başına işaret eden pointer
+ */
+void free_all_professors(Professor *head) {
+    Professor *temp;
+    
+    while (head != NULL) {
+        temp = head;
+        head = head->next;
+        free(temp);
+    }
+    professor_tail = NULL;
+    professor_tail_owner = NULL;
+    id_index_clear(&professor_id_index);
+    bloom_clear(&professor_id_filter);
+    index_clear(&professor_email_index);
+    index_clear(&professor_name_index);
+    trie_clear(&professor_search_trie);
+    
+    printf("Memory for professors cleared.\n");
+}
+
+/**
+ * Returns the total count of professors registered in the system.
+ * Sistemde kayıtlı olan toplam profesör sayısını döndürür.
+ * * @param head - Pointer to the head of the professor list
+ * @param head - Profesör listesinin başına işaret eden pointer
+ * @return Integer representing total number of professors
+ * @return Toplam profesör sayısını temsil eden tam sayı
+ */
+int count_professors(Professor *head) {
+    int count = 0;
+    Professor *current = head;
+    
+    while (current != NULL) {
+        count++;
+        current = current->next;
+    }
+    
+    return count;
+}
+
+/**
+ * Prints the duplicate-ID filter statistics of the professor table.
+ * Profesör tablosunun mükerrer ID filtresi istatistiklerini yazdırır.
+ */
+void display_professor_filter_stats(void) {
+    bloom_print_stats("Professors", &professor_id_filter, professor_id_index.size);
+}
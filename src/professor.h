@@ -1,32 +1,41 @@
-#ifndef PROFESSOR_H
-#define PROFESSOR_H
-
-#include <stdio.h>
-#include <stdlib.h>
-
-typedef struct Professor {
-    int id;
-    char first_name[50];
-    char last_name[50];
-    char email[100];
-    char phone[20];
-    char department[50];
-    char title[50];
-    char office[20];
-    struct Professor *next;
-} Professor;
-
-int load_professors_from_csv(Professor **head_ptr);
-int save_professors_to_csv(Professor *head, const char *filename);
-int add_professor(Professor **head_ptr, const Professor *new_prof);
-int update_professor(Professor *prof_to_update, const Professor *new_data);
-int delete_professor(Professor **head_ptr, int id);
-Professor* find_professor_by_id(Professor *head, int id);
-Professor* find_professor_by_name(Professor *head, const char *first_name, const char *last_name);
-void display_all_professors(Professor *head);
-void display_professor_details(Professor *professor);
-void display_professor_courses(int professor_id, void *enrollment_head, void *course_head);
-void free_all_professors(Professor *head);
-int count_professors(Professor *head);
-
-#endif
+#ifndef PROFESSOR_H
+#define PROFESSOR_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+struct Enrollment;
+
+typedef struct Professor {
+    int id;
+    char first_name[50];
+    char last_name[50];
+    char email[100];
+    char phone[20];
+    char department[50];
+    char title[50];
+    char office[20];
+    struct Enrollment *first_enrollment;   // Per-professor enrollment chain (Enrollment.next_by_professor)
+    struct Enrollment *last_enrollment;    // Tail of the enrollment chain, for O(1) appends
+    struct Professor *next;
+} Professor;
+
+int load_professors_from_csv(Professor **head_ptr);
+int save_professors_to_csv(Professor *head, const char *filename);
+int add_professor(Professor **head_ptr, const Professor *new_prof);
+int update_professor(Professor *prof_to_update, const Professor *new_data);
+int delete_professor(Professor **head_ptr, int id);
+Professor* find_professor_by_id(Professor *head, int id);
+Professor* get_professor_by_id(int id);
+Professor* find_professor_by_name(Professor *head, const char *first_name, const char *last_name);
+Professor* find_professor_by_email(Professor *head, const char *email);
+int search_professors_by_prefix(Professor *head, const char *prefix, Professor **results, int max_results);
+void display_all_professors(Professor *head);
+void display_professor_details(Professor *professor);
+void display_professor_courses(int professor_id, void *enrollment_head, void *course_head);
+void display_faculty_workload(Professor *head);
+void display_professor_filter_stats(void);
+void free_all_professors(Professor *head);
+int count_professors(Professor *head);
+
+#endif
@@ -0,0 +1,756 @@
+// ranking.c - Sınıf Sıralaması Modülü (Top-K, Dekan Listesi)
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "ranking.h"
+#include "utils.h"
+#include "index.h"
+#include "archive.h"
+
+// Students ordered by (ranked_gpa desc, id asc), overall and within each class (major and enrollment
+// year). GPA changes are queued and applied by binary-search reinsertion on the next query; only a
+// first build or a large backlog sorts the whole list again.
+// (ranked_gpa azalan, id artan) sırasındaki öğrenciler; genel ve her sınıf (bölüm ve giriş yılı) içinde.
+// GPA değişiklikleri sıraya alınır ve sonraki sorguda ikili aramayla yeniden yerleştirilir; yalnızca
+// ilk kurulum veya büyük bir birikim tüm listeyi sıralar.
+static Student **rank_order = NULL;
+static int rank_count = 0;
+static int rank_capacity = 0;
+static int rank_built = 0;
+static Student **rank_pending = NULL;
+static int pending_count = 0;
+static int pending_capacity = 0;
+
+// One class in ranking order, found by its normalized "major|year" key
+// Normalize edilmiş "bölüm|yıl" anahtarıyla bulunan, sıralama düzenindeki bir sınıf
+typedef struct RankClass {
+    char major[INDEX_KEY_LEN];   // Normalized major
+    int year;
+    Student **order;
+    int count;
+    int capacity;
+    int slot;                    // Position in rank_classes
+} RankClass;
+
+static HashIndex rank_class_index = {NULL, 0, 0};
+static RankClass **rank_classes = NULL;
+static int rank_class_count = 0;
+static int rank_class_capacity = 0;
+
+// Students with in-memory grades in one term, so a dean's list reads only that term's students
+// Bir dönemde bellekte notu olan öğrenciler; dekan listesi yalnızca o dönemin öğrencilerini okur
+typedef struct TermRoster {
+    Student **members;
+    int count;
+    int capacity;
+} TermRoster;
+
+static IdIndex term_rosters = {NULL, 0, 0};
+
+// Ranking order: higher GPA first, then lower ID
+// Sıralama düzeni: önce yüksek GPA, sonra düşük ID
+static int ranked_ahead(const Student *a, const Student *b) {
+    if (a->ranked_gpa != b->ranked_gpa) return a->ranked_gpa > b->ranked_gpa;
+    return a->id < b->id;
+}
+
+static int compare_ranked(const void *a, const void *b) {
+    const Student *x = *(Student * const *)a;
+    const Student *y = *(Student * const *)b;
+    if (x == y) return 0;
+    return ranked_ahead(x, y) ? -1 : 1;
+}
+
+/**
+ * First position of an order whose student does not rank ahead of s (s's own slot while it is filed).
+ * Bir düzende öğrencisi s'nin önünde olmayan ilk konum (s dosyalıyken kendi yeri).
+ */
+static int order_position(Student * const *order, int count, const Student *s) {
+    int lo = 0, hi = count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (ranked_ahead(order[mid], s)) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * Inserts s into an order at its ranking position, growing the order when needed.
+ * s'yi bir düzene sıralama konumundan ekler; gerekirse düzeni büyütür.
+ * @return 1 if inserted, 0 on allocation failure
+ * @return Eklendiyse 1, bellek hatasında 0 döner
+ */
+static int order_insert(Student ***order, int *count, int *capacity, Student *s) {
+    if (*count == *capacity) {
+        int grown_capacity = (*capacity > 0) ? *capacity * 2 : 64;
+        Student **grown = (Student **)realloc(*order, grown_capacity * sizeof(Student *));
+        if (grown == NULL) return 0;
+        *order = grown;
+        *capacity = grown_capacity;
+    }
+    int pos = order_position(*order, *count, s);
+    memmove(*order + pos + 1, *order + pos, (*count - pos) * sizeof(Student *));
+    (*order)[pos] = s;
+    (*count)++;
+    return 1;
+}
+
+static void order_remove(Student **order, int *count, const Student *s) {
+    int pos = order_position(order, *count, s);
+    if (pos < *count && order[pos] == s) {
+        memmove(order + pos, order + pos + 1, (*count - pos - 1) * sizeof(Student *));
+        (*count)--;
+    }
+}
+
+/**
+ * Finds the class of a major and enrollment year, creating it on request.
+ * Bir bölüm ve giriş yılının sınıfını bulur; istenirse oluşturur.
+ * @return The class, or NULL if it does not exist (or memory ran out)
+ * @return Sınıf; yoksa (veya bellek yetmezse) NULL
+ */
+static RankClass* find_rank_class(const char *major, int year, int create) {
+    char raw[INDEX_KEY_LEN], key[INDEX_KEY_LEN];
+    snprintf(raw, sizeof(raw), "%s|%d", major, year);
+    normalize_key(raw, key, INDEX_KEY_LEN);
+    RankClass *c = (RankClass *)index_find(&rank_class_index, key);
+    if (c != NULL || !create) return c;
+
+    if (rank_class_count == rank_class_capacity) {
+        int capacity = (rank_class_capacity > 0) ? rank_class_capacity * 2 : 16;
+        RankClass **grown = (RankClass **)realloc(rank_classes, capacity * sizeof(RankClass *));
+        if (grown == NULL) return NULL;
+        rank_classes = grown;
+        rank_class_capacity = capacity;
+    }
+    c = (RankClass *)calloc(1, sizeof(RankClass));
+    if (c == NULL || !index_insert(&rank_class_index, key, c)) {
+        free(c);
+        return NULL;
+    }
+    normalize_key(major, c->major, INDEX_KEY_LEN);
+    c->year = year;
+    c->slot = rank_class_count;
+    rank_classes[rank_class_count++] = c;
+    return c;
+}
+
+static void unfile_student(Student *s) {
+    order_remove(rank_order, &rank_count, s);
+    if (s->rank_class != NULL) order_remove(s->rank_class->order, &s->rank_class->count, s);
+    s->rank_class = NULL;
+    s->rank_filed = 0;
+}
+
+/**
+ * Files a student under its current GPA in the overall order and in its class.
+ * Bir öğrenciyi güncel GPA'sıyla genel düzene ve sınıfına yerleştirir.
+ * @return 1 if filed, 0 on allocation failure
+ * @return Yerleştirildiyse 1, bellek hatasında 0 döner
+ */
+static int file_student(Student *s) {
+    s->ranked_gpa = s->gpa;
+    RankClass *c = find_rank_class(s->major, s->enrollment_year, 1);
+    if (c == NULL || !order_insert(&rank_order, &rank_count, &rank_capacity, s)) return 0;
+    if (!order_insert(&c->order, &c->count, &c->capacity, s)) {
+        order_remove(rank_order, &rank_count, s);
+        return 0;
+    }
+    s->rank_class = c;
+    s->rank_filed = 1;
+    return 1;
+}
+
+/**
+ * Queues a student whose GPA, major or enrollment year changed (or who was just added) for the ranking.
+ * GPA'sı, bölümü veya giriş yılı değişen (ya da yeni eklenen) bir öğrenciyi sıralama için sıraya koyar.
+ * * @param s - Student
+ * @param s - Öğrenci
+ */
+void ranking_touch(Student *s) {
+    if (s == NULL || !rank_built || s->rank_pending) return;
+    if (pending_count == pending_capacity) {
+        int capacity = (pending_capacity > 0) ? pending_capacity * 2 : 64;
+        Student **grown = (Student **)realloc(rank_pending, capacity * sizeof(Student *));
+        if (grown == NULL) {
+            // Kuyruk büyütülemezse bir sonraki sorguda sıralama baştan kurulur
+            rank_built = 0;
+            return;
+        }
+        rank_pending = grown;
+        pending_capacity = capacity;
+    }
+    rank_pending[pending_count++] = s;
+    s->rank_pending = 1;
+}
+
+/**
+ * Takes a student about to be deleted out of the ranking.
+ * Silinmek üzere olan bir öğrenciyi sıralamadan çıkarır.
+ * * @param s - Student
+ * @param s - Öğrenci
+ */
+void ranking_remove(Student *s) {
+    int i;
+    if (s == NULL) return;
+    if (s->rank_pending) {
+        for (i = 0; i < pending_count; i++) {
+            if (rank_pending[i] == s) {
+                rank_pending[i] = rank_pending[--pending_count];
+                break;
+            }
+        }
+        s->rank_pending = 0;
+    }
+    if (s->rank_filed && rank_built) unfile_student(s);
+    s->rank_filed = 0;
+    s->rank_class = NULL;
+}
+
+/**
+ * Adds a student to a term's roster; the term module calls this when a student's first grade of the term arrives.
+ * Bir öğrenciyi dönemin listesine ekler; öğrencinin o dönemdeki ilk notu geldiğinde çağrılır.
+ * * @param s - Student
+ * @param s - Öğrenci
+ * @param term - Term ordinal
+ * @param term - Dönem sıra numarası
+ */
+void ranking_term_join(Student *s, int term) {
+    TermRoster *r = (TermRoster *)id_index_find(&term_rosters, term);
+    if (r == NULL) {
+        r = (TermRoster *)calloc(1, sizeof(TermRoster));
+        if (r == NULL || !id_index_insert(&term_rosters, term, r)) {
+            printf("Error: Memory allocation failed!\n");
+            free(r);
+            return;
+        }
+    }
+    if (r->count == r->capacity) {
+        int capacity = (r->capacity > 0) ? r->capacity * 2 : 64;
+        Student **grown = (Student **)realloc(r->members, capacity * sizeof(Student *));
+        if (grown == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return;
+        }
+        r->members = grown;
+        r->capacity = capacity;
+    }
+    r->members[r->count++] = s;
+}
+
+/**
+ * Removes a student from a term's roster (its last grade of the term is gone). O(students of the term).
+ * Bir öğrenciyi dönemin listesinden çıkarır (dönemdeki son notu gitti). O(dönemin öğrencileri).
+ * * @param s - Student
+ * @param s - Öğrenci
+ * @param term - Term ordinal
+ * @param term - Dönem sıra numarası
+ */
+void ranking_term_leave(Student *s, int term) {
+    TermRoster *r = (TermRoster *)id_index_find(&term_rosters, term);
+    int i;
+    if (r == NULL) return;
+    for (i = 0; i < r->count; i++) {
+        if (r->members[i] == s) {
+            r->members[i] = r->members[--r->count];
+            return;
+        }
+    }
+}
+
+/**
+ * Drops the ranking and the term rosters (the student list is being freed).
+ * Sıralamayı ve dönem listelerini bırakır (öğrenci listesi serbest bırakılıyor).
+ */
+void ranking_clear(void) {
+    int i;
+    free(rank_order);
+    free(rank_pending);
+    rank_order = rank_pending = NULL;
+    rank_count = rank_capacity = pending_count = pending_capacity = 0;
+    rank_built = 0;
+    for (i = 0; i < rank_class_count; i++) {
+        free(rank_classes[i]->order);
+        free(rank_classes[i]);
+    }
+    free(rank_classes);
+    rank_classes = NULL;
+    rank_class_count = rank_class_capacity = 0;
+    index_clear(&rank_class_index);
+    for (i = 0; i < term_rosters.bucket_count; i++) {
+        IdIndexNode *node;
+        for (node = term_rosters.buckets[i]; node != NULL; node = node->next) {
+            TermRoster *r = (TermRoster *)node->value;
+            free(r->members);
+            free(r);
+        }
+    }
+    id_index_clear(&term_rosters);
+}
+
+// ===============================================
+// PARALLEL SORT (PARALEL SIRALAMA)
+// ===============================================
+
+typedef struct RankSortTask {
+    Student **base;
+    int count;
+} RankSortTask;
+
+static void* rank_sort_worker(void *arg) {
+    RankSortTask *task = (RankSortTask *)arg;
+    qsort(task->base, task->count, sizeof(Student *), compare_ranked);
+    return NULL;
+}
+
+static void merge_runs(Student **src, int lo, int mid, int hi, Student **dst) {
+    int i = lo, j = mid, k = lo;
+    while (i < mid && j < hi) dst[k++] = ranked_ahead(src[j], src[i]) ? src[j++] : src[i++];
+    while (i < mid) dst[k++] = src[i++];
+    while (j < hi) dst[k++] = src[j++];
+}
+
+/**
+ * Sorts into ranking order: each thread sorts one slice, then the sorted slices are merged pairwise.
+ * Sıralama düzenine dizer: her iş parçacığı bir dilimi sıralar, ardından sıralı dilimler ikişer birleştirilir.
+ * * @param items - Students to sort
+ * @param items - Sıralanacak öğrenciler
+ * @param count - Number of students
+ * @param count - Öğrenci sayısı
+ */
+static void parallel_rank_sort(Student **items, int count) {
+    pthread_t threads[RANKING_SORT_THREADS];
+    RankSortTask tasks[RANKING_SORT_THREADS];
+    int started[RANKING_SORT_THREADS];
+    int bounds[RANKING_SORT_THREADS + 1];
+    int runs = RANKING_SORT_THREADS, t;
+
+    Student **buffer = (count >= RANKING_PARALLEL_MIN) ? (Student **)malloc(count * sizeof(Student *)) : NULL;
+    if (buffer == NULL) {
+        qsort(items, count, sizeof(Student *), compare_ranked);
+        return;
+    }
+    for (t = 0; t <= runs; t++) bounds[t] = (int)((long)count * t / runs);
+    for (t = 0; t < runs; t++) {
+        tasks[t].base = items + bounds[t];
+        tasks[t].count = bounds[t + 1] - bounds[t];
+        started[t] = (pthread_create(&threads[t], NULL, rank_sort_worker, &tasks[t]) == 0);
+        if (!started[t]) rank_sort_worker(&tasks[t]);
+    }
+    for (t = 0; t < runs; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+    }
+
+    Student **src = items, **dst = buffer;
+    while (runs > 1) {
+        int merged = 0;
+        for (t = 0; t < runs; t += 2) {
+            int hi = (t + 2 <= runs) ? bounds[t + 2] : bounds[t + 1];
+            merge_runs(src, bounds[t], bounds[t + 1], hi, dst);
+            bounds[merged++] = bounds[t];
+        }
+        bounds[merged] = count;
+        runs = merged;
+        Student **swap = src; src = dst; dst = swap;
+    }
+    if (src != items) memcpy(items, src, count * sizeof(Student *));
+    free(buffer);
+}
+
+/**
+ * Brings the ranking orders up to date: queued students are reinserted one by one; the first query,
+ * or a backlog larger than a quarter of the students, rebuilds the overall order with the parallel sort
+ * and deals it out to the class orders.
+ * Sıralama düzenlerini günceller: sıradaki öğrenciler tek tek yeniden yerleştirilir; ilk sorgu veya
+ * öğrencilerin dörtte birinden büyük bir birikim genel düzeni paralel sıralama ile yeniden kurar ve
+ * sınıf düzenlerine dağıtır.
+ * @return 1 if the ranking is current, 0 on allocation failure
+ * @return Sıralama güncelse 1, bellek hatasında 0 döner
+ */
+static int ranking_refresh(Student *head) {
+    Student *s;
+    int i;
+
+    if (rank_built && pending_count <= rank_count / 4) {
+        for (i = 0; i < pending_count; i++) {
+            s = rank_pending[i];
+            s->rank_pending = 0;
+            if (s->rank_filed) unfile_student(s);
+            if (!file_student(s)) {
+                printf("Error: Memory allocation failed!\n");
+                rank_built = 0;
+                return 0;
+            }
+        }
+        pending_count = 0;
+        return 1;
+    }
+
+    int count = 0;
+    for (s = head; s != NULL; s = s->next) count++;
+    if (count > rank_capacity) {
+        Student **grown = (Student **)realloc(rank_order, count * sizeof(Student *));
+        if (grown == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return 0;
+        }
+        rank_order = grown;
+        rank_capacity = count;
+    }
+    rank_count = 0;
+    for (s = head; s != NULL; s = s->next) {
+        s->ranked_gpa = s->gpa;
+        s->rank_pending = 0;
+        rank_order[rank_count++] = s;
+    }
+    pending_count = 0;
+    parallel_rank_sort(rank_order, rank_count);
+
+    // Sınıf düzenleri genel düzen sırayla dağıtılarak kurulur; her ekleme düzenin sonuna düşer
+    for (i = 0; i < rank_class_count; i++) rank_classes[i]->count = 0;
+    for (i = 0; i < rank_count; i++) {
+        s = rank_order[i];
+        RankClass *c = find_rank_class(s->major, s->enrollment_year, 1);
+        if (c == NULL || !order_insert(&c->order, &c->count, &c->capacity, s)) {
+            printf("Error: Memory allocation failed!\n");
+            rank_built = 0;
+            return 0;
+        }
+        s->rank_class = c;
+        s->rank_filed = 1;
+    }
+    rank_built = 1;
+    return 1;
+}
+
+// ===============================================
+// QUERIES (SORGULAR)
+// ===============================================
+
+/**
+ * Merges the head of a class order into the best-first students kept so far, keeping at most k.
+ * Bir sınıf düzeninin başını şimdiye kadar tutulan en iyi öğrencilerle birleştirir; en fazla k tutar.
+ * @return Number of students kept
+ * @return Tutulan öğrenci sayısı
+ */
+static int merge_class_head(Student **kept, int kept_count, const RankClass *c, int k) {
+    Student *merged[RANKING_MAX_K];
+    int i = 0, j = 0, n = 0;
+    while (n < k && (i < kept_count || j < c->count)) {
+        if (j >= c->count || (i < kept_count && ranked_ahead(kept[i], c->order[j]))) merged[n++] = kept[i++];
+        else merged[n++] = c->order[j++];
+    }
+    memcpy(kept, merged, n * sizeof(Student *));
+    return n;
+}
+
+/**
+ * Finds the K highest GPAs of a class by reading the head of its ranking order. A whole major or a whole
+ * year merges the heads of the matching class orders; no filter reads the overall order.
+ * Bir sınıfın en yüksek K GPA'sını sıralama düzeninin başından okur. Bütün bir bölüm veya bütün bir yıl,
+ * eşleşen sınıf düzenlerinin başlarını birleştirir; filtresiz sorgu genel düzeni okur.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param major - Major of the class (NULL or "" for every major)
+ * @param major - Sınıfın bölümü (tüm bölümler için NULL veya "")
+ * @param year - Enrollment year of the class (0 for every year)
+ * @param year - Sınıfın giriş yılı (tüm yıllar için 0)
+ * @param k - Number of students wanted (at most RANKING_MAX_K)
+ * @param k - İstenen öğrenci sayısı (en fazla RANKING_MAX_K)
+ * @param out - Receives the students, best first
+ * @param out - Öğrencileri en iyiden başlayarak alır
+ * @param class_size - Receives the number of students in the class (may be NULL)
+ * @param class_size - Sınıftaki öğrenci sayısını alır (NULL olabilir)
+ * @return Number of students written
+ * @return Yazılan öğrenci sayısı
+ */
+int ranking_top_k(Student *head, const char *major, int year, int k, Student **out, int *class_size) {
+    char wanted[INDEX_KEY_LEN];
+    int any_major = (major == NULL || major[0] == '\0');
+    int members = 0, count = 0, i;
+
+    if (class_size != NULL) *class_size = 0;
+    if (k > RANKING_MAX_K) k = RANKING_MAX_K;
+    if (k < 0) k = 0;
+    if (!ranking_refresh(head)) return 0;
+
+    if (any_major && year == 0) {
+        members = rank_count;
+        count = (k < rank_count) ? k : rank_count;
+        memcpy(out, rank_order, count * sizeof(Student *));
+    } else if (!any_major && year != 0) {
+        RankClass *c = find_rank_class(major, year, 0);
+        if (c != NULL) {
+            members = c->count;
+            count = (k < c->count) ? k : c->count;
+            memcpy(out, c->order, count * sizeof(Student *));
+        }
+    } else {
+        if (!any_major) normalize_key(major, wanted, INDEX_KEY_LEN);
+        for (i = 0; i < rank_class_count; i++) {
+            const RankClass *c = rank_classes[i];
+            if (any_major ? c->year != year : strcmp(c->major, wanted) != 0) continue;
+            members += c->count;
+            count = merge_class_head(out, count, c, k);
+        }
+    }
+    if (class_size != NULL) *class_size = members;
+    return count;
+}
+
+/**
+ * Rank of a student within their major and enrollment year, found by binary search in the class order;
+ * equal GPAs share a rank.
+ * Bir öğrencinin bölümü ve giriş yılı içindeki sırası, sınıf düzeninde ikili aramayla bulunur;
+ * eşit GPA'ler aynı sırayı paylaşır.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param s - Student
+ * @param s - Öğrenci
+ * @param class_size - Receives the number of students in the class (may be NULL)
+ * @param class_size - Sınıftaki öğrenci sayısını alır (NULL olabilir)
+ * @return Class rank (1 = top), or 0 if the ranking could not be built
+ * @return Sınıf sırası (1 = en üst); sıralama kurulamazsa 0
+ */
+int ranking_class_rank(Student *head, const Student *s, int *class_size) {
+    if (class_size != NULL) *class_size = 0;
+    if (s == NULL || !ranking_refresh(head) || s->rank_class == NULL) return 0;
+    const RankClass *c = s->rank_class;
+    int lo = 0, hi = c->count;
+    // Daha yüksek GPA'li öğrencilerin sayısı (eşitler aynı sırayı paylaşır)
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (c->order[mid]->ranked_gpa > s->ranked_gpa) lo = mid + 1;
+        else hi = mid;
+    }
+    if (class_size != NULL) *class_size = c->count;
+    return lo + 1;
+}
+
+/**
+ * Writes the full ranking, overall and within each major and enrollment year, in one walk of the ranking order.
+ * Tam sıralamayı, genel ve her bölüm ve giriş yılı içinde, sıralama düzeni üzerinde tek geçişte yazar.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param filename - Destination CSV file
+ * @param filename - Hedef CSV dosyası
+ * @return 1 if successful, 0 otherwise
+ * @return Başarılıysa 1, aksi takdirde 0 döner
+ */
+int save_ranking_to_csv(Student *head, const char *filename) {
+    // Her sınıf için: görülen öğrenci sayısı, son sıra ve son GPA
+    typedef struct ClassCounter { int seen; int rank; float last_gpa; } ClassCounter;
+    ClassCounter *counters = NULL;
+    int class_count = 0, overall = 0, i;
+
+    if (!ranking_refresh(head)) return 0;
+    counters = (ClassCounter *)calloc(rank_class_count > 0 ? rank_class_count : 1, sizeof(ClassCounter));
+    FILE *file = fopen(filename, "w");
+    if (counters == NULL || file == NULL) {
+        printf("Error: Could not write %s!\n", filename);
+        free(counters);
+        if (file != NULL) fclose(file);
+        return 0;
+    }
+    fprintf(file, "overall_rank,class_rank,student_id,first_name,last_name,major,enrollment_year,gpa\n");
+    for (i = 0; i < rank_count; i++) {
+        Student *s = rank_order[i];
+        if (i == 0 || s->ranked_gpa != rank_order[i - 1]->ranked_gpa) overall = i + 1;
+
+        ClassCounter *c = &counters[s->rank_class->slot];
+        if (++c->seen == 1) class_count++;
+        if (c->seen == 1 || s->ranked_gpa != c->last_gpa) c->rank = c->seen;
+        c->last_gpa = s->ranked_gpa;
+
+        fprintf(file, "%d,%d,%d,%s,%s,%s,%d,%.2f\n", overall, c->rank, s->id, s->first_name, s->last_name,
+                s->major, s->enrollment_year, s->ranked_gpa);
+    }
+    fclose(file);
+    free(counters);
+    printf("Success: Ranked %d students in %d classes into %s.\n", rank_count, class_count, filename);
+    return 1;
+}
+
+static int compare_deans_entries(const void *a, const void *b) {
+    const DeansListEntry *x = (const DeansListEntry *)a;
+    const DeansListEntry *y = (const DeansListEntry *)b;
+    if (x->term_gpa != y->term_gpa) return (x->term_gpa < y->term_gpa) - (x->term_gpa > y->term_gpa);
+    return (x->student->id > y->student->id) - (x->student->id < y->student->id);
+}
+
+static int compare_student_ids(const void *a, const void *b) {
+    const Student *x = *(Student * const *)a;
+    const Student *y = *(Student * const *)b;
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+/**
+ * Students who may have grades in a term: the term's roster plus the students of the term's archives.
+ * A student with both hot and archived grades is counted twice; callers de-duplicate.
+ * Bir dönemde notu olabilecek öğrenciler: dönemin listesi ve dönemin arşivlerindeki öğrenciler.
+ * Hem sıcak hem arşivlenmiş notu olan öğrenci iki kez sayılır; çağıranlar tekrarları ayıklar.
+ * @param out - Receives the students (NULL to only count them)
+ * @param out - Öğrencileri alır (yalnızca saymak için NULL)
+ * @return Number of candidates
+ * @return Aday sayısı
+ */
+static int term_candidates(int term, Student **out) {
+    TermRoster *r = (TermRoster *)id_index_find(&term_rosters, term);
+    int n = 0, a, i;
+    if (r != NULL) {
+        if (out != NULL) memcpy(out, r->members, r->count * sizeof(Student *));
+        n = r->count;
+    }
+    for (a = 0; a < archive_count(); a++) {
+        const SemesterArchive *archive = archive_get(a);
+        if (semester_to_term(archive->semester) != term) continue;
+        // Arşiv satırları öğrenciye göre sıralıdır: her öğrenci ardışık bir dizidir
+        for (i = 0; i < archive->grade_count; i++) {
+            if (i > 0 && archive->grades[i].student_id == archive->grades[i - 1].student_id) continue;
+            Student *s = get_student_by_id(archive->grades[i].student_id);
+            if (s == NULL) continue;
+            if (out != NULL) out[n] = s;
+            n++;
+        }
+    }
+    return n;
+}
+
+/**
+ * Builds a term's dean's list from the students who have grades in that term (the term roster and the
+ * term's archives), not the whole student list: term GPA at or above min_gpa with at least min_credits
+ * attempted, read from each student's term totals. Sorted by term GPA.
+ * Bir dönemin dekan listesini tüm öğrenci listesinden değil, o dönemde notu olan öğrencilerden (dönem
+ * listesi ve dönemin arşivleri) oluşturur: dönem GPA'sı min_gpa veya üstü ve en az min_credits kredi;
+ * değerler öğrencinin dönem toplamlarından okunur. Dönem GPA'sına göre sıralıdır.
+ * * @param head - Head of the student list (unused, kept for API compatibility)
+ * @param head - Öğrenci listesinin başı (kullanılmıyor, API uyumluluğu için tutuldu)
+ * @param term - Term ordinal
+ * @param term - Dönem sıra numarası
+ * @param min_gpa - Lowest qualifying term GPA
+ * @param min_gpa - Listeye giren en düşük dönem GPA'sı
+ * @param min_credits - Lowest qualifying credit load
+ * @param min_credits - Listeye giren en düşük kredi yükü
+ * @param out - Receives the entries
+ * @param out - Kayıtları alır
+ * @param max_results - Capacity of out
+ * @param max_results - out'un kapasitesi
+ * @return Number of entries written
+ * @return Yazılan kayıt sayısı
+ */
+int deans_list(Student *head, int term, float min_gpa, int min_credits, DeansListEntry *out, int max_results) {
+    TermRecord r;
+    int count = 0, total, i;
+    (void)head;
+
+    total = term_candidates(term, NULL);
+    Student **candidates = (Student **)malloc((total > 0 ? total : 1) * sizeof(Student *));
+    if (candidates == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+    total = term_candidates(term, candidates);
+    qsort(candidates, total, sizeof(Student *), compare_student_ids);
+    for (i = 0; i < total && count < max_results; i++) {
+        Student *s = candidates[i];
+        if (i > 0 && candidates[i - 1] == s) continue;
+        if (!student_term_record(s, term, &r) || r.credits_attempted < min_credits) continue;
+        float gpa = r.quality_points / r.credits_attempted;
+        if (gpa < min_gpa) continue;
+        out[count].student = s;
+        out[count].term_gpa = gpa;
+        out[count].credits = r.credits_attempted;
+        count++;
+    }
+    free(candidates);
+    qsort(out, count, sizeof(DeansListEntry), compare_deans_entries);
+    return count;
+}
+
+// ===============================================
+// REPORTS (RAPORLAR)
+// ===============================================
+
+/**
+ * Prints the top K of a class with their class rank.
+ * Bir sınıfın ilk K öğrencisini sınıf sıralarıyla yazdırır.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param major - Major ("" for every major)
+ * @param major - Bölüm (tüm bölümler için "")
+ * @param year - Enrollment year (0 for every year)
+ * @param year - Giriş yılı (tüm yıllar için 0)
+ * @param k - Number of students to show
+ * @param k - Gösterilecek öğrenci sayısı
+ */
+void display_class_ranking(Student *head, const char *major, int year, int k) {
+    Student *top[RANKING_MAX_K];
+    char year_text[12];
+    int class_size = 0, rank = 0, i;
+    int count = ranking_top_k(head, major, year, k, top, &class_size);
+
+    if (year > 0) snprintf(year_text, sizeof(year_text), "%d", year);
+    else strcpy(year_text, "all years");
+    printf("\n==========================================================================\n");
+    printf("   Class Ranking: %s, %s (top %d of %d)\n", (major != NULL && major[0] != '\0') ? major : "all majors",
+           year_text, count, class_size);
+    printf("==========================================================================\n");
+    printf("%-5s %-10s %-25s %-20s %-5s %5s\n", "Rank", "ID", "Name", "Major", "Year", "GPA");
+    printf("--------------------------------------------------------------------------\n");
+    for (i = 0; i < count; i++) {
+        char name[100];
+        if (i == 0 || top[i]->gpa != top[i - 1]->gpa) rank = i + 1;
+        snprintf(name, sizeof(name), "%s %s", top[i]->first_name, top[i]->last_name);
+        printf("%-5d %-10d %-25.25s %-20.20s %-5d %5.2f\n", rank, top[i]->id, name, top[i]->major,
+               top[i]->enrollment_year, top[i]->gpa);
+    }
+    if (count == 0) printf("No students in this class.\n");
+    printf("==========================================================================\n");
+}
+
+/**
+ * Prints a term's dean's list.
+ * Bir dönemin dekan listesini yazdırır.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param term - Term ordinal
+ * @param term - Dönem sıra numarası
+ * @param min_gpa - Lowest qualifying term GPA
+ * @param min_gpa - Listeye giren en düşük dönem GPA'sı
+ * @param min_credits - Lowest qualifying credit load
+ * @param min_credits - Listeye giren en düşük kredi yükü
+ */
+void display_deans_list(Student *head, int term, float min_gpa, int min_credits) {
+    Student *s;
+    char semester[20];
+    int i;
+    int students = term_candidates(term, NULL);
+    DeansListEntry *entries = (DeansListEntry *)malloc((students > 0 ? students : 1) * sizeof(DeansListEntry));
+    if (entries == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return;
+    }
+    int count = deans_list(head, term, min_gpa, min_credits, entries, students);
+
+    term_to_semester(term, semester, sizeof(semester));
+    printf("\n==================================================================\n");
+    printf("   Dean's List %s (term GPA >= %.2f, >= %d credits)\n", semester, min_gpa, min_credits);
+    printf("==================================================================\n");
+    printf("%-10s %-25s %-18s %7s %8s\n", "ID", "Name", "Major", "Credits", "Term GPA");
+    printf("------------------------------------------------------------------\n");
+    for (i = 0; i < count; i++) {
+        char name[100];
+        s = entries[i].student;
+        snprintf(name, sizeof(name), "%s %s", s->first_name, s->last_name);
+        printf("%-10d %-25.25s %-18.18s %7d %8.2f\n", s->id, name, s->major, entries[i].credits, entries[i].term_gpa);
+    }
+    if (count == 0) printf("No students qualify.\n");
+    else printf("------------------------------------------------------------------\nTotal: %d student(s)\n", count);
+    printf("==================================================================\n");
+    free(entries);
+}
@@ -0,0 +1,37 @@
+// ranking.h - Sınıf Sıralaması Modülü (Top-K, Dekan Listesi)
+
+#ifndef RANKING_H
+#define RANKING_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "student.h"
+
+#define RANKING_FILE "data/class_ranking.csv"
+#define RANKING_MAX_K 100
+#define RANKING_SORT_THREADS 4
+#define RANKING_PARALLEL_MIN 4096    // Shorter lists are sorted on the calling thread
+#define DEANS_LIST_MIN_GPA 3.50f
+#define DEANS_LIST_MIN_CREDITS 12
+
+// One student on a term's dean's list
+// Bir dönemin dekan listesindeki bir öğrenci
+typedef struct DeansListEntry {
+    Student *student;
+    float term_gpa;
+    int credits;
+} DeansListEntry;
+
+void ranking_touch(Student *s);
+void ranking_remove(Student *s);
+void ranking_term_join(Student *s, int term);
+void ranking_term_leave(Student *s, int term);
+void ranking_clear(void);
+int ranking_top_k(Student *head, const char *major, int year, int k, Student **out, int *class_size);
+int ranking_class_rank(Student *head, const Student *s, int *class_size);
+int save_ranking_to_csv(Student *head, const char *filename);
+int deans_list(Student *head, int term, float min_gpa, int min_credits, DeansListEntry *out, int max_results);
+void display_class_ranking(Student *head, const char *major, int year, int k);
+void display_deans_list(Student *head, int term, float min_gpa, int min_credits);
+
+#endif
@@ -0,0 +1,297 @@
+// registration.c - Toplu Kayıt Modülü (Dönem Açılışı)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "registration.h"
+#include "student.h"
+#include "course.h"
+#include "professor.h"
+#include "utils.h"
+
+// One row of the request file and its outcome; reason stays NULL while the request is still accepted.
+// İstek dosyasının bir satırı ve sonucu; istek kabul edildiği sürece reason NULL kalır.
+typedef struct BulkRequest {
+    int line;
+    int student_id;
+    int course_id;
+    int professor_id;
+    char semester[20];
+    unsigned long long priority;   // Lower wins a contested seat
+    Course *course;
+    const char *reason;
+    int enrollment_id;
+} BulkRequest;
+
+/**
+ * Returns a printable name of a registration policy.
+ * Bir kayıt politikasının yazdırılabilir adını döndürür.
+ * * @param policy - Registration policy
+ * @param policy - Kayıt politikası
+ * @return Constant name string
+ * @return Sabit ad dizgisi
+ */
+const char* registration_policy_name(RegistrationPolicy policy) {
+    return (policy == REGISTRATION_LOTTERY) ? "Lottery" : "Submission order";
+}
+
+/**
+ * Mixes the seed with a (student, course) pair into a lottery number (splitmix64 finalizer).
+ * Depends only on the seed and the pair, so reordering the request file does not change the draw.
+ * Tohumu bir (öğrenci, ders) çiftiyle karıştırarak kura numarası üretir (splitmix64 sonlandırıcısı).
+ * Yalnızca tohuma ve çifte bağlıdır; istek dosyasının sırası değişse de kura sonucu değişmez.
+ */
+static unsigned long long lottery_number(unsigned long seed, int student_id, int course_id) {
+    unsigned long long x = (unsigned long long)seed;
+    x ^= ((unsigned long long)(unsigned int)student_id << 32) | (unsigned int)course_id;
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * Orders requests by student, then course, then priority (duplicate and prerequisite pass).
+ * İstekleri öğrenciye, sonra derse, sonra önceliğe göre sıralar (tekrar ve ön koşul geçişi).
+ */
+static int compare_by_student(const void *a, const void *b) {
+    const BulkRequest *x = *(const BulkRequest * const *)a;
+    const BulkRequest *y = *(const BulkRequest * const *)b;
+    if (x->student_id != y->student_id) return (x->student_id < y->student_id) ? -1 : 1;
+    if (x->course_id != y->course_id) return (x->course_id < y->course_id) ? -1 : 1;
+    if (x->priority != y->priority) return (x->priority < y->priority) ? -1 : 1;
+    return x->line - y->line;
+}
+
+/**
+ * Orders requests by course, then priority (capacity pass).
+ * İstekleri derse, sonra önceliğe göre sıralar (kapasite geçişi).
+ */
+static int compare_by_course(const void *a, const void *b) {
+    const BulkRequest *x = *(const BulkRequest * const *)a;
+    const BulkRequest *y = *(const BulkRequest * const *)b;
+    if (x->course_id != y->course_id) return (x->course_id < y->course_id) ? -1 : 1;
+    if (x->priority != y->priority) return (x->priority < y->priority) ? -1 : 1;
+    return x->line - y->line;
+}
+
+/**
+ * Reads the request file (student_id,course_id,professor_id,semester; header optional).
+ * İstek dosyasını okur (student_id,course_id,professor_id,semester; başlık isteğe bağlı).
+ * * @param file - Open request file
+ * @param file - Açık istek dosyası
+ * @param count - Receives the number of rows read
+ * @param count - Okunan satır sayısını alır
+ * @return Array of requests (caller frees) or NULL on allocation failure
+ * @return İstek dizisi (çağıran serbest bırakır) veya bellek hatasında NULL
+ */
+static BulkRequest* read_requests(FILE *file, int *count) {
+    char line[512];
+    char *tokens[5];
+    int capacity = 1024, n = 0, line_no = 0;
+    BulkRequest *requests = (BulkRequest *)malloc(capacity * sizeof(BulkRequest));
+    if (requests == NULL) return NULL;
+
+    while (fgets(line, sizeof(line), file)) {
+        line_no++;
+        remove_newline(line);
+        trim_whitespace(line);
+        if (line[0] == '\0') continue;
+        if (line_no == 1 && !isdigit((unsigned char)line[0])) continue;   // Başlık satırı
+
+        if (n == capacity) {
+            BulkRequest *grown = (BulkRequest *)realloc(requests, capacity * 2 * sizeof(BulkRequest));
+            if (grown == NULL) {
+                free(requests);
+                return NULL;
+            }
+            requests = grown;
+            capacity *= 2;
+        }
+        BulkRequest *r = &requests[n++];
+        memset(r, 0, sizeof(BulkRequest));
+        r->line = line_no;
+        if (split_csv_line(line, tokens, 4) < 4) {
+            r->reason = "Malformed row";
+            continue;
+        }
+        r->student_id = atoi(tokens[0]);
+        r->course_id = atoi(tokens[1]);
+        r->professor_id = atoi(tokens[2]);
+        trim_whitespace(tokens[3]);
+        snprintf(r->semester, sizeof(r->semester), "%s", tokens[3]);
+    }
+    *count = n;
+    return requests;
+}
+
+/**
+ * Writes one report row per request in file order.
+ * Her istek için dosya sırasıyla bir rapor satırı yazar.
+ * * @return 1 if written, 0 if the file cannot be opened
+ * @return Yazıldıysa 1, dosya açılamazsa 0 döner
+ */
+static int write_registration_report(const char *filename, const BulkRequest *requests, int count) {
+    FILE *file = fopen(filename, "w");
+    int i;
+    if (file == NULL) {
+        printf("Error: Could not open %s for writing!\n", filename);
+        return 0;
+    }
+    fprintf(file, "line,student_id,course_id,professor_id,semester,result,enrollment_id,reason\n");
+    for (i = 0; i < count; i++) {
+        const BulkRequest *r = &requests[i];
+        fprintf(file, "%d,%d,%d,%d,%s,%s,%d,%s\n", r->line, r->student_id, r->course_id, r->professor_id,
+                r->semester, (r->reason == NULL) ? "Accepted" : "Rejected", r->enrollment_id,
+                (r->reason == NULL) ? "" : r->reason);
+    }
+    fclose(file);
+    return 1;
+}
+
+/**
+ * Registers a whole batch of (student, course, professor, semester) requests at once.
+ * Existence is checked through the ID indexes, duplicates and prerequisites are checked once per
+ * student group, capacity conflicts are settled per course by the chosen policy and the accepted
+ * rows are committed in one pass. Every request gets an Accepted/Rejected line in the report.
+ * Bir (öğrenci, ders, profesör, dönem) istek grubunu tek seferde kaydeder.
+ * Varlık ID indeksleriyle, tekrarlar ve ön koşullar her öğrenci grubu için bir kez kontrol edilir,
+ * kontenjan çakışmaları seçilen politikaya göre ders bazında çözülür ve kabul edilen satırlar
+ * tek geçişte eklenir. Her istek raporda bir Accepted/Rejected satırı alır.
+ * * @param head_ptr - Double pointer to the head of the enrollment list
+ * @param head_ptr - Kayıt listesinin başına işaret eden çift kademeli pointer
+ * @param g_head - Head of the grade list (for prerequisites)
+ * @param g_head - Not listesinin başı (ön koşullar için)
+ * @param request_file - CSV of requests: student_id,course_id,professor_id,semester
+ * @param request_file - İstek CSV'si: student_id,course_id,professor_id,semester
+ * @param report_file - Destination of the accepted/rejected report
+ * @param report_file - Kabul/ret raporunun hedef dosyası
+ * @param policy - How oversubscribed courses are settled
+ * @param policy - Kontenjanı aşılan derslerin nasıl çözüleceği
+ * @param seed - Lottery seed (ignored for submission order)
+ * @param seed - Kura tohumu (gönderim sırasında yok sayılır)
+ * @param summary - Receives request/accepted/rejected counts (may be NULL)
+ * @param summary - İstek/kabul/ret sayılarını alır (NULL olabilir)
+ * @return 1 if the batch was processed, 0 if the request file cannot be read
+ * @return Grup işlendiyse 1, istek dosyası okunamazsa 0 döner
+ */
+int bulk_register_from_csv(Enrollment **head_ptr, Grade *g_head, const char *request_file, const char *report_file,
+                           RegistrationPolicy policy, unsigned long seed, RegistrationSummary *summary) {
+    FILE *file = fopen(request_file, "r");
+    int count = 0, valid = 0, i, j;
+    if (file == NULL) {
+        printf("Error: Could not open %s!\n", request_file);
+        return 0;
+    }
+    BulkRequest *requests = read_requests(file, &count);
+    fclose(file);
+    if (requests == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+
+    BulkRequest **order = (BulkRequest **)malloc((count > 0 ? count : 1) * sizeof(BulkRequest *));
+    int slot_count = get_course_slot_count();
+    Grade **best = (Grade **)malloc((slot_count > 0 ? slot_count : 1) * sizeof(Grade *));
+    if (order == NULL || best == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        free(order);
+        free(best);
+        free(requests);
+        return 0;
+    }
+
+    // 1) Varlık kontrolü: her satır için O(1) indeks araması
+    for (i = 0; i < count; i++) {
+        BulkRequest *r = &requests[i];
+        if (r->reason != NULL) continue;
+        if (get_student_by_id(r->student_id) == NULL) r->reason = enroll_result_message(ENROLL_NO_STUDENT);
+        else if ((r->course = get_course_by_id(r->course_id)) == NULL) r->reason = enroll_result_message(ENROLL_NO_COURSE);
+        else if (get_professor_by_id(r->professor_id) == NULL) r->reason = enroll_result_message(ENROLL_NO_PROFESSOR);
+        else {
+            r->priority = (policy == REGISTRATION_LOTTERY) ? lottery_number(seed, r->student_id, r->course_id)
+                                                            : (unsigned long long)r->line;
+            order[valid++] = r;
+        }
+    }
+
+    // 2) Öğrenci grupları: tekrar istekler, mevcut kayıtlar ve ön koşullar (notlar öğrenci başına bir kez toplanır)
+    qsort(order, valid, sizeof(BulkRequest *), compare_by_student);
+    for (i = 0; i < valid; i = j) {
+        int student_id = order[i]->student_id, grades_ready = 0;
+        for (j = i; j < valid && order[j]->student_id == student_id; j++) {
+            BulkRequest *r = order[j];
+            if (j > i && order[j - 1]->course_id == r->course_id) {
+                r->reason = "Duplicate request in batch";
+            } else if (is_student_enrolled(*head_ptr, student_id, r->course_id)) {
+                r->reason = enroll_result_message(ENROLL_ALREADY_ENROLLED);
+            } else if (has_prerequisites(r->course)) {
+                if (!grades_ready) {
+                    memset(best, 0, (slot_count > 0 ? slot_count : 1) * sizeof(Grade *));
+                    collect_best_grades(student_id, g_head, best);
+                    grades_ready = 1;
+                }
+                if (!prerequisites_met(r->course, best)) r->reason = enroll_result_message(ENROLL_PREREQUISITE);
+            }
+        }
+    }
+
+    // 3) Kapasite: her ders için öncelik sırasına göre kalan koltuklar dağıtılır
+    int contenders = 0;
+    for (i = 0; i < valid; i++) {
+        if (order[i]->reason == NULL) order[contenders++] = order[i];
+    }
+    qsort(order, contenders, sizeof(BulkRequest *), compare_by_course);
+    for (i = 0; i < contenders; i = j) {
+        Course *c = order[i]->course;
+        int seats = c->capacity - c->seats_taken;
+        for (j = i; j < contenders && order[j]->course == c; j++) {
+            if (seats > 0) seats--;
+            else order[j]->reason = enroll_result_message(ENROLL_COURSE_FULL);
+        }
+    }
+
+    // 4) Kabul edilenler dosya sırasıyla tek geçişte eklenir
+    Enrollment *rows = (Enrollment *)malloc((count > 0 ? count : 1) * sizeof(Enrollment));
+    int row_count = 0;
+    if (rows == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        for (i = 0; i < count; i++) {
+            if (requests[i].reason == NULL) requests[i].reason = enroll_result_message(ENROLL_FAILED);
+        }
+    } else {
+        for (i = 0; i < count; i++) {
+            BulkRequest *r = &requests[i];
+            if (r->reason != NULL) continue;
+            memset(&rows[row_count], 0, sizeof(Enrollment));
+            rows[row_count].student_id = r->student_id;
+            rows[row_count].course_id = r->course_id;
+            rows[row_count].professor_id = r->professor_id;
+            strcpy(rows[row_count].semester, r->semester);
+            row_count++;
+        }
+        append_enrollments(head_ptr, rows, row_count);
+        for (i = 0, j = 0; i < count; i++) {
+            BulkRequest *r = &requests[i];
+            if (r->reason != NULL) continue;
+            r->enrollment_id = rows[j++].id;
+            if (r->enrollment_id == 0) r->reason = enroll_result_message(ENROLL_COURSE_FULL);
+        }
+        free(rows);
+    }
+
+    RegistrationSummary result = {count, 0, 0};
+    for (i = 0; i < count; i++) {
+        if (requests[i].reason == NULL) result.accepted++;
+        else result.rejected++;
+    }
+    write_registration_report(report_file, requests, count);
+    printf("Success: Bulk registration (%s) processed %d requests: %d accepted, %d rejected. Report: %s\n",
+           registration_policy_name(policy), result.requests, result.accepted, result.rejected, report_file);
+    if (summary != NULL) *summary = result;
+
+    free(best);
+    free(order);
+    free(requests);
+    return 1;
+}
@@ -0,0 +1,30 @@
+// registration.h - Toplu Kayıt Modülü (Dönem Açılışı)
+
+#ifndef REGISTRATION_H
+#define REGISTRATION_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "enrollment.h"
+#include "grade.h"
+
+#define REGISTRATION_REPORT_FILE "data/registration_report.csv"
+
+// Who gets the last seats of an oversubscribed course
+// Kontenjanı aşılan bir dersin son koltuklarını kimin alacağı
+typedef enum RegistrationPolicy {
+    REGISTRATION_SUBMISSION = 0,   // Earlier rows of the request file first
+    REGISTRATION_LOTTERY           // Seeded draw per (student, course); same seed, same result
+} RegistrationPolicy;
+
+typedef struct RegistrationSummary {
+    int requests;
+    int accepted;
+    int rejected;
+} RegistrationSummary;
+
+int bulk_register_from_csv(Enrollment **head_ptr, Grade *g_head, const char *request_file, const char *report_file,
+                           RegistrationPolicy policy, unsigned long seed, RegistrationSummary *summary);
+const char* registration_policy_name(RegistrationPolicy policy);
+
+#endif
@@ -0,0 +1,174 @@
+// section.c - Ders Şubesi (Profesör Ders Yükü) Modülü
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "section.h"
+#include "index.h"
+
+// All sections, the "prof|course|semester" -> Section* index and the professor -> first section chain.
+// Tüm şubeler, "prof|ders|dönem" -> Section* indeksi ve profesör -> ilk şube zinciri.
+static Section *section_list = NULL;
+static HashIndex section_key_index = {NULL, 0, 0};
+static IdIndex professor_section_index = {NULL, 0, 0};
+
+/**
+ * Builds the lookup key of the section an enrollment belongs to.
+ * Bir kaydın ait olduğu şubenin arama anahtarını oluşturur.
+ * * @param e - Enrollment record
+ * @param e - Kayıt verisi
+ * @param key - Buffer of INDEX_KEY_LEN bytes
+ * @param key - INDEX_KEY_LEN boyutunda alan
+ */
+static void section_key(const Enrollment *e, char *key) {
+    snprintf(key, INDEX_KEY_LEN, "%d|%d|%s", e->professor_id, e->course_id, e->semester);
+}
+
+/**
+ * Returns the counter matching an enrollment status.
+ * Bir kayıt durumuna karşılık gelen sayacı döndürür.
+ * * @param section - Section whose counter is selected
+ * @param section - Sayacı seçilecek şube
+ * @param status - Enrollment status string
+ * @param status - Kayıt durumu dizgisi
+ * @return Pointer to the counter
+ * @return Sayaca işaret eden pointer
+ */
+static int* section_counter(Section *section, const char *status) {
+    if (strcmp(status, "Enrolled") == 0) return &section->enrolled_count;
+    if (strcmp(status, "Completed") == 0) return &section->completed_count;
+    if (strcmp(status, "Dropped") == 0) return &section->dropped_count;
+    return &section->other_count;
+}
+
+/**
+ * Counts an enrollment in its section, creating the section on first use.
+ * Bir kaydı şubesinde sayar; şube ilk kez kullanılıyorsa oluşturur.
+ * * @param e - Enrollment that was added to the system
+ * @param e - Sisteme eklenen kayıt
+ */
+void section_add_enrollment(const Enrollment *e) {
+    char key[INDEX_KEY_LEN];
+    section_key(e, key);
+
+    Section *section = (Section *)index_find(&section_key_index, key);
+    if (section == NULL) {
+        section = (Section *)calloc(1, sizeof(Section));
+        if (section == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return;
+        }
+        section->professor_id = e->professor_id;
+        section->course_id = e->course_id;
+        strcpy(section->semester, e->semester);
+        section->next = section_list;
+        if (section_list != NULL) section_list->prev = section;
+        section_list = section;
+        index_insert(&section_key_index, key, section);
+
+        // Profesör zincirinin sonuna ekle (ilk görülme sırası korunur)
+        Section *first = (Section *)id_index_find(&professor_section_index, e->professor_id);
+        if (first == NULL) {
+            id_index_insert(&professor_section_index, e->professor_id, section);
+        } else {
+            while (first->next_by_professor != NULL) first = first->next_by_professor;
+            first->next_by_professor = section;
+            section->prev_by_professor = first;
+        }
+    }
+    (*section_counter(section, e->status))++;
+}
+
+/**
+ * Uncounts an enrollment and drops its section once no rows remain.
+ * Bir kaydı şubeden düşer; şubede satır kalmadığında şubeyi siler.
+ * * @param e - Enrollment about to be deleted
+ * @param e - Silinecek kayıt
+ */
+void section_remove_enrollment(const Enrollment *e) {
+    char key[INDEX_KEY_LEN];
+    section_key(e, key);
+
+    Section *section = (Section *)index_find(&section_key_index, key);
+    if (section == NULL) return;
+
+    int *counter = section_counter(section, e->status);
+    if (*counter > 0) (*counter)--;
+    if (section->enrolled_count + section->completed_count + section->dropped_count + section->other_count > 0) return;
+
+    index_remove(&section_key_index, key, section);
+
+    // Çift yönlü bağlar sayesinde şube, listeler yürünmeden çıkarılır
+    if (section->prev_by_professor == NULL) {
+        id_index_remove(&professor_section_index, section->professor_id, section);
+        if (section->next_by_professor != NULL) {
+            id_index_insert(&professor_section_index, section->professor_id, section->next_by_professor);
+        }
+    } else {
+        section->prev_by_professor->next_by_professor = section->next_by_professor;
+    }
+    if (section->next_by_professor != NULL) section->next_by_professor->prev_by_professor = section->prev_by_professor;
+
+    if (section->prev == NULL) section_list = section->next;
+    else section->prev->next = section->next;
+    if (section->next != NULL) section->next->prev = section->prev;
+    free(section);
+}
+
+/**
+ * Moves an enrollment between status counters after its status changed.
+ * Durumu değişen bir kaydı şube sayaçları arasında taşır.
+ * * @param e - Enrollment holding the new status
+ * @param e - Yeni durumu taşıyan kayıt
+ * @param old_status - Status before the change
+ * @param old_status - Değişiklikten önceki durum
+ */
+void section_update_status(const Enrollment *e, const char *old_status) {
+    char key[INDEX_KEY_LEN];
+    section_key(e, key);
+
+    Section *section = (Section *)index_find(&section_key_index, key);
+    if (section == NULL) return;
+
+    int *counter = section_counter(section, old_status);
+    if (*counter > 0) (*counter)--;
+    (*section_counter(section, e->status))++;
+}
+
+/**
+ * Returns the first section taught by a professor (follow next_by_professor).
+ * Bir profesörün verdiği ilk şubeyi döndürür (next_by_professor ile devam edilir).
+ * * @param professor_id - ID of the professor
+ * @param professor_id - Profesörün ID'si
+ * @return First section or NULL
+ * @return İlk şube veya NULL
+ */
+Section* get_professor_sections(int professor_id) {
+    return (Section *)id_index_find(&professor_section_index, professor_id);
+}
+
+/**
+ * Number of students who did not drop the section.
+ * Şubeyi bırakmamış öğrenci sayısı.
+ * * @param section - Section to count
+ * @param section - Sayılacak şube
+ * @return Enrolled + completed + other statuses
+ * @return Kayıtlı + tamamlamış + diğer durumlar
+ */
+int section_headcount(const Section *section) {
+    return section->enrolled_count + section->completed_count + section->other_count;
+}
+
+/**
+ * Frees every section and resets the indexes.
+ * Tüm şubeleri serbest bırakır ve indeksleri sıfırlar.
+ */
+void section_clear(void) {
+    while (section_list != NULL) {
+        Section *temp = section_list;
+        section_list = section_list->next;
+        free(temp);
+    }
+    index_clear(&section_key_index);
+    id_index_clear(&professor_section_index);
+}
@@ -0,0 +1,33 @@
+// section.h - Ders Şubesi (Profesör Ders Yükü) Modülü
+
+#ifndef SECTION_H
+#define SECTION_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "enrollment.h"
+
+// One (professor, course, semester) section with live headcounts
+// Canlı öğrenci sayılarıyla bir (profesör, ders, dönem) şubesi
+typedef struct Section {
+    int professor_id;
+    int course_id;
+    char semester[20];
+    int enrolled_count;    // Status "Enrolled"
+    int completed_count;   // Status "Completed"
+    int dropped_count;     // Status "Dropped"
+    int other_count;       // Any other status
+    struct Section *next_by_professor;
+    struct Section *prev_by_professor;   // Unlinking a section needs no walk
+    struct Section *next;
+    struct Section *prev;
+} Section;
+
+void section_add_enrollment(const Enrollment *e);
+void section_remove_enrollment(const Enrollment *e);
+void section_update_status(const Enrollment *e, const char *old_status);
+Section* get_professor_sections(int professor_id);
+int section_headcount(const Section *section);
+void section_clear(void);
+
+#endif
@@ -0,0 +1,910 @@
+// server.c - Çok İstemcili Sunucu Modülü (Unix Domain Socket)
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include "server.h"
+#include "utils.h"
+#include "integrity.h"
+#include "snapshot.h"
+#include "waitlist.h"
+#include "archive.h"
+#include "curriculum.h"
+
+// Cleared by SIGINT/SIGTERM or the SHUTDOWN command to leave the event loop.
+// Olay döngüsünden çıkmak için SIGINT/SIGTERM veya SHUTDOWN komutuyla sıfırlanır.
+static volatile sig_atomic_t server_running = 0;
+
+// Growable output buffer of one client
+// Bir istemcinin büyüyebilen çıktı tamponu
+typedef struct ServerBuffer {
+    char *data;
+    size_t len;
+    size_t cap;
+} ServerBuffer;
+
+// Connection state: partial request line and pending response bytes
+// Bağlantı durumu: yarım kalmış istek satırı ve gönderilmeyi bekleyen yanıt baytları
+typedef struct ClientConn {
+    int fd;
+    int slot;
+    char in[SERVER_LINE_MAX];
+    size_t in_len;
+    ServerBuffer out;
+    size_t out_sent;
+    int closing;
+    int report_pending;          // A report thread is answering; later requests wait their turn
+    unsigned long generation;    // Distinguishes reuses of the same slot
+} ClientConn;
+
+// Report computed on its own thread from a snapshot, handed back to the event loop when done
+// Bir görüntüden kendi iş parçacığında hesaplanan, bitince olay döngüsüne geri verilen rapor
+typedef enum ReportKind {
+    REPORT_TRANSCRIPT,
+    REPORT_ROSTER,
+    REPORT_GRADESTATS,
+    REPORT_AUDIT
+} ReportKind;
+
+typedef struct ReportJob {
+    ReportKind kind;
+    int id;
+    int slot;
+    unsigned long generation;
+    Snapshot *snap;
+    ServerBuffer result;
+    struct ReportJob *next;
+} ReportJob;
+
+// Result of one request for the event loop
+// Olay döngüsü için tek bir isteğin sonucu
+#define REQUEST_CONTINUE 0
+#define REQUEST_CLOSE 1
+#define REQUEST_SHUTDOWN 2
+#define REQUEST_DEFERRED 3
+
+// Open connections by slot, so they can be released on shutdown
+// Kapanışta serbest bırakılabilmeleri için yuvaya göre açık bağlantılar
+static ClientConn *clients[SERVER_MAX_CLIENTS];
+static int client_count = 0;
+static unsigned long next_generation = 1;
+
+// Finished reports and the pipe that wakes the event loop for them
+// Biten raporlar ve olay döngüsünü onlar için uyandıran boru
+static pthread_mutex_t report_lock = PTHREAD_MUTEX_INITIALIZER;
+static ReportJob *finished_reports = NULL;
+static int report_pipe[2] = {-1, -1};
+static int reports_outstanding = 0;
+
+/**
+ * Signal handler that asks the event loop to stop.
+ * Olay döngüsünün durmasını isteyen sinyal işleyicisi.
+ * * @param sig - Received signal
+ * @param sig - Alınan sinyal
+ */
+static void server_stop(int sig) {
+    (void)sig;
+    server_running = 0;
+}
+
+/**
+ * Appends formatted text to a buffer, growing it as needed.
+ * Bir tampona biçimlendirilmiş metin ekler, gerekirse tamponu büyütür.
+ * * @param b - Target buffer
+ * @param b - Hedef tampon
+ * @param fmt - printf-style format
+ * @param fmt - printf biçiminde format
+ */
+static void server_printf(ServerBuffer *b, const char *fmt, ...) {
+    va_list args;
+    char small[512];
+
+    va_start(args, fmt);
+    int n = vsnprintf(small, sizeof(small), fmt, args);
+    va_end(args);
+    if (n < 0) return;
+
+    if (b->len + (size_t)n + 1 > b->cap) {
+        size_t cap = b->cap ? b->cap : 1024;
+        while (b->len + (size_t)n + 1 > cap) cap *= 2;
+        char *data = (char *)realloc(b->data, cap);
+        if (data == NULL) return;
+        b->data = data;
+        b->cap = cap;
+    }
+    if ((size_t)n < sizeof(small)) {
+        memcpy(b->data + b->len, small, (size_t)n + 1);
+    } else {
+        va_start(args, fmt);
+        vsnprintf(b->data + b->len, (size_t)n + 1, fmt, args);
+        va_end(args);
+    }
+    b->len += (size_t)n;
+}
+
+/**
+ * Writes an "OK <lines>" header followed by the collected body lines.
+ * "OK <satır>" başlığını ve ardından toplanan gövde satırlarını yazar.
+ * * @param out - Client output buffer
+ * @param out - İstemci çıktı tamponu
+ * @param body - Body lines (may be empty)
+ * @param body - Gövde satırları (boş olabilir)
+ * @param lines - Number of body lines
+ * @param lines - Gövde satır sayısı
+ */
+static void reply_ok(ServerBuffer *out, ServerBuffer *body, int lines) {
+    server_printf(out, "OK %d\n", lines);
+    if (body->len > 0) server_printf(out, "%s", body->data);
+}
+
+/**
+ * Writes an "ERR <message>" response.
+ * "ERR <mesaj>" yanıtı yazar.
+ * * @param out - Client output buffer
+ * @param out - İstemci çıktı tamponu
+ * @param message - Error description
+ * @param message - Hata açıklaması
+ */
+static void reply_error(ServerBuffer *out, const char *message) {
+    server_printf(out, "ERR %s\n", message);
+}
+
+/**
+ * Parses "<int> <int> ..." arguments.
+ * "<int> <int> ..." argümanlarını ayrıştırır.
+ * * @param args - Argument text
+ * @param args - Argüman metni
+ * @param values - Output array
+ * @param values - Çıktı dizisi
+ * @param count - Number of integers expected
+ * @param count - Beklenen tam sayı adedi
+ * @param rest - Receives the text after the integers (may be NULL)
+ * @param rest - Tam sayılardan sonraki metni alır (NULL olabilir)
+ * @return 1 if all integers were read, 0 otherwise
+ * @return Tüm tam sayılar okunduysa 1, aksi halde 0 döner
+ */
+static int parse_ints(char *args, int *values, int count, char **rest) {
+    int i;
+    char *p = args;
+    for (i = 0; i < count; i++) {
+        char *end;
+        long v = strtol(p, &end, 10);
+        if (end == p) return 0;
+        values[i] = (int)v;
+        p = end;
+    }
+    while (*p == ' ') p++;
+    if (rest != NULL) *rest = p;
+    return 1;
+}
+
+/**
+ * Records or updates a grade for an enrolled student, as the Grade Management menu does.
+ * Not Yönetimi menüsünde olduğu gibi kayıtlı bir öğrenci için not girer veya günceller.
+ * * @param data - Shared dataset
+ * @param data - Ortak veri kümesi
+ * @param sid - Student ID
+ * @param sid - Öğrenci ID'si
+ * @param cid - Course ID
+ * @param cid - Kurs ID'si
+ * @param numeric - Numeric grade (0-100)
+ * @param numeric - Sayısal not (0-100)
+ * @param semester - Semester string
+ * @param semester - Dönem dizgisi
+ * @param out - Client output buffer
+ * @param out - İstemci çıktı tamponu
+ */
+static void serve_grade(ServerData *data, int sid, int cid, float numeric, const char *semester, ServerBuffer *out) {
+    Student *s = get_student_by_id(sid);
+    Enrollment *e;
+
+    if (s == NULL) { reply_error(out, "Student not found"); return; }
+    if (!isfinite(numeric) || numeric < 0.0 || numeric > 100.0) { reply_error(out, "Grade must be between 0 and 100"); return; }
+    for (e = s->first_enrollment; e != NULL; e = e->next_by_student) {
+        if (e->course_id == cid && strcmp(e->status, "Enrolled") == 0) break;
+    }
+    if (e == NULL) { reply_error(out, "Student is not enrolled in this course"); return; }
+
+    Grade *existing = find_student_course_grade(*data->g_head, sid, cid);
+    if (existing != NULL) {
+        update_grade(existing, numeric, NULL);
+    } else {
+        Grade g;
+        g.id = get_next_grade_id(*data->g_head);
+        g.enrollment_id = e->id;
+        g.student_id = sid;
+        g.course_id = cid;
+        g.numeric_grade = numeric;
+        numeric_to_letter(numeric, g.letter_grade);
+        snprintf(g.semester, sizeof(g.semester), "%s", semester);
+        g.next = NULL;
+        if (!add_grade(data->g_head, &g)) { reply_error(out, "Grade could not be added"); return; }
+    }
+    student_set_gpa(s, calculate_student_gpa(sid, *data->g_head, *data->c_head));
+
+    ServerBuffer body = {NULL, 0, 0};
+    server_printf(&body, "%.2f\n", s->gpa);
+    reply_ok(out, &body, 1);
+    free(body.data);
+}
+
+/**
+ * Formats a transcript, roster, grade statistics or graduation audit from a snapshot into the job's result buffer.
+ * Bir görüntüden transkript, sınıf listesi, not istatistiği veya mezuniyet denetimini işin sonuç tamponuna biçimlendirir.
+ * * @param job - Report job holding the snapshot
+ * @param job - Görüntüyü tutan rapor işi
+ */
+static void build_report(ReportJob *job) {
+    ServerBuffer body = {NULL, 0, 0};
+    const Snapshot *snap = job->snap;
+    int i, count, lines = 0;
+
+    if (job->kind == REPORT_TRANSCRIPT) {
+        const Grade *g;
+        if (snapshot_find_student(snap, job->id) == NULL) {
+            reply_error(&job->result, "Student not found");
+            return;
+        }
+        server_printf(&body, "GPA,%.2f\n", snapshot_student_gpa(snap, job->id));
+        lines = 1;
+        int a;
+        for (a = 0; a < archive_count(); a++) {
+            count = archive_student_grades(archive_get(a), job->id, &g);
+            for (i = 0; i < count; i++) {
+                const Course *c = snapshot_find_course(snap, g[i].course_id);
+                server_printf(&body, "%s,%s,%.2f,%s\n", c ? c->code : "?", g[i].semester, g[i].numeric_grade, g[i].letter_grade);
+                lines++;
+            }
+        }
+        count = snapshot_student_grades(snap, job->id, &g);
+        for (i = 0; i < count; i++) {
+            const Course *c = snapshot_find_course(snap, g[i].course_id);
+            server_printf(&body, "%s,%s,%.2f,%s\n", c ? c->code : "?", g[i].semester, g[i].numeric_grade, g[i].letter_grade);
+            lines++;
+        }
+    } else if (job->kind == REPORT_AUDIT) {
+        GraduationAudit audit;
+        if (!audit_graduation_snapshot(snap, job->id, &audit)) {
+            reply_error(&job->result, "Student not found");
+            return;
+        }
+        for (i = 0; i < REQUIRED_COURSE_COUNT; i++) {
+            if (audit.required_scores[i] >= 0) server_printf(&body, "%s,PASSED,%.2f\n", audit.required_codes[i], audit.required_scores[i]);
+            else server_printf(&body, "%s,MISSING,-\n", audit.required_codes[i]);
+        }
+        server_printf(&body, "CREDITS,%d,%d\n", audit.credits_earned, GRADUATION_CREDITS);
+        server_printf(&body, "STATUS,%s\n", audit.missing_count == 0 ? "ELIGIBLE" : "NOT_ELIGIBLE");
+        lines = REQUIRED_COURSE_COUNT + 2;
+    } else if (job->kind == REPORT_GRADESTATS) {
+        GradeSummary summary;
+        if (snapshot_find_course(snap, job->id) == NULL) {
+            reply_error(&job->result, "Course not found");
+            return;
+        }
+        snapshot_course_summary(snap, job->id, &summary);
+        server_printf(&body, "count,%ld\nmean,%.2f\nstddev,%.2f\nmin,%.2f\nq1,%.2f\nmedian,%.2f\nq3,%.2f\nmax,%.2f\n",
+                      summary.count, summary.mean, summary.stddev, summary.min, summary.q1,
+                      summary.median, summary.q3, summary.max);
+        lines = 8;
+    } else {
+        const Enrollment *e;
+        if (snapshot_find_course(snap, job->id) == NULL) {
+            reply_error(&job->result, "Course not found");
+            return;
+        }
+        count = snapshot_course_enrollments(snap, job->id, &e);
+        for (i = 0; i < count; i++) {
+            const Student *s = snapshot_find_student(snap, e[i].student_id);
+            server_printf(&body, "%d,%s,%s,%s,%s\n", e[i].student_id, s ? s->first_name : "?",
+                          s ? s->last_name : "?", e[i].semester, e[i].status);
+            lines++;
+        }
+    }
+    reply_ok(&job->result, &body, lines);
+    free(body.data);
+}
+
+/**
+ * Report thread: builds the report without touching the live lists, then queues it and wakes the event loop.
+ * Rapor iş parçacığı: raporu canlı listelere dokunmadan oluşturur, sıraya koyar ve olay döngüsünü uyandırır.
+ * * @param arg - ReportJob to run
+ * @param arg - Çalıştırılacak ReportJob
+ * @return Always NULL
+ * @return Her zaman NULL
+ */
+static void* report_worker(void *arg) {
+    ReportJob *job = (ReportJob *)arg;
+    char wake = 'r';
+
+    build_report(job);
+    pthread_mutex_lock(&report_lock);
+    job->next = finished_reports;
+    finished_reports = job;
+    pthread_mutex_unlock(&report_lock);
+    if (write(report_pipe[1], &wake, 1) < 0) {
+        // Pipe full: a wake-up is already pending / Boru dolu: bekleyen bir uyandırma zaten var
+    }
+    return NULL;
+}
+
+/**
+ * Starts a report on a consistent snapshot so writers keep being served while it runs.
+ * Falls back to building it inline if no thread can be started.
+ * Bir raporu tutarlı bir görüntü üzerinde başlatır; rapor çalışırken yazıcılara hizmet sürer.
+ * İş parçacığı başlatılamazsa raporu satır içinde oluşturur.
+ * * @param client - Requesting connection
+ * @param client - İsteği gönderen bağlantı
+ * @param kind - Report type
+ * @param kind - Rapor türü
+ * @param id - Student (transcript, audit) or course (roster, statistics) ID
+ * @param id - Öğrenci (transkript, denetim) veya kurs (sınıf listesi, istatistik) ID'si
+ * @return 1 if the answer will arrive later, 0 if it was already written
+ * @return Yanıt daha sonra gelecekse 1, zaten yazıldıysa 0 döner
+ */
+static int start_report(ClientConn *client, ReportKind kind, int id) {
+    pthread_t thread;
+    pthread_attr_t attr;
+    ReportJob *job = (ReportJob *)calloc(1, sizeof(ReportJob));
+
+    if (job == NULL) {
+        reply_error(&client->out, "Out of memory");
+        return 0;
+    }
+    job->snap = snapshot_acquire((kind == REPORT_TRANSCRIPT || kind == REPORT_AUDIT) ? SNAPSHOT_STUDENT : SNAPSHOT_COURSE, id);
+    if (job->snap == NULL) {
+        free(job);
+        reply_error(&client->out, "Out of memory");
+        return 0;
+    }
+    job->kind = kind;
+    job->id = id;
+    job->slot = client->slot;
+    job->generation = client->generation;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int started = (pthread_create(&thread, &attr, report_worker, job) == 0);
+    pthread_attr_destroy(&attr);
+    if (!started) {
+        build_report(job);
+        server_printf(&client->out, "%s", job->result.data);
+        snapshot_release(job->snap);
+        free(job->result.data);
+        free(job);
+        return 0;
+    }
+    reports_outstanding++;
+    client->report_pending = 1;
+    return 1;
+}
+
+/**
+ * Executes one request line and appends the response to the client's buffer.
+ * Protocol: "<COMMAND> [args]" per line; reply is "OK <n>" plus n lines, or "ERR <message>".
+ * Tek bir istek satırını çalıştırır ve yanıtı istemcinin tamponuna ekler.
+ * Protokol: satır başına "<KOMUT> [argümanlar]"; yanıt "OK <n>" ve n satır ya da "ERR <mesaj>".
+ * * @param data - Shared dataset
+ * @param data - Ortak veri kümesi
+ * @param client - Requesting connection
+ * @param client - İsteği gönderen bağlantı
+ * @param line - Request line without the newline
+ * @param line - Yeni satır karakteri olmadan istek satırı
+ * @return REQUEST_CONTINUE, REQUEST_CLOSE, REQUEST_SHUTDOWN or REQUEST_DEFERRED
+ * @return REQUEST_CONTINUE, REQUEST_CLOSE, REQUEST_SHUTDOWN veya REQUEST_DEFERRED
+ */
+static int handle_request(ServerData *data, ClientConn *client, char *line) {
+    ServerBuffer *out = &client->out;
+    ServerBuffer body = {NULL, 0, 0};
+    int result = REQUEST_CONTINUE;
+    int v[3];
+    char *args, *rest;
+    char *cmd = line;
+
+    trim_whitespace(line);
+    if (*line == '\0') return REQUEST_CONTINUE;
+    args = strchr(line, ' ');
+    if (args != NULL) {
+        *args++ = '\0';
+        while (*args == ' ') args++;
+    } else {
+        args = line + strlen(line);
+    }
+    for (rest = cmd; *rest; rest++) *rest = (char)toupper((unsigned char)*rest);
+
+    if (strcmp(cmd, "PING") == 0) {
+        reply_ok(out, &body, 0);
+    } else if (strcmp(cmd, "HELP") == 0) {
+        const char *usage[] = {
+            "PING", "STATS", "STUDENT <id>", "ADD_STUDENT <id>,<first>,<last>,<email>,<phone>,<year>,<major>",
+            "DEL_STUDENT <id>", "COURSE <id>", "PROFESSOR <id>", "ENROLL <student> <course> <professor> <semester>",
+            "DROP <student> <course>", "WAITLIST <student> <course>", "GRADE <student> <course> <0-100> <semester>",
+            "TRANSCRIPT <student>", "ROSTER <course>", "GRADESTATS <course>", "AUDIT <student>",
+            "SEARCH <prefix>", "SAVE", "QUIT", "SHUTDOWN"
+        };
+        int i, n = (int)(sizeof(usage) / sizeof(usage[0]));
+        for (i = 0; i < n; i++) server_printf(&body, "%s\n", usage[i]);
+        reply_ok(out, &body, n);
+    } else if (strcmp(cmd, "STATS") == 0) {
+        int student_count = 0;
+        Student *s;
+        for (s = *data->s_head; s != NULL; s = s->next) student_count++;
+        server_printf(&body, "students,%d\ncourses,%d\nprofessors,%d\nenrollments,%d\ngrades,%d\n",
+                      student_count, count_courses(*data->c_head), count_professors(*data->p_head),
+                      count_enrollments(*data->e_head), count_grades(*data->g_head));
+        reply_ok(out, &body, 5);
+    } else if (strcmp(cmd, "STUDENT") == 0 && parse_ints(args, v, 1, NULL)) {
+        Student *s = find_student_by_id(*data->s_head, v[0]);
+        if (s == NULL) {
+            reply_error(out, "Student not found");
+        } else {
+            server_printf(&body, "%d,%s,%s,%s,%s,%d,%s,%.2f\n", s->id, s->first_name, s->last_name,
+                          s->email, s->phone, s->enrollment_year, s->major, s->gpa);
+            reply_ok(out, &body, 1);
+        }
+    } else if (strcmp(cmd, "ADD_STUDENT") == 0) {
+        char *tokens[7];
+        Student s;
+        if (split_csv_line(args, tokens, 7) < 7) {
+            reply_error(out, "Usage: ADD_STUDENT <id>,<first>,<last>,<email>,<phone>,<year>,<major>");
+        } else if (!validate_email(tokens[3])) {
+            reply_error(out, "Invalid email");
+        } else {
+            memset(&s, 0, sizeof(Student));
+            s.id = atoi(tokens[0]);
+            snprintf(s.first_name, sizeof(s.first_name), "%s", tokens[1]);
+            snprintf(s.last_name, sizeof(s.last_name), "%s", tokens[2]);
+            snprintf(s.email, sizeof(s.email), "%s", tokens[3]);
+            snprintf(s.phone, sizeof(s.phone), "%s", tokens[4]);
+            s.enrollment_year = atoi(tokens[5]);
+            snprintf(s.major, sizeof(s.major), "%s", tokens[6]);
+            if (!validate_positive_int(s.id)) reply_error(out, "Student ID must be positive");
+            else if (add_student(data->s_head, &s)) reply_ok(out, &body, 0);
+            else reply_error(out, "Student ID already exists");
+        }
+    } else if (strcmp(cmd, "DEL_STUDENT") == 0 && parse_ints(args, v, 1, NULL)) {
+        if (delete_student_with_policy(data->s_head, data->e_head, data->g_head, v[0])) reply_ok(out, &body, 0);
+        else reply_error(out, "Student not found or still referenced");
+    } else if (strcmp(cmd, "COURSE") == 0 && parse_ints(args, v, 1, NULL)) {
+        Course *c = find_course_by_id(*data->c_head, v[0]);
+        if (c == NULL) {
+            reply_error(out, "Course not found");
+        } else {
+            server_printf(&body, "%d,%s,%s,%d,%d,%d\n", c->id, c->code, c->name, c->credits, c->capacity,
+                          get_enrollment_count(*data->e_head, c->id));
+            reply_ok(out, &body, 1);
+        }
+    } else if (strcmp(cmd, "PROFESSOR") == 0 && parse_ints(args, v, 1, NULL)) {
+        Professor *p = find_professor_by_id(*data->p_head, v[0]);
+        if (p == NULL) {
+            reply_error(out, "Professor not found");
+        } else {
+            server_printf(&body, "%d,%s,%s,%s,%s,%s,%s\n", p->id, p->first_name, p->last_name,
+                          p->email, p->department, p->title, p->office);
+            reply_ok(out, &body, 1);
+        }
+    } else if (strcmp(cmd, "ENROLL") == 0 && parse_ints(args, v, 3, &rest) && *rest != '\0') {
+        int enrollment_id = 0, waiting;
+        EnrollResult r = enroll_student(data->e_head, *data->g_head, v[0], v[1], v[2], rest, &enrollment_id);
+        if (r == ENROLL_OK) {
+            server_printf(&body, "%d\n", enrollment_id);
+            reply_ok(out, &body, 1);
+        } else if (r == ENROLL_COURSE_FULL && (waiting = waitlist_add(v[0], v[1], v[2], rest)) > 0) {
+            // Place in line and length, as WAITLIST reports them; the place is an O(log n) rank lookup
+            // WAITLIST'in bildirdiği gibi sıradaki yer ve uzunluk; yer O(log n) bir sıra sorgusudur
+            server_printf(&body, "WAITLISTED,%d,%d\n", waitlist_position(v[0], v[1]), waiting);
+            reply_ok(out, &body, 1);
+        } else {
+            reply_error(out, enroll_result_message(r));
+        }
+    } else if (strcmp(cmd, "WAITLIST") == 0 && parse_ints(args, v, 2, NULL)) {
+        int position = waitlist_position(v[0], v[1]);
+        if (position > 0) {
+            server_printf(&body, "%d,%d\n", position, waitlist_size(v[1]));
+            reply_ok(out, &body, 1);
+        } else {
+            reply_error(out, "Student is not on the waitlist");
+        }
+    } else if (strcmp(cmd, "DROP") == 0 && parse_ints(args, v, 2, NULL)) {
+        if (drop_enrollment(data->e_head, v[0], v[1])) reply_ok(out, &body, 0);
+        else reply_error(out, "Active enrollment not found");
+    } else if (strcmp(cmd, "GRADE") == 0 && parse_ints(args, v, 2, &rest)) {
+        char *end;
+        float numeric = strtof(rest, &end);
+        // Puan belirtecinin tamamı sayı olmalı; "85abc" gibi artıklar reddedilir
+        int whole = (end != rest && *end == ' ');
+        while (*end == ' ') end++;
+        if (!whole || *end == '\0') reply_error(out, "Usage: GRADE <student> <course> <0-100> <semester>");
+        else serve_grade(data, v[0], v[1], numeric, end, out);
+    } else if ((strcmp(cmd, "TRANSCRIPT") == 0 || strcmp(cmd, "ROSTER") == 0 || strcmp(cmd, "GRADESTATS") == 0 ||
+                strcmp(cmd, "AUDIT") == 0) && parse_ints(args, v, 1, NULL)) {
+        ReportKind kind = (cmd[0] == 'T') ? REPORT_TRANSCRIPT : (cmd[0] == 'R') ? REPORT_ROSTER :
+                          (cmd[0] == 'G') ? REPORT_GRADESTATS : REPORT_AUDIT;
+        if (start_report(client, kind, v[0])) {
+            result = REQUEST_DEFERRED;
+        }
+    } else if (strcmp(cmd, "SEARCH") == 0 && *args != '\0') {
+        Student *students[50];
+        Professor *professors[50];
+        int i;
+        int s_count = search_students_by_prefix(*data->s_head, args, students, 50);
+        int p_count = search_professors_by_prefix(*data->p_head, args, professors, 50);
+        for (i = 0; i < s_count; i++) {
+            server_printf(&body, "S,%d,%s %s,%s\n", students[i]->id, students[i]->first_name,
+                          students[i]->last_name, students[i]->email);
+        }
+        for (i = 0; i < p_count; i++) {
+            server_printf(&body, "P,%d,%s %s,%s\n", professors[i]->id, professors[i]->first_name,
+                          professors[i]->last_name, professors[i]->email);
+        }
+        reply_ok(out, &body, s_count + p_count);
+    } else if (strcmp(cmd, "SAVE") == 0) {
+        save_students_to_csv(*data->s_head, "data/students.csv");
+        save_courses_to_csv(*data->c_head, "data/courses.csv");
+        save_professors_to_csv(*data->p_head, "data/professors.csv");
+        save_enrollments_to_csv(*data->e_head, "data/enrollments.csv");
+        save_grades_to_csv(*data->g_head, "data/grades.csv");
+        reply_ok(out, &body, 0);
+    } else if (strcmp(cmd, "QUIT") == 0) {
+        reply_ok(out, &body, 0);
+        result = REQUEST_CLOSE;
+    } else if (strcmp(cmd, "SHUTDOWN") == 0) {
+        reply_ok(out, &body, 0);
+        result = REQUEST_SHUTDOWN;
+    } else {
+        reply_error(out, "Unknown command or bad arguments (try HELP)");
+    }
+
+    free(body.data);
+    return result;
+}
+
+/**
+ * Switches a descriptor to non-blocking mode.
+ * Bir tanımlayıcıyı engellemesiz moda geçirir.
+ * * @param fd - File descriptor
+ * @param fd - Dosya tanımlayıcısı
+ * @return 1 if successful, 0 otherwise
+ * @return Başarılıysa 1, aksi halde 0 döner
+ */
+static int set_nonblocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+/**
+ * Closes a client connection and frees its buffers.
+ * Bir istemci bağlantısını kapatır ve tamponlarını serbest bırakır.
+ * * @param epfd - epoll instance
+ * @param epfd - epoll örneği
+ * @param client - Connection to close
+ * @param client - Kapatılacak bağlantı
+ */
+static void close_client(int epfd, ClientConn *client) {
+    epoll_ctl(epfd, EPOLL_CTL_DEL, client->fd, NULL);
+    close(client->fd);
+    clients[client->slot] = NULL;
+    client_count--;
+    free(client->out.data);
+    free(client);
+}
+
+/**
+ * Sends as much pending output as the socket accepts and updates the epoll interest set.
+ * Soketin kabul ettiği kadar bekleyen çıktıyı gönderir ve epoll ilgi kümesini günceller.
+ * * @param epfd - epoll instance
+ * @param epfd - epoll örneği
+ * @param client - Connection to flush
+ * @param client - Boşaltılacak bağlantı
+ * @return 1 if the connection is still usable, 0 if it failed
+ * @return Bağlantı hâlâ kullanılabilirse 1, hata oluştuysa 0 döner
+ */
+static int flush_client(int epfd, ClientConn *client) {
+    while (client->out_sent < client->out.len) {
+        ssize_t n = send(client->fd, client->out.data + client->out_sent,
+                         client->out.len - client->out_sent, MSG_NOSIGNAL);
+        if (n > 0) {
+            client->out_sent += (size_t)n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            return 0;
+        }
+    }
+    if (client->out_sent == client->out.len) {
+        client->out.len = 0;
+        client->out_sent = 0;
+    }
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = (client->report_pending ? 0 : EPOLLIN) | (client->out.len > 0 ? EPOLLOUT : 0);
+    ev.data.ptr = client;
+    epoll_ctl(epfd, EPOLL_CTL_MOD, client->fd, &ev);
+    return 1;
+}
+
+/**
+ * Executes the complete request lines buffered for a client, stopping while a report is pending.
+ * Bir istemci için tamponlanmış tam istek satırlarını çalıştırır; bekleyen rapor varken durur.
+ * * @param data - Shared dataset
+ * @param data - Ortak veri kümesi
+ * @param client - Connection with buffered input
+ * @param client - Tamponlanmış girdisi olan bağlantı
+ */
+static void process_lines(ServerData *data, ClientConn *client) {
+    char *start = client->in;
+    char *nl;
+
+    while (!client->report_pending && !client->closing && server_running &&
+           (nl = strchr(start, '\n')) != NULL) {
+        *nl = '\0';
+        int r = handle_request(data, client, start);
+        start = nl + 1;
+        if (r == REQUEST_CLOSE) client->closing = 1;
+        if (r == REQUEST_SHUTDOWN) server_running = 0;
+    }
+    client->in_len -= (size_t)(start - client->in);
+    memmove(client->in, start, client->in_len);
+    client->in[client->in_len] = '\0';
+}
+
+/**
+ * Reads available bytes and executes every complete request line.
+ * Mevcut baytları okur ve tamamlanmış her istek satırını çalıştırır.
+ * * @param data - Shared dataset
+ * @param data - Ortak veri kümesi
+ * @param client - Connection with readable data
+ * @param client - Okunabilir verisi olan bağlantı
+ * @return 1 to keep the connection, 0 to close it
+ * @return Bağlantıyı korumak için 1, kapatmak için 0
+ */
+static int read_client(ServerData *data, ClientConn *client) {
+    while (!client->report_pending) {
+        ssize_t n = recv(client->fd, client->in + client->in_len, sizeof(client->in) - 1 - client->in_len, 0);
+        if (n == 0) {
+            // Peer finished sending: answer what was read, then close
+            // Karşı taraf göndermeyi bitirdi: okunanları yanıtla, sonra kapat
+            client->closing = 1;
+            return 1;
+        }
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return (errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+        client->in_len += (size_t)n;
+        client->in[client->in_len] = '\0';
+
+        process_lines(data, client);
+        if (client->closing || !server_running) return 1;
+        if (!client->report_pending && client->in_len == sizeof(client->in) - 1) {
+            reply_error(&client->out, "Request line too long");
+            client->closing = 1;
+            return 1;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Hands finished reports to their connections (if still open) and resumes their queued requests.
+ * Must not run inside an epoll batch, since it may close (and free) connections.
+ * Biten raporları (hâlâ açıksa) bağlantılarına teslim eder ve sıradaki isteklerini sürdürür.
+ * Bağlantıları kapatıp serbest bırakabileceği için bir epoll grubunun içinde çalışmamalıdır.
+ * * @param data - Shared dataset
+ * @param data - Ortak veri kümesi
+ * @param epfd - epoll instance
+ * @param epfd - epoll örneği
+ */
+static void collect_reports(ServerData *data, int epfd) {
+    char drain[64];
+    ReportJob *job;
+
+    while (read(report_pipe[0], drain, sizeof(drain)) > 0);
+    pthread_mutex_lock(&report_lock);
+    job = finished_reports;
+    finished_reports = NULL;
+    pthread_mutex_unlock(&report_lock);
+
+    while (job != NULL) {
+        ReportJob *next = job->next;
+        ClientConn *client = clients[job->slot];
+        if (client != NULL && client->generation == job->generation) {
+            server_printf(&client->out, "%s", job->result.data);
+            client->report_pending = 0;
+            process_lines(data, client);
+            if (!flush_client(epfd, client) || (client->closing && client->out.len == 0)) {
+                close_client(epfd, client);
+            }
+        }
+        snapshot_release(job->snap);
+        free(job->result.data);
+        free(job);
+        reports_outstanding--;
+        job = next;
+    }
+}
+
+/**
+ * Accepts every pending connection on the listening socket.
+ * Dinleyen soketteki bekleyen tüm bağlantıları kabul eder.
+ * * @param epfd - epoll instance
+ * @param epfd - epoll örneği
+ * @param listen_fd - Listening socket
+ * @param listen_fd - Dinleyen soket
+ */
+static void accept_clients(int epfd, int listen_fd) {
+    int slot = 0;
+    while (1) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        while (slot < SERVER_MAX_CLIENTS && clients[slot] != NULL) slot++;
+        if (slot == SERVER_MAX_CLIENTS || !set_nonblocking(fd)) {
+            const char *busy = "ERR Server busy\n";
+            send(fd, busy, strlen(busy), MSG_NOSIGNAL);
+            close(fd);
+            continue;
+        }
+
+        ClientConn *client = (ClientConn *)calloc(1, sizeof(ClientConn));
+        if (client == NULL) {
+            close(fd);
+            continue;
+        }
+        client->fd = fd;
+        client->slot = slot;
+        client->generation = next_generation++;
+
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.ptr = client;
+        if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            close(fd);
+            free(client);
+            continue;
+        }
+        clients[slot] = client;
+        client_count++;
+    }
+}
+
+/**
+ * Serves the loaded dataset to many clients over a Unix domain socket until SIGINT/SIGTERM
+ * or a SHUTDOWN request. Writes run on the event loop thread; transcripts and rosters run
+ * on report threads over snapshots, so neither side waits for the other.
+ * Yüklenmiş veri kümesini SIGINT/SIGTERM veya SHUTDOWN isteği gelene kadar Unix domain
+ * soketi üzerinden çok sayıda istemciye sunar. Yazmalar olay döngüsü iş parçacığında çalışır;
+ * transkript ve sınıf listeleri görüntüler üzerinde rapor iş parçacıklarında çalışır, taraflar birbirini beklemez.
+ * * @param socket_path - Filesystem path of the socket
+ * @param socket_path - Soketin dosya sistemi yolu
+ * @param data - Shared dataset
+ * @param data - Ortak veri kümesi
+ * @return 1 on clean shutdown, 0 if the socket could not be set up
+ * @return Temiz kapanışta 1, soket kurulamazsa 0 döner
+ */
+int run_server(const char *socket_path, ServerData *data) {
+    struct sockaddr_un addr;
+    struct epoll_event events[SERVER_MAX_EVENTS];
+    struct sigaction sa;
+    int i;
+
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        printf("Error: Socket path too long!\n");
+        return 0;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = server_stop;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        printf("Error: Could not create socket!\n");
+        return 0;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socket_path);
+    unlink(socket_path);
+
+    if (bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+        listen(listen_fd, SERVER_BACKLOG) < 0 || !set_nonblocking(listen_fd)) {
+        printf("Error: Could not listen on %s!\n", socket_path);
+        close(listen_fd);
+        return 0;
+    }
+
+    int epfd = epoll_create1(0);
+    if (epfd < 0 || pipe(report_pipe) < 0 || !set_nonblocking(report_pipe[0]) || !set_nonblocking(report_pipe[1])) {
+        printf("Error: Could not create epoll instance!\n");
+        if (epfd >= 0) close(epfd);
+        close(listen_fd);
+        unlink(socket_path);
+        return 0;
+    }
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, listen_fd, &ev);
+    ev.data.ptr = report_pipe;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, report_pipe[0], &ev);
+
+    printf("Server listening on %s (send HELP for commands).\n", socket_path);
+    fflush(stdout);
+    server_running = 1;
+
+    while (server_running) {
+        int reports_ready = 0;
+        int n = epoll_wait(epfd, events, SERVER_MAX_EVENTS, -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        for (i = 0; i < n; i++) {
+            ClientConn *client = (ClientConn *)events[i].data.ptr;
+            if (client == NULL) {
+                accept_clients(epfd, listen_fd);
+                continue;
+            }
+            if (events[i].data.ptr == (void *)report_pipe) {
+                reports_ready = 1;
+                continue;
+            }
+
+            int alive = 1;
+            if (events[i].events & EPOLLIN) alive = read_client(data, client);
+            else if (events[i].events & (EPOLLHUP | EPOLLERR)) alive = 0;
+            if (alive) alive = flush_client(epfd, client);
+            if (!alive || (client->closing && client->out.len == 0)) {
+                close_client(epfd, client);
+            }
+        }
+        // Reports are handed over after the batch: delivering one may close its connection,
+        // and a later event of this batch could still point at it
+        // Raporlar grup bittikten sonra teslim edilir: teslim bağlantıyı kapatabilir ve grubun
+        // sonraki bir olayı hâlâ ona işaret ediyor olabilir
+        if (reports_ready) collect_reports(data, epfd);
+    }
+
+    // Let running reports finish, send what is already queued, then close the remaining connections
+    // Çalışan raporların bitmesini bekle, kuyruktaki yanıtları gönder, ardından kalan bağlantıları kapat
+    while (reports_outstanding > 0) {
+        epoll_wait(epfd, events, SERVER_MAX_EVENTS, 100);
+        collect_reports(data, epfd);
+    }
+    printf("Server shutting down (%d open connection%s).\n", client_count, client_count == 1 ? "" : "s");
+    for (i = 0; i < SERVER_MAX_CLIENTS; i++) {
+        if (clients[i] != NULL) {
+            flush_client(epfd, clients[i]);
+            close_client(epfd, clients[i]);
+        }
+    }
+    close(report_pipe[0]);
+    close(report_pipe[1]);
+    close(epfd);
+    close(listen_fd);
+    unlink(socket_path);
+    snapshot_clear();
+    return 1;
+}
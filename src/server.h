@@ -0,0 +1,32 @@
+// server.h - Çok İstemcili Sunucu Modülü (Unix Domain Socket)
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "student.h"
+#include "course.h"
+#include "professor.h"
+#include "enrollment.h"
+#include "grade.h"
+
+#define SERVER_DEFAULT_SOCKET "/tmp/student_system.sock"
+#define SERVER_MAX_EVENTS 64
+#define SERVER_MAX_CLIENTS 256
+#define SERVER_LINE_MAX 1024
+#define SERVER_BACKLOG 64
+
+// The shared in-memory dataset served to every client
+// Tüm istemcilere sunulan ortak bellek içi veri kümesi
+typedef struct ServerData {
+    Student **s_head;
+    Course **c_head;
+    Professor **p_head;
+    Enrollment **e_head;
+    Grade **g_head;
+} ServerData;
+
+int run_server(const char *socket_path, ServerData *data);
+
+#endif
@@ -0,0 +1,455 @@
+// snapshot.c - Rapor Anlık Görüntüleri Modülü (Epoch Tabanlı)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "snapshot.h"
+#include "archive.h"
+#include "gradestats.h"
+
+// Write epoch: bumped by every change to students, courses, enrollments or grades.
+// Yazma epoch'u: öğrenci, kurs, kayıt veya notlardaki her değişiklikte artırılır.
+static unsigned long data_epoch = 1;
+
+// Latest snapshot, reused by readers until the epoch moves on. Holds one reference itself.
+// Epoch değişene kadar okuyucuların yeniden kullandığı son görüntü. Kendisi bir referans tutar.
+static Snapshot *current_snapshot = NULL;
+
+/**
+ * Marks the data as changed. Writers call this after every mutation; it never blocks.
+ * Veriyi değişmiş olarak işaretler. Yazıcılar her değişiklikten sonra çağırır; asla beklemez.
+ */
+void snapshot_touch(void) {
+    __sync_fetch_and_add(&data_epoch, 1);
+}
+
+/**
+ * Returns the current write epoch.
+ * Geçerli yazma epoch'unu döndürür.
+ * @return Epoch counter
+ * @return Epoch sayacı
+ */
+unsigned long snapshot_epoch(void) {
+    return __sync_fetch_and_add(&data_epoch, 0);
+}
+
+// qsort/bsearch orderings of the snapshot arrays
+// Görüntü dizilerinin qsort/bsearch sıralamaları
+static int compare_student_id(const void *a, const void *b) {
+    const Student *x = (const Student *)a, *y = (const Student *)b;
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+static int compare_course_id(const void *a, const void *b) {
+    const Course *x = (const Course *)a, *y = (const Course *)b;
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+static int compare_enrollment_course(const void *a, const void *b) {
+    const Enrollment *x = (const Enrollment *)a, *y = (const Enrollment *)b;
+    if (x->course_id != y->course_id) return (x->course_id > y->course_id) - (x->course_id < y->course_id);
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+static int compare_grade_student(const void *a, const void *b) {
+    const Grade *x = (const Grade *)a, *y = (const Grade *)b;
+    int cmp;
+    if (x->student_id != y->student_id) return (x->student_id > y->student_id) - (x->student_id < y->student_id);
+    cmp = strcmp(x->semester, y->semester);
+    if (cmp != 0) return cmp;
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+/**
+ * Frees a snapshot and all of its row copies.
+ * Bir görüntüyü ve tüm satır kopyalarını serbest bırakır.
+ * * @param snap - Snapshot without remaining references
+ * @param snap - Referansı kalmamış görüntü
+ */
+static void snapshot_free(Snapshot *snap) {
+    free(snap->students);
+    free(snap->courses);
+    free(snap->enrollments);
+    free(snap->grades);
+    free(snap);
+}
+
+/**
+ * Appends a copy of a student with its chain pointers cleared.
+ * Zincir pointer'ları temizlenmiş bir öğrenci kopyasını ekler.
+ */
+static void snapshot_add_student(Snapshot *snap, const Student *s) {
+    Student *copy = &snap->students[snap->student_count++];
+    *copy = *s;
+    copy->first_grade = copy->last_grade = NULL;
+    copy->first_enrollment = copy->last_enrollment = NULL;
+    copy->terms = NULL;
+    copy->term_count = copy->term_capacity = 0;
+    copy->archived_terms = NULL;
+    copy->archived_term_count = copy->archived_version = 0;
+    copy->next = NULL;
+}
+
+/**
+ * Appends a copy of a course with its chain pointers cleared.
+ * Zincir pointer'ları temizlenmiş bir kurs kopyasını ekler.
+ */
+static void snapshot_add_course(Snapshot *snap, const Course *c) {
+    Course *copy = &snap->courses[snap->course_count++];
+    *copy = *c;
+    copy->first_grade = copy->last_grade = NULL;
+    copy->first_enrollment = copy->last_enrollment = NULL;
+    copy->next = NULL;
+}
+
+/**
+ * Sorts the copied students and courses by ID and drops the repeats.
+ * Kopyalanan öğrenci ve kursları ID'ye göre sıralar ve tekrarları atar.
+ */
+static void snapshot_sort_entities(Snapshot *snap) {
+    int i, n;
+    qsort(snap->students, snap->student_count, sizeof(Student), compare_student_id);
+    for (i = 0, n = 0; i < snap->student_count; i++) {
+        if (n == 0 || snap->students[n - 1].id != snap->students[i].id) snap->students[n++] = snap->students[i];
+    }
+    snap->student_count = n;
+    qsort(snap->courses, snap->course_count, sizeof(Course), compare_course_id);
+    for (i = 0, n = 0; i < snap->course_count; i++) {
+        if (n == 0 || snap->courses[n - 1].id != snap->courses[i].id) snap->courses[n++] = snap->courses[i];
+    }
+    snap->course_count = n;
+}
+
+/**
+ * Copies one student's transcript rows: the student, its grade chain and the courses of its
+ * hot and archived grades. Costs O(k log k) in the student's grades, not in the dataset.
+ * Bir öğrencinin transkript satırlarını kopyalar: öğrenci, not zinciri ve sıcak ile arşivlenmiş
+ * notlarının kursları. Maliyet veri kümesine değil öğrencinin not sayısına bağlıdır (O(k log k)).
+ * * @param snap - Empty snapshot to fill
+ * @param snap - Doldurulacak boş görüntü
+ * @param student_id - Student ID
+ * @param student_id - Öğrenci ID'si
+ * @return 1 on success, 0 if memory ran out
+ * @return Başarılıysa 1, bellek yetmezse 0
+ */
+static int snapshot_fill_student(Snapshot *snap, int student_id) {
+    Student *s = get_student_by_id(student_id);
+    const Grade *archived;
+    Grade *g;
+    int a, i, count, grade_rows = 0, course_rows = 0;
+
+    if (s == NULL) return 1;
+    for (g = s->first_grade; g != NULL; g = g->next_by_student) grade_rows++;
+    course_rows = grade_rows;
+    for (a = 0; a < archive_count(); a++) course_rows += archive_student_grades(archive_get(a), student_id, &archived);
+
+    snap->students = (Student *)malloc(sizeof(Student));
+    snap->grades = (Grade *)malloc((grade_rows + 1) * sizeof(Grade));
+    snap->courses = (Course *)malloc((course_rows + 1) * sizeof(Course));
+    if (!snap->students || !snap->grades || !snap->courses) return 0;
+
+    snapshot_add_student(snap, s);
+    for (g = s->first_grade; g != NULL; g = g->next_by_student) {
+        Grade *copy = &snap->grades[snap->grade_count++];
+        Course *c = get_course_by_id(g->course_id);
+        *copy = *g;
+        copy->next_by_student = NULL;
+        copy->next_by_course = NULL;
+        copy->prev = NULL;
+        copy->next = NULL;
+        if (c != NULL) snapshot_add_course(snap, c);
+    }
+    for (a = 0; a < archive_count(); a++) {
+        count = archive_student_grades(archive_get(a), student_id, &archived);
+        for (i = 0; i < count; i++) {
+            Course *c = get_course_by_id(archived[i].course_id);
+            if (c != NULL) snapshot_add_course(snap, c);
+        }
+    }
+    qsort(snap->grades, snap->grade_count, sizeof(Grade), compare_grade_student);
+    snapshot_sort_entities(snap);
+    return 1;
+}
+
+/**
+ * Copies one course's roster and statistics rows: the course, its enrollment and grade chains, its
+ * archived enrollments and the enrolled students. Costs O(k log k) in the course's rows, not in the dataset.
+ * Bir kursun sınıf listesi ve istatistik satırlarını kopyalar: kurs, kayıt ve not zincirleri, arşivlenmiş
+ * kayıtları ve kayıtlı öğrenciler. Maliyet veri kümesine değil kursun satır sayısına bağlıdır (O(k log k)).
+ * * @param snap - Empty snapshot to fill
+ * @param snap - Doldurulacak boş görüntü
+ * @param course_id - Course ID
+ * @param course_id - Kurs ID'si
+ * @return 1 on success, 0 if memory ran out
+ * @return Başarılıysa 1, bellek yetmezse 0
+ */
+static int snapshot_fill_course(Snapshot *snap, int course_id) {
+    Course *c = get_course_by_id(course_id);
+    const Enrollment **archived;
+    Enrollment *e;
+    Grade *g;
+    int a, i, count, rows = 0, grade_rows = 0;
+
+    if (c == NULL) return 1;
+    for (e = c->first_enrollment; e != NULL; e = e->next_by_course) rows++;
+    for (g = c->first_grade; g != NULL; g = g->next_by_course) grade_rows++;
+    for (a = 0; a < archive_count(); a++) rows += archive_course_enrollments(archive_get(a), course_id, &archived);
+
+    snap->courses = (Course *)malloc(sizeof(Course));
+    snap->enrollments = (Enrollment *)malloc((rows + 1) * sizeof(Enrollment));
+    snap->students = (Student *)malloc((rows + 1) * sizeof(Student));
+    snap->grades = (Grade *)malloc((grade_rows + 1) * sizeof(Grade));
+    if (!snap->courses || !snap->enrollments || !snap->students || !snap->grades) return 0;
+
+    snapshot_add_course(snap, c);
+    for (e = c->first_enrollment; e != NULL; e = e->next_by_course) {
+        Enrollment *copy = &snap->enrollments[snap->enrollment_count++];
+        Student *s = get_student_by_id(e->student_id);
+        *copy = *e;
+        copy->next_by_student = NULL;
+        copy->next_by_course = NULL;
+        copy->next_by_professor = NULL;
+        copy->prev = NULL;
+        copy->next = NULL;
+        if (s != NULL) snapshot_add_student(snap, s);
+    }
+    for (a = 0; a < archive_count(); a++) {
+        count = archive_course_enrollments(archive_get(a), course_id, &archived);
+        for (i = 0; i < count; i++) {
+            Student *s = get_student_by_id(archived[i]->student_id);
+            snap->enrollments[snap->enrollment_count++] = *archived[i];
+            if (s != NULL) snapshot_add_student(snap, s);
+        }
+    }
+    for (g = c->first_grade; g != NULL; g = g->next_by_course) {
+        Grade *copy = &snap->grades[snap->grade_count++];
+        *copy = *g;
+        copy->next_by_student = NULL;
+        copy->next_by_course = NULL;
+        copy->prev = NULL;
+        copy->next = NULL;
+    }
+    qsort(snap->enrollments, snap->enrollment_count, sizeof(Enrollment), compare_enrollment_course);
+    qsort(snap->grades, snap->grade_count, sizeof(Grade), compare_grade_student);
+    snapshot_sort_entities(snap);
+    return 1;
+}
+
+/**
+ * Returns a consistent snapshot of the rows one report reads, with one reference for the caller.
+ * Only that report's rows are copied, through the ID indexes and per-entity chains, so a write
+ * never makes the next report pay for the whole dataset. Consecutive readers of the same report
+ * share the snapshot until a writer calls snapshot_touch().
+ * Must be called from the thread that owns the lists; the snapshot can then be handed to any thread.
+ * Bir raporun okuduğu satırların tutarlı bir görüntüsünü çağırana bir referansla döndürür.
+ * Yalnızca o raporun satırları ID indeksleri ve varlık zincirleri üzerinden kopyalanır; bir yazma
+ * sonraki raporu tüm veri kümesinin bedelini ödemeye zorlamaz. Aynı raporun ardışık okuyucuları,
+ * bir yazıcı snapshot_touch() çağırana kadar görüntüyü paylaşır.
+ * Listelerin sahibi olan iş parçacığından çağrılmalıdır; görüntü sonra herhangi bir iş parçacığına verilebilir.
+ * * @param scope - SNAPSHOT_STUDENT (transcript, audit) or SNAPSHOT_COURSE (roster, statistics)
+ * @param scope - SNAPSHOT_STUDENT (transkript, denetim) veya SNAPSHOT_COURSE (sınıf listesi, istatistik)
+ * @param id - Student or course ID
+ * @param id - Öğrenci veya kurs ID'si
+ * @return Snapshot to be released with snapshot_release, or NULL on memory failure
+ * @return snapshot_release ile bırakılacak görüntü; bellek hatasında NULL
+ */
+Snapshot* snapshot_acquire(int scope, int id) {
+    if (current_snapshot == NULL || current_snapshot->epoch != snapshot_epoch() ||
+        current_snapshot->scope != scope || current_snapshot->scope_id != id) {
+        Snapshot *fresh = (Snapshot *)calloc(1, sizeof(Snapshot));
+        if (fresh == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return NULL;
+        }
+        fresh->epoch = snapshot_epoch();
+        fresh->scope = scope;
+        fresh->scope_id = id;
+        if (!(scope == SNAPSHOT_STUDENT ? snapshot_fill_student(fresh, id) : snapshot_fill_course(fresh, id))) {
+            printf("Error: Memory allocation failed!\n");
+            snapshot_free(fresh);
+            return NULL;
+        }
+        fresh->refcount = 1;
+        if (current_snapshot != NULL) snapshot_release(current_snapshot);
+        current_snapshot = fresh;
+    }
+    __sync_fetch_and_add(&current_snapshot->refcount, 1);
+    return current_snapshot;
+}
+
+/**
+ * Drops one reference; the last reader of a superseded snapshot frees it. Safe from any thread.
+ * Bir referansı bırakır; eskimiş bir görüntünün son okuyucusu onu serbest bırakır. Her iş parçacığından güvenlidir.
+ * * @param snap - Snapshot returned by snapshot_acquire
+ * @param snap - snapshot_acquire tarafından döndürülen görüntü
+ */
+void snapshot_release(Snapshot *snap) {
+    if (snap == NULL) return;
+    if (__sync_sub_and_fetch(&snap->refcount, 1) == 0) snapshot_free(snap);
+}
+
+/**
+ * Drops the cached snapshot (readers still holding it keep it alive until they release it).
+ * Önbellekteki görüntüyü bırakır (onu tutan okuyucular bırakana kadar görüntü yaşamaya devam eder).
+ */
+void snapshot_clear(void) {
+    if (current_snapshot != NULL) {
+        snapshot_release(current_snapshot);
+        current_snapshot = NULL;
+    }
+}
+
+/**
+ * Finds a student in a snapshot by binary search.
+ * Bir görüntüde öğrenciyi ikili arama ile bulur.
+ * * @param snap - Snapshot to search
+ * @param snap - Aranacak görüntü
+ * @param id - Student ID
+ * @param id - Öğrenci ID'si
+ * @return Student copy or NULL
+ * @return Öğrenci kopyası veya NULL
+ */
+const Student* snapshot_find_student(const Snapshot *snap, int id) {
+    Student key;
+    if (snap->student_count == 0) return NULL;
+    key.id = id;
+    return (const Student *)bsearch(&key, snap->students, snap->student_count, sizeof(Student), compare_student_id);
+}
+
+/**
+ * Finds a course in a snapshot by binary search.
+ * Bir görüntüde kursu ikili arama ile bulur.
+ * * @param snap - Snapshot to search
+ * @param snap - Aranacak görüntü
+ * @param id - Course ID
+ * @param id - Kurs ID'si
+ * @return Course copy or NULL
+ * @return Kurs kopyası veya NULL
+ */
+const Course* snapshot_find_course(const Snapshot *snap, int id) {
+    Course key;
+    if (snap->course_count == 0) return NULL;
+    key.id = id;
+    return (const Course *)bsearch(&key, snap->courses, snap->course_count, sizeof(Course), compare_course_id);
+}
+
+/**
+ * Returns the contiguous run of a student's grades (ordered by semester).
+ * Bir öğrencinin notlarından oluşan bitişik aralığı döndürür (döneme göre sıralı).
+ * * @param snap - Snapshot to search
+ * @param snap - Aranacak görüntü
+ * @param student_id - Student ID
+ * @param student_id - Öğrenci ID'si
+ * @param first - Receives the first grade of the run
+ * @param first - Aralığın ilk notunu alır
+ * @return Number of grades in the run
+ * @return Aralıktaki not sayısı
+ */
+int snapshot_student_grades(const Snapshot *snap, int student_id, const Grade **first) {
+    int lo = 0, hi = snap->grade_count, end;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (snap->grades[mid].student_id < student_id) lo = mid + 1;
+        else hi = mid;
+    }
+    for (end = lo; end < snap->grade_count && snap->grades[end].student_id == student_id; end++);
+    *first = snap->grades + lo;
+    return end - lo;
+}
+
+/**
+ * Returns the contiguous run of a course's enrollments (ordered by enrollment ID).
+ * Bir kursun kayıtlarından oluşan bitişik aralığı döndürür (kayıt ID'sine göre sıralı).
+ * * @param snap - Snapshot to search
+ * @param snap - Aranacak görüntü
+ * @param course_id - Course ID
+ * @param course_id - Kurs ID'si
+ * @param first - Receives the first enrollment of the run
+ * @param first - Aralığın ilk kaydını alır
+ * @return Number of enrollments in the run
+ * @return Aralıktaki kayıt sayısı
+ */
+int snapshot_course_enrollments(const Snapshot *snap, int course_id, const Enrollment **first) {
+    int lo = 0, hi = snap->enrollment_count, end;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (snap->enrollments[mid].course_id < course_id) lo = mid + 1;
+        else hi = mid;
+    }
+    for (end = lo; end < snap->enrollment_count && snap->enrollments[end].course_id == course_id; end++);
+    *first = snap->enrollments + lo;
+    return end - lo;
+}
+
+// Adds the grade points and credits of a run of grades
+// Bir not aralığının not puanlarını ve kredilerini ekler
+static void accumulate_grade_points(const Snapshot *snap, const Grade *g, int count,
+                                    float *total_points, int *total_credits) {
+    int i;
+    for (i = 0; i < count; i++) {
+        const Course *c = snapshot_find_course(snap, g[i].course_id);
+        if (c != NULL) {
+            *total_points += numeric_to_grade_point(g[i].numeric_grade) * c->credits;
+            *total_credits += c->credits;
+        }
+    }
+}
+
+/**
+ * Calculates a student's GPA from a snapshot, with the same grade points as calculate_student_gpa.
+ * Bir öğrencinin GPA'sını görüntüden, calculate_student_gpa ile aynı not puanlarıyla hesaplar.
+ * * @param snap - Snapshot to read (SNAPSHOT_STUDENT scope of the same student)
+ * @param snap - Okunacak görüntü (aynı öğrencinin SNAPSHOT_STUDENT kapsamı)
+ * @param student_id - Student ID
+ * @param student_id - Öğrenci ID'si
+ * @return GPA on the 4.0 scale
+ * @return 4.0 ölçeğinde GPA
+ */
+float snapshot_student_gpa(const Snapshot *snap, int student_id) {
+    const Grade *g;
+    float total_points = 0;
+    int total_credits = 0;
+    int a, count = snapshot_student_grades(snap, student_id, &g);
+
+    accumulate_grade_points(snap, g, count, &total_points, &total_credits);
+    // Archives are immutable once mapped, so they are read without a snapshot copy
+    // Arşivler eşlendikten sonra değişmez; görüntü kopyası olmadan okunur
+    for (a = 0; a < archive_count(); a++) {
+        count = archive_student_grades(archive_get(a), student_id, &g);
+        accumulate_grade_points(snap, g, count, &total_points, &total_credits);
+    }
+    if (total_credits == 0) return 0.0;
+    return total_points / total_credits;
+}
+
+/**
+ * Summarizes a course's grades from a snapshot, archived semesters included, with the same
+ * sketch as course_grade_summary but without reading the live statistics tables.
+ * Bir dersin notlarını, arşivlenmiş dönemler dahil, görüntüden özetler; course_grade_summary ile
+ * aynı özeti kullanır ama canlı istatistik tablolarını okumaz.
+ * * @param snap - Snapshot to read (SNAPSHOT_COURSE scope of the same course)
+ * @param snap - Okunacak görüntü (aynı dersin SNAPSHOT_COURSE kapsamı)
+ * @param course_id - Course ID
+ * @param course_id - Ders ID'si
+ * @param out - Receives the summary
+ * @param out - Özeti alır
+ * @return 1 if the course has grades, 0 otherwise
+ * @return Dersin notu varsa 1, yoksa 0 döner
+ */
+int snapshot_course_summary(const Snapshot *snap, int course_id, GradeSummary *out) {
+    const Grade **archived;
+    GradeSketch sketch;
+    int a, i, count;
+
+    memset(&sketch, 0, sizeof(GradeSketch));
+    for (i = 0; i < snap->grade_count; i++) {
+        if (snap->grades[i].course_id == course_id) grade_sketch_add(&sketch, snap->grades[i].numeric_grade);
+    }
+    for (a = 0; a < archive_count(); a++) {
+        count = archive_course_grades(archive_get(a), course_id, &archived);
+        for (i = 0; i < count; i++) grade_sketch_add(&sketch, archived[i]->numeric_grade);
+    }
+    grade_sketch_summary(&sketch, out);
+    grade_sketch_free(&sketch);
+    return out->count > 0;
+}
@@ -0,0 +1,48 @@
+// snapshot.h - Rapor Anlık Görüntüleri Modülü (Epoch Tabanlı)
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "student.h"
+#include "course.h"
+#include "enrollment.h"
+#include "grade.h"
+#include "gradestats.h"
+
+#define SNAPSHOT_STUDENT 0         // One student's transcript: the student, its grades and their courses
+#define SNAPSHOT_COURSE 1          // One course's roster and statistics: the course, its enrollments, grades and students
+
+// Immutable copy of the rows one report reads at one write epoch, shared by report threads.
+// Chain pointers of the copied rows are cleared; use the lookup helpers instead.
+// Rapor iş parçacıklarınca paylaşılan, bir raporun okuduğu satırların bir yazma epoch'undaki değişmez kopyası.
+// Kopyalanan satırların zincir pointer'ları temizlenir; bunun yerine arama yardımcılarını kullanın.
+typedef struct Snapshot {
+    unsigned long epoch;
+    int refcount;
+    int scope;                 // SNAPSHOT_STUDENT or SNAPSHOT_COURSE
+    int scope_id;              // Student or course the rows belong to
+    Student *students;         // Sorted by id
+    int student_count;
+    Course *courses;           // Sorted by id
+    int course_count;
+    Enrollment *enrollments;   // Sorted by course_id, then id
+    int enrollment_count;
+    Grade *grades;             // Sorted by student_id, then semester and id
+    int grade_count;
+} Snapshot;
+
+void snapshot_touch(void);
+unsigned long snapshot_epoch(void);
+Snapshot* snapshot_acquire(int scope, int id);
+void snapshot_release(Snapshot *snap);
+void snapshot_clear(void);
+const Student* snapshot_find_student(const Snapshot *snap, int id);
+const Course* snapshot_find_course(const Snapshot *snap, int id);
+int snapshot_student_grades(const Snapshot *snap, int student_id, const Grade **first);
+int snapshot_course_enrollments(const Snapshot *snap, int course_id, const Enrollment **first);
+float snapshot_student_gpa(const Snapshot *snap, int student_id);
+int snapshot_course_summary(const Snapshot *snap, int course_id, GradeSummary *out);
+
+#endif
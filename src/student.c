@@ -1,432 +1,1029 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <strings.h>
-#include "student.h"
-#include "utils.h"
-#include "grade.h"
-#include "course.h"
-
-/**
- * Adds a new student to the system. Checks for duplicate IDs.
- * Sisteme yeni bir renci ekler. Mkerrer ID kontrol yapar.
- * * @param head - Address of the pointer to the head of the student list
- * @param head - renci listesinin ban tutan pointer'n adresi
- * @param new_student - Pointer to the structure containing new student data
- * @param new_student - Yeni renci verilerini ieren yap pointer'
- * @return 1 if successful, 0 if ID exists or memory allocation fails
- * @return Baarlysa 1, ID zaten varsa veya bellek hatas oluursa 0 dner
- */
-int add_student(Student **head, Student *new_student) {
-    if (find_student_by_id(*head, new_student->id) != NULL) {
-        printf("Error: Student with ID %d already exists!\n", new_student->id);
-        return 0;
-    }
-
-    Student *node = (Student *)malloc(sizeof(Student));
-    if (node == NULL) {
-        printf("Memory allocation failed!\n");
-        return 0;
-    }
-
-    *node = *new_student;
-    node->next = NULL;
-
-    if (*head == NULL) {
-        *head = node;
-    } else {
-        Student *temp = *head;
-        while (temp->next != NULL) {
-            temp = temp->next;
-        }
-        temp->next = node;
-    }
-    return 1;
-}
-
-/**
- * Searches for a student in the list by their unique ID.
- * renciyi benzersiz ID numarasna gre listede arar.
- * * @param head - Head of the student list
- * @param head - renci listesinin ba
- * @param id - Unique ID of the student to find
- * @param id - Aranan rencinin benzersiz ID'si
- * @return Pointer to the found student or NULL if not found
- * @return Bulunursa renci yapsnn adresi, bulunamazsa NULL dner
- */
-Student* find_student_by_id(Student *head, int id) {
-    Student *current = head;
-    while (current != NULL) {
-        if (current->id == id) {
-            return current;
-        }
-        current = current->next;
-    }
-    return NULL;
-}
-
-/**
- * Searches for a student by first and last name (case-insensitive).
- * sim ve soyisime gre renci aramas yapar (byk/kk harf duyarsz).
- * * @param head - Head of the student list
- * @param head - renci listesinin ba
- * @param first - First name to search
- * @param first - Aranan isim
- * @param last - Last name to search
- * @param last - Aranan soyisim
- * @return Pointer to the matched student or NULL
- * @return Eleen renci yaps veya NULL dner
- */
-Student* find_student_by_name(Student *head, const char *first, const char *last) {
-    Student *current = head;
-    while (current != NULL) {
-        if (strcasecmp(current->first_name, first) == 0 && strcasecmp(current->last_name, last) == 0) {
-            return current;
-        }
-        current = current->next;
-    }
-    return NULL;
-}
-
-/**
- * Searches for a student by their email address.
- * E-posta adresine gre renci aramas yapar.
- * * @param head - Head of the student list
- * @param head - renci listesinin ba
- * @param email - Email address to search
- * @param email - Aranan e-posta adresi
- * @return Pointer to the matched student or NULL
- * @return Eleen renci yaps veya NULL dner
- */
-Student* find_student_by_email(Student *head, const char *email) {
-    Student *current = head;
-    while (current != NULL) {
-        if (strcmp(current->email, email) == 0) {
-            return current;
-        }
-        current = current->next;
-    }
-    return NULL;
-}
-
-/**
- * Updates an existing student's information with new data.
- * Mevcut bir rencinin bilgilerini yeni verilerle gnceller.
- * * @param target - Pointer to the existing student structure to be updated
- * @param target - Gncellenecek olan mevcut renci yaps
- * @param new_data - Structure containing updated information
- * @param new_data - Yeni bilgileri ieren yap
- */
-void update_student(Student *target, Student *new_data) {
-    if (target == NULL) return;
-    strcpy(target->first_name, new_data->first_name);
-    strcpy(target->last_name, new_data->last_name);
-    strcpy(target->email, new_data->email);
-    strcpy(target->phone, new_data->phone);
-    target->enrollment_year = new_data->enrollment_year;
-    strcpy(target->major, new_data->major);
-    printf("Success: Student information updated!\n");
-}
-
-/**
- * Deletes a student by ID and frees associated memory.
- * Belirtilen ID'ye sahip renciyi siler ve bellei serbest brakr.
- * * @param head - Address of the pointer to the head of the student list
- * @param head - renci listesinin ban tutan pointer'n adresi
- * @param id - ID of the student to delete
- * @param id - Silinecek rencinn ID'si
- * @return 1 if successful, 0 if student not found
- * @return Silme baarlysa 1, renci bulunamazsa 0 dner
- */
-int delete_student(Student **head, int id) {
-    if (*head == NULL) return 0;
-
-    Student *temp = *head;
-    Student *prev = NULL;
-
-    if (temp != NULL && temp->id == id) {
-        *head = temp->next;
-        free(temp);
-        printf("Success: Student with ID %d deleted.\n", id);
-        return 1;
-    }
-
-    while (temp != NULL && temp->id != id) {
-        prev = temp;
-        temp = temp->next;
-    }
-
-    if (temp == NULL) {
-        printf("Error: Student with ID %d not found.\n", id);
-        return 0;
-    }
-
-    prev->next = temp->next;
-    free(temp);
-    printf("Success: Student with ID %d deleted.\n", id);
-    return 1;
-}
-
-/**
- * Displays all students in the system in a tabular format.
- * Sistemdeki tm rencileri tablo formatnda listeler.
- * * @param head - Head of the student list
- * @param head - renci listesinin ba
- */
-void display_all_students(Student *head) {
-    printf("\n================================================================================\n");
-    printf("                                STUDENT LIST\n");
-    printf("================================================================================\n");
-    printf("%-10s %-20s %-25s %-15s\n", "ID", "Name", "Email", "Major");
-    printf("--------------------------------------------------------------------------------\n");
-    
-    Student *current = head;
-    while (current != NULL) {
-        char full_name[100];
-        sprintf(full_name, "%s %s", current->first_name, current->last_name);
-        printf("%-10d %-20s %-25s %-15s\n", 
-               current->id, full_name, current->email, current->major);
-        current = current->next;
-    }
-    printf("================================================================================\n");
-}
-
-/**
- * Displays detailed information and recalculated GPA for a student.
- * Bir rencinin detayl bilgilerini ve yeniden hesaplanan GPA deerini gsterir.
- * * @param s - Pointer to the student structure
- * @param s - Bilgileri gsterilecek renci yaps
- * @param g_head - Head of the grade list (for GPA calculation)
- * @param g_head - Not listesinin ba (GPA hesab iin)
- * @param c_head - Head of the course list (for credit info)
- * @param c_head - Kurs listesinin ba (Kredi bilgisi iin)
- */
-void display_student_details(Student *s, struct Grade *g_head, struct Course *c_head) {
-    if (s == NULL) return;
-    
-    s->gpa = calculate_student_gpa(s->id, g_head, c_head);
-
-    printf("\n========================================\n");
-    printf("         STUDENT DETAILS\n");
-    printf("========================================\n");
-    printf("ID:              %d\n", s->id);
-    printf("Name:            %s %s\n", s->first_name, s->last_name);
-    printf("Email:           %s\n", s->email);
-    printf("Phone:           %s\n", s->phone);
-    printf("Enrollment Year: %d\n", s->enrollment_year);
-    printf("Major:           %s\n", s->major);
-    printf("GPA:             %.2f\n", s->gpa);
-    printf("========================================\n");
-}
-
-/**
- * Calculates a student's Cumulative GPA based on numeric grades and credits.
- * rencinin saysal notlarna ve kredilerine gre genel GPA'ini hesaplar.
- * * @param student_id - ID of the student
- * @param student_id - Hesaplama yaplacak rencinin ID'si
- * @param g_head - Head of the grade list
- * @param g_head - Not listesinin ba
- * @param c_head - Head of the course list
- * @param c_head - Kurs listesinin ba
- * @return Calculated GPA value (0.0 - 4.0)
- * @return Hesaplanan GPA deeri (0.0 - 4.0 aras)
- */
-float calculate_student_gpa(int student_id, struct Grade *g_head, struct Course *c_head) {
-    float total_points = 0;
-    int total_credits = 0;
-    Grade *current_g = g_head;
-    
-    while (current_g != NULL) {
-        if (current_g->student_id == student_id) {
-            Course *c = find_course_by_id(c_head, current_g->course_id);
-            if (c != NULL) {
-                float grade_point = 0;
-                if (current_g->numeric_grade >= 90) grade_point = 4.0;
-                else if (current_g->numeric_grade >= 85) grade_point = 3.5;
-                else if (current_g->numeric_grade >= 80) grade_point = 3.0;
-                else if (current_g->numeric_grade >= 75) grade_point = 2.5;
-                else if (current_g->numeric_grade >= 70) grade_point = 2.0;
-                else if (current_g->numeric_grade >= 60) grade_point = 1.5;
-                else if (current_g->numeric_grade >= 50) grade_point = 1.0;
-                else grade_point = 0.0;
-                
-                total_points += (grade_point * c->credits);
-                total_credits += c->credits;
-            }
-        }
-        current_g = current_g->next;
-    }
-    
-    if (total_credits == 0) return 0.0;
-    return total_points / total_credits;
-}
-
-/**
- * Displays the student's transcript, including courses, grades, and total credits.
- * rencinin transkriptini (dersler, notlar ve toplam kredi) listeler.
- * * @param s - Pointer to the student structure
- * @param s - renci yaps pointer'
- * @param g_head - Head of the grade list
- * @param g_head - Not listesinin ba
- * @param c_head - Head of the course list
- * @param c_head - Kurs listesinin ba
- */
-void display_student_transcript(Student *s, struct Grade *g_head, struct Course *c_head) {
-    if (s == NULL) return;
-    
-    s->gpa = calculate_student_gpa(s->id, g_head, c_head);
-
-    printf("\n================================================================================\n");
-    printf("                            TRANSCRIPT OF RECORDS\n");
-    printf("================================================================================\n");
-    printf("Student: %s %s (ID: %d)\n", s->first_name, s->last_name, s->id);
-    printf("Major:   %s\n", s->major);
-    printf("================================================================================\n");
-    printf("%-8s %-35s %-15s %-7s %-8s %s\n", "Code", "Course Name", "Semester", "Credits", "Grade", "Letter");
-    printf("--------------------------------------------------------------------------------\n");
-    
-    Grade *g = g_head;
-    int total_credits = 0;
-    
-    while (g != NULL) {
-        if (g->student_id == s->id) {
-            Course *c = find_course_by_id(c_head, g->course_id);
-            if (c != NULL) {
-                printf("%-8s %-35s %-15s %-7d %-8.2f %s\n",
-                       c->code, c->name, g->semester, c->credits, g->numeric_grade, g->letter_grade);
-                total_credits += c->credits;
-            }
-        }
-        g = g->next;
-    }
-    printf("================================================================================\n");
-    printf("Total Credits: %d\n", total_credits);
-    printf("Cumulative GPA: %.2f / 4.00\n", s->gpa);
-    printf("================================================================================\n");
-}
-
-/**
- * Saves the current list of students to a CSV file.
- * Mevcut renci listesini bir CSV dosyasna kaydeder.
- * * @param head - Head of the student list
- * @param head - renci listesinin ba
- * @param filename - Name and path of the file to save
- * @param filename - Kaydedilecek dosyann ad ve yolu
- * @return 1 if save successful, 0 if file cannot be opened
- * @return Kayt baarlysa 1, dosya alamazsa 0 dner
- */
-int save_students_to_csv(Student *head, const char *filename) {
-    FILE *file = fopen(filename, "w");
-    if (file == NULL) {
-        printf("Error: Could not open file %s for writing.\n", filename);
-        return 0;
-    }
-    
-    fprintf(file, "student_id,first_name,last_name,email,phone,enrollment_year,major,gpa\n");
-    
-    Student *current = head;
-    int count = 0;
-    while (current != NULL) {
-        fprintf(file, "%d,%s,%s,%s,%s,%d,%s,%.2f\n",
-                current->id,
-                current->first_name,
-                current->last_name,
-                current->email,
-                current->phone,
-                current->enrollment_year,
-                current->major,
-                current->gpa);
-        current = current->next;
-        count++;
-    }
-    fclose(file);
-    printf("Success: Saved %d students to CSV.\n", count);
-    return 1;
-}
-
-/**
- * Loads student records from a CSV file into the linked list.
- * CSV dosyasndaki renci kaytlarn bal listeye ykler.
- * * @param head - Address of the pointer to the head of the student list
- * @param head - renci listesinin ban tutan pointer'n adresi
- * @return Number of students successfully loaded
- * @return Baaryla yklenen renci saysn dner
- */
-int load_students_from_csv(Student **head) {
-    const char *filename = "data/students.csv";
-    FILE *file = fopen(filename, "r");
-    
-    if (file == NULL) {
-        filename = "students.csv";
-        file = fopen(filename, "r");
-        if (file == NULL) {
-            printf("Warning: Could not open students.csv anywhere. Starting empty.\n");
-            return 0;
-        }
-    }
-    
-    char line[512];
-    int count = 0;
-    fgets(line, sizeof(line), file);
-    
-    while (fgets(line, sizeof(line), file)) {
-        Student *new_s = (Student *)malloc(sizeof(Student));
-        
-        char *token = strtok(line, ",");
-        if(token) new_s->id = atoi(token);
-        
-        token = strtok(NULL, ","); if(token) strcpy(new_s->first_name, token);
-        token = strtok(NULL, ","); if(token) strcpy(new_s->last_name, token);
-        token = strtok(NULL, ","); if(token) strcpy(new_s->email, token);
-        token = strtok(NULL, ","); if(token) strcpy(new_s->phone, token);
-        token = strtok(NULL, ","); if(token) new_s->enrollment_year = atoi(token);
-        
-        token = strtok(NULL, ","); if(token) strcpy(new_s->major, token);
-        new_s->major[strcspn(new_s->major, "\r\n")] = 0;
-        
-        token = strtok(NULL, ","); if(token) new_s->gpa = atof(token);
-        
-        new_s->next = NULL;
-        add_student(head, new_s);
-        free(new_s); 
-        count++;
-    }
-    
-    fclose(file);
-    printf("Success: Loaded %d students from CSV.\n", count);
-    return count;
-}
-
-/**
- * Updates GPA values for all students based on the current grade and course data.
- * Tm rencilerin GPA deerlerini gncel not ve kurs verilerine gre gnceller.
- * * @param s_head - Head of the student list
- * @param s_head - renci listesinin ba
- * @param g_head - Head of the grade list
- * @param g_head - Not listesinin ba
- * @param c_head - Head of the course list
- * @param c_head - Kurs listesinin ba
- */
-void calculate_all_gpas(Student *s_head, struct Grade *g_head, struct Course *c_head) {
-    Student *current = s_head;
-    while(current != NULL) {
-        current->gpa = calculate_student_gpa(current->id, g_head, c_head);
-        current = current->next;
-    }
-}
-
-/**
- * Frees all memory allocated for the student linked list.
- * renci bal listesi iin ayrlan tm bellei serbest brakr.
- * * @param head - Head of the student list
- * @param head - renci listesinin ba
- */
-void free_all_students(Student *head) {
-    Student *temp;
-    while (head != NULL) {
-        temp = head;
-        head = head->next;
-        free(temp);
-    }
-    printf("Memory for students cleared.\n");
-}
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "student.h"
+#include "utils.h"
+#include "grade.h"
+#include "course.h"
+#include "enrollment.h"
+#include "index.h"
+#include "trie.h"
+#include "bloom.h"
+#include "snapshot.h"
+#include "archive.h"
+#include "ranking.h"
+#include "transcript.h"
+#include "join.h"
+
+// Secondary indexes over normalized email and "first|last" name keys.
+// Normalize e-posta ve "isim|soyisim" anahtarları üzerindeki ikincil indeksler.
+static IdIndex student_id_index = {NULL, 0, 0};
+static HashIndex student_email_index = {NULL, 0, 0};
+static HashIndex student_name_index = {NULL, 0, 0};
+
+// Blocked Bloom filter in front of the ID index; most brand-new IDs are ruled out without a lookup.
+// ID indeksinin önündeki blok Bloom filtresi; yeni ID'lerin çoğu arama yapılmadan elenir.
+static BloomFilter student_id_filter = {NULL, 0, 0, 0, 0};
+
+// Tail of the student list (and the head pointer it was found from), so add_student does not walk the list.
+// Öğrenci listesinin sonu (ve bulunduğu baş pointer'ı); add_student listeyi yürümez.
+static Student *student_tail = NULL;
+static Student **student_tail_owner = NULL;
+
+// Prefix search trie over diacritic-folded first, last, full name and email keys.
+// Aksanlardan arındırılmış isim, soyisim, tam isim ve e-posta anahtarları üzerindeki önek arama ağacı.
+static Trie student_search_trie = {NULL, 0};
+
+// Toplu not aktarımında GPA yeniden hesabı ertelenir; sayaç testler için tutulur
+static int gpa_deferred = 0;
+static long gpa_passes = 0;
+
+// Generation of the archived term totals; bumped whenever archives are mapped, frozen or unmapped
+// Arşiv dönem toplamlarının kuşağı; arşivler eşlendiğinde, dondurulduğunda veya bırakıldığında artırılır
+static int archived_totals_version = 1;
+
+#define STUDENT_SEARCH_KEYS 4
+
+/**
+ * Builds the folded search keys of a student (first, last, "first last", email).
+ * Bir öğrencinin arama anahtarlarını üretir (isim, soyisim, "isim soyisim", e-posta).
+ * * @param s - Student node
+ * @param s - Öğrenci düğümü
+ * @param keys - Output key buffers
+ * @param keys - Anahtarların yazılacağı alanlar
+ */
+static void student_search_keys(Student *s, char keys[STUDENT_SEARCH_KEYS][INDEX_KEY_LEN]) {
+    char full_name[INDEX_KEY_LEN];
+    snprintf(full_name, INDEX_KEY_LEN, "%s %s", s->first_name, s->last_name);
+    fold_search_text(s->first_name, keys[0], INDEX_KEY_LEN);
+    fold_search_text(s->last_name, keys[1], INDEX_KEY_LEN);
+    fold_search_text(full_name, keys[2], INDEX_KEY_LEN);
+    fold_search_text(s->email, keys[3], INDEX_KEY_LEN);
+}
+
+/**
+ * Registers a student node in the ID, email, name and prefix search indexes.
+ * Bir öğrenci düğümünü ID, e-posta, isim ve önek arama indekslerine kaydeder.
+ * * @param s - Student node stored in the list
+ * @param s - Listede saklanan öğrenci düğümü
+ */
+static void index_student(Student *s) {
+    char key[INDEX_KEY_LEN];
+    id_index_insert(&student_id_index, s->id, s);
+    snapshot_touch();
+    bloom_insert(&student_id_filter, &student_id_index, s->id);
+    normalize_key(s->email, key, INDEX_KEY_LEN);
+    index_insert(&student_email_index, key, s);
+    make_name_key(s->first_name, s->last_name, key, INDEX_KEY_LEN);
+    index_insert(&student_name_index, key, s);
+
+    char keys[STUDENT_SEARCH_KEYS][INDEX_KEY_LEN];
+    int i;
+    student_search_keys(s, keys);
+    for (i = 0; i < STUDENT_SEARCH_KEYS; i++) trie_insert(&student_search_trie, keys[i], s);
+}
+
+/**
+ * Removes a student node from the ID, email, name and prefix search indexes using its current keys.
+ * Bir öğrenci düğümünü mevcut anahtarlarıyla ID, e-posta, isim ve önek arama indekslerinden çıkarır.
+ * * @param s - Student node stored in the list
+ * @param s - Listede saklanan öğrenci düğümü
+ */
+static void unindex_student(Student *s) {
+    char key[INDEX_KEY_LEN];
+    id_index_remove(&student_id_index, s->id, s);
+    snapshot_touch();
+    normalize_key(s->email, key, INDEX_KEY_LEN);
+    index_remove(&student_email_index, key, s);
+    make_name_key(s->first_name, s->last_name, key, INDEX_KEY_LEN);
+    index_remove(&student_name_index, key, s);
+
+    char keys[STUDENT_SEARCH_KEYS][INDEX_KEY_LEN];
+    int i;
+    student_search_keys(s, keys);
+    for (i = 0; i < STUDENT_SEARCH_KEYS; i++) trie_remove(&student_search_trie, keys[i], s);
+}
+
+/**
+ * Hands a deleted student's grade and enrollment chains to the orphan chains of their modules, so the
+ * rows are linked back if a student with the same ID is added again.
+ * Silinen öğrencinin not ve kayıt zincirlerini modüllerinin yetim zincirlerine verir; aynı ID ile
+ * bir öğrenci yeniden eklenirse satırlar ona geri bağlanır.
+ * * @param s - Student node about to be freed
+ * @param s - Serbest bırakılacak öğrenci düğümü
+ */
+static void detach_student_chains(Student *s) {
+    grade_detach_student(s);
+    student_clear_terms(s);
+    enrollment_detach_student(s);
+    free(s->archived_terms);
+    s->archived_terms = NULL;
+}
+
+/**
+ * Appends a student node after the kept tail in O(1); the tail is walked to only when another list is appended to.
+ * Bir öğrenci düğümünü tutulan son düğümün arkasına O(1) sürede ekler; başka bir listeye eklenirken son düğüme yürünür.
+ * * @param head_ptr - Double pointer to the head of the student list
+ * @param head_ptr - Öğrenci listesinin başına işaret eden çift kademeli pointer
+ * @param node - Node to append
+ * @param node - Eklenecek düğüm
+ */
+static void append_student_node(Student **head_ptr, Student *node) {
+    if (head_ptr != student_tail_owner || *head_ptr == NULL) {
+        student_tail = *head_ptr;
+        while (student_tail != NULL && student_tail->next != NULL) student_tail = student_tail->next;
+        student_tail_owner = head_ptr;
+    }
+    node->next = NULL;
+    if (student_tail == NULL) *head_ptr = node;
+    else student_tail->next = node;
+    student_tail = node;
+}
+
+/**
+ * Checks whether a student ID is taken, asking the Bloom filter before the exact ID index.
+ * Bir öğrenci ID'sinin kullanımda olup olmadığını, tam ID indeksinden önce Bloom filtresine sorarak kontrol eder.
+ * * @param id - ID to check
+ * @param id - Kontrol edilecek ID
+ * @return 1 if the ID exists, 0 otherwise
+ * @return ID varsa 1, yoksa 0 döner
+ */
+static int student_id_exists(int id) {
+    if (!bloom_may_contain(&student_id_filter, id)) return 0;
+    if (get_student_by_id(id) != NULL) return 1;
+    bloom_note_false_positive(&student_id_filter);
+    return 0;
+}
+
+/**
+ * Adds a new student to the system. Checks for duplicate IDs and appends at the kept tail in O(1).
+ * Sisteme yeni bir öğrenci ekler. Mükerrer ID kontrolü yapar ve tutulan son düğümün arkasına O(1) sürede ekler.
+ * * @param head - Address of the pointer to the head of the student list
+ * @param head - Öğrenci listesinin başını tutan pointer'ın adresi
+ * @param new_student - Pointer to the structure containing new student data
+ * @param new_student - Yeni öğrenci verilerini içeren yapı pointer'ı
+ * @return 1 if successful, 0 if ID exists or memory allocation fails
+ * @return Başarılıysa 1, ID zaten varsa veya bellek hatası oluşursa 0 döner
+ */
+int add_student(Student **head, Student *new_student) {
+    if (student_id_exists(new_student->id)) {
+        printf("Error: Student with ID %d already exists!\n", new_student->id);
+        return 0;
+    }
+
+    Student *node = (Student *)malloc(sizeof(Student));
+    if (node == NULL) {
+        printf("Memory allocation failed!\n");
+        return 0;
+    }
+
+    *node = *new_student;
+    node->first_grade = node->last_grade = NULL;
+    node->first_enrollment = node->last_enrollment = NULL;
+    node->terms = NULL;
+    node->term_count = node->term_capacity = 0;
+    node->archived_terms = NULL;
+    node->archived_term_count = node->archived_version = 0;
+    node->rank_filed = node->rank_pending = 0;
+    node->rank_class = NULL;
+    node->next = NULL;
+
+    append_student_node(head, node);
+    index_student(node);
+    grade_relink_student(node);
+    enrollment_relink_student(node);
+    ranking_touch(node);
+    return 1;
+}
+
+/**
+ * Searches for a student in the list by their unique ID.
+ * Öğrenciyi benzersiz ID numarasına göre listede arar.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param id - Unique ID of the student to find
+ * @param id - Aranan öğrencinin benzersiz ID'si
+ * @return Pointer to the found student or NULL if not found
+ * @return Bulunursa öğrenci yapısının adresi, bulunamazsa NULL döner
+ */
+Student* find_student_by_id(Student *head, int id) {
+    if (head == NULL) return NULL;
+    return get_student_by_id(id);
+}
+
+/**
+ * Looks up a student by ID through the ID index, without needing the list head.
+ * Used by the grade and enrollment modules to reach a student's row chains.
+ * Liste başına ihtiyaç duymadan ID indeksi üzerinden öğrenci arar.
+ * Not ve kayıt modülleri öğrencinin satır zincirlerine ulaşmak için kullanır.
+ * * @param id - Unique ID of the student
+ * @param id - Öğrencinin benzersiz ID'si
+ * @return Pointer to the student or NULL
+ * @return Öğrenci yapısının adresi veya NULL
+ */
+Student* get_student_by_id(int id) {
+    return (Student *)id_index_find(&student_id_index, id);
+}
+
+/**
+ * Searches for a student by first and last name (case-insensitive).
+ * İsim ve soyisime göre öğrenci araması yapar (büyük/küçük harf duyarsız).
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param first - First name to search
+ * @param first - Aranan isim
+ * @param last - Last name to search
+ * @param last - Aranan soyisim
+ * @return Pointer to the matched student or NULL
+ * @return Eşleşen öğrenci yapısı veya NULL döner
+ */
+Student* find_student_by_name(Student *head, const char *first, const char *last) {
+    char key[INDEX_KEY_LEN];
+    if (head == NULL) return NULL;
+    make_name_key(first, last, key, INDEX_KEY_LEN);
+    return (Student *)index_find(&student_name_index, key);
+}
+
+/**
+ * Collects every student sharing the given first and last name (case-insensitive).
+ * Aynı isim ve soyisme sahip tüm öğrencileri toplar (büyük/küçük harf duyarsız).
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param first - First name to search
+ * @param first - Aranan isim
+ * @param last - Last name to search
+ * @param last - Aranan soyisim
+ * @param results - Array receiving the matched students
+ * @param results - Eşleşen öğrencilerin yazılacağı dizi
+ * @param max_results - Capacity of the results array
+ * @param max_results - Sonuç dizisinin kapasitesi
+ * @return Number of matched students
+ * @return Eşleşen öğrenci sayısı
+ */
+int find_students_by_name(Student *head, const char *first, const char *last, Student **results, int max_results) {
+    char key[INDEX_KEY_LEN];
+    if (head == NULL) return 0;
+    make_name_key(first, last, key, INDEX_KEY_LEN);
+    return index_find_all(&student_name_index, key, (void **)results, max_results);
+}
+
+/**
+ * Finds students whose first name, last name, full name or email starts with a prefix.
+ * Matching ignores case and Turkish/Latin diacritics (e.g. "yil" matches "Yılmaz").
+ * İsmi, soyismi, tam ismi veya e-postası verilen önekle başlayan öğrencileri bulur.
+ * Eşleştirme büyük/küçük harf ve Türkçe/Latin aksanlardan bağımsızdır (örn. "yil", "Yılmaz" ile eşleşir).
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param prefix - Prefix typed by the operator
+ * @param prefix - Operatörün yazdığı önek
+ * @param results - Array receiving the matched students
+ * @param results - Eşleşen öğrencilerin yazılacağı dizi
+ * @param max_results - Capacity of the results array
+ * @param max_results - Sonuç dizisinin kapasitesi
+ * @return Number of matched students
+ * @return Eşleşen öğrenci sayısı
+ */
+int search_students_by_prefix(Student *head, const char *prefix, Student **results, int max_results) {
+    char key[INDEX_KEY_LEN];
+    if (head == NULL) return 0;
+    fold_search_text(prefix, key, INDEX_KEY_LEN);
+    return trie_collect_prefix(&student_search_trie, key, (void **)results, max_results);
+}
+
+/**
+ * Searches for a student by their email address.
+ * E-posta adresine göre öğrenci araması yapar.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param email - Email address to search
+ * @param email - Aranan e-posta adresi
+ * @return Pointer to the matched student or NULL
+ * @return Eşleşen öğrenci yapısı veya NULL döner
+ */
+Student* find_student_by_email(Student *head, const char *email) {
+    char key[INDEX_KEY_LEN];
+    if (head == NULL) return NULL;
+    normalize_key(email, key, INDEX_KEY_LEN);
+    return (Student *)index_find(&student_email_index, key);
+}
+
+/**
+ * Updates an existing student's information with new data.
+ * Mevcut bir öğrencinin bilgilerini yeni verilerle günceller.
+ * * @param target - Pointer to the existing student structure to be updated
+ * @param target - Güncellenecek olan mevcut öğrenci yapısı
+ * @param new_data - Structure containing updated information
+ * @param new_data - Yeni bilgileri içeren yapı
+ */
+void update_student(Student *target, Student *new_data) {
+    if (target == NULL) return;
+    // Re-key: drop the old email/name entries before the fields change
+    // Yeniden anahtarla: alanlar değişmeden önce eski e-posta/isim kayıtlarını çıkar
+    unindex_student(target);
+    int moved = (target->enrollment_year != new_data->enrollment_year || strcmp(target->major, new_data->major) != 0);
+    strcpy(target->first_name, new_data->first_name);
+    strcpy(target->last_name, new_data->last_name);
+    strcpy(target->email, new_data->email);
+    strcpy(target->phone, new_data->phone);
+    target->enrollment_year = new_data->enrollment_year;
+    strcpy(target->major, new_data->major);
+    index_student(target);
+    // Bölüm veya giriş yılı değiştiyse öğrenci yeni sınıfının sıralamasına taşınır
+    if (moved) ranking_touch(target);
+    printf("Success: Student information updated!\n");
+}
+
+/**
+ * Deletes a student by ID and frees associated memory.
+ * Belirtilen ID'ye sahip öğrenciyi siler ve belleği serbest bırakır.
+ * * @param head - Address of the pointer to the head of the student list
+ * @param head - Öğrenci listesinin başını tutan pointer'ın adresi
+ * @param id - ID of the student to delete
+ * @param id - Silinecek öğrencinın ID'si
+ * @return 1 if successful, 0 if student not found
+ * @return Silme başarılıysa 1, öğrenci bulunamazsa 0 döner
+ */
+int delete_student(Student **head, int id) {
+    if (*head == NULL) return 0;
+
+    Student *temp = *head;
+    Student *prev = NULL;
+
+    if (temp != NULL && temp->id == id) {
+        *head = temp->next;
+        if (temp == student_tail) student_tail = NULL;
+        unindex_student(temp);
+        ranking_remove(temp);
+        detach_student_chains(temp);
+        free(temp);
+        printf("Success: Student with ID %d deleted.\n", id);
+        return 1;
+    }
+
+    while (temp != NULL && temp->id != id) {
+        prev = temp;
+        temp = temp->next;
+    }
+
+    if (temp == NULL) {
+        printf("Error: Student with ID %d not found.\n", id);
+        return 0;
+    }
+
+    prev->next = temp->next;
+    if (temp == student_tail) student_tail = prev;
+    unindex_student(temp);
+    ranking_remove(temp);
+    detach_student_chains(temp);
+    free(temp);
+    printf("Success: Student with ID %d deleted.\n", id);
+    return 1;
+}
+
+/**
+ * Displays all students in the system in a tabular format.
+ * Sistemdeki tüm öğrencileri tablo formatında listeler.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ */
+void display_all_students(Student *head) {
+    printf("\n================================================================================\n");
+    printf("                                STUDENT LIST\n");
+    printf("================================================================================\n");
+    printf("%-10s %-20s %-25s %-15s\n", "ID", "Name", "Email", "Major");
+    printf("--------------------------------------------------------------------------------\n");
+    
+    Student *current = head;
+    while (current != NULL) {
+        char full_name[100];
+        sprintf(full_name, "%s %s", current->first_name, current->last_name);
+        printf("%-10d %-20s %-25s %-15s\n", 
+               current->id, full_name, current->email, current->major);
+        current = current->next;
+    }
+    printf("================================================================================\n");
+}
+
+/**
+ * Displays detailed information and recalculated GPA for a student.
+ * Bir öğrencinin detaylı bilgilerini ve yeniden hesaplanan GPA değerini gösterir.
+ * * @param s - Pointer to the student structure
+ * @param s - Bilgileri gösterilecek öğrenci yapısı
+ * @param g_head - Head of the grade list (for GPA calculation)
+ * @param g_head - Not listesinin başı (GPA hesabı için)
+ * @param c_head - Head of the course list (for credit info)
+ * @param c_head - Kurs listesinin başı (Kredi bilgisi için)
+ */
+void display_student_details(Student *s, struct Grade *g_head, struct Course *c_head) {
+    if (s == NULL) return;
+    
+    student_set_gpa(s, calculate_student_gpa(s->id, g_head, c_head));
+
+    printf("\n========================================\n");
+    printf("         STUDENT DETAILS\n");
+    printf("========================================\n");
+    printf("ID:              %d\n", s->id);
+    printf("Name:            %s %s\n", s->first_name, s->last_name);
+    printf("Email:           %s\n", s->email);
+    printf("Phone:           %s\n", s->phone);
+    printf("Enrollment Year: %d\n", s->enrollment_year);
+    printf("Major:           %s\n", s->major);
+    printf("GPA:             %.2f\n", s->gpa);
+    printf("========================================\n");
+}
+
+/**
+ * Maps a numeric grade to its grade point on the 4.0 scale.
+ * Sayısal notu 4.0 ölçeğindeki not puanına çevirir.
+ * * @param numeric_grade - Score between 0 and 100
+ * @param numeric_grade - 0 ile 100 arasında puan
+ * @return Grade point (0.0 - 4.0)
+ * @return Not puanı (0.0 - 4.0)
+ */
+float numeric_to_grade_point(float numeric_grade) {
+    if (numeric_grade >= 90) return 4.0;
+    if (numeric_grade >= 85) return 3.5;
+    if (numeric_grade >= 80) return 3.0;
+    if (numeric_grade >= 75) return 2.5;
+    if (numeric_grade >= 70) return 2.0;
+    if (numeric_grade >= 60) return 1.5;
+    if (numeric_grade >= 50) return 1.0;
+    return 0.0;
+}
+
+// ===============================================
+// TERM GPA TOTALS (DÖNEM GPA TOPLAMLARI)
+// ===============================================
+
+/**
+ * Binary-searches a student's term records.
+ * Bir öğrencinin dönem kayıtlarında ikili arama yapar.
+ * @return The record for term, or NULL; *pos receives its (insertion) position
+ * @return Döneme ait kayıt veya NULL; *pos kaydın (ekleme) konumunu alır
+ */
+static TermRecord* find_term_record(const Student *s, int term, int *pos) {
+    int lo = 0, hi = s->term_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (s->terms[mid].term < term) lo = mid + 1;
+        else hi = mid;
+    }
+    if (pos != NULL) *pos = lo;
+    return (lo < s->term_count && s->terms[lo].term == term) ? &s->terms[lo] : NULL;
+}
+
+/**
+ * Adds one graded course to a term record.
+ * Not verilmiş bir dersi bir dönem kaydına ekler.
+ */
+static void add_to_term_record(TermRecord *r, int credits, float numeric_grade, int sign) {
+    r->grades += sign;
+    r->credits_attempted += sign * credits;
+    if (numeric_grade >= 50) r->credits_earned += sign * credits;
+    r->quality_points += sign * numeric_to_grade_point(numeric_grade) * credits;
+}
+
+/**
+ * Adds (sign = 1) or removes (sign = -1) one grade in the student's per-term totals.
+ * Called by the grade module whenever a grade is linked, unlinked or rescored.
+ * Öğrencinin dönem toplamlarına bir not ekler (sign = 1) veya çıkarır (sign = -1).
+ * Not modülü bir not bağlandığında, çözüldüğünde veya puanı değiştiğinde çağırır.
+ * * @param s - Student owning the grade
+ * @param s - Notun sahibi öğrenci
+ * @param term - Term ordinal of the grade
+ * @param term - Notun dönem sıra numarası
+ * @param credits - Credits of the course
+ * @param credits - Dersin kredisi
+ * @param numeric_grade - Score of the grade
+ * @param numeric_grade - Notun puanı
+ * @param sign - 1 to add, -1 to remove
+ * @param sign - Eklemek için 1, çıkarmak için -1
+ */
+void student_account_grade(Student *s, int term, int credits, float numeric_grade, int sign) {
+    int pos;
+    if (s == NULL || credits <= 0) return;
+    TermRecord *r = find_term_record(s, term, &pos);
+    if (r == NULL) {
+        if (sign < 0) return;
+        if (s->term_count == s->term_capacity) {
+            int capacity = (s->term_capacity > 0) ? s->term_capacity * 2 : 8;
+            TermRecord *grown = (TermRecord *)realloc(s->terms, capacity * sizeof(TermRecord));
+            if (grown == NULL) {
+                printf("Error: Memory allocation failed!\n");
+                return;
+            }
+            s->terms = grown;
+            s->term_capacity = capacity;
+        }
+        memmove(s->terms + pos + 1, s->terms + pos, (s->term_count - pos) * sizeof(TermRecord));
+        r = &s->terms[pos];
+        memset(r, 0, sizeof(TermRecord));
+        r->term = term;
+        s->term_count++;
+        ranking_term_join(s, term);
+    }
+    add_to_term_record(r, credits, numeric_grade, sign);
+    if (r->grades <= 0) {
+        memmove(s->terms + pos, s->terms + pos + 1, (s->term_count - pos - 1) * sizeof(TermRecord));
+        s->term_count--;
+        ranking_term_leave(s, term);
+    }
+    if (!gpa_deferred) student_set_gpa(s, student_cumulative_gpa(s, TERM_LATEST));
+}
+
+/**
+ * Turns deferred GPA accounting on or off. While on, student_account_grade keeps the term totals
+ * but leaves the cached GPA and the ranking alone; the caller recomputes each affected student once.
+ * Ertelenmiş GPA hesabını açar ya da kapatır. Açıkken student_account_grade dönem toplamlarını tutar,
+ * önbellekteki GPA'ya ve sıralamaya dokunmaz; etkilenen her öğrenci çağıran tarafından bir kez hesaplanır.
+ * * @param defer - 1 to defer, 0 to resume
+ * @param defer - Ertelemek için 1, devam için 0
+ */
+void student_defer_gpa(int defer) {
+    gpa_deferred = defer;
+}
+
+/**
+ * Number of cumulative GPA passes run so far.
+ * Şimdiye kadar yapılan genel GPA hesaplama sayısı.
+ * * @return Pass count
+ * @return Hesaplama sayısı
+ */
+long student_gpa_pass_count(void) {
+    return gpa_passes;
+}
+
+/**
+ * Updates a student's cached GPA and queues the student for the class ranking if it changed.
+ * Öğrencinin önbellekteki GPA'sını günceller; değiştiyse öğrenciyi sınıf sıralaması için sıraya koyar.
+ * * @param s - Student
+ * @param s - Öğrenci
+ * @param gpa - New GPA
+ * @param gpa - Yeni GPA
+ */
+void student_set_gpa(Student *s, float gpa) {
+    if (s == NULL || s->gpa == gpa) return;
+    s->gpa = gpa;
+    ranking_touch(s);
+}
+
+/**
+ * Drops all term totals of a student (their grades are gone).
+ * Bir öğrencinin tüm dönem toplamlarını bırakır (notları silinmiştir).
+ * * @param s - Student
+ * @param s - Öğrenci
+ */
+void student_clear_terms(Student *s) {
+    int i;
+    if (s == NULL) return;
+    for (i = 0; i < s->term_count; i++) ranking_term_leave(s, s->terms[i].term);
+    free(s->terms);
+    s->terms = NULL;
+    s->term_count = s->term_capacity = 0;
+}
+
+/**
+ * Builds the term totals of a student's rows in one archive from the student's contiguous rows,
+ * using the credits each row was counted with when the semester was frozen.
+ * Bir öğrencinin bir arşivdeki satırlarının dönem toplamını öğrencinin ardışık satırlarından,
+ * her satırın dönem dondurulurken sayıldığı krediyle oluşturur.
+ * @return 1 if the student has grades in the archive, 0 otherwise
+ * @return Öğrencinin arşivde notu varsa 1, yoksa 0 döner
+ */
+static int archived_term_record(const SemesterArchive *archive, int student_id, TermRecord *out) {
+    const Grade *rows;
+    int i, count = archive_student_grades(archive, student_id, &rows);
+    memset(out, 0, sizeof(TermRecord));
+    out->term = semester_to_term(archive->semester);
+    for (i = 0; i < count; i++) {
+        // Arşiv satırları dondurulurken sayıldıkları krediyle toplanır
+        if (rows[i].counted_credits > 0) add_to_term_record(out, rows[i].counted_credits, rows[i].numeric_grade, 1);
+    }
+    return out->grades > 0;
+}
+
+/**
+ * Marks every student's archived totals stale; the next GPA or history query rebuilds them once.
+ * Tüm öğrencilerin arşiv toplamlarını eskimiş sayar; sonraki GPA veya geçmiş sorgusu onları bir kez yeniden kurar.
+ */
+void student_archived_totals_invalidate(void) {
+    __sync_fetch_and_add(&archived_totals_version, 1);
+}
+
+/**
+ * Returns a student's archived term totals, rebuilding them from the archives only after they changed,
+ * so a GPA update does not rescan every mapped archive. The cache lives on the student, hence the cast.
+ * Bir öğrencinin arşiv dönem toplamlarını döndürür; arşivler değişmedikçe yeniden taranmaz, böylece
+ * GPA güncellemesi eşlenmiş tüm arşivleri taramaz. Önbellek öğrencide durduğu için const kaldırılır.
+ * * @param s - Student
+ * @param s - Öğrenci
+ * @param count - Receives the number of records
+ * @param count - Kayıt sayısını alır
+ * @return Records sorted by term (NULL if none)
+ * @return Döneme göre sıralı kayıtlar (yoksa NULL)
+ */
+static const TermRecord* student_archived_terms(const Student *s, int *count) {
+    Student *cached = (Student *)s;
+    int version = __sync_fetch_and_add(&archived_totals_version, 0);
+    if (cached->archived_version != version) {
+        int a, j, n = 0, total = archive_count();
+        TermRecord *records = (total > 0) ? (TermRecord *)malloc(total * sizeof(TermRecord)) : NULL;
+        for (a = 0; a < total && records != NULL; a++) {
+            TermRecord r;
+            if (!archived_term_record(archive_get(a), s->id, &r)) continue;
+            // Arşivler dondurulma sırasındadır; dönem sırasına ekleyerek yerleştir
+            for (j = n; j > 0 && records[j - 1].term > r.term; j--) records[j] = records[j - 1];
+            records[j] = r;
+            n++;
+        }
+        if (total > 0 && records == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            *count = 0;
+            return NULL;
+        }
+        free(cached->archived_terms);
+        cached->archived_terms = records;
+        cached->archived_term_count = n;
+        cached->archived_version = version;
+    }
+    *count = cached->archived_term_count;
+    return cached->archived_terms;
+}
+
+/**
+ * Lists a student's term totals, archived semesters included, in term order.
+ * Bir öğrencinin dönem toplamlarını, arşivlenmiş dönemler dahil, dönem sırasıyla listeler.
+ * * @param s - Student
+ * @param s - Öğrenci
+ * @param out - Receives the term records
+ * @param out - Dönem kayıtlarını alır
+ * @param max_terms - Capacity of out
+ * @param max_terms - out'un kapasitesi
+ * @return Number of records written
+ * @return Yazılan kayıt sayısı
+ */
+int student_term_history(const Student *s, TermRecord *out, int max_terms) {
+    int archived_count, i, j, n = 0;
+    if (s == NULL) return 0;
+    const TermRecord *archived = student_archived_terms(s, &archived_count);
+
+    // Sıcak dönemler ile arşiv dönemlerinin birleştirilmesi
+    for (i = 0, j = 0; (i < s->term_count || j < archived_count) && n < max_terms; n++) {
+        if (j >= archived_count || (i < s->term_count && s->terms[i].term < archived[j].term)) {
+            out[n] = s->terms[i++];
+        } else if (i >= s->term_count || archived[j].term < s->terms[i].term) {
+            out[n] = archived[j++];
+        } else {
+            out[n] = s->terms[i++];
+            out[n].grades += archived[j].grades;
+            out[n].credits_attempted += archived[j].credits_attempted;
+            out[n].credits_earned += archived[j].credits_earned;
+            out[n].quality_points += archived[j].quality_points;
+            j++;
+        }
+    }
+    return n;
+}
+
+/**
+ * A student's totals for one term, archived grades included.
+ * Bir öğrencinin bir dönemdeki toplamları (arşivlenmiş notlar dahil).
+ * * @param s - Student
+ * @param s - Öğrenci
+ * @param term - Term ordinal
+ * @param term - Dönem sıra numarası
+ * @param out - Receives the totals
+ * @param out - Toplamları alır
+ * @return 1 if the student has grades in that term, 0 otherwise
+ * @return Öğrencinin o dönemde notu varsa 1, yoksa 0 döner
+ */
+int student_term_record(const Student *s, int term, TermRecord *out) {
+    int a, archived_count;
+    memset(out, 0, sizeof(TermRecord));
+    out->term = term;
+    if (s == NULL) return 0;
+    TermRecord *r = find_term_record(s, term, NULL);
+    if (r != NULL) *out = *r;
+    const TermRecord *archived = student_archived_terms(s, &archived_count);
+    for (a = 0; a < archived_count; a++) {
+        if (archived[a].term == term) {
+            out->grades += archived[a].grades;
+            out->credits_attempted += archived[a].credits_attempted;
+            out->credits_earned += archived[a].credits_earned;
+            out->quality_points += archived[a].quality_points;
+        }
+    }
+    return out->grades > 0;
+}
+
+/**
+ * GPA of a single term.
+ * Tek bir dönemin GPA'sı.
+ * * @param s - Student
+ * @param s - Öğrenci
+ * @param term - Term ordinal
+ * @param term - Dönem sıra numarası
+ * @return Term GPA (0.0 if nothing was graded that term)
+ * @return Dönem GPA'sı (o dönem not yoksa 0.0)
+ */
+float student_term_gpa(const Student *s, int term) {
+    TermRecord r;
+    if (!student_term_record(s, term, &r) || r.credits_attempted == 0) return 0.0;
+    return r.quality_points / r.credits_attempted;
+}
+
+/**
+ * Cumulative GPA as it stood at the end of a term.
+ * Bir dönemin sonundaki genel GPA.
+ * * @param s - Student
+ * @param s - Öğrenci
+ * @param through_term - Last term to include (TERM_LATEST for the whole history)
+ * @param through_term - Dahil edilecek son dönem (tüm geçmiş için TERM_LATEST)
+ * @return Cumulative GPA on the 4.0 scale
+ * @return 4.0 ölçeğinde genel GPA
+ */
+float student_cumulative_gpa(const Student *s, int through_term) {
+    float points = 0;
+    int credits = 0, a, i, archived_count;
+    if (s == NULL) return 0.0;
+    gpa_passes++;
+    for (i = 0; i < s->term_count && s->terms[i].term <= through_term; i++) {
+        points += s->terms[i].quality_points;
+        credits += s->terms[i].credits_attempted;
+    }
+    const TermRecord *archived = student_archived_terms(s, &archived_count);
+    for (a = 0; a < archived_count && archived[a].term <= through_term; a++) {
+        points += archived[a].quality_points;
+        credits += archived[a].credits_attempted;
+    }
+    return (credits > 0) ? points / credits : 0.0;
+}
+
+/**
+ * Prints a student's term GPA, cumulative GPA and its change after each term.
+ * Bir öğrencinin her dönemdeki dönem GPA'sını, genel GPA'sını ve genel GPA'daki değişimi yazdırır.
+ * * @param s - Student
+ * @param s - Öğrenci
+ */
+void display_student_gpa_history(const Student *s) {
+    TermRecord history[MAX_STUDENT_TERMS];
+    char semester[20];
+    float points = 0, previous = 0;
+    int credits = 0, i;
+    if (s == NULL) return;
+    int count = student_term_history(s, history, MAX_STUDENT_TERMS);
+
+    printf("\n================================================================\n");
+    printf("   GPA History: %s %s (ID: %d)\n", s->first_name, s->last_name, s->id);
+    printf("================================================================\n");
+    printf("%-12s %9s %7s %9s %9s %8s\n", "Semester", "Attempted", "Earned", "Term GPA", "Cum. GPA", "Change");
+    printf("----------------------------------------------------------------\n");
+    for (i = 0; i < count; i++) {
+        TermRecord *r = &history[i];
+        points += r->quality_points;
+        credits += r->credits_attempted;
+        float cumulative = (credits > 0) ? points / credits : 0.0f;
+        term_to_semester(r->term, semester, sizeof(semester));
+        printf("%-12s %9d %7d %9.2f %9.2f ", semester, r->credits_attempted, r->credits_earned,
+               (r->credits_attempted > 0) ? r->quality_points / r->credits_attempted : 0.0f, cumulative);
+        if (i == 0) printf("%8s\n", "-");
+        else printf("%+8.2f\n", cumulative - previous);
+        previous = cumulative;
+    }
+    if (count == 0) printf("No graded terms.\n");
+    printf("================================================================\n");
+}
+
+// Quality points and credits gathered by the GPA fallback join
+// GPA yedek birleştirmesinin topladığı kalite puanları ve krediler
+typedef struct GpaJoin {
+    int student_id;
+    float points;
+    int credits;
+} GpaJoin;
+
+static int gpa_grade_course_key(const void *row) {
+    return ((const Grade *)row)->course_id;
+}
+
+static void* gpa_course_lookup(int id) {
+    return get_course_by_id(id);
+}
+
+static void emit_gpa_row(const void *left, const void *right, void *ctx) {
+    const Grade *g = (const Grade *)left;
+    const Course *c = (const Course *)right;
+    GpaJoin *gpa = (GpaJoin *)ctx;
+    if (g->student_id != gpa->student_id) return;
+    gpa->points += numeric_to_grade_point(g->numeric_grade) * c->credits;
+    gpa->credits += c->credits;
+}
+
+/**
+ * Calculates a student's Cumulative GPA based on numeric grades and credits.
+ * Known students are answered from their per-term totals; unknown IDs join the grade list and
+ * the archived rows with the course index.
+ * Öğrencinin sayısal notlarına ve kredilerine göre genel GPA'ini hesaplar.
+ * Bilinen öğrenciler dönem toplamlarından yanıtlanır; bilinmeyen ID'lerde not listesi ve arşiv
+ * satırları kurs indeksiyle birleştirilir.
+ * * @param student_id - ID of the student
+ * @param student_id - Hesaplama yapılacak öğrencinin ID'si
+ * @param g_head - Head of the grade list
+ * @param g_head - Not listesinin başı
+ * @param c_head - Head of the course list (NULL means there are no courses)
+ * @param c_head - Kurs listesinin başı (NULL ise hiç kurs yoktur)
+ * @return Calculated GPA value (0.0 - 4.0)
+ * @return Hesaplanan GPA değeri (0.0 - 4.0 arası)
+ */
+float calculate_student_gpa(int student_id, struct Grade *g_head, struct Course *c_head) {
+    GpaJoin gpa = {student_id, 0, 0};
+    int a;
+    Student *s = get_student_by_id(student_id);
+    if (s != NULL) return student_cumulative_gpa(s, TERM_LATEST);
+    if (c_head == NULL) return 0.0;
+
+    JoinSide courses = join_index(gpa_course_lookup);
+    JoinSide grades = join_chain(g_head, offsetof(Grade, next), gpa_grade_course_key);
+    hash_join(&grades, &courses, JOIN_INNER, emit_gpa_row, &gpa);
+
+    // Arşivlenmiş dönemlerin notları
+    for (a = 0; a < archive_count(); a++) {
+        const Grade *rows;
+        int count = archive_student_grades(archive_get(a), student_id, &rows);
+        JoinSide archived = join_array(rows, count, sizeof(Grade), gpa_grade_course_key);
+        hash_join(&archived, &courses, JOIN_INNER, emit_gpa_row, &gpa);
+    }
+    
+    if (gpa.credits == 0) return 0.0;
+    return gpa.points / gpa.credits;
+}
+
+/**
+ * Displays the student's transcript grouped by semester, with term subtotals taken from the term totals.
+ * Öğrencinin transkriptini dönemlere göre gruplar; dönem ara toplamları dönem toplamlarından alınır.
+ * * @param s - Pointer to the student structure
+ * @param s - Öğrenci yapısı pointer'ı
+ * @param g_head - Head of the grade list
+ * @param g_head - Not listesinin başı
+ * @param c_head - Head of the course list
+ * @param c_head - Kurs listesinin başı
+ */
+void display_student_transcript(Student *s, struct Grade *g_head, struct Course *c_head) {
+    TranscriptBuffer buf;
+    if (s == NULL) return;
+    
+    student_set_gpa(s, calculate_student_gpa(s->id, g_head, c_head));
+
+    transcript_buffer_init(&buf);
+    if (render_student_transcript(s, &buf)) {
+        fwrite(buf.text, 1, buf.length, stdout);
+    } else {
+        printf("Error: Memory allocation failed!\n");
+    }
+    transcript_buffer_free(&buf);
+}
+
+/**
+ * Saves the current list of students to a CSV file.
+ * Mevcut öğrenci listesini bir CSV dosyasına kaydeder.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param filename - Name and path of the file to save
+ * @param filename - Kaydedilecek dosyanın adı ve yolu
+ * @return 1 if save successful, 0 if file cannot be opened
+ * @return Kayıt başarılıysa 1, dosya açılamazsa 0 döner
+ */
+int save_students_to_csv(Student *head, const char *filename) {
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) {
+        printf("Error: Could not open file %s for writing.\n", filename);
+        return 0;
+    }
+    
+    fprintf(file, "student_id,first_name,last_name,email,phone,enrollment_year,major,gpa\n");
+    
+    Student *current = head;
+    int count = 0;
+    while (current != NULL) {
+        fprintf(file, "%d,%s,%s,%s,%s,%d,%s,%.2f\n",
+                current->id,
+                current->first_name,
+                current->last_name,
+                current->email,
+                current->phone,
+                current->enrollment_year,
+                current->major,
+                current->gpa);
+        current = current->next;
+        count++;
+    }
+    fclose(file);
+    printf("Success: Saved %d students to CSV.\n", count);
+    return 1;
+}
+
+/**
+ * Loads student records from a CSV file into the linked list.
+ * CSV dosyasındaki öğrenci kayıtlarını bağlı listeye yükler.
+ * * @param head - Address of the pointer to the head of the student list
+ * @param head - Öğrenci listesinin başını tutan pointer'ın adresi
+ * @return Number of students successfully loaded
+ * @return Başarıyla yüklenen öğrenci sayısını döner
+ */
+int load_students_from_csv(Student **head) {
+    const char *filename = "data/students.csv";
+    FILE *file = fopen(filename, "r");
+    
+    if (file == NULL) {
+        filename = "students.csv";
+        file = fopen(filename, "r");
+        if (file == NULL) {
+            printf("Warning: Could not open students.csv anywhere. Starting empty.\n");
+            return 0;
+        }
+    }
+    
+    char line[512];
+    int count = 0;
+    fgets(line, sizeof(line), file);
+    
+    while (fgets(line, sizeof(line), file)) {
+        Student *new_s = (Student *)malloc(sizeof(Student));
+        
+        char *token = strtok(line, ",");
+        if(token) new_s->id = atoi(token);
+        
+        token = strtok(NULL, ","); if(token) strcpy(new_s->first_name, token);
+        token = strtok(NULL, ","); if(token) strcpy(new_s->last_name, token);
+        token = strtok(NULL, ","); if(token) strcpy(new_s->email, token);
+        token = strtok(NULL, ","); if(token) strcpy(new_s->phone, token);
+        token = strtok(NULL, ","); if(token) new_s->enrollment_year = atoi(token);
+        
+        token = strtok(NULL, ","); if(token) strcpy(new_s->major, token);
+        new_s->major[strcspn(new_s->major, "\r\n")] = 0;
+        
+        token = strtok(NULL, ","); if(token) new_s->gpa = atof(token);
+        
+        new_s->next = NULL;
+        add_student(head, new_s);
+        free(new_s); 
+        count++;
+    }
+    
+    fclose(file);
+    printf("Success: Loaded %d students from CSV.\n", count);
+    return count;
+}
+
+/**
+ * Updates GPA values for all students based on the current grade and course data.
+ * Tüm öğrencilerin GPA değerlerini güncel not ve kurs verilerine göre günceller.
+ * * @param s_head - Head of the student list
+ * @param s_head - Öğrenci listesinin başı
+ * @param g_head - Head of the grade list
+ * @param g_head - Not listesinin başı
+ * @param c_head - Head of the course list
+ * @param c_head - Kurs listesinin başı
+ */
+void calculate_all_gpas(Student *s_head, struct Grade *g_head, struct Course *c_head) {
+    Student *current = s_head;
+    while(current != NULL) {
+        student_set_gpa(current, calculate_student_gpa(current->id, g_head, c_head));
+        current = current->next;
+    }
+}
+
+/**
+ * Frees all memory allocated for the student linked list.
+ * Öğrenci bağlı listesi için ayrılan tüm belleği serbest bırakır.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ */
+void free_all_students(Student *head) {
+    Student *temp;
+    while (head != NULL) {
+        temp = head;
+        head = head->next;
+        free(temp->terms);
+        free(temp->archived_terms);
+        free(temp);
+    }
+    student_tail = NULL;
+    student_tail_owner = NULL;
+    ranking_clear();
+    id_index_clear(&student_id_index);
+    bloom_clear(&student_id_filter);
+    index_clear(&student_email_index);
+    index_clear(&student_name_index);
+    trie_clear(&student_search_trie);
+    printf("Memory for students cleared.\n");
+}
+
+/**
+ * Prints the duplicate-ID filter statistics of the student table.
+ * Öğrenci tablosunun mükerrer ID filtresi istatistiklerini yazdırır.
+ */
+void display_student_filter_stats(void) {
+    bloom_print_stats("Students", &student_id_filter, student_id_index.size);
+}
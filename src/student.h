@@ -1,51 +1,97 @@
-#ifndef STUDENT_H
-#define STUDENT_H
-
-#include <stdio.h>
-
-// --- FORWARD DECLARATIONS ---
-// Grade ve Course yaplarn derleyiciye nceden haber veriyoruz.
-// Bylece circular dependency (dngsel bamllk) hatas almyoruz.
-struct Grade;
-struct Course;
-
-typedef struct Student {
-    int id;
-    char first_name[50];
-    char last_name[50];
-    char email[100];
-    char phone[20];
-    int enrollment_year;
-    char major[100];
-    float gpa;
-    struct Student *next;
-} Student;
-
-// --- FONKSYON PROTOTPLER ---
-
-// CRUD lemleri
-int add_student(Student **head, Student *new_student);
-Student* find_student_by_id(Student *head, int id);
-Student* find_student_by_name(Student *head, const char *first, const char *last);
-Student* find_student_by_email(Student *head, const char *email);
-void update_student(Student *target, Student *new_data); // void veya int olabilir, c dosyasna uydurduk
-int delete_student(Student **head, int id);
-
-// Listeleme ve Detay
-void display_all_students(Student *head);
-
-// !!! GNCELLENEN FONKSYONLAR (Hatay zen ksmm) !!!
-// Artk Grade ve Course listelerini de parametre olarak alyorlar
-void display_student_details(Student *s, struct Grade *g_head, struct Course *c_head);
-void display_student_transcript(Student *s, struct Grade *g_head, struct Course *c_head);
-float calculate_student_gpa(int student_id, struct Grade *g_head, struct Course *c_head);
-
-// Toplu GPA Hesaplama
-void calculate_all_gpas(Student *s_head, struct Grade *g_head, struct Course *c_head);
-
-// Dosya lemleri
-int save_students_to_csv(Student *head, const char *filename);
-int load_students_from_csv(Student **head);
-void free_all_students(Student *head);
-
-#endif
+#ifndef STUDENT_H
+#define STUDENT_H
+
+#include <stdio.h>
+
+// --- FORWARD DECLARATIONS ---
+// Grade ve Course yapılarını derleyiciye önceden haber veriyoruz.
+// Böylece circular dependency (döngüsel bağımlılık) hatası almıyoruz.
+struct Grade;
+struct Course;
+struct Enrollment;
+
+#define TERM_LATEST 2147483647   // through_term that covers the whole history / Tüm geçmişi kapsayan through_term
+#define MAX_STUDENT_TERMS 64
+
+// One student's totals for one semester, kept up to date as grades are added, changed and removed
+// Bir öğrencinin bir dönemdeki toplamları; notlar eklendikçe, değiştikçe ve silindikçe güncel tutulur
+typedef struct TermRecord {
+    int term;                // semester_to_term ordinal
+    int grades;
+    int credits_attempted;
+    int credits_earned;      // Courses passed with 50 or more (FD and above)
+    float quality_points;    // Sum of grade point x credits
+} TermRecord;
+
+typedef struct Student {
+    int id;
+    char first_name[50];
+    char last_name[50];
+    char email[100];
+    char phone[20];
+    int enrollment_year;
+    char major[100];
+    float gpa;
+    struct Grade *first_grade;             // Per-student grade chain (Grade.next_by_student)
+    struct Enrollment *first_enrollment;   // Per-student enrollment chain (Enrollment.next_by_student)
+    struct Grade *last_grade;              // Tail of the grade chain, for O(1) appends
+    struct Enrollment *last_enrollment;    // Tail of the enrollment chain
+    TermRecord *terms;                     // Per-term totals of the in-memory grades, sorted by term
+    int term_count;
+    int term_capacity;
+    TermRecord *archived_terms;            // Totals of the archived semesters, sorted by term (rebuilt on demand)
+    int archived_term_count;
+    int archived_version;                  // Generation the archived totals were built for
+    float ranked_gpa;                      // GPA the class ranking last filed this student under
+    int rank_filed;                        // 1 while the student sits in the ranking order
+    int rank_pending;                      // 1 while a GPA or class change waits to be applied to the ranking
+    struct RankClass *rank_class;          // Class order the student is filed in (ranking module)
+    struct Student *next;
+} Student;
+
+// --- FONKSİYON PROTOTİPLERİ ---
+
+// CRUD İşlemleri
+int add_student(Student **head, Student *new_student);
+Student* find_student_by_id(Student *head, int id);
+Student* get_student_by_id(int id);
+Student* find_student_by_name(Student *head, const char *first, const char *last);
+int find_students_by_name(Student *head, const char *first, const char *last, Student **results, int max_results);
+Student* find_student_by_email(Student *head, const char *email);
+int search_students_by_prefix(Student *head, const char *prefix, Student **results, int max_results);
+void update_student(Student *target, Student *new_data); // void veya int olabilir, c dosyasına uydurduk
+int delete_student(Student **head, int id);
+
+// Listeleme ve Detay
+void display_all_students(Student *head);
+
+// !!! GÜNCELLENEN FONKSİYONLAR (Hatayı çözen kısımm) !!!
+// Artık Grade ve Course listelerini de parametre olarak alıyorlar
+void display_student_details(Student *s, struct Grade *g_head, struct Course *c_head);
+void display_student_transcript(Student *s, struct Grade *g_head, struct Course *c_head);
+float calculate_student_gpa(int student_id, struct Grade *g_head, struct Course *c_head);
+float numeric_to_grade_point(float numeric_grade);
+
+// Dönem bazlı GPA toplamları
+void student_account_grade(Student *s, int term, int credits, float numeric_grade, int sign);
+void student_clear_terms(Student *s);
+void student_archived_totals_invalidate(void);
+void student_set_gpa(Student *s, float gpa);
+void student_defer_gpa(int defer);
+long student_gpa_pass_count(void);
+int student_term_record(const Student *s, int term, TermRecord *out);
+int student_term_history(const Student *s, TermRecord *out, int max_terms);
+float student_term_gpa(const Student *s, int term);
+float student_cumulative_gpa(const Student *s, int through_term);
+void display_student_gpa_history(const Student *s);
+
+// Toplu GPA Hesaplama
+void calculate_all_gpas(Student *s_head, struct Grade *g_head, struct Course *c_head);
+
+// Dosya İşlemleri
+int save_students_to_csv(Student *head, const char *filename);
+int load_students_from_csv(Student **head);
+void display_student_filter_stats(void);
+void free_all_students(Student *head);
+
+#endif
@@ -0,0 +1,419 @@
+// transcript.c - Toplu Transkript Modülü (İş Parçacığı Havuzu)
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "transcript.h"
+#include "course.h"
+#include "archive.h"
+#include "utils.h"
+#include "join.h"
+
+#define TRANSCRIPT_INITIAL_SIZE 4096
+#define TRANSCRIPT_COPY_SIZE 65536
+
+// One contiguous slice of the student list rendered by a worker thread
+// Bir işçi iş parçacığının işlediği öğrenci listesinin ardışık bir dilimi
+typedef struct TranscriptChunk {
+    Student **students;
+    long begin;
+    long end;
+    TranscriptLayout layout;
+    char path[300];              // Directory (per student) or this chunk's output file (single file)
+    long written;
+    int failed_id;               // Student whose transcript could not be written, 0 if none
+} TranscriptChunk;
+
+/**
+ * Prepares an empty buffer; storage is allocated on first use and then reused.
+ * Boş bir tampon hazırlar; bellek ilk kullanımda ayrılır ve sonra yeniden kullanılır.
+ * * @param buf - Buffer to initialize
+ * @param buf - Başlatılacak tampon
+ */
+void transcript_buffer_init(TranscriptBuffer *buf) {
+    memset(buf, 0, sizeof(TranscriptBuffer));
+}
+
+/**
+ * Releases the storage of a buffer.
+ * Bir tamponun belleğini serbest bırakır.
+ * * @param buf - Buffer to release
+ * @param buf - Serbest bırakılacak tampon
+ */
+void transcript_buffer_free(TranscriptBuffer *buf) {
+    free(buf->text);
+    free(buf->rows);
+    transcript_buffer_init(buf);
+}
+
+/**
+ * Appends formatted text to the buffer, growing it when needed.
+ * Tampona biçimlendirilmiş metin ekler; gerekirse tamponu büyütür.
+ * * @return 1 if appended, 0 if memory allocation fails
+ * @return Eklendiyse 1, bellek hatasında 0 döner
+ */
+static int buffer_printf(TranscriptBuffer *buf, const char *format, ...) {
+    va_list args;
+    int needed;
+
+    va_start(args, format);
+    needed = vsnprintf(buf->text + buf->length, buf->capacity - buf->length, format, args);
+    va_end(args);
+    if (needed < 0) return 0;
+    if (buf->length + needed < buf->capacity) {
+        buf->length += needed;
+        return 1;
+    }
+
+    size_t capacity = buf->capacity * 2;
+    while (capacity <= buf->length + needed) capacity *= 2;
+    char *text = (char *)realloc(buf->text, capacity);
+    if (text == NULL) return 0;
+    buf->text = text;
+    buf->capacity = capacity;
+
+    va_start(args, format);
+    vsnprintf(buf->text + buf->length, buf->capacity - buf->length, format, args);
+    va_end(args);
+    buf->length += needed;
+    return 1;
+}
+
+static int compare_transcript_rows(const void *a, const void *b) {
+    const Grade *x = ((const TranscriptRow *)a)->grade;
+    const Grade *y = ((const TranscriptRow *)b)->grade;
+    if (x->term != y->term) return (x->term > y->term) - (x->term < y->term);
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+// State shared with the join callbacks while one transcript is rendered
+// Bir transkript yazılırken birleştirme geri çağırmalarıyla paylaşılan durum
+typedef struct TranscriptJoin {
+    TranscriptBuffer *buf;
+    int row_count;
+    int ok;
+} TranscriptJoin;
+
+static int transcript_course_key(const void *row) {
+    return ((const Grade *)row)->course_id;
+}
+
+static void* transcript_course_lookup(int id) {
+    return get_course_by_id(id);
+}
+
+// Collects the student's grades with their courses for sorting; uncounted rows are listed with 0 credits
+// Öğrencinin notlarını sıralamak için dersleriyle birlikte toplar; sayılmayan satırlar 0 krediyle listelenir
+static void collect_transcript_row(const void *left, const void *right, void *ctx) {
+    TranscriptJoin *join = (TranscriptJoin *)ctx;
+    const Grade *g = (const Grade *)left;
+    join->buf->rows[join->row_count].grade = g;
+    join->buf->rows[join->row_count].course = (const Course *)right;
+    join->row_count++;
+}
+
+// Prints an archived grade with the credits it was counted with; archive rows already come in the archive's order
+// Arşivlenmiş bir notu sayıldığı krediyle yazar; arşiv satırları zaten arşiv sırasıyla gelir
+static void print_archived_row(const void *left, const void *right, void *ctx) {
+    TranscriptJoin *join = (TranscriptJoin *)ctx;
+    const Grade *g = (const Grade *)left;
+    const Course *c = (const Course *)right;
+    join->ok &= buffer_printf(join->buf, "%-8s %-35s %-15s %-7d %-8.2f %s\n",
+                              c ? c->code : "?", c ? c->name : "?", g->semester, g->counted_credits,
+                              g->numeric_grade, g->letter_grade);
+}
+
+// Inserts a term into a sorted, duplicate-free list
+// Bir dönemi sıralı ve tekrarsız listeye ekler
+static void add_transcript_term(int *terms, int *count, int max_terms, int term) {
+    int j = *count;
+    while (j > 0 && terms[j - 1] > term) j--;
+    if ((j > 0 && terms[j - 1] == term) || *count == max_terms) return;
+    memmove(terms + j + 1, terms + j, (*count - j) * sizeof(int));
+    terms[j] = term;
+    (*count)++;
+}
+
+/**
+ * Renders a student's transcript, grouped by semester with term subtotals, into the buffer.
+ * The student's grade chain and archived rows are joined with the course ID index (hash_join),
+ * so nothing scans the full grade or course lists. The data is only read; several threads may
+ * render different students while no thread modifies it.
+ * Öğrencinin transkriptini dönemlere göre gruplanmış ve dönem ara toplamlarıyla tampona yazar.
+ * Öğrencinin not zinciri ve arşiv satırları kurs ID indeksiyle birleştirilir (hash_join); tüm not
+ * veya kurs listesi taranmaz. Veri yalnızca okunur; veriyi değiştiren iş parçacığı yokken birden
+ * çok iş parçacığı farklı öğrencileri yazabilir.
+ * * @param s - Student to render
+ * @param s - Yazılacak öğrenci
+ * @param buf - Buffer receiving the text (previous contents are replaced)
+ * @param buf - Metni alan tampon (önceki içerik silinir)
+ * @return 1 if rendered, 0 if memory allocation fails
+ * @return Yazıldıysa 1, bellek hatasında 0 döner
+ */
+int render_student_transcript(const Student *s, TranscriptBuffer *buf) {
+    TermRecord history[MAX_STUDENT_TERMS];
+    TranscriptJoin join;
+    char semester[20];
+    int row_count = 0, next_row = 0, total_credits = 0, earned_credits = 0;
+    int a, t;
+    float points = 0;
+    Grade *g;
+
+    if (s == NULL) return 0;
+    if (buf->text == NULL) {
+        buf->text = (char *)malloc(TRANSCRIPT_INITIAL_SIZE);
+        if (buf->text == NULL) return 0;
+        buf->capacity = TRANSCRIPT_INITIAL_SIZE;
+    }
+    buf->length = 0;
+    buf->text[0] = '\0';
+
+    for (g = s->first_grade; g != NULL; g = g->next_by_student) row_count++;
+    if (row_count > buf->row_capacity) {
+        TranscriptRow *rows = (TranscriptRow *)realloc(buf->rows, row_count * sizeof(TranscriptRow));
+        if (rows == NULL) return 0;
+        buf->rows = rows;
+        buf->row_capacity = row_count;
+    }
+    join.buf = buf;
+    join.row_count = 0;
+    join.ok = 1;
+    JoinSide courses = join_index(transcript_course_lookup);
+    JoinSide grades = join_chain(s->first_grade, offsetof(Grade, next_by_student), transcript_course_key);
+    hash_join(&grades, &courses, JOIN_LEFT_OUTER, collect_transcript_row, &join);
+    row_count = join.row_count;
+    if (row_count > 1) qsort(buf->rows, row_count, sizeof(TranscriptRow), compare_transcript_rows);
+
+    join.ok &= buffer_printf(buf, "\n================================================================================\n");
+    join.ok &= buffer_printf(buf, "                            TRANSCRIPT OF RECORDS\n");
+    join.ok &= buffer_printf(buf, "================================================================================\n");
+    join.ok &= buffer_printf(buf, "Student: %s %s (ID: %d)\n", s->first_name, s->last_name, s->id);
+    join.ok &= buffer_printf(buf, "Major:   %s\n", s->major);
+    join.ok &= buffer_printf(buf, "================================================================================\n");
+    join.ok &= buffer_printf(buf, "%-8s %-35s %-15s %-7s %-8s %s\n", "Code", "Course Name", "Semester", "Credits", "Grade", "Letter");
+    join.ok &= buffer_printf(buf, "--------------------------------------------------------------------------------\n");
+
+    int term_count = student_term_history(s, history, MAX_STUDENT_TERMS);
+    // Yalnızca sayılmayan satırları olan dönemler de listelenir; dönemler toplamlar, satırlar ve arşivlerden toplanır
+    int terms[MAX_STUDENT_TERMS + MAX_ARCHIVES];
+    int listed = 0, h = 0;
+    for (t = 0; t < term_count; t++) add_transcript_term(terms, &listed, MAX_STUDENT_TERMS + MAX_ARCHIVES, history[t].term);
+    for (t = 0; t < row_count; t++) add_transcript_term(terms, &listed, MAX_STUDENT_TERMS + MAX_ARCHIVES, buf->rows[t].grade->term);
+    for (a = 0; a < archive_count(); a++) {
+        const Grade *archived;
+        if (archive_student_grades(archive_get(a), s->id, &archived) > 0) {
+            add_transcript_term(terms, &listed, MAX_STUDENT_TERMS + MAX_ARCHIVES, semester_to_term(archive_get(a)->semester));
+        }
+    }
+    for (t = 0; t < listed; t++) {
+        TermRecord none = {terms[t], 0, 0, 0, 0.0f};
+        while (h < term_count && history[h].term < terms[t]) h++;
+        TermRecord *r = (h < term_count && history[h].term == terms[t]) ? &history[h] : &none;
+        for (a = 0; a < archive_count(); a++) {
+            const SemesterArchive *archive = archive_get(a);
+            const Grade *archived;
+            if (semester_to_term(archive->semester) != r->term) continue;
+            int count = archive_student_grades(archive, s->id, &archived);
+            JoinSide archived_side = join_array(archived, count, sizeof(Grade), transcript_course_key);
+            hash_join(&archived_side, &courses, JOIN_LEFT_OUTER, print_archived_row, &join);
+        }
+        for (; next_row < row_count && buf->rows[next_row].grade->term == r->term; next_row++) {
+            const Grade *row = buf->rows[next_row].grade;
+            const Course *c = buf->rows[next_row].course;
+            join.ok &= buffer_printf(buf, "%-8s %-35s %-15s %-7d %-8.2f %s\n",
+                                     c ? c->code : "?", c ? c->name : "?", row->semester, row->counted_credits,
+                                     row->numeric_grade, row->letter_grade);
+        }
+        total_credits += r->credits_attempted;
+        earned_credits += r->credits_earned;
+        points += r->quality_points;
+        term_to_semester(r->term, semester, sizeof(semester));
+        join.ok &= buffer_printf(buf, "   %s subtotal: %d credits, term GPA %.2f, cumulative GPA %.2f\n", semester, r->credits_attempted,
+                                 (r->credits_attempted > 0) ? r->quality_points / r->credits_attempted : 0.0f,
+                                 (total_credits > 0) ? points / total_credits : 0.0f);
+    }
+    join.ok &= buffer_printf(buf, "================================================================================\n");
+    join.ok &= buffer_printf(buf, "Total Credits: %d (earned %d)\n", total_credits, earned_credits);
+    join.ok &= buffer_printf(buf, "Cumulative GPA: %.2f / 4.00\n", s->gpa);
+    join.ok &= buffer_printf(buf, "================================================================================\n");
+    return join.ok;
+}
+
+/**
+ * Worker entry point: renders the chunk's students into one reusable buffer and writes them
+ * either to one file each or, in order, to the chunk's output file.
+ * İşçi giriş noktası: parçanın öğrencilerini tek bir yeniden kullanılan tampona yazar ve her
+ * birini ayrı bir dosyaya ya da sırayla parçanın çıktı dosyasına yazar.
+ * * @param arg - TranscriptChunk to process
+ * @param arg - İşlenecek TranscriptChunk
+ * @return Always NULL
+ * @return Her zaman NULL
+ */
+static void* transcript_worker(void *arg) {
+    TranscriptChunk *chunk = (TranscriptChunk *)arg;
+    TranscriptBuffer buf;
+    char file_path[340];
+    FILE *file = NULL;
+    long i;
+
+    transcript_buffer_init(&buf);
+    if (chunk->layout == TRANSCRIPT_SINGLE_FILE) {
+        file = fopen(chunk->path, "w");
+        if (file == NULL) {
+            chunk->failed_id = (chunk->begin < chunk->end) ? chunk->students[chunk->begin]->id : -1;
+            return NULL;
+        }
+    }
+    for (i = chunk->begin; i < chunk->end && chunk->failed_id == 0; i++) {
+        Student *s = chunk->students[i];
+        if (!render_student_transcript(s, &buf)) {
+            chunk->failed_id = s->id;
+            break;
+        }
+        if (chunk->layout == TRANSCRIPT_SINGLE_FILE) {
+            if (fwrite(buf.text, 1, buf.length, file) != buf.length) chunk->failed_id = s->id;
+        } else {
+            snprintf(file_path, sizeof(file_path), "%s/transcript_%d.txt", chunk->path, s->id);
+            FILE *out = fopen(file_path, "w");
+            if (out == NULL || fwrite(buf.text, 1, buf.length, out) != buf.length) chunk->failed_id = s->id;
+            if (out != NULL && fclose(out) != 0) chunk->failed_id = s->id;
+        }
+        if (chunk->failed_id == 0) chunk->written++;
+    }
+    if (file != NULL && fclose(file) != 0 && chunk->failed_id == 0) chunk->failed_id = -1;
+    transcript_buffer_free(&buf);
+    return NULL;
+}
+
+/**
+ * Picks the worker count: one per TRANSCRIPT_MIN_CHUNK students, capped by the online CPUs.
+ * İşçi sayısını seçer: her TRANSCRIPT_MIN_CHUNK öğrenci için bir, çevrimiçi CPU sayısıyla sınırlı.
+ * * @param students - Number of students
+ * @param students - Öğrenci sayısı
+ * @return Number of threads to use (at least 1)
+ * @return Kullanılacak iş parçacığı sayısı (en az 1)
+ */
+static int transcript_thread_count(long students) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    long threads = students / TRANSCRIPT_MIN_CHUNK;
+    if (cpus < 1) cpus = 1;
+    if (threads > cpus) threads = cpus;
+    if (threads > TRANSCRIPT_MAX_THREADS) threads = TRANSCRIPT_MAX_THREADS;
+    return threads < 1 ? 1 : (int)threads;
+}
+
+/**
+ * Appends a chunk's part file to the combined output.
+ * Bir parçanın ara dosyasını birleşik çıktıya ekler.
+ * * @return 1 if copied, 0 otherwise
+ * @return Kopyalandıysa 1, aksi takdirde 0 döner
+ */
+static int append_part(FILE *out, const char *part_path) {
+    char block[TRANSCRIPT_COPY_SIZE];
+    size_t n;
+    int ok = 1;
+    FILE *part = fopen(part_path, "r");
+    if (part == NULL) return 0;
+    while ((n = fread(block, 1, sizeof(block), part)) > 0) {
+        if (fwrite(block, 1, n, out) != n) {
+            ok = 0;
+            break;
+        }
+    }
+    if (ferror(part)) ok = 0;
+    fclose(part);
+    return ok;
+}
+
+/**
+ * Writes the transcripts of all students on a pool of worker threads. The list is split into
+ * contiguous chunks; each worker renders its students into its own reusable buffer. With one file
+ * per student the workers write straight into the directory; for a single file each worker writes
+ * a part file and the parts are joined in list order. Must not run while another thread modifies the data.
+ * Tüm öğrencilerin transkriptlerini bir işçi iş parçacığı havuzunda yazar. Liste ardışık parçalara
+ * bölünür; her işçi öğrencilerini kendi yeniden kullanılan tamponuna yazar. Öğrenci başına dosyada
+ * işçiler doğrudan dizine yazar; tek dosyada her işçi bir ara dosya yazar ve parçalar liste sırasıyla
+ * birleştirilir. Veriyi değiştiren başka bir iş parçacığı varken çalıştırılmamalıdır.
+ * * @param head - Head of the student list
+ * @param head - Öğrenci listesinin başı
+ * @param layout - One file per student or a single concatenated file
+ * @param layout - Öğrenci başına bir dosya veya tek birleşik dosya
+ * @param path - Output directory (per student) or output file (single file)
+ * @param path - Çıktı dizini (öğrenci başına) veya çıktı dosyası (tek dosya)
+ * @param threads_used - Receives the number of worker threads (may be NULL)
+ * @param threads_used - Kullanılan işçi iş parçacığı sayısını alır (NULL olabilir)
+ * @return Number of transcripts written, or -1 on failure
+ * @return Yazılan transkript sayısı, hata durumunda -1
+ */
+long generate_transcripts(Student *head, TranscriptLayout layout, const char *path, int *threads_used) {
+    TranscriptChunk chunks[TRANSCRIPT_MAX_THREADS];
+    pthread_t threads[TRANSCRIPT_MAX_THREADS];
+    int started[TRANSCRIPT_MAX_THREADS];
+    long rows = 0, i, written = 0;
+    int t, failed_id = 0;
+    Student *s;
+
+    if (threads_used != NULL) *threads_used = 0;
+    if (layout == TRANSCRIPT_PER_STUDENT && mkdir(path, 0755) != 0 && errno != EEXIST) {
+        printf("Error: Could not create %s!\n", path);
+        return -1;
+    }
+    for (s = head; s != NULL; s = s->next) rows++;
+    Student **students = (Student **)malloc((rows > 0 ? rows : 1) * sizeof(Student *));
+    if (students == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return -1;
+    }
+    for (s = head, i = 0; s != NULL; s = s->next) students[i++] = s;
+
+    int count = transcript_thread_count(rows);
+    for (t = 0; t < count; t++) {
+        memset(&chunks[t], 0, sizeof(TranscriptChunk));
+        chunks[t].students = students;
+        chunks[t].begin = rows * t / count;
+        chunks[t].end = rows * (t + 1) / count;
+        chunks[t].layout = layout;
+        if (layout == TRANSCRIPT_SINGLE_FILE && count > 1) {
+            snprintf(chunks[t].path, sizeof(chunks[t].path), "%s.part%d", path, t);
+        } else {
+            snprintf(chunks[t].path, sizeof(chunks[t].path), "%s", path);
+        }
+        started[t] = (count > 1 && pthread_create(&threads[t], NULL, transcript_worker, &chunks[t]) == 0);
+        if (!started[t]) transcript_worker(&chunks[t]);
+    }
+    for (t = 0; t < count; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+        written += chunks[t].written;
+        if (failed_id == 0) failed_id = chunks[t].failed_id;
+    }
+    free(students);
+
+    if (layout == TRANSCRIPT_SINGLE_FILE && count > 1) {
+        FILE *out = (failed_id == 0) ? fopen(path, "w") : NULL;
+        if (out == NULL && failed_id == 0) failed_id = -1;
+        for (t = 0; t < count; t++) {
+            if (out != NULL && !append_part(out, chunks[t].path)) failed_id = -1;
+            remove(chunks[t].path);
+        }
+        if (out != NULL && fclose(out) != 0) failed_id = -1;
+    }
+    if (threads_used != NULL) *threads_used = count;
+
+    if (failed_id > 0) {
+        printf("Error: Could not write the transcript of student %d under %s!\n", failed_id, path);
+        return -1;
+    }
+    if (failed_id != 0) {
+        printf("Error: Could not write %s!\n", path);
+        return -1;
+    }
+    printf("Success: Wrote %ld transcripts to %s using %d thread(s).\n", written, path, count);
+    return written;
+}
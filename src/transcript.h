@@ -0,0 +1,46 @@
+// transcript.h - Toplu Transkript Modülü (İş Parçacığı Havuzu)
+
+#ifndef TRANSCRIPT_H
+#define TRANSCRIPT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "student.h"
+#include "grade.h"
+#include "course.h"
+
+#define TRANSCRIPT_DIR "data/transcripts"
+#define TRANSCRIPT_BATCH_FILE "data/transcripts.txt"
+#define TRANSCRIPT_MAX_THREADS 8
+#define TRANSCRIPT_MIN_CHUNK 256     // Students per worker before another thread is worth starting
+
+// One transcript line: a grade joined with its course (NULL if the course was deleted)
+// Bir transkript satırı: dersiyle birleştirilmiş bir not (ders silindiyse NULL)
+typedef struct TranscriptRow {
+    const Grade *grade;
+    const Course *course;
+} TranscriptRow;
+
+// Reusable render target: the text of one transcript plus scratch space for its rows
+// Yeniden kullanılabilir çıktı alanı: bir transkriptin metni ve satırları için çalışma alanı
+typedef struct TranscriptBuffer {
+    char *text;
+    size_t length;
+    size_t capacity;
+    TranscriptRow *rows;
+    int row_capacity;
+} TranscriptBuffer;
+
+// How a batch run lays out its output
+// Toplu çalıştırmanın çıktıyı nasıl düzenlediği
+typedef enum TranscriptLayout {
+    TRANSCRIPT_PER_STUDENT = 0,    // <dir>/transcript_<id>.txt
+    TRANSCRIPT_SINGLE_FILE         // All transcripts concatenated in list order
+} TranscriptLayout;
+
+void transcript_buffer_init(TranscriptBuffer *buf);
+void transcript_buffer_free(TranscriptBuffer *buf);
+int render_student_transcript(const Student *s, TranscriptBuffer *buf);
+long generate_transcripts(Student *head, TranscriptLayout layout, const char *path, int *threads_used);
+
+#endif
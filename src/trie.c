@@ -0,0 +1,234 @@
+// trie.c - Önek Arama Ağacı (Trie) Modülü
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trie.h"
+
+/**
+ * Finds the child of a node holding the given character, optionally creating it.
+ * Children are kept sorted so that prefix results come out in alphabetical order.
+ * Bir düğümün verilen karakteri taşıyan çocuğunu bulur, istenirse oluşturur.
+ * Çocuklar sıralı tutulur, böylece önek sonuçları alfabetik sırayla döner.
+ * * @param parent - Parent node
+ * @param parent - Ebeveyn düğüm
+ * @param ch - Character to look for
+ * @param ch - Aranan karakter
+ * @param create - 1 to create a missing child, 0 to only search
+ * @param create - Eksik çocuğu oluşturmak için 1, sadece aramak için 0
+ * @return Child node or NULL
+ * @return Çocuk düğüm veya NULL
+ */
+static TrieNode* trie_child(TrieNode *parent, char ch, int create) {
+    TrieNode *current = parent->child;
+    TrieNode *prev = NULL;
+
+    while (current != NULL && (unsigned char)current->ch < (unsigned char)ch) {
+        prev = current;
+        current = current->sibling;
+    }
+    if (current != NULL && current->ch == ch) return current;
+    if (!create) return NULL;
+
+    TrieNode *node = (TrieNode *)calloc(1, sizeof(TrieNode));
+    if (node == NULL) return NULL;
+    node->ch = ch;
+    node->sibling = current;
+    if (prev == NULL) parent->child = node;
+    else prev->sibling = node;
+    return node;
+}
+
+/**
+ * Walks the trie along a key.
+ * Trie üzerinde bir anahtar boyunca ilerler.
+ * * @param trie - Trie to walk
+ * @param trie - Üzerinde ilerlenecek trie
+ * @param key - Already folded key
+ * @param key - Önceden normalize edilmiş anahtar
+ * @param create - 1 to create missing nodes along the way
+ * @param create - Yol üzerindeki eksik düğümleri oluşturmak için 1
+ * @return Node reached at the end of the key or NULL
+ * @return Anahtarın sonunda ulaşılan düğüm veya NULL
+ */
+static TrieNode* trie_walk(Trie *trie, const char *key, int create) {
+    if (trie->root == NULL) {
+        if (!create) return NULL;
+        trie->root = (TrieNode *)calloc(1, sizeof(TrieNode));
+        if (trie->root == NULL) return NULL;
+    }
+
+    TrieNode *node = trie->root;
+    while (*key != '\0' && node != NULL) {
+        node = trie_child(node, *key, create);
+        key++;
+    }
+    return node;
+}
+
+/**
+ * Stores a value under a key. The same value may be stored under several keys.
+ * Bir değeri anahtar altında saklar. Aynı değer birden fazla anahtar altında saklanabilir.
+ * * @param trie - Target trie
+ * @param trie - Hedef trie
+ * @param key - Folded key (empty keys are ignored)
+ * @param key - Normalize edilmiş anahtar (boş anahtarlar yok sayılır)
+ * @param value - Record pointer
+ * @param value - Kayıt pointer'ı
+ * @return 1 if successful, 0 otherwise
+ * @return Başarılıysa 1, aksi halde 0 döner
+ */
+int trie_insert(Trie *trie, const char *key, void *value) {
+    if (key == NULL || *key == '\0') return 0;
+
+    TrieNode *node = trie_walk(trie, key, 1);
+    if (node == NULL) return 0;
+
+    TrieValue *entry = (TrieValue *)malloc(sizeof(TrieValue));
+    if (entry == NULL) return 0;
+    entry->value = value;
+    entry->next = node->values;
+    node->values = entry;
+    trie->size++;
+    return 1;
+}
+
+/**
+ * Removes one occurrence of a value stored under a key.
+ * Bir anahtar altında saklanan değerin bir örneğini siler.
+ * * @param trie - Target trie
+ * @param trie - Hedef trie
+ * @param key - Folded key used at insert time
+ * @param key - Ekleme sırasında kullanılan normalize anahtar
+ * @param value - Record pointer to remove
+ * @param value - Silinecek kayıt pointer'ı
+ * @return 1 if removed, 0 if not found
+ * @return Silindiyse 1, bulunamadıysa 0 döner
+ */
+int trie_remove(Trie *trie, const char *key, void *value) {
+    if (key == NULL || *key == '\0') return 0;
+
+    TrieNode *node = trie_walk(trie, key, 0);
+    if (node == NULL) return 0;
+
+    TrieValue *current = node->values;
+    TrieValue *prev = NULL;
+    while (current != NULL) {
+        if (current->value == value) {
+            if (prev == NULL) node->values = current->next;
+            else prev->next = current->next;
+            free(current);
+            trie->size--;
+            return 1;
+        }
+        prev = current;
+        current = current->next;
+    }
+    return 0;
+}
+
+/**
+ * Appends the values stored on a single node, skipping ones already collected.
+ * Tek bir düğümde saklanan değerleri, daha önce toplananları atlayarak ekler.
+ * * @param node - Node whose values are appended
+ * @param node - Değerleri eklenecek düğüm
+ * @param results - Output array
+ * @param results - Çıktı dizisi
+ * @param count - Number of values already collected
+ * @param count - Şimdiye kadar toplanan değer sayısı
+ * @param max_results - Capacity of the output array
+ * @param max_results - Çıktı dizisinin kapasitesi
+ * @return Updated count
+ * @return Güncellenmiş sayı
+ */
+static int trie_append_values(TrieNode *node, void **results, int count, int max_results) {
+    TrieValue *v;
+    for (v = node->values; v != NULL && count < max_results; v = v->next) {
+        int i, seen = 0;
+        for (i = 0; i < count; i++) {
+            if (results[i] == v->value) { seen = 1; break; }
+        }
+        if (!seen) results[count++] = v->value;
+    }
+    return count;
+}
+
+/**
+ * Depth-first collection of distinct values below a node.
+ * Bir düğümün altındaki farklı değerleri derinlik öncelikli olarak toplar.
+ * * @param node - First child of the subtree
+ * @param node - Alt ağacın ilk çocuğu
+ * @param results - Output array
+ * @param results - Çıktı dizisi
+ * @param count - Number of values already collected
+ * @param count - Şimdiye kadar toplanan değer sayısı
+ * @param max_results - Capacity of the output array
+ * @param max_results - Çıktı dizisinin kapasitesi
+ * @return Updated count
+ * @return Güncellenmiş sayı
+ */
+static int trie_collect(TrieNode *node, void **results, int count, int max_results) {
+    while (node != NULL && count < max_results) {
+        count = trie_append_values(node, results, count, max_results);
+        count = trie_collect(node->child, results, count, max_results);
+        node = node->sibling;
+    }
+    return count;
+}
+
+/**
+ * Returns the distinct values whose key starts with the given prefix.
+ * Anahtarı verilen önekle başlayan farklı değerleri döndürür.
+ * * @param trie - Trie to search
+ * @param trie - Aranacak trie
+ * @param prefix - Folded prefix
+ * @param prefix - Normalize edilmiş önek
+ * @param results - Output array
+ * @param results - Çıktı dizisi
+ * @param max_results - Capacity of the output array
+ * @param max_results - Çıktı dizisinin kapasitesi
+ * @return Number of values written to results
+ * @return Sonuç dizisine yazılan değer sayısı
+ */
+int trie_collect_prefix(Trie *trie, const char *prefix, void **results, int max_results) {
+    if (prefix == NULL || *prefix == '\0') return 0;
+
+    TrieNode *node = trie_walk(trie, prefix, 0);
+    if (node == NULL) return 0;
+
+    int count = trie_append_values(node, results, 0, max_results);
+    return trie_collect(node->child, results, count, max_results);
+}
+
+/**
+ * Recursively frees a subtree and its stored values.
+ * Bir alt ağacı ve saklanan değerleri özyinelemeli olarak serbest bırakır.
+ * * @param node - Subtree root
+ * @param node - Alt ağacın kökü
+ */
+static void trie_free_node(TrieNode *node) {
+    while (node != NULL) {
+        TrieNode *sibling = node->sibling;
+        TrieValue *v = node->values;
+        while (v != NULL) {
+            TrieValue *temp = v;
+            v = v->next;
+            free(temp);
+        }
+        trie_free_node(node->child);
+        free(node);
+        node = sibling;
+    }
+}
+
+/**
+ * Frees every node of the trie.
+ * Trie'nin tüm düğümlerini serbest bırakır.
+ * * @param trie - Trie to clear
+ * @param trie - Temizlenecek trie
+ */
+void trie_clear(Trie *trie) {
+    trie_free_node(trie->root);
+    trie->root = NULL;
+    trie->size = 0;
+}
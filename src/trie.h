@@ -0,0 +1,31 @@
+// trie.h - Önek Arama Ağacı (Trie) Modülü
+
+#ifndef TRIE_H
+#define TRIE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct TrieValue {
+    void *value;
+    struct TrieValue *next;
+} TrieValue;
+
+typedef struct TrieNode {
+    char ch;
+    struct TrieNode *child;
+    struct TrieNode *sibling;
+    TrieValue *values;
+} TrieNode;
+
+typedef struct Trie {
+    TrieNode *root;
+    int size;
+} Trie;
+
+int trie_insert(Trie *trie, const char *key, void *value);
+int trie_remove(Trie *trie, const char *key, void *value);
+int trie_collect_prefix(Trie *trie, const char *prefix, void **results, int max_results);
+void trie_clear(Trie *trie);
+
+#endif
@@ -1,264 +1,530 @@
-// utils.c - Yardmc Fonksiyonlar (FINAL VERSION)
-#include <stdio.h>
-#include <string.h>
-#include <ctype.h>
-#include "utils.h"
-#include <stdlib.h>
-#include <time.h>
-
-/**
- * Sanitizes input string by replacing Turkish characters with ASCII equivalents.
- * Girdi dizisindeki Trke karakterleri ASCII karlklaryla deitirerek temizler.
- * @param str - The string to be sanitized / Temizlenecek dizgi
- */
-static void sanitize_input(char *str) {
-	if (str == NULL) return;
-    int i;
-	for ( i = 0; str[i] != '\0'; i++) {
-        switch (str[i]) {
-            case '': str[i] = 's'; break;
-            case '': str[i] = 'S'; break;
-            case '': str[i] = 'i'; break;
-            case '': str[i] = 'I'; break;
-            case '': str[i] = 'g'; break;
-            case '': str[i] = 'G'; break;
-            case '': str[i] = 'u'; break;
-            case '': str[i] = 'U'; break;
-            case '': str[i] = 'o'; break;
-            case '': str[i] = 'O'; break;
-            case '': str[i] = 'c'; break;
-            case '': str[i] = 'C'; break;
-        }
-    }
-}
-
-/**
- * Removes newline and carriage return characters from the end of a string.
- * Bir dizginin sonundaki satr ba ve yeni satr karakterlerini kaldrr.
- * @param str - Target string / Hedef dizgi
- */
-void remove_newline(char *str) {
-    if (str == NULL) return;
-    size_t len = strlen(str);
-    if (len > 0 && str[len - 1] == '\n') {
-        str[len - 1] = '\0';
-    }
-    if (len > 1 && str[len - 2] == '\r') {
-        str[len - 2] = '\0';
-    }
-}
-
-/**
- * Splits a CSV line into tokens using comma as a delimiter.
- * Bir CSV satrn virgl ayrac kullanarak paralara (token) ayrr.
- * @param line - The raw CSV line / Ham CSV satr
- * @param tokens - Array to store split tokens / Paralarn saklanaca dizi
- * @param max_tokens - Maximum number of tokens allowed / zin verilen maks. para says
- * @return Number of tokens found / Bulunan para says
- */
-int split_csv_line(char *line, char *tokens[], int max_tokens) {
-    int count = 0;
-    char *token = strtok(line, ",");
-    while (token != NULL && count < max_tokens) {
-        tokens[count++] = token;
-        token = strtok(NULL, ",");
-    }
-    return count;
-}
-
-/**
- * Removes leading and trailing whitespace from a string.
- * Bir dizginin bandaki ve sonundaki boluklar temizler.
- * @param str - The string to be trimmed / Temizlenecek dizgi
- */
-void trim_whitespace(char *str) {
-    if (str == NULL) return;
-    char *start = str;
-    while (*start && isspace(*start)) start++;
-    char *end = str + strlen(str) - 1;
-    while (end > start && isspace(*end)) end--;
-    size_t len = end - start + 1;
-    memmove(str, start, len);
-    str[len] = '\0';
-}
-
-/**
- * Validates if a string contains only numeric characters.
- * Bir dizginin sadece saysal karakterler ierip iermediini dorular.
- * @param str - The string to check / Kontrol edilecek dizgi
- * @return 1 if numeric, 0 otherwise / Saysalsa 1, aksi halde 0 dner
- */
-int is_numeric(const char *str) {
-    if (str == NULL || *str == '\0') return 0;
-    if (*str == '-' || *str == '+') str++;
-    while (*str) {
-        if (!isdigit(*str)) return 0;
-        str++;
-    }
-    return 1;
-}
-
-/**
- * Validates the format of an email address.
- * Bir e-posta adresinin formatn dorular.
- * @param email - Email string / E-posta dizgisi
- * @return 1 if valid, 0 otherwise / Geerliyse 1, aksi halde 0 dner
- */
-int validate_email(const char *email) {
-    if (email == NULL || strlen(email) < 5) return 0;
-    const char *at = strchr(email, '@');
-    if (at == NULL) return 0;
-    const char *dot = strchr(at, '.');
-    if (dot == NULL || dot <= at + 1) return 0;
-    if (at == email) return 0;
-    return 1;
-}
-
-/**
- * Ensures a phone number contains at least 7 digits.
- * Bir telefon numarasnn en az 7 rakam ierdiinden emin olur.
- * @param phone - Phone number string / Telefon numaras dizgisi
- * @return 1 if valid, 0 otherwise / Geerliyse 1, aksi halde 0 dner
- */
-int validate_phone(const char *phone) {
-    if (phone == NULL || strlen(phone) < 7) return 0;
-    int i, digit_count = 0;
-    for (i = 0; phone[i] != '\0'; i++) {
-        if (isdigit(phone[i])) digit_count++;
-    }
-    return digit_count >= 7;
-}
-
-/**
- * Checks if a GPA value is within the 0.0 to 4.0 range.
- * Bir GPA deerinin 0.0 ile 4.0 aralnda olup olmadn kontrol eder.
- * @param gpa - Floating point GPA value / Ondalkl GPA deeri
- * @return 1 if in range, 0 otherwise / Aralktaysa 1, aksi halde 0 dner
- */
-int validate_gpa(float gpa) {
-    return (gpa >= 0.0 && gpa <= 4.0);
-}
-
-/**
- * Validates if an integer is greater than zero.
- * Bir tam saynn sfrdan byk olduunu dorular.
- * @param value - Integer value / Tam say deeri
- * @return 1 if positive, 0 otherwise / Pozitifse 1, aksi halde 0 dner
- */
-int validate_positive_int(int value) {
-    return (value > 0);
-}
-
-/**
- * Ensures a year value is within a logical range (1900-2100).
- * Bir yl deerinin mantkl bir aralkta (1900-2100) olmasn salar.
- * @param year - Year value / Yl deeri
- * @return 1 if in range, 0 otherwise / Aralktaysa 1, aksi halde 0 dner
- */
-int validate_year(int year) {
-    return (year >= 1900 && year <= 2100);
-}
-
-/**
- * Safely reads a string from user input, cleans it, and handles Turkish characters.
- * Kullancdan gvenli bir ekilde dizgi alr, temizler ve Trke karakterleri iler.
- * @param prompt - Text to display to user / Kullancya gsterilecek metin
- * @param buffer - Storage for input string / Girdi dizgisinin saklanaca yer
- * @param max_len - Maximum buffer length / Maksimum tampon uzunluu
- */
-void get_string_input(const char *prompt, char *buffer, int max_len) {
-   if (prompt != NULL && strlen(prompt) > 0) printf("%s", prompt);
-    if (fgets(buffer, max_len, stdin) == NULL) {
-        buffer[0] = '\0';
-        return;
-    }
-    size_t len = strlen(buffer);
-    if (len > 0 && buffer[len - 1] == '\n') buffer[len - 1] = '\0';
-    sanitize_input(buffer);
-    trim_whitespace(buffer);
-}
-
-/**
- * Reads an integer from user input with error checking and numeric validation.
- * Hata kontrol ve saysal dorulama ile kullancdan bir tam say okur.
- * @param prompt - Instruction for the user / Kullanc iin talimat
- * @return Validated integer value / Dorulanm tam say deeri
- */
-int get_int_input(const char *prompt) {
-    int value;
-    char input[50];
-    while (1) {
-        if (strlen(prompt) > 0) printf("%s", prompt);
-        if (fgets(input, sizeof(input), stdin) == NULL) continue;
-        remove_newline(input);
-        trim_whitespace(input);
-        if (strlen(input) == 0) continue;
-        if (is_numeric(input)) {
-            value = atoi(input);
-            return value;
-        } else printf("Error: Please enter a valid number!\n");
-    }
-}
-
-/**
- * Reads a float from user input and handles parsing errors.
- * Kullancdan bir ondalkl say okur ve ayrtrma hatalarn iler.
- * @param prompt - Instruction for the user / Kullanc iin talimat
- * @return Validated float value / Dorulanm ondalkl say deeri
- */
-float get_float_input(const char *prompt) {
-    float value;
-    char input[50];
-    while (1) {
-        if (strlen(prompt) > 0) printf("%s", prompt);
-        if (fgets(input, sizeof(input), stdin) == NULL) continue;
-        remove_newline(input);
-        trim_whitespace(input);
-        if (strlen(input) == 0) continue;
-        if (sscanf(input, "%f", &value) == 1) return value;
-        else printf("Error: Please enter a valid number!\n");
-    }
-}
-
-/**
- * Prompts user for an ID and ensures it is a positive integer.
- * Kullancdan bir ID ister ve bunun pozitif bir tam say olmasn salar.
- * @param prompt - Message for the user / Kullanc mesaj
- * @return Validated positive ID / Dorulanm pozitif ID
- */
-int get_validated_id(const char *prompt) {
-    int id;
-    do {
-        id = get_int_input(prompt);
-        if (!validate_positive_int(id)) printf("Error: ID must be a positive number!\n");
-    } while (!validate_positive_int(id));
-    return id;
-}
-
-/**
- * Retrieves the current system date in YYYY-MM-DD format.
- * Mevcut sistem tarihini YYYY-MM-DD formatnda alr.
- * @param buffer - Storage for the date string / Tarih dizgisinin saklanaca yer
- */
-void get_current_date(char *buffer) {
-    time_t t = time(NULL);
-    struct tm *tm_info = localtime(&t);
-    strftime(buffer, 20, "%Y-%m-%d", tm_info);
-}
-
-/**
- * Validates if a date string follows the YYYY-MM-DD format.
- * Bir tarih dizgisinin YYYY-MM-DD formatna uyup uymadn dorular.
- * @param date - Date string to check / Kontrol edilecek tarih dizgisi
- * @return 1 if format is valid, 0 otherwise / Format geerliyse 1, aksi halde 0 dner
- */
-int validate_date(const char *date) {
-    if (strlen(date) != 10) return 0;
-    if (date[4] != '-' || date[7] != '-') return 0;
-    int i;
-    for (i = 0; i < 10; i++) {
-        if (i == 4 || i == 7) continue;
-        if (!isdigit(date[i])) return 0;
-    }
-    return 1;
-}
+// utils.c - Yardımcı Fonksiyonlar (FINAL VERSION)
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include "utils.h"
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * Sanitizes input string by replacing Turkish characters with ASCII equivalents.
+ * Girdi dizisindeki Türkçe karakterleri ASCII karşılıklarıyla değiştirerek temizler.
+ * @param str - The string to be sanitized / Temizlenecek dizgi
+ */
+static void sanitize_input(char *str) {
+	if (str == NULL) return;
+    int i;
+	for ( i = 0; str[i] != '\0'; i++) {
+        switch (str[i]) {
+            case 'ş': str[i] = 's'; break;
+            case 'Ş': str[i] = 'S'; break;
+            case 'ı': str[i] = 'i'; break;
+            case 'İ': str[i] = 'I'; break;
+            case 'ğ': str[i] = 'g'; break;
+            case 'Ğ': str[i] = 'G'; break;
+            case 'ü': str[i] = 'u'; break;
+            case 'Ü': str[i] = 'U'; break;
+            case 'ö': str[i] = 'o'; break;
+            case 'Ö': str[i] = 'O'; break;
+            case 'ç': str[i] = 'c'; break;
+            case 'Ç': str[i] = 'C'; break;
+        }
+    }
+}
+
+/**
+ * Maps a single accented Latin character code (0xC0-0xFF range) to its lowercase ASCII base letter.
+ * Tek bir aksanlı Latin karakter kodunu (0xC0-0xFF aralığı) küçük ASCII temel harfine dönüştürür.
+ * @param c - Character code / Karakter kodu
+ * @param latin5 - 1 if the code comes from ISO-8859-9 (Turkish) input / Kod ISO-8859-9 girdiden geliyorsa 1
+ * @return ASCII letter or 0 if there is no sensible equivalent / ASCII harf, karşılığı yoksa 0
+ */
+static char fold_latin_char(unsigned char c, int latin5) {
+    if (latin5) {
+        switch (c) {
+            case 0xD0: case 0xF0: return 'g';
+            case 0xDD: case 0xFD: return 'i';
+            case 0xDE: case 0xFE: return 's';
+        }
+    }
+    if (c >= 0xE0) c -= 0x20;
+    if (c <= 0xC5) return 'a';
+    if (c == 0xC7) return 'c';
+    if (c >= 0xC8 && c <= 0xCB) return 'e';
+    if (c >= 0xCC && c <= 0xCF) return 'i';
+    if (c == 0xD1) return 'n';
+    if (c >= 0xD2 && c <= 0xD6) return 'o';
+    if (c >= 0xD9 && c <= 0xDC) return 'u';
+    return 0;
+}
+
+/**
+ * Folds text into a search key: lowercase ASCII with Turkish and other diacritics removed.
+ * Accepts both UTF-8 (as stored in the CSV files) and ISO-8859-9 (as typed on Turkish consoles).
+ * Metni arama anahtarına dönüştürür: Türkçe ve diğer aksanlardan arındırılmış küçük ASCII.
+ * Hem UTF-8 (CSV dosyalarındaki gibi) hem de ISO-8859-9 (Türkçe konsollardaki gibi) girdiyi kabul eder.
+ * @param src - Source text / Kaynak metin
+ * @param dest - Buffer to store the folded key / Dönüştürülmüş anahtarın saklanacağı alan
+ * @param max_len - Size of the destination buffer / Hedef alanın boyutu
+ */
+void fold_search_text(const char *src, char *dest, int max_len) {
+    const unsigned char *p = (const unsigned char *)(src ? src : "");
+    int n = 0;
+
+    while (*p == ' ' || *p == '\t') p++;
+    while (*p != '\0' && n < max_len - 1) {
+        char out = 0;
+        if (*p < 0x80) {
+            out = (char)tolower(*p);
+            p++;
+        } else if (*p == 0xC3 && p[1] >= 0x80 && p[1] <= 0xBF) {
+            out = fold_latin_char((unsigned char)(p[1] + 0x40), 0);
+            p += 2;
+        } else if ((*p == 0xC4 || *p == 0xC5) && p[1] >= 0x80 && p[1] <= 0xBF) {
+            // ğ/Ğ = C4 9E/9F, ı/İ = C4 B0/B1, ş/Ş = C5 9E/9F
+            if (*p == 0xC4 && (p[1] == 0x9E || p[1] == 0x9F)) out = 'g';
+            else if (*p == 0xC4 && (p[1] == 0xB0 || p[1] == 0xB1)) out = 'i';
+            else if (*p == 0xC5 && (p[1] == 0x9E || p[1] == 0x9F)) out = 's';
+            p += 2;
+        } else if (*p >= 0xC0 && p[1] >= 0x80 && p[1] <= 0xBF) {
+            // Other UTF-8 sequences have no ASCII equivalent; skip them whole
+            p++;
+            while (*p >= 0x80 && *p <= 0xBF) p++;
+        } else if (*p >= 0xC0) {
+            out = fold_latin_char(*p, 1);
+            p++;
+        } else {
+            p++;
+        }
+        if (out != 0) dest[n++] = out;
+    }
+    while (n > 0 && dest[n - 1] == ' ') n--;
+    dest[n] = '\0';
+}
+
+/**
+ * Removes newline and carriage return characters from the end of a string.
+ * Bir dizginin sonundaki satır başı ve yeni satır karakterlerini kaldırır.
+ * @param str - Target string / Hedef dizgi
+ */
+void remove_newline(char *str) {
+    if (str == NULL) return;
+    size_t len = strlen(str);
+    if (len > 0 && str[len - 1] == '\n') {
+        str[len - 1] = '\0';
+    }
+    if (len > 1 && str[len - 2] == '\r') {
+        str[len - 2] = '\0';
+    }
+}
+
+/**
+ * Splits a CSV line into tokens using comma as a delimiter.
+ * Bir CSV satırını virgül ayıracı kullanarak parçalara (token) ayırır.
+ * @param line - The raw CSV line / Ham CSV satırı
+ * @param tokens - Array to store split tokens / Parçaların saklanacağı dizi
+ * @param max_tokens - Maximum number of tokens allowed / İzin verilen maks. parça sayısı
+ * @return Number of tokens found / Bulunan parça sayısı
+ */
+int split_csv_line(char *line, char *tokens[], int max_tokens) {
+    int count = 0;
+    char *token = strtok(line, ",");
+    while (token != NULL && count < max_tokens) {
+        tokens[count++] = token;
+        token = strtok(NULL, ",");
+    }
+    return count;
+}
+
+/**
+ * Removes leading and trailing whitespace from a string.
+ * Bir dizginin başındaki ve sonundaki boşlukları temizler.
+ * @param str - The string to be trimmed / Temizlenecek dizgi
+ */
+void trim_whitespace(char *str) {
+    if (str == NULL) return;
+    char *start = str;
+    while (*start && isspace(*start)) start++;
+    char *end = str + strlen(str) - 1;
+    while (end > start && isspace(*end)) end--;
+    size_t len = end - start + 1;
+    memmove(str, start, len);
+    str[len] = '\0';
+}
+
+/**
+ * Validates if a string contains only numeric characters.
+ * Bir dizginin sadece sayısal karakterler içerip içermediğini doğrular.
+ * @param str - The string to check / Kontrol edilecek dizgi
+ * @return 1 if numeric, 0 otherwise / Sayısalsa 1, aksi halde 0 döner
+ */
+int is_numeric(const char *str) {
+    if (str == NULL || *str == '\0') return 0;
+    if (*str == '-' || *str == '+') str++;
+    while (*str) {
+        if (!isdigit(*str)) return 0;
+        str++;
+    }
+    return 1;
+}
+
+/**
+ * Validates the format of an email address.
+ * Bir e-posta adresinin formatını doğrular.
+ * @param email - Email string / E-posta dizgisi
+ * @return 1 if valid, 0 otherwise / Geçerliyse 1, aksi halde 0 döner
+ */
+int validate_email(const char *email) {
+    if (email == NULL || strlen(email) < 5) return 0;
+    const char *at = strchr(email, '@');
+    if (at == NULL) return 0;
+    const char *dot = strchr(at, '.');
+    if (dot == NULL || dot <= at + 1) return 0;
+    if (at == email) return 0;
+    return 1;
+}
+
+/**
+ * Ensures a phone number contains at least 7 digits.
+ * Bir telefon numarasının en az 7 rakam içerdiğinden emin olur.
+ * @param phone - Phone number string / Telefon numarası dizgisi
+ * @return 1 if valid, 0 otherwise / Geçerliyse 1, aksi halde 0 döner
+ */
+int validate_phone(const char *phone) {
+    if (phone == NULL || strlen(phone) < 7) return 0;
+    int i, digit_count = 0;
+    for (i = 0; phone[i] != '\0'; i++) {
+        if (isdigit(phone[i])) digit_count++;
+    }
+    return digit_count >= 7;
+}
+
+/**
+ * Checks if a GPA value is within the 0.0 to 4.0 range.
+ * Bir GPA değerinin 0.0 ile 4.0 aralığında olup olmadığını kontrol eder.
+ * @param gpa - Floating point GPA value / Ondalıklı GPA değeri
+ * @return 1 if in range, 0 otherwise / Aralıktaysa 1, aksi halde 0 döner
+ */
+int validate_gpa(float gpa) {
+    return (gpa >= 0.0 && gpa <= 4.0);
+}
+
+/**
+ * Validates if an integer is greater than zero.
+ * Bir tam sayının sıfırdan büyük olduğunu doğrular.
+ * @param value - Integer value / Tam sayı değeri
+ * @return 1 if positive, 0 otherwise / Pozitifse 1, aksi halde 0 döner
+ */
+int validate_positive_int(int value) {
+    return (value > 0);
+}
+
+/**
+ * Ensures a year value is within a logical range (1900-2100).
+ * Bir yıl değerinin mantıklı bir aralıkta (1900-2100) olmasını sağlar.
+ * @param year - Year value / Yıl değeri
+ * @return 1 if in range, 0 otherwise / Aralıktaysa 1, aksi halde 0 döner
+ */
+int validate_year(int year) {
+    return (year >= 1900 && year <= 2100);
+}
+
+/**
+ * Safely reads a string from user input, cleans it, and handles Turkish characters.
+ * Kullanıcıdan güvenli bir şekilde dizgi alır, temizler ve Türkçe karakterleri işler.
+ * @param prompt - Text to display to user / Kullanıcıya gösterilecek metin
+ * @param buffer - Storage for input string / Girdi dizgisinin saklanacağı yer
+ * @param max_len - Maximum buffer length / Maksimum tampon uzunluğu
+ */
+void get_string_input(const char *prompt, char *buffer, int max_len) {
+   if (prompt != NULL && strlen(prompt) > 0) printf("%s", prompt);
+    if (fgets(buffer, max_len, stdin) == NULL) {
+        buffer[0] = '\0';
+        return;
+    }
+    size_t len = strlen(buffer);
+    if (len > 0 && buffer[len - 1] == '\n') buffer[len - 1] = '\0';
+    sanitize_input(buffer);
+    trim_whitespace(buffer);
+}
+
+/**
+ * Reads an integer from user input with error checking and numeric validation.
+ * Hata kontrolü ve sayısal doğrulama ile kullanıcıdan bir tam sayı okur.
+ * @param prompt - Instruction for the user / Kullanıcı için talimat
+ * @return Validated integer value / Doğrulanmış tam sayı değeri
+ */
+int get_int_input(const char *prompt) {
+    int value;
+    char input[50];
+    while (1) {
+        if (strlen(prompt) > 0) printf("%s", prompt);
+        if (fgets(input, sizeof(input), stdin) == NULL) continue;
+        remove_newline(input);
+        trim_whitespace(input);
+        if (strlen(input) == 0) continue;
+        if (is_numeric(input)) {
+            value = atoi(input);
+            return value;
+        } else printf("Error: Please enter a valid number!\n");
+    }
+}
+
+/**
+ * Reads a float from user input and handles parsing errors.
+ * Kullanıcıdan bir ondalıklı sayı okur ve ayrıştırma hatalarını işler.
+ * @param prompt - Instruction for the user / Kullanıcı için talimat
+ * @return Validated float value / Doğrulanmış ondalıklı sayı değeri
+ */
+float get_float_input(const char *prompt) {
+    float value;
+    char input[50];
+    while (1) {
+        if (strlen(prompt) > 0) printf("%s", prompt);
+        if (fgets(input, sizeof(input), stdin) == NULL) continue;
+        remove_newline(input);
+        trim_whitespace(input);
+        if (strlen(input) == 0) continue;
+        if (sscanf(input, "%f", &value) == 1) return value;
+        else printf("Error: Please enter a valid number!\n");
+    }
+}
+
+/**
+ * Prompts user for an ID and ensures it is a positive integer.
+ * Kullanıcıdan bir ID ister ve bunun pozitif bir tam sayı olmasını sağlar.
+ * @param prompt - Message for the user / Kullanıcı mesajı
+ * @return Validated positive ID / Doğrulanmış pozitif ID
+ */
+int get_validated_id(const char *prompt) {
+    int id;
+    do {
+        id = get_int_input(prompt);
+        if (!validate_positive_int(id)) printf("Error: ID must be a positive number!\n");
+    } while (!validate_positive_int(id));
+    return id;
+}
+
+/**
+ * Retrieves the current system date in YYYY-MM-DD format.
+ * Mevcut sistem tarihini YYYY-MM-DD formatında alır.
+ * @param buffer - Storage for the date string / Tarih dizgisinin saklanacağı yer
+ */
+void get_current_date(char *buffer) {
+    time_t t = time(NULL);
+    struct tm *tm_info = localtime(&t);
+    strftime(buffer, 20, "%Y-%m-%d", tm_info);
+}
+
+/**
+ * Validates if a date string follows the YYYY-MM-DD format.
+ * Bir tarih dizgisinin YYYY-MM-DD formatına uyup uymadığını doğrular.
+ * @param date - Date string to check / Kontrol edilecek tarih dizgisi
+ * @return 1 if format is valid, 0 otherwise / Format geçerliyse 1, aksi halde 0 döner
+ */
+int validate_date(const char *date) {
+    if (strlen(date) != 10) return 0;
+    if (date[4] != '-' || date[7] != '-') return 0;
+    int i;
+    for (i = 0; i < 10; i++) {
+        if (i == 4 || i == 7) continue;
+        if (!isdigit(date[i])) return 0;
+    }
+    return 1;
+}
+
+// Term order within a calendar year; the ordinal is year * 4 + position
+// Takvim yılı içindeki dönem sırası; sıra numarası yıl * 4 + konumdur
+static const char *term_names[4] = {"WINTER", "SPRING", "SUMMER", "FALL"};
+
+/**
+ * Encodes a "YYYY-TERM" semester as an ordinal (year * 4 + term) so that terms compare as integers.
+ * "YYYY-DÖNEM" biçimli bir dönemi, tam sayı olarak karşılaştırılabilmesi için sıra numarasına (yıl * 4 + dönem) çevirir.
+ * @param semester - Semester string, e.g. "2023-FALL" (case-insensitive) / Dönem dizgisi, örn. "2023-FALL" (büyük/küçük harf duyarsız)
+ * @return Term ordinal, or TERM_NONE if the string is not a semester / Dönem sıra numarası, dönem değilse TERM_NONE
+ */
+int semester_to_term(const char *semester) {
+    int year = 0, i;
+    if (semester == NULL) return TERM_NONE;
+    for (i = 0; i < 4; i++) {
+        if (!isdigit((unsigned char)semester[i])) return TERM_NONE;
+        year = year * 10 + (semester[i] - '0');
+    }
+    if (semester[4] != '-') return TERM_NONE;
+    for (i = 0; i < 4; i++) {
+        const char *a = semester + 5, *b = term_names[i];
+        while (*a != '\0' && *b != '\0' && toupper((unsigned char)*a) == *b) { a++; b++; }
+        if (*a == '\0' && *b == '\0') return year * 4 + i;
+    }
+    return TERM_NONE;
+}
+
+/**
+ * Decodes a term ordinal back into "YYYY-TERM".
+ * Dönem sıra numarasını tekrar "YYYY-DÖNEM" biçimine çevirir.
+ * @param term - Term ordinal / Dönem sıra numarası
+ * @param buffer - Destination, at least 12 bytes / Hedef, en az 12 bayt
+ * @param size - Size of the buffer / Tamponun boyutu
+ */
+void term_to_semester(int term, char *buffer, int size) {
+    if (term < 0) snprintf(buffer, size, "?");
+    else snprintf(buffer, size, "%04d-%s", term / 4, term_names[term % 4]);
+}
+
+/**
+ * Encodes a YYYY-MM-DD date as a day number (days since 1970-01-01) so that dates subtract and compare as integers.
+ * YYYY-MM-DD biçimli bir tarihi, tam sayı olarak çıkarılıp karşılaştırılabilmesi için gün numarasına (1970-01-01'den beri gün) çevirir.
+ * @param date - Date string / Tarih dizgisi
+ * @return Day number, or DAY_NONE for a malformed date or one before 1970 / Gün numarası; hatalı veya 1970 öncesi tarihte DAY_NONE
+ */
+int date_to_day(const char *date) {
+    static const int month_days[12] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (date == NULL || !validate_date(date)) return DAY_NONE;
+    int y = atoi(date), m = atoi(date + 5), d = atoi(date + 8);
+    if (y < 1970 || m < 1 || m > 12 || d < 1 || d > month_days[m - 1]) return DAY_NONE;
+    if (m == 2 && d == 29 && !(y % 4 == 0 && (y % 100 != 0 || y % 400 == 0))) return DAY_NONE;
+
+    // Civil-to-days with March as the first month, so the leap day falls at the end of the year
+    // Mart'ı yılın ilk ayı sayan dönüşüm; artık gün yılın sonuna düşer
+    if (m <= 2) y--;
+    int era = y / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+/**
+ * Decodes a day number back into YYYY-MM-DD.
+ * Gün numarasını tekrar YYYY-MM-DD biçimine çevirir.
+ * @param day - Day number / Gün numarası
+ * @param buffer - Destination, at least 11 bytes / Hedef, en az 11 bayt
+ */
+void day_to_date(int day, char *buffer) {
+    if (day < 0) {
+        strcpy(buffer, "?");
+        return;
+    }
+    int z = day + 719468;
+    int era = z / 146097;
+    int doe = z - era * 146097;
+    int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int mp = (5 * doy + 2) / 153;
+    int d = doy - (153 * mp + 2) / 5 + 1;
+    int m = mp + (mp < 10 ? 3 : -9);
+    int y = yoe + era * 400 + (m <= 2);
+    sprintf(buffer, "%04d-%02d-%02d", y, m, d);
+}
+
+/**
+ * Today's day number.
+ * Bugünün gün numarası.
+ * @return Day number of the current local date / Yerel tarihin gün numarası
+ */
+int current_day(void) {
+    char today[20];
+    get_current_date(today);
+    return date_to_day(today);
+}
+
+/**
+ * Reads the persisted next-ID of a table and returns the larger of it and the seed.
+ * Bir tablonun kaydedilmiş sonraki ID'sini okur; bu değer ile başlangıç değerinden büyük olanı döndürür.
+ * @param table - Sequence name, e.g. "enrollments" / Dizi adı, örn. "enrollments"
+ * @param seed - Next ID derived from the loaded rows / Yüklenen satırlardan türetilen sonraki ID
+ * @return Next ID that has never been handed out / Daha önce hiç verilmemiş sonraki ID
+ */
+int load_sequence(const char *table, int seed) {
+    FILE *file = fopen(SEQUENCE_FILE, "r");
+    if (file == NULL) return seed;
+
+    char line[128];
+    char *tokens[2];
+    while (fgets(line, sizeof(line), file)) {
+        remove_newline(line);
+        if (split_csv_line(line, tokens, 2) == 2 && strcmp(tokens[0], table) == 0) {
+            int stored = atoi(tokens[1]);
+            if (stored > seed) seed = stored;
+        }
+    }
+    fclose(file);
+    return seed;
+}
+
+/**
+ * Persists the next-ID of a table, keeping the rows of the other tables.
+ * Bir tablonun sonraki ID'sini kaydeder; diğer tabloların satırlarını korur.
+ * @param table - Sequence name / Dizi adı
+ * @param next_id - Next ID to be handed out / Verilecek sonraki ID
+ * @return 1 if saved, 0 if the file cannot be written / Kaydedildiyse 1, dosya yazılamazsa 0 döner
+ */
+int save_sequence(const char *table, int next_id) {
+    char names[MAX_SEQUENCES][32];
+    int values[MAX_SEQUENCES];
+    int count = 0, i;
+
+    FILE *file = fopen(SEQUENCE_FILE, "r");
+    if (file != NULL) {
+        char line[128];
+        char *tokens[2];
+        fgets(line, sizeof(line), file);
+        while (fgets(line, sizeof(line), file) && count < MAX_SEQUENCES) {
+            remove_newline(line);
+            if (split_csv_line(line, tokens, 2) == 2) {
+                snprintf(names[count], sizeof(names[count]), "%s", tokens[0]);
+                values[count] = atoi(tokens[1]);
+                count++;
+            }
+        }
+        fclose(file);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (strcmp(names[i], table) == 0) break;
+    }
+    if (i == count) {
+        if (count == MAX_SEQUENCES) return 0;
+        snprintf(names[count], sizeof(names[count]), "%s", table);
+        count++;
+    }
+    values[i] = next_id;
+
+    file = fopen(SEQUENCE_FILE, "w");
+    if (file == NULL) return 0;
+    fprintf(file, "table,next_id\n");
+    for (i = 0; i < count; i++) {
+        fprintf(file, "%s,%d\n", names[i], values[i]);
+    }
+    fclose(file);
+    return 1;
+}
+
+/**
+ * Starts one journal line ("timestamp|operation|") in the append-only journal; the caller writes the details.
+ * Salt eklemeli günlükte bir satır ("zaman|işlem|") başlatır; ayrıntıları çağıran yazar.
+ * @param operation - Operation name, e.g. "ROLLOVER" / İşlem adı, örn. "ROLLOVER"
+ * @return Open journal file, or NULL if it cannot be opened / Açık günlük dosyası, açılamazsa NULL
+ */
+FILE* journal_begin_entry(const char *operation) {
+    FILE *file = fopen(JOURNAL_FILE, "a");
+    if (file == NULL) return NULL;
+
+    char stamp[32];
+    time_t t = time(NULL);
+    strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", localtime(&t));
+    fprintf(file, "%s|%s|", stamp, operation);
+    return file;
+}
+
+/**
+ * Terminates and flushes a journal line started with journal_begin_entry.
+ * journal_begin_entry ile başlatılan günlük satırını sonlandırır ve diske yazar.
+ * @param file - File returned by journal_begin_entry / journal_begin_entry'nin döndürdüğü dosya
+ * @return 1 if the entry was written, 0 otherwise / Kayıt yazıldıysa 1, aksi halde 0 döner
+ */
+int journal_end_entry(FILE *file) {
+    if (file == NULL) return 0;
+    fputc('\n', file);
+    return fclose(file) == 0;
+}
@@ -1,33 +1,54 @@
-// utils.h - Yardmc Fonksiyonlar (FINAL VERSION)
-
-#ifndef UTILS_H
-#define UTILS_H
-
-#include <stdio.h>
-#include <string.h>
-#include <ctype.h>
-
-// String ilemleri
-void remove_newline(char *str);
-int split_csv_line(char *line, char *tokens[], int max_tokens);
-void trim_whitespace(char *str);
-
-// Validasyon fonksiyonlar
-int is_numeric(const char *str);
-int validate_email(const char *email);
-int validate_phone(const char *phone);
-int validate_gpa(float gpa);
-int validate_positive_int(int value);
-int validate_year(int year);
-
-// Girdi alma fonksiyonlar
-void get_string_input(const char *prompt, char *buffer, int max_len);
-int get_int_input(const char *prompt);
-float get_float_input(const char *prompt);
-int get_validated_id(const char *prompt);
-
-// Tarih fonksiyonlar
-void get_current_date(char *buffer);
-int validate_date(const char *date);
-
-#endif // UTILS_H
+// utils.h - Yardımcı Fonksiyonlar (FINAL VERSION)
+
+#ifndef UTILS_H
+#define UTILS_H
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+// String işlemleri
+void remove_newline(char *str);
+int split_csv_line(char *line, char *tokens[], int max_tokens);
+void trim_whitespace(char *str);
+void fold_search_text(const char *src, char *dest, int max_len);
+
+// Validasyon fonksiyonları
+int is_numeric(const char *str);
+int validate_email(const char *email);
+int validate_phone(const char *phone);
+int validate_gpa(float gpa);
+int validate_positive_int(int value);
+int validate_year(int year);
+
+// Girdi alma fonksiyonları
+void get_string_input(const char *prompt, char *buffer, int max_len);
+int get_int_input(const char *prompt);
+float get_float_input(const char *prompt);
+int get_validated_id(const char *prompt);
+
+// Tarih fonksiyonları
+void get_current_date(char *buffer);
+int validate_date(const char *date);
+
+// Paketlenmiş dönem ve tarih kodlamaları (sıralanabilir tam sayılar)
+#define TERM_NONE -1             // Unparseable semester / Çözümlenemeyen dönem
+#define DAY_NONE -1              // Invalid or pre-1970 date / Geçersiz veya 1970 öncesi tarih
+int semester_to_term(const char *semester);
+void term_to_semester(int term, char *buffer, int size);
+int date_to_day(const char *date);
+void day_to_date(int day, char *buffer);
+int current_day(void);
+
+// ID dizileri (silinen kayıtların ID'leri tekrar kullanılmaz)
+#define SEQUENCE_FILE "data/sequences.csv"
+#define MAX_SEQUENCES 16
+int load_sequence(const char *table, int seed);
+int save_sequence(const char *table, int next_id);
+
+// Toplu işlemler günlüğü (her işlem tek satır)
+#define JOURNAL_FILE "data/journal.log"
+FILE* journal_begin_entry(const char *operation);
+int journal_end_entry(FILE *file);
+
+#endif // UTILS_H
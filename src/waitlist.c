@@ -0,0 +1,570 @@
+// waitlist.c - Kurs Bekleme Listesi Modülü (Öncelik Kuyruğu)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "waitlist.h"
+#include "student.h"
+#include "index.h"
+#include "utils.h"
+
+// All waitlists, the course -> Waitlist index and the "course|student" -> entry position index.
+// Tüm bekleme listeleri, kurs -> Waitlist indeksi ve "kurs|öğrenci" -> kayıt konum indeksi.
+static Waitlist *waitlist_list = NULL;
+static IdIndex course_waitlist_index = {NULL, 0, 0};
+static HashIndex waitlist_entry_index = {NULL, 0, 0};
+static unsigned long next_ticket = 1;
+
+// xorshift state for treap priorities; only touched under waitlist_lock
+// Treap öncelikleri için xorshift durumu; yalnızca waitlist_lock altında değişir
+static unsigned int line_seed = 2463534242u;
+
+// Enrollment may run on several threads; every public function takes this lock.
+// Kayıt birden fazla iş parçacığında çalışabilir; tüm dış fonksiyonlar bu kilidi alır.
+static pthread_mutex_t waitlist_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Builds the position index key of a (course, student) pair.
+ * Bir (kurs, öğrenci) çiftinin konum indeksi anahtarını oluşturur.
+ * * @param course_id - Course ID
+ * @param course_id - Kurs ID'si
+ * @param student_id - Student ID
+ * @param student_id - Öğrenci ID'si
+ * @param key - Buffer of INDEX_KEY_LEN bytes
+ * @param key - INDEX_KEY_LEN boyutunda alan
+ */
+static void waitlist_key(int course_id, int student_id, char *key) {
+    snprintf(key, INDEX_KEY_LEN, "%d|%d", course_id, student_id);
+}
+
+/**
+ * Heap order: earlier class year first, then earlier arrival.
+ * Yığın sırası: önce eski sınıf yılı, sonra erken geliş.
+ * @return 1 if a must be served before b / a, b'den önce alınmalıysa 1
+ */
+static int entry_before(const WaitlistEntry *a, const WaitlistEntry *b) {
+    if (a->class_year != b->class_year) return a->class_year < b->class_year;
+    return a->ticket < b->ticket;
+}
+
+/**
+ * Swaps two heap slots and keeps their heap_pos fields in step.
+ * İki yığın yuvasını değiştirir ve heap_pos alanlarını günceller.
+ */
+static void heap_swap(Waitlist *wl, int i, int j) {
+    WaitlistEntry *tmp = wl->heap[i];
+    wl->heap[i] = wl->heap[j];
+    wl->heap[j] = tmp;
+    wl->heap[i]->heap_pos = i;
+    wl->heap[j]->heap_pos = j;
+}
+
+/**
+ * Restores heap order around slot i after it changed (O(log n)).
+ * Değişen i yuvasının çevresinde yığın sırasını geri kurar (O(log n)).
+ */
+static void heap_fix(Waitlist *wl, int i) {
+    while (i > 0 && entry_before(wl->heap[i], wl->heap[(i - 1) / 2])) {
+        heap_swap(wl, i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+    while (1) {
+        int left = 2 * i + 1, right = left + 1, best = i;
+        if (left < wl->size && entry_before(wl->heap[left], wl->heap[best])) best = left;
+        if (right < wl->size && entry_before(wl->heap[right], wl->heap[best])) best = right;
+        if (best == i) break;
+        heap_swap(wl, i, best);
+        i = best;
+    }
+}
+
+// ===============================================
+// ORDER-STATISTIC TREAP (SIRA AĞACI)
+// ===============================================
+
+// Entry count of a treap subtree (0 for NULL)
+// Bir treap alt ağacındaki kayıt sayısı (NULL için 0)
+static int line_size(const WaitlistEntry *e) {
+    return (e != NULL) ? e->subtree : 0;
+}
+
+/**
+ * Rotates an entry above its parent, keeping parent links and subtree counts in step.
+ * Bir kaydı ebeveyninin üstüne döndürür; ebeveyn bağlantılarını ve alt ağaç sayılarını günceller.
+ * * @param wl - Course waitlist
+ * @param wl - Kurs bekleme listesi
+ * @param x - Entry to lift (must have a parent)
+ * @param x - Yukarı alınacak kayıt (ebeveyni olmalı)
+ */
+static void line_rotate_up(Waitlist *wl, WaitlistEntry *x) {
+    WaitlistEntry *p = x->parent, *g = p->parent;
+    if (p->left == x) {
+        p->left = x->right;
+        if (x->right != NULL) x->right->parent = p;
+        x->right = p;
+    } else {
+        p->right = x->left;
+        if (x->left != NULL) x->left->parent = p;
+        x->left = p;
+    }
+    p->parent = x;
+    x->parent = g;
+    if (g == NULL) wl->order_root = x;
+    else if (g->left == p) g->left = x;
+    else g->right = x;
+    p->subtree = 1 + line_size(p->left) + line_size(p->right);
+    x->subtree = 1 + line_size(x->left) + line_size(x->right);
+}
+
+/**
+ * Inserts an entry into the course treap by heap priority (expected O(log n)).
+ * Bir kaydı yığın önceliğine göre kurs treap'ine ekler (beklenen O(log n)).
+ * * @param wl - Course waitlist
+ * @param wl - Kurs bekleme listesi
+ * @param e - Entry to insert
+ * @param e - Eklenecek kayıt
+ */
+static void line_insert(Waitlist *wl, WaitlistEntry *e) {
+    WaitlistEntry *parent = NULL, *cur = wl->order_root;
+    line_seed ^= line_seed << 13;
+    line_seed ^= line_seed >> 17;
+    line_seed ^= line_seed << 5;
+    e->weight = line_seed;
+    e->left = e->right = NULL;
+    e->subtree = 1;
+    while (cur != NULL) {
+        cur->subtree++;
+        parent = cur;
+        cur = entry_before(e, cur) ? cur->left : cur->right;
+    }
+    e->parent = parent;
+    if (parent == NULL) wl->order_root = e;
+    else if (entry_before(e, parent)) parent->left = e;
+    else parent->right = e;
+    while (e->parent != NULL && e->weight > e->parent->weight) line_rotate_up(wl, e);
+}
+
+/**
+ * Unlinks an entry from the course treap (expected O(log n)).
+ * Bir kaydı kurs treap'inden çıkarır (beklenen O(log n)).
+ * * @param wl - Course waitlist
+ * @param wl - Kurs bekleme listesi
+ * @param e - Entry to unlink
+ * @param e - Çıkarılacak kayıt
+ */
+static void line_remove(Waitlist *wl, WaitlistEntry *e) {
+    // Kayıt en fazla bir çocuğu kalana dek aşağı döndürülür
+    while (e->left != NULL && e->right != NULL) {
+        line_rotate_up(wl, (e->left->weight > e->right->weight) ? e->left : e->right);
+    }
+    WaitlistEntry *child = (e->left != NULL) ? e->left : e->right;
+    WaitlistEntry *p = e->parent;
+    if (child != NULL) child->parent = p;
+    if (p == NULL) wl->order_root = child;
+    else if (p->left == e) p->left = child;
+    else p->right = child;
+    for (; p != NULL; p = p->parent) p->subtree--;
+}
+
+/**
+ * 1-based place of an entry in line: entries before it in its subtree plus every left branch on the way up.
+ * Bir kaydın sıradaki yeri (1'den başlar): alt ağacındaki öncekiler ve yukarı çıkarken geçilen sol dallar.
+ * * @param e - Entry in a course treap
+ * @param e - Kurs treap'indeki kayıt
+ * @return Place in line
+ * @return Sıradaki yer
+ */
+static int line_rank(const WaitlistEntry *e) {
+    int rank = line_size(e->left) + 1;
+    for (; e->parent != NULL; e = e->parent) {
+        if (e->parent->right == e) rank += line_size(e->parent->left) + 1;
+    }
+    return rank;
+}
+
+/**
+ * Next entry in line after e (in-order successor), or NULL after the last one.
+ * Sırada e'den sonraki kayıt (sıralı ardıl); sonuncudan sonra NULL.
+ */
+static const WaitlistEntry* line_next(const WaitlistEntry *e) {
+    if (e->right != NULL) {
+        e = e->right;
+        while (e->left != NULL) e = e->left;
+        return e;
+    }
+    while (e->parent != NULL && e->parent->right == e) e = e->parent;
+    return e->parent;
+}
+
+/**
+ * Returns the waitlist of a course, optionally creating it.
+ * Bir kursun bekleme listesini döndürür; istenirse oluşturur.
+ * * @param course_id - Course ID
+ * @param course_id - Kurs ID'si
+ * @param create - 1 to create a missing waitlist
+ * @param create - Eksik listeyi oluşturmak için 1
+ * @return Waitlist or NULL
+ * @return Bekleme listesi veya NULL
+ */
+static Waitlist* find_waitlist(int course_id, int create) {
+    Waitlist *wl = (Waitlist *)id_index_find(&course_waitlist_index, course_id);
+    if (wl != NULL || !create) return wl;
+
+    wl = (Waitlist *)calloc(1, sizeof(Waitlist));
+    if (wl == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return NULL;
+    }
+    wl->course_id = course_id;
+    wl->next = waitlist_list;
+    waitlist_list = wl;
+    id_index_insert(&course_waitlist_index, course_id, wl);
+    return wl;
+}
+
+/**
+ * Inserts an entry into its course heap and the position index; the caller holds waitlist_lock.
+ * Bir kaydı kurs yığınına ve konum indeksine ekler; çağıran waitlist_lock'u tutar.
+ * * @param entry - Heap-allocated entry
+ * @param entry - Heap üzerinde ayrılmış kayıt
+ * @return 1 if inserted, 0 on memory failure
+ * @return Eklendiyse 1, bellek hatasında 0 döner
+ */
+static int push_entry(WaitlistEntry *entry) {
+    char key[INDEX_KEY_LEN];
+    Waitlist *wl = find_waitlist(entry->course_id, 1);
+    if (wl == NULL) return 0;
+
+    if (wl->size == wl->capacity) {
+        int new_capacity = (wl->capacity == 0) ? 8 : wl->capacity * 2;
+        WaitlistEntry **grown = (WaitlistEntry **)realloc(wl->heap, new_capacity * sizeof(WaitlistEntry *));
+        if (grown == NULL) {
+            printf("Error: Memory allocation failed!\n");
+            return 0;
+        }
+        wl->heap = grown;
+        wl->capacity = new_capacity;
+    }
+    entry->heap_pos = wl->size;
+    wl->heap[wl->size++] = entry;
+    heap_fix(wl, entry->heap_pos);
+    line_insert(wl, entry);
+
+    waitlist_key(entry->course_id, entry->student_id, key);
+    index_insert(&waitlist_entry_index, key, entry);
+    if (entry->ticket >= next_ticket) next_ticket = entry->ticket + 1;
+    return 1;
+}
+
+/**
+ * Removes the entry at a heap slot and returns it (O(log n)); the caller holds waitlist_lock.
+ * Bir yığın yuvasındaki kaydı çıkarır ve döndürür (O(log n)); çağıran waitlist_lock'u tutar.
+ * * @param wl - Course waitlist
+ * @param wl - Kurs bekleme listesi
+ * @param pos - Heap slot
+ * @param pos - Yığın yuvası
+ * @return The removed entry (still allocated)
+ * @return Çıkarılan kayıt (bellekte duruyor)
+ */
+static WaitlistEntry* remove_at(Waitlist *wl, int pos) {
+    char key[INDEX_KEY_LEN];
+    WaitlistEntry *entry = wl->heap[pos];
+
+    wl->size--;
+    if (pos != wl->size) {
+        wl->heap[pos] = wl->heap[wl->size];
+        wl->heap[pos]->heap_pos = pos;
+        heap_fix(wl, pos);
+    }
+    line_remove(wl, entry);
+
+    waitlist_key(entry->course_id, entry->student_id, key);
+    index_remove(&waitlist_entry_index, key, entry);
+    return entry;
+}
+
+/**
+ * Puts a student on a course's waitlist.
+ * Bir öğrenciyi kursun bekleme listesine alır.
+ * * @param student_id - ID of the waiting student
+ * @param student_id - Bekleyen öğrencinin ID'si
+ * @param course_id - ID of the full course
+ * @param course_id - Dolu kursun ID'si
+ * @param professor_id - Professor to enroll with once a seat frees up
+ * @param professor_id - Koltuk boşalınca kayıt yapılacak profesör
+ * @param semester - Semester of the requested enrollment
+ * @param semester - İstenen kaydın dönemi
+ * @return Waitlist length after the add (ask waitlist_position for the place in line), or 0 if
+ *         the student is unknown or already waiting
+ * @return Eklemeden sonraki bekleme listesi uzunluğu (sıradaki yer için waitlist_position'a sorun);
+ *         öğrenci bilinmiyorsa veya zaten bekliyorsa 0
+ */
+int waitlist_add(int student_id, int course_id, int professor_id, const char *semester) {
+    char key[INDEX_KEY_LEN];
+    Student *s = get_student_by_id(student_id);
+    if (s == NULL) {
+        printf("Error: Student not found!\n");
+        return 0;
+    }
+
+    pthread_mutex_lock(&waitlist_lock);
+    waitlist_key(course_id, student_id, key);
+    if (index_find(&waitlist_entry_index, key) != NULL) {
+        pthread_mutex_unlock(&waitlist_lock);
+        printf("Error: Student is already on the waitlist for this course!\n");
+        return 0;
+    }
+
+    WaitlistEntry *entry = (WaitlistEntry *)calloc(1, sizeof(WaitlistEntry));
+    if (entry == NULL) {
+        pthread_mutex_unlock(&waitlist_lock);
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+    entry->student_id = student_id;
+    entry->course_id = course_id;
+    entry->professor_id = professor_id;
+    snprintf(entry->semester, sizeof(entry->semester), "%s", semester);
+    entry->class_year = s->enrollment_year;
+    entry->ticket = next_ticket++;
+    if (!push_entry(entry)) {
+        pthread_mutex_unlock(&waitlist_lock);
+        free(entry);
+        return 0;
+    }
+    int size = find_waitlist(course_id, 0)->size;
+    pthread_mutex_unlock(&waitlist_lock);
+    return size;
+}
+
+/**
+ * Takes a student off a course's waitlist in O(log n) via the position index.
+ * Bir öğrenciyi konum indeksi üzerinden O(log n) sürede bekleme listesinden çıkarır.
+ * * @param student_id - ID of the student
+ * @param student_id - Öğrencinin ID'si
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ * @return 1 if removed, 0 if the student was not waiting
+ * @return Çıkarıldıysa 1, öğrenci beklemiyorsa 0 döner
+ */
+int waitlist_remove(int student_id, int course_id) {
+    char key[INDEX_KEY_LEN];
+    pthread_mutex_lock(&waitlist_lock);
+    waitlist_key(course_id, student_id, key);
+    WaitlistEntry *entry = (WaitlistEntry *)index_find(&waitlist_entry_index, key);
+    Waitlist *wl = find_waitlist(course_id, 0);
+    if (entry == NULL || wl == NULL) {
+        pthread_mutex_unlock(&waitlist_lock);
+        return 0;
+    }
+    free(remove_at(wl, entry->heap_pos));
+    pthread_mutex_unlock(&waitlist_lock);
+    return 1;
+}
+
+/**
+ * Removes the highest-priority student of a course's waitlist (O(log n)).
+ * Bir kursun bekleme listesindeki en öncelikli öğrenciyi çıkarır (O(log n)).
+ * * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ * @param out - Receives a copy of the removed entry
+ * @param out - Çıkarılan kaydın kopyasını alır
+ * @return 1 if an entry was removed, 0 if the waitlist is empty
+ * @return Kayıt çıkarıldıysa 1, liste boşsa 0 döner
+ */
+int waitlist_pop(int course_id, WaitlistEntry *out) {
+    pthread_mutex_lock(&waitlist_lock);
+    Waitlist *wl = find_waitlist(course_id, 0);
+    if (wl == NULL || wl->size == 0) {
+        pthread_mutex_unlock(&waitlist_lock);
+        return 0;
+    }
+    WaitlistEntry *entry = remove_at(wl, 0);
+    pthread_mutex_unlock(&waitlist_lock);
+    *out = *entry;
+    free(entry);
+    return 1;
+}
+
+/**
+ * Puts a popped entry back with its original class year and arrival ticket (keeps its place in line).
+ * Çıkarılmış bir kaydı özgün sınıf yılı ve geliş numarasıyla geri koyar (sıradaki yerini korur).
+ * * @param entry - Entry returned by waitlist_pop
+ * @param entry - waitlist_pop tarafından döndürülen kayıt
+ * @return 1 if requeued, 0 on memory failure
+ * @return Geri konduysa 1, bellek hatasında 0 döner
+ */
+int waitlist_requeue(const WaitlistEntry *entry) {
+    WaitlistEntry *copy = (WaitlistEntry *)malloc(sizeof(WaitlistEntry));
+    if (copy == NULL) {
+        printf("Error: Memory allocation failed!\n");
+        return 0;
+    }
+    *copy = *entry;
+    pthread_mutex_lock(&waitlist_lock);
+    int ok = push_entry(copy);
+    pthread_mutex_unlock(&waitlist_lock);
+    if (!ok) free(copy);
+    return ok;
+}
+
+/**
+ * Returns a student's place in line. The entry is found through the position index in O(1) and
+ * ranked through the course treap in O(log n), whatever changed since the last query.
+ * Bir öğrencinin sıradaki yerini döndürür. Kayıt konum indeksiyle O(1) sürede bulunur ve
+ * kurs treap'i üzerinden, son sorgudan beri ne değişmiş olursa olsun O(log n) sürede sıralanır.
+ * * @param student_id - ID of the student
+ * @param student_id - Öğrencinin ID'si
+ * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ * @return 1-based place, or 0 if the student is not waiting
+ * @return 1'den başlayan sıra; öğrenci beklemiyorsa 0
+ */
+int waitlist_position(int student_id, int course_id) {
+    char key[INDEX_KEY_LEN];
+    int rank = 0;
+
+    pthread_mutex_lock(&waitlist_lock);
+    waitlist_key(course_id, student_id, key);
+    WaitlistEntry *entry = (WaitlistEntry *)index_find(&waitlist_entry_index, key);
+    if (entry != NULL) rank = line_rank(entry);
+    pthread_mutex_unlock(&waitlist_lock);
+    return rank;
+}
+
+/**
+ * Returns the number of students waiting for a course.
+ * Bir kurs için bekleyen öğrenci sayısını döndürür.
+ * * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ * @return Waitlist length
+ * @return Bekleme listesi uzunluğu
+ */
+int waitlist_size(int course_id) {
+    pthread_mutex_lock(&waitlist_lock);
+    Waitlist *wl = find_waitlist(course_id, 0);
+    int size = (wl != NULL) ? wl->size : 0;
+    pthread_mutex_unlock(&waitlist_lock);
+    return size;
+}
+
+/**
+ * Prints a course's waitlist in promotion order.
+ * Bir kursun bekleme listesini terfi sırasına göre yazdırır.
+ * * @param course_id - ID of the course
+ * @param course_id - Kursun ID'si
+ */
+void display_course_waitlist(int course_id) {
+    printf("\n====================================================\n");
+    printf("  Waitlist for Course ID: %d\n", course_id);
+    printf("====================================================\n");
+    printf("%-6s %-10s %-6s %-10s %-15s\n", "Pos.", "StudentID", "Year", "Prof.ID", "Semester");
+    printf("----------------------------------------------------\n");
+
+    pthread_mutex_lock(&waitlist_lock);
+    Waitlist *wl = find_waitlist(course_id, 0);
+    int pos = 0, size = (wl != NULL) ? wl->size : 0;
+    const WaitlistEntry *e = (wl != NULL) ? wl->order_root : NULL;
+    // Treap sırayla yürünür; sıralama gerekmez
+    while (e != NULL && e->left != NULL) e = e->left;
+    for (; e != NULL; e = line_next(e)) {
+        printf("%-6d %-10d %-6d %-10d %-15s\n", ++pos, e->student_id, e->class_year,
+               e->professor_id, e->semester);
+    }
+    pthread_mutex_unlock(&waitlist_lock);
+
+    if (size == 0) {
+        printf("No students waiting for this course.\n");
+    }
+    printf("====================================================\n");
+}
+
+/**
+ * Loads waitlists from CSV, replacing the ones in memory. A missing file means no waitlists.
+ * Bekleme listelerini CSV'den yükler, bellektekilerin yerine geçer. Dosya yoksa liste de yoktur.
+ * * @param filename - Source file path
+ * @param filename - Kaynak dosya yolu
+ * @return Number of loaded entries
+ * @return Yüklenen kayıt sayısı
+ */
+int load_waitlists_from_csv(const char *filename) {
+    char line[256];
+    char *tokens[6];
+    int count = 0;
+
+    waitlist_clear();
+    FILE *file = fopen(filename, "r");
+    if (file == NULL) return 0;
+
+    pthread_mutex_lock(&waitlist_lock);
+    fgets(line, sizeof(line), file);
+    while (fgets(line, sizeof(line), file)) {
+        remove_newline(line);
+        if (split_csv_line(line, tokens, 6) < 6) continue;
+
+        WaitlistEntry *entry = (WaitlistEntry *)calloc(1, sizeof(WaitlistEntry));
+        if (entry == NULL) break;
+        entry->course_id = atoi(tokens[0]);
+        entry->student_id = atoi(tokens[1]);
+        entry->professor_id = atoi(tokens[2]);
+        snprintf(entry->semester, sizeof(entry->semester), "%s", tokens[3]);
+        entry->class_year = atoi(tokens[4]);
+        entry->ticket = strtoul(tokens[5], NULL, 10);
+        if (push_entry(entry)) count++;
+        else free(entry);
+    }
+    pthread_mutex_unlock(&waitlist_lock);
+    fclose(file);
+    return count;
+}
+
+/**
+ * Saves every waitlist entry to CSV (course_id,student_id,professor_id,semester,class_year,ticket).
+ * Tüm bekleme listesi kayıtlarını CSV'ye kaydeder (course_id,student_id,professor_id,semester,class_year,ticket).
+ * * @param filename - Destination file path
+ * @param filename - Hedef dosya yolu
+ * @return 1 if saved, 0 if the file cannot be written
+ * @return Kaydedildiyse 1, dosya yazılamazsa 0 döner
+ */
+int save_waitlists_to_csv(const char *filename) {
+    FILE *file = fopen(filename, "w");
+    Waitlist *wl;
+    int i;
+
+    if (file == NULL) {
+        printf("Error: Could not open %s for writing!\n", filename);
+        return 0;
+    }
+    fprintf(file, "course_id,student_id,professor_id,semester,class_year,ticket\n");
+    pthread_mutex_lock(&waitlist_lock);
+    for (wl = waitlist_list; wl != NULL; wl = wl->next) {
+        for (i = 0; i < wl->size; i++) {
+            WaitlistEntry *e = wl->heap[i];
+            fprintf(file, "%d,%d,%d,%s,%d,%lu\n", e->course_id, e->student_id, e->professor_id,
+                    e->semester, e->class_year, e->ticket);
+        }
+    }
+    pthread_mutex_unlock(&waitlist_lock);
+    fclose(file);
+    return 1;
+}
+
+/**
+ * Frees every waitlist and clears the indexes.
+ * Tüm bekleme listelerini serbest bırakır ve indeksleri temizler.
+ */
+void waitlist_clear(void) {
+    int i;
+    pthread_mutex_lock(&waitlist_lock);
+    while (waitlist_list != NULL) {
+        Waitlist *wl = waitlist_list;
+        waitlist_list = wl->next;
+        for (i = 0; i < wl->size; i++) free(wl->heap[i]);
+        free(wl->heap);
+        free(wl);
+    }
+    id_index_clear(&course_waitlist_index);
+    index_clear(&waitlist_entry_index);
+    pthread_mutex_unlock(&waitlist_lock);
+}
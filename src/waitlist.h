@@ -0,0 +1,49 @@
+// waitlist.h - Kurs Bekleme Listesi Modülü (Öncelik Kuyruğu)
+
+#ifndef WAITLIST_H
+#define WAITLIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define WAITLIST_FILE "data/waitlists.csv"
+
+// One student waiting for a seat; earlier class years go first, then earlier arrivals
+// Koltuk bekleyen bir öğrenci; önce eski sınıf yılları, sonra erken gelenler
+typedef struct WaitlistEntry {
+    int student_id;
+    int course_id;
+    int professor_id;
+    char semester[20];
+    int class_year;          // Student.enrollment_year
+    unsigned long ticket;    // Arrival order
+    int heap_pos;            // Slot in the course heap
+    // Order-statistic treap links; subtree counts give the place in line in O(log n)
+    struct WaitlistEntry *left, *right, *parent;
+    int subtree;             // Entries in this subtree
+    unsigned int weight;     // Treap priority (random)
+} WaitlistEntry;
+
+// Binary min-heap of entries for one course, plus a size-augmented treap over the same entries
+// Bir kurs için kayıtların ikili min-yığını ve aynı kayıtlar üzerinde boyut tutan bir treap
+typedef struct Waitlist {
+    int course_id;
+    WaitlistEntry **heap;
+    int size;
+    int capacity;
+    WaitlistEntry *order_root;
+    struct Waitlist *next;
+} Waitlist;
+
+int waitlist_add(int student_id, int course_id, int professor_id, const char *semester);
+int waitlist_remove(int student_id, int course_id);
+int waitlist_pop(int course_id, WaitlistEntry *out);
+int waitlist_requeue(const WaitlistEntry *entry);
+int waitlist_position(int student_id, int course_id);
+int waitlist_size(int course_id);
+void display_course_waitlist(int course_id);
+int load_waitlists_from_csv(const char *filename);
+int save_waitlists_to_csv(const char *filename);
+void waitlist_clear(void);
+
+#endif
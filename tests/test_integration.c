@@ -1,58 +1,1250 @@
-// tests/test_integration.c
-void run_integration_tests() {
-    printf("\n--- Running Integration Tests (Enrollment & Grade) ---\n");
-
-    // Tüm listeleri sıfırdan oluşturuyoryz
-    Student *s_head = NULL;
-    Course *c_head = NULL;
-    Enrollment *e_head = NULL;
-    Grade *g_head = NULL;
-
-    // 1. Hazırlık: Öðrenci ve Ders Ekle
-    Student s; s.id = 2024001; strcpy(s.first_name,"Test"); strcpy(s.last_name,"Stud");
-    strcpy(s.email,"t@t.com"); strcpy(s.phone,"555"); s.enrollment_year=2024;
-    strcpy(s.major,"CS"); s.gpa=0; s.next=NULL;
-    add_student(&s_head, &s);
-
-    Course c; c.id = 3001; strcpy(c.code,"CS101"); strcpy(c.name,"Coding");
-    c.credits=4; c.capacity=30; strcpy(c.department,"CS"); 
-    strcpy(c.prerequisites,""); c.next=NULL;
-    add_course(&c_head, &c);
-
-    // 2. Test: Kayıt Olma (Enrollment)
-    Enrollment e; e.student_id = 2024001; e.course_id = 3001;
-    e.professor_id = 0; strcpy(e.semester, "2024-FALL"); 
-    strcpy(e.date, "2024-09-01"); strcpy(e.status, "Enrolled");
-    e.id = 1; e.next = NULL;
-
-    // check_prerequisites fonksiyonunu manuel test ediyoruz
-    int can_take = check_prerequisites(s.id, &c, g_head, e_head);
-    TEST_ASSERT(can_take == 1, "Prerequisite Check Passed (No prereqs)");
-
-    int res = add_enrollment(&e_head, &e);
-    TEST_ASSERT(res == 1, "Student Enrolled Successfully");
-
-    // 3. Test: Çift Kayıt Engelleme
-    int is_enrolled = is_student_enrolled(e_head, 2024001, 3001);
-    TEST_ASSERT(is_enrolled == 1, "is_student_enrolled returns True");
-
-    // 4. Test: Not Verme (Grade)
-    Grade g; g.id = 1; g.student_id = 2024001; g.course_id = 3001;
-    g.enrollment_id = 1; g.numeric_grade = 90.0; 
-    strcpy(g.semester, "2024-FALL"); g.next = NULL;
-    
-    res = add_grade(&g_head, &g);
-    TEST_ASSERT(res == 1, "Grade Assigned");
-
-    // 5. Test: GPA Hesaplama
-    // Grade eklendiği için GPA değişmeli (Þu an hesapla fonksiyonunu çağırıyoruz)
-    float gpa = calculate_student_gpa(2024001, g_head, c_head);
-    TEST_ASSERT(gpa > 0.0, "GPA Calculated > 0.0");
-
-    // Temizlik
-    free_all_students(&s_head);
-    free_all_courses(&c_head);
-    free_all_enrollments(&e_head);
-    free_all_grades(&g_head);
-}
-
+// tests/test_integration.c
+void run_integration_tests() {
+    printf("\n--- Running Integration Tests (Enrollment & Grade) ---\n");
+
+    // Tüm listeleri sıfırdan oluşturuyoryz
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Enrollment *e_head = NULL;
+    Grade *g_head = NULL;
+
+    // 1. Hazırlık: Öðrenci ve Ders Ekle
+    Student s; s.id = 2024001; strcpy(s.first_name,"Test"); strcpy(s.last_name,"Stud");
+    strcpy(s.email,"t@t.com"); strcpy(s.phone,"555"); s.enrollment_year=2024;
+    strcpy(s.major,"CS"); s.gpa=0; s.next=NULL;
+    add_student(&s_head, &s);
+
+    Course c; c.id = 3001; strcpy(c.code,"CS101"); strcpy(c.name,"Coding");
+    c.credits=4; c.capacity=30; strcpy(c.department,"CS"); 
+    strcpy(c.prerequisites,""); c.next=NULL;
+    add_course(&c_head, &c);
+
+    // 2. Test: Kayıt Olma (Enrollment)
+    Enrollment e; e.student_id = 2024001; e.course_id = 3001;
+    e.professor_id = 0; strcpy(e.semester, "2024-FALL"); 
+    strcpy(e.date, "2024-09-01"); strcpy(e.status, "Enrolled");
+    e.id = 1; e.next = NULL;
+
+    // check_prerequisites fonksiyonunu manuel test ediyoruz
+    int can_take = check_prerequisites(s.id, &c, g_head, e_head);
+    TEST_ASSERT(can_take == 1, "Prerequisite Check Passed (No prereqs)");
+
+    int res = add_enrollment(&e_head, &e);
+    TEST_ASSERT(res == 1, "Student Enrolled Successfully");
+
+    // 3. Test: Çift Kayıt Engelleme
+    int is_enrolled = is_student_enrolled(e_head, 2024001, 3001);
+    TEST_ASSERT(is_enrolled == 1, "is_student_enrolled returns True");
+
+    int next_id = get_next_enrollment_id(e_head);
+    TEST_ASSERT(next_id > 1 && get_next_enrollment_id(e_head) == next_id + 1, "Enrollment IDs Come From a Monotonic Sequence");
+
+    // 4. Test: Not Verme (Grade)
+    Grade g; g.id = 1; g.student_id = 2024001; g.course_id = 3001;
+    g.enrollment_id = 1; g.numeric_grade = 90.0; 
+    strcpy(g.semester, "2024-FALL"); g.next = NULL;
+    
+    res = add_grade(&g_head, &g);
+    TEST_ASSERT(res == 1, "Grade Assigned");
+    TEST_ASSERT(s_head->first_grade == g_head && c_head->first_grade == g_head, "Grade Linked to Student and Course Chains");
+    TEST_ASSERT(s_head->first_enrollment == e_head, "Enrollment Linked to Student Chain");
+
+    // 5. Test: GPA Hesaplama
+    // Grade eklendiği için GPA değişmeli (Þu an hesapla fonksiyonunu çağırıyoruz)
+    float gpa = calculate_student_gpa(2024001, g_head, c_head);
+    TEST_ASSERT(gpa > 0.0, "GPA Calculated > 0.0");
+
+    // 6. Test: Şube sayaçları (profesör ders yükü)
+    Section *sec = get_professor_sections(0);
+    TEST_ASSERT(sec != NULL && sec->course_id == 3001 && sec->enrolled_count == 1, "Section Counts Active Enrollment");
+    drop_enrollment(&e_head, 2024001, 3001);
+    TEST_ASSERT(sec->enrolled_count == 0 && sec->dropped_count == 1 && section_headcount(sec) == 0, "Section Counts Follow Drop");
+    Enrollment later = e;
+    later.id = 2; strcpy(later.semester, "2025-SPRING"); strcpy(later.status, "Completed");
+    add_enrollment(&e_head, &later);
+    later.id = 3; strcpy(later.semester, "2025-FALL");
+    add_enrollment(&e_head, &later);
+    delete_enrollment(&e_head, 2);
+    TEST_ASSERT(sec->next_by_professor != NULL && strcmp(sec->next_by_professor->semester, "2025-FALL") == 0 &&
+                sec->next_by_professor->prev_by_professor == sec && sec->next_by_professor->next_by_professor == NULL,
+                "Emptied Section Unlinks From The Middle Of Its Chain");
+    delete_enrollment(&e_head, 3);
+    TEST_ASSERT(get_professor_sections(0) == sec && sec->next_by_professor == NULL, "Emptied Last Section Unlinks");
+
+    // 7. Test: Rapor görüntüsü (yazma, açık görüntüyü değiştirmez)
+    Snapshot *before = snapshot_acquire(SNAPSHOT_STUDENT, 2024001);
+    TEST_ASSERT(snapshot_acquire(SNAPSHOT_STUDENT, 2024001) == before, "Readers Share Snapshot While Data Is Unchanged");
+    snapshot_release(before);
+    TEST_ASSERT(before->student_count == 1 && before->course_count == 1 && before->grade_count == 1 &&
+                before->enrollment_count == 0, "Transcript Snapshot Copies Only The Student's Rows");
+    snapshot_release(before);
+    Snapshot *roster = snapshot_acquire(SNAPSHOT_COURSE, 3001);
+    const Enrollment *se;
+    TEST_ASSERT(roster != before && snapshot_course_enrollments(roster, 3001, &se) == 1 && se->student_id == 2024001 &&
+                snapshot_find_student(roster, 2024001) != NULL && roster->grade_count == 1,
+                "Roster Snapshot Copies The Course's Enrollments, Grades And Students");
+    GradeSummary live_summary, snap_summary;
+    course_grade_summary(3001, &live_summary);
+    TEST_ASSERT(snapshot_course_summary(roster, 3001, &snap_summary) && snap_summary.count == live_summary.count &&
+                snap_summary.mean == live_summary.mean && snap_summary.median == live_summary.median,
+                "Snapshot Grade Statistics Match The Live Sketch");
+    snapshot_release(roster);
+    before = snapshot_acquire(SNAPSHOT_STUDENT, 2024001);
+    update_grade(g_head, 40.0, NULL);
+    Snapshot *after = snapshot_acquire(SNAPSHOT_STUDENT, 2024001);
+    const Grade *sg;
+    TEST_ASSERT(after != before && snapshot_student_grades(before, 2024001, &sg) == 1 && sg->numeric_grade == 90.0,
+                "Old Snapshot Keeps Pre-Update Grade");
+    TEST_ASSERT(snapshot_student_gpa(after, 2024001) == 0.0 && snapshot_student_gpa(before, 2024001) == 4.0,
+                "Snapshot GPA Follows Its Own Epoch");
+    snapshot_release(before);
+    snapshot_release(after);
+    snapshot_clear();
+    update_grade(g_head, 90.0, NULL);
+
+    // 8. Test: Veri doğrulama (profesör 0 sistemde yok)
+    IntegrityReport report;
+    long anomalies = verify_data(e_head, g_head, &report);
+    TEST_ASSERT(anomalies == 1 && report.counts[ANOMALY_ENROLLMENT_NO_PROFESSOR] == 1, "Verify Data Reports Missing Professor Only");
+
+    // 9. Test: Referans bütünlüğü (restrict / cascade)
+    set_delete_mode(DELETE_RESTRICT);
+    TEST_ASSERT(delete_student_with_policy(&s_head, &e_head, &g_head, 2024001) == 0, "Restrict Mode Keeps Student With Dependents");
+    set_delete_mode(DELETE_CASCADE);
+    res = delete_student_with_policy(&s_head, &e_head, &g_head, 2024001);
+    TEST_ASSERT(res == 1 && e_head == NULL && g_head == NULL, "Cascade Mode Removes Enrollments and Grades");
+    set_delete_mode(DELETE_ORPHAN);
+
+    // Temizlik
+    free_all_students(&s_head);
+    free_all_courses(&c_head);
+    free_all_enrollments(&e_head);
+    free_all_grades(&g_head);
+}
+
+
+// --- Eşzamanlı kayıt stres testi ---
+#define STRESS_THREADS 8
+#define STRESS_STUDENTS 48
+#define STRESS_CAPACITY 12
+
+static Enrollment **stress_e_head;
+static Grade *stress_g_head;
+static int stress_enrolled = 0;
+static int stress_prereq_enrolled = 0;
+
+static void* enroll_stress_worker(void *arg) {
+    int offset = *(int *)arg;
+    int i;
+    for (i = 0; i < STRESS_STUDENTS; i++) {
+        int sid = 3100000 + (offset + i) % STRESS_STUDENTS;
+        if (enroll_student(stress_e_head, NULL, sid, 3901, 7901, "2025-SPRING", NULL) == ENROLL_OK) {
+            __sync_fetch_and_add(&stress_enrolled, 1);
+        }
+        // Ön koşullu kurs: tüm iş parçacıkları aynı ön koşul önbelleğini çözer ve okur
+        if (enroll_student(stress_e_head, stress_g_head, sid, 3902, 7901, "2025-SPRING", NULL) == ENROLL_OK) {
+            __sync_fetch_and_add(&stress_prereq_enrolled, 1);
+        }
+    }
+    return NULL;
+}
+
+void run_enrollment_stress_test() {
+    printf("\n--- Running Concurrent Enrollment Stress Test ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Professor *p_head = NULL;
+    Enrollment *e_head = NULL;
+    Grade *g_head = NULL;
+    pthread_t threads[STRESS_THREADS];
+    int offsets[STRESS_THREADS];
+    int i;
+
+    for (i = 0; i < STRESS_STUDENTS; i++) {
+        Student s; memset(&s, 0, sizeof(Student));
+        s.id = 3100000 + i; strcpy(s.first_name, "Rush"); sprintf(s.last_name, "Student%d", i);
+        sprintf(s.email, "rush%d@t.com", i); strcpy(s.phone, "555"); s.enrollment_year = 2025; strcpy(s.major, "CS");
+        add_student(&s_head, &s);
+    }
+    Course c; memset(&c, 0, sizeof(Course));
+    c.id = 3901; strcpy(c.code, "CS399"); strcpy(c.name, "Popular"); c.credits = 3;
+    c.capacity = STRESS_CAPACITY; strcpy(c.department, "CS"); strcpy(c.prerequisites, "");
+    add_course(&c_head, &c);
+    c.id = 3902; strcpy(c.code, "CS400"); strcpy(c.name, "Follow-up"); c.capacity = STRESS_STUDENTS;
+    strcpy(c.prerequisites, "CS300");
+    add_course(&c_head, &c);
+    c.id = 3903; strcpy(c.code, "CS300"); strcpy(c.name, "Basics"); strcpy(c.prerequisites, "");
+    add_course(&c_head, &c);
+    // Her sekizinci öğrenci ön koşuldan kalmıştır
+    for (i = 0; i < STRESS_STUDENTS; i++) {
+        Grade g; memset(&g, 0, sizeof(Grade));
+        g.id = 390000 + i; g.student_id = 3100000 + i; g.course_id = 3903;
+        g.numeric_grade = (i % 8 == 0) ? 40.0f : 80.0f; strcpy(g.semester, "2024-FALL");
+        add_grade(&g_head, &g);
+    }
+    Professor p; memset(&p, 0, sizeof(Professor));
+    p.id = 7901; strcpy(p.first_name, "Rush"); strcpy(p.last_name, "Prof"); strcpy(p.email, "rp@t.com");
+    add_professor(&p_head, &p);
+
+    // Her iş parçacığı tüm öğrencileri farklı bir sıradan dener: aynı kurs ve aynı öğrenciler için yarış
+    stress_e_head = &e_head;
+    stress_g_head = g_head;
+    for (i = 0; i < STRESS_THREADS; i++) {
+        offsets[i] = i * (STRESS_STUDENTS / STRESS_THREADS);
+        pthread_create(&threads[i], NULL, enroll_stress_worker, &offsets[i]);
+    }
+    for (i = 0; i < STRESS_THREADS; i++) pthread_join(threads[i], NULL);
+
+    int active = 0, duplicates = 0;
+    Enrollment *e;
+    for (e = e_head; e != NULL; e = e->next) {
+        Enrollment *other;
+        if (e->course_id == 3901 && strcmp(e->status, "Enrolled") == 0) active++;
+        for (other = e->next; other != NULL; other = other->next) {
+            if (other->student_id == e->student_id && other->course_id == e->course_id) duplicates++;
+        }
+    }
+    TEST_ASSERT(stress_enrolled == STRESS_CAPACITY && active == STRESS_CAPACITY, "Concurrent Enrollment Fills Course Exactly to Capacity");
+    TEST_ASSERT(stress_prereq_enrolled == STRESS_STUDENTS - STRESS_STUDENTS / 8 &&
+                get_enrollment_count(e_head, 3902) == stress_prereq_enrolled &&
+                !is_student_enrolled(e_head, 3100000, 3902) && is_student_enrolled(e_head, 3100001, 3902),
+                "Prerequisite Checks Hold Under Concurrent Enrollment");
+    TEST_ASSERT(get_enrollment_count(e_head, 3901) == STRESS_CAPACITY, "Seat Counter Matches Active Enrollments");
+    TEST_ASSERT(duplicates == 0, "No Student Enrolled Twice Under Contention");
+
+    for (e = e_head; e != NULL && e->course_id != 3901; e = e->next);
+    drop_enrollment(&e_head, e->student_id, 3901);
+    TEST_ASSERT(get_enrollment_count(e_head, 3901) == STRESS_CAPACITY - 1, "Drop Releases a Seat");
+
+    free_all_enrollments(e_head);
+    free_all_grades(g_head);
+    free_all_professors(p_head);
+    free_all_courses(c_head);
+    free_all_students(s_head);
+}
+
+// --- ORTAK TEST VERİSİ ---
+// Students, course and professor that the scenario tests below set up the same way
+// Aşağıdaki senaryo testlerinin aynı şekilde kurduğu öğrenci, ders ve hoca
+
+static void make_students(Student **s_head, int first_id, int count, const char *first_name, int enrollment_year) {
+    int i;
+    for (i = 0; i < count; i++) {
+        Student s; memset(&s, 0, sizeof(Student));
+        s.id = first_id + i; strcpy(s.first_name, first_name); sprintf(s.last_name, "Student%d", s.id % 100);
+        sprintf(s.email, "s%d@t.com", s.id); s.enrollment_year = enrollment_year;
+        add_student(s_head, &s);
+    }
+}
+
+static void make_course(Course **c_head, int id, const char *code, const char *name, int credits, int capacity) {
+    Course c; memset(&c, 0, sizeof(Course));
+    c.id = id; strcpy(c.code, code); strcpy(c.name, name); c.credits = credits; c.capacity = capacity;
+    add_course(c_head, &c);
+}
+
+static void make_professor(Professor **p_head, int id) {
+    Professor p; memset(&p, 0, sizeof(Professor));
+    p.id = id; sprintf(p.email, "p%d@t.com", id);
+    add_professor(p_head, &p);
+}
+
+// Frees whichever lists a test built; dependents go first so chains are detached before their owners
+// Testin kurduğu listeleri serbest bırakır; bağımlılar önce gider ki zincirler sahiplerinden önce çözülsün
+static void free_fixture(Student *s_head, Course *c_head, Professor *p_head, Enrollment *e_head, Grade *g_head) {
+    if (g_head != NULL) free_all_grades(g_head);
+    if (e_head != NULL) free_all_enrollments(e_head);
+    if (p_head != NULL) free_all_professors(p_head);
+    if (c_head != NULL) free_all_courses(c_head);
+    if (s_head != NULL) free_all_students(s_head);
+}
+
+void run_waitlist_tests() {
+    printf("\n--- Running Waitlist Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Professor *p_head = NULL;
+    Enrollment *e_head = NULL;
+    int i;
+
+    make_students(&s_head, 3200000, 2, "Wait", 2024);
+    make_students(&s_head, 3200002, 1, "Wait", 2022);
+    make_course(&c_head, 3902, "CS398", "Tiny", 3, 1);
+    make_professor(&p_head, 7902);
+
+    TEST_ASSERT(enroll_student(&e_head, NULL, 3200000, 3902, 7902, "2025-SPRING", NULL) == ENROLL_OK, "First Student Takes the Only Seat");
+    TEST_ASSERT(enroll_student(&e_head, NULL, 3200001, 3902, 7902, "2025-SPRING", NULL) == ENROLL_COURSE_FULL, "Second Student Finds Course Full");
+    TEST_ASSERT(waitlist_add(3200001, 3902, 7902, "2025-SPRING") == 1 && waitlist_position(3200001, 3902) == 1,
+                "Waitlisted at Position 1");
+    TEST_ASSERT(waitlist_add(3200002, 3902, 7902, "2025-SPRING") == 2 && waitlist_position(3200002, 3902) == 1 &&
+                waitlist_position(3200001, 3902) == 2, "Earlier Class Year Moves Ahead in Line");
+    TEST_ASSERT(waitlist_add(3200001, 3902, 7902, "2025-SPRING") == 0, "Duplicate Waitlist Entry Rejected");
+
+    drop_enrollment(&e_head, 3200000, 3902);
+    TEST_ASSERT(is_student_enrolled(e_head, 3200002, 3902) && waitlist_position(3200002, 3902) == 0,
+                "Drop Promotes Highest-Priority Student");
+    TEST_ASSERT(waitlist_size(3902) == 1 && waitlist_position(3200001, 3902) == 1, "Remaining Student Moves Up");
+    TEST_ASSERT(waitlist_remove(3200001, 3902) == 1 && waitlist_size(3902) == 0, "Student Leaves Waitlist");
+
+    // Karışık sınıf yıllarıyla uzun bir sıra; silmelerden sonra her yer kaba sayımla karşılaştırılır
+    int line_ok = 1, k;
+    for (i = 0; i < 40; i++) {
+        Student s; memset(&s, 0, sizeof(Student));
+        s.id = 3200100 + i; strcpy(s.first_name, "Line"); sprintf(s.last_name, "Student%d", i);
+        sprintf(s.email, "line%d@t.com", i); s.enrollment_year = 2020 + (i * 7) % 5;
+        add_student(&s_head, &s);
+        waitlist_add(s.id, 3902, 7902, "2025-SPRING");
+    }
+    for (i = 0; i < 40; i += 3) waitlist_remove(3200100 + i, 3902);
+    for (i = 0; i < 40; i++) {
+        int expected = 0;
+        if (i % 3 != 0) {
+            expected = 1;
+            for (k = 0; k < 40; k++) {
+                int year_k = 2020 + (k * 7) % 5, year_i = 2020 + (i * 7) % 5;
+                if (k % 3 != 0 && (year_k < year_i || (year_k == year_i && k < i))) expected++;
+            }
+        }
+        if (waitlist_position(3200100 + i, 3902) != expected) line_ok = 0;
+    }
+    TEST_ASSERT(line_ok && waitlist_size(3902) == 26, "Positions Stay Exact After Removals");
+    for (i = 0; i < 40; i++) waitlist_remove(3200100 + i, 3902);
+
+    free_fixture(s_head, c_head, p_head, e_head, NULL);
+}
+
+void run_bulk_registration_tests() {
+    printf("\n--- Running Bulk Registration Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Professor *p_head = NULL;
+    Enrollment *e_head = NULL;
+    RegistrationSummary summary;
+    const char *request_file = "bulk_requests_test.csv";
+    const char *report_file = "bulk_report_test.csv";
+
+    make_students(&s_head, 3300000, 4, "Bulk", 2024);
+    make_course(&c_head, 3903, "CS397", "Batch", 3, 2);
+    make_professor(&p_head, 7903);
+
+    FILE *f = fopen(request_file, "w");
+    fprintf(f, "student_id,course_id,professor_id,semester\n");
+    fprintf(f, "3300000,3903,7903,2025-FALL\n");
+    fprintf(f, "3300001,3903,7903,2025-FALL\n");
+    fprintf(f, "3300000,3903,7903,2025-FALL\n");
+    fprintf(f, "3300002,3903,7903,2025-FALL\n");
+    fprintf(f, "3399999,3903,7903,2025-FALL\n");
+    fprintf(f, "3300003,3903\n");
+    fclose(f);
+
+    TEST_ASSERT(bulk_register_from_csv(&e_head, NULL, request_file, report_file, REGISTRATION_SUBMISSION, 0, &summary) == 1,
+                "Bulk Registration Runs");
+    TEST_ASSERT(summary.requests == 6 && summary.accepted == 2 && summary.rejected == 4, "Accepted/Rejected Counts");
+    TEST_ASSERT(is_student_enrolled(e_head, 3300000, 3903) && is_student_enrolled(e_head, 3300001, 3903) &&
+                !is_student_enrolled(e_head, 3300002, 3903), "Submission Order Decides the Last Seats");
+    TEST_ASSERT(get_enrollment_count(e_head, 3903) == 2 && count_enrollments(e_head) == 2, "Capacity Respected, No Duplicates");
+
+    free_all_enrollments(e_head);
+    e_head = NULL;
+    RegistrationSummary first, second;
+    bulk_register_from_csv(&e_head, NULL, request_file, report_file, REGISTRATION_LOTTERY, 42, &first);
+    int winner_a = is_student_enrolled(e_head, 3300002, 3903);
+    free_all_enrollments(e_head);
+    e_head = NULL;
+    bulk_register_from_csv(&e_head, NULL, request_file, report_file, REGISTRATION_LOTTERY, 42, &second);
+    TEST_ASSERT(first.accepted == 2 && second.accepted == 2 && winner_a == is_student_enrolled(e_head, 3300002, 3903),
+                "Lottery Is Deterministic for a Seed");
+
+    remove(request_file);
+    remove(report_file);
+    free_fixture(s_head, c_head, p_head, e_head, NULL);
+}
+
+void run_grade_import_tests() {
+    printf("\n--- Running Grade Import Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Professor *p_head = NULL;
+    Enrollment *e_head = NULL;
+    Grade *g_head = NULL;
+    GradeImportSummary summary;
+    const char *sheet = "grade_sheet_test.csv";
+    int i;
+
+    make_students(&s_head, 3400000, 3, "Sheet", 2023);
+    make_course(&c_head, 3904, "CS396", "Sheets", 4, 10);
+    make_professor(&p_head, 7904);
+    enroll_student(&e_head, NULL, 3400000, 3904, 7904, "2025-FALL", NULL);
+    enroll_student(&e_head, NULL, 3400001, 3904, 7904, "2025-FALL", NULL);
+
+    float scores[9] = {95.0f, 90.0f, 89.99f, 72.5f, 65.0f, 60.0f, 55.0f, 49.0f, 0.0f};
+    char letters[9][5], expected[5];
+    int same = 1;
+    numeric_to_letter_batch(scores, letters, 9);
+    for (i = 0; i < 9; i++) {
+        numeric_to_letter(scores[i], expected);
+        if (strcmp(letters[i], expected) != 0) same = 0;
+    }
+    TEST_ASSERT(same, "Batch Letter Conversion Matches numeric_to_letter");
+
+    FILE *f = fopen(sheet, "w");
+    fprintf(f, "student_id,course_id,numeric\n");
+    fprintf(f, "3400000,3904,91\n");
+    fprintf(f, "3400001,3904,55\n");
+    fprintf(f, "3400002,3904,80\n");
+    fprintf(f, "3400001,3904,140\n");
+    fclose(f);
+    long passes = student_gpa_pass_count();
+    TEST_ASSERT(import_grades_from_csv(&g_head, c_head, sheet, 3904, &summary) == 1 &&
+                summary.inserted == 2 && summary.rejected == 2, "Sheet Posts Only Enrolled Students");
+    TEST_ASSERT(student_gpa_pass_count() - passes == summary.students_updated && summary.students_updated == 2,
+                "One GPA Pass Per Imported Student");
+    Grade *g = find_student_course_grade(g_head, 3400000, 3904);
+    TEST_ASSERT(g != NULL && strcmp(g->letter_grade, "AA") == 0 && get_student_by_id(3400000)->gpa == 4.0f,
+                "Letters and GPA Set Once");
+
+    f = fopen(sheet, "w");
+    fprintf(f, "3400001,3904,86\n");
+    fclose(f);
+    import_grades_from_csv(&g_head, c_head, sheet, 0, &summary);
+    g = find_student_course_grade(g_head, 3400001, 3904);
+    TEST_ASSERT(summary.updated == 1 && count_grades(g_head) == 2 && g != NULL && strcmp(g->letter_grade, "BA") == 0,
+                "Existing Grade Upserted on (Student, Course)");
+
+    remove(sheet);
+    free_fixture(s_head, c_head, p_head, e_head, g_head);
+}
+
+void run_curve_tests() {
+    printf("\n--- Running Course Curve Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Grade *g_head = NULL;
+    CurveSpec spec;
+    CurveReport report;
+    float scores[4] = {40.0f, 60.0f, 70.0f, 98.0f};
+    int i;
+
+    make_course(&c_head, 3905, "CS395", "Curves", 3, 10);
+    make_students(&s_head, 3500000, 4, "Curve", 2023);
+    for (i = 0; i < 4; i++) {
+        Grade g; memset(&g, 0, sizeof(Grade));
+        g.id = get_next_grade_id(g_head); g.student_id = 3500000 + i; g.course_id = 3905; g.numeric_grade = scores[i];
+        strcpy(g.semester, "2025-FALL");
+        add_grade(&g_head, &g);
+    }
+
+    spec.method = CURVE_SHIFT; spec.amount = 5.0f; spec.percentile = 0.0f;
+    TEST_ASSERT(curve_course_grades(c_head, 3905, &spec, 1, &report) == 1 && report.new_mean == 71.25f &&
+                find_student_course_grade(g_head, 3500000, 3905)->numeric_grade == 40.0f, "Dry Run Leaves Grades Alone");
+    TEST_ASSERT(report.after[GRADE_BANDS - 1] == 1 && report.before[2] == 1 && report.after[3] == 1,
+                "Preview Shows the New Distribution");
+
+    curve_course_grades(c_head, 3905, &spec, 0, &report);
+    Grade *top = find_student_course_grade(g_head, 3500003, 3905);
+    Grade *low = find_student_course_grade(g_head, 3500000, 3905);
+    TEST_ASSERT(top->numeric_grade == 100.0f && low->numeric_grade == 45.0f && strcmp(low->letter_grade, "FF") == 0 &&
+                report.students_updated == 4, "Shift Applied and Clamped at 100");
+
+    spec.method = CURVE_SCALE_TO_MEAN; spec.amount = 80.0f;
+    curve_course_grades(c_head, 3905, &spec, 0, &report);
+    TEST_ASSERT(report.slope > 1.0f && report.new_mean > report.old_mean && report.new_mean <= 80.0f,
+                "Scale Moves the Mean Toward the Target");
+
+    spec.method = CURVE_PERCENTILE; spec.percentile = 50.0f; spec.amount = 10.0f;
+    TEST_ASSERT(curve_course_grades(c_head, 3905, &spec, 1, &report) == 1 && report.offset == 0.0f,
+                "Percentile Curve Never Lowers Scores");
+
+    free_fixture(s_head, c_head, NULL, NULL, g_head);
+}
+
+void run_rollover_tests() {
+    printf("\n--- Running Semester Rollover Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Professor *p_head = NULL;
+    Enrollment *e_head = NULL;
+    Grade *g_head = NULL;
+    RolloverSummary summary;
+    int ids[3], i;
+
+    make_course(&c_head, 3906, "CS394", "Rollover", 3, 10);
+    make_professor(&p_head, 7906);
+    make_students(&s_head, 3600000, 3, "Roll", 2023);
+    for (i = 0; i < 3; i++) {
+        enroll_student(&e_head, NULL, 3600000 + i, 3906, 7906, (i < 2) ? "2025-FALL" : "2026-SPRING", &ids[i]);
+    }
+    Grade g; memset(&g, 0, sizeof(Grade));
+    g.id = get_next_grade_id(g_head); g.enrollment_id = ids[0]; g.student_id = 3600000; g.course_id = 3906;
+    g.numeric_grade = 77.0f; strcpy(g.semester, "2025-FALL");
+    add_grade(&g_head, &g);
+
+    TEST_ASSERT(rollover_semester(e_head, g_head, "2025-FALL", &summary) == 1 &&
+                summary.examined == 2 && summary.completed == 1 && summary.incomplete == 1, "Rollover Counts");
+    TEST_ASSERT(strcmp(find_enrollment_by_id(e_head, ids[0])->status, "Completed") == 0 &&
+                strcmp(find_enrollment_by_id(e_head, ids[1])->status, "Incomplete") == 0 &&
+                strcmp(find_enrollment_by_id(e_head, ids[2])->status, "Enrolled") == 0, "Graded Completed, Ungraded Flagged, Other Term Untouched");
+    TEST_ASSERT(get_enrollment_count(e_head, 3906) == 1, "Closed Rows Release Their Seats");
+
+    free_fixture(s_head, c_head, p_head, e_head, g_head);
+}
+
+void run_archive_tests() {
+    printf("\n--- Running Semester Archive Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Professor *p_head = NULL;
+    Enrollment *e_head = NULL;
+    Grade *g_head = NULL;
+    int ids[2];
+
+    archive_set_directory("test_archive");
+    make_course(&c_head, 3907, "CS395", "Archive", 4, 10);
+    make_professor(&p_head, 7907);
+    make_students(&s_head, 3700000, 2, "Arch", 2022);
+    enroll_student(&e_head, NULL, 3700000, 3907, 7907, "2022-FALL", &ids[0]);
+    enroll_student(&e_head, NULL, 3700001, 3907, 7907, "2026-SPRING", &ids[1]);
+    Grade g; memset(&g, 0, sizeof(Grade));
+    g.id = get_next_grade_id(g_head); g.enrollment_id = ids[0]; g.student_id = 3700000; g.course_id = 3907;
+    g.numeric_grade = 92.0f; strcpy(g.semester, "2022-FALL");
+    add_grade(&g_head, &g);
+    float gpa_before = calculate_student_gpa(3700000, g_head, c_head);
+
+    TEST_ASSERT(archive_freeze_semester(&e_head, &g_head, "2022-FALL") == 0, "Refuse Freezing A Semester With Active Enrollments");
+    rollover_semester(e_head, g_head, "2022-FALL", NULL);
+    TEST_ASSERT(archive_freeze_semester(&e_head, &g_head, "2022-FALL") == 1 && archive_is_frozen("2022-FALL"), "Freeze Closed Semester");
+    TEST_ASSERT(g_head == NULL && find_enrollment_by_id(e_head, ids[0]) == NULL &&
+                find_enrollment_by_id(e_head, ids[1]) != NULL, "Frozen Rows Leave The Hot Lists");
+    TEST_ASSERT(calculate_student_gpa(3700000, g_head, c_head) == gpa_before, "GPA Still Counts Archived Grades");
+    TEST_ASSERT(is_student_enrolled(e_head, 3700000, 3907), "Archived Completion Blocks Re-Enrollment");
+    Grade **range_grades;
+    Enrollment **range_rows;
+    int from_term = semester_to_term("2022-FALL"), to_term = semester_to_term("2026-SPRING");
+    TEST_ASSERT(grades_in_term_range(g_head, from_term, to_term, &range_grades) == 1 &&
+                range_grades[0]->numeric_grade == 92.0f &&
+                enrollments_in_term_range(e_head, from_term, to_term, &range_rows) == 2 &&
+                range_rows[0]->id == ids[0] && range_rows[1]->id == ids[1], "Term Ranges Include Archived Rows");
+    Section *frozen_section = get_professor_sections(7907);
+    while (frozen_section != NULL && strcmp(frozen_section->semester, "2022-FALL") != 0) frozen_section = frozen_section->next_by_professor;
+    const Enrollment **course_rows;
+    const Grade **course_grades;
+    TEST_ASSERT(frozen_section != NULL && frozen_section->completed_count == 1 &&
+                archive_course_enrollments(archive_get(0), 3907, &course_rows) == 1 && course_rows[0]->id == ids[0] &&
+                archive_course_grades(archive_get(0), 3907, &course_grades) == 1 && course_grades[0]->numeric_grade == 92.0f,
+                "Archived Semester Keeps Its Section And Course Rows");
+
+    TermRecord archived_term;
+    Student *archived_student = get_student_by_id(3700000);
+    Course recredited = *get_course_by_id(3907); recredited.credits = 3;
+    update_course(get_course_by_id(3907), &recredited);
+    TEST_ASSERT(student_term_record(archived_student, from_term, &archived_term) && archived_term.credits_attempted == 4,
+                "Archived Totals Keep Their Frozen Credits");
+    TranscriptBuffer archived_transcript;
+    transcript_buffer_init(&archived_transcript);
+    TEST_ASSERT(render_student_transcript(archived_student, &archived_transcript) &&
+                strstr(archived_transcript.text, "2022-FALL       4       92.00") != NULL &&
+                strstr(archived_transcript.text, "2022-FALL subtotal: 4 credits") != NULL,
+                "Archived Transcript Row Shows Its Counted Credits");
+    transcript_buffer_free(&archived_transcript);
+
+    archive_unload_all();
+    TEST_ASSERT(grades_in_term_range(g_head, from_term, to_term, &range_grades) == 0 &&
+                enrollments_in_term_range(e_head, from_term, to_term, &range_rows) == 1, "Term Ranges Drop Unmapped Archives");
+    TEST_ASSERT(student_cumulative_gpa(archived_student, TERM_LATEST) == 0.0f, "Unmapping Drops Cached Archived Totals");
+    TEST_ASSERT(archive_load_all() == 1 && archive_get(0)->grade_count == 1 && archive_get(0)->enrollment_count == 1, "Archive Maps Again From Manifest");
+    TEST_ASSERT(student_cumulative_gpa(archived_student, TERM_LATEST) == gpa_before, "Reloaded Archive Rebuilds Cached Totals");
+    TEST_ASSERT(grades_in_term_range(g_head, from_term, to_term, &range_grades) == 1, "Term Ranges Pick Up Reloaded Archives");
+
+    g.id = get_next_grade_id(g_head); g.enrollment_id = ids[1]; g.student_id = 3700001;
+    g.numeric_grade = 70.0f; strcpy(g.semester, "2026-SPRING");
+    add_grade(&g_head, &g);
+    GradeSummary summary;
+    int terms[MAX_COURSE_TERMS];
+    TEST_ASSERT(course_grade_summary(3907, &summary) && summary.count == 2 && summary.mean == 81.0f &&
+                calculate_course_average(NULL, 3907) == 81.0f && course_grade_terms(3907, terms, MAX_COURSE_TERMS) == 2 &&
+                section_grade_summary(3907, from_term, &summary) && summary.count == 1, "Course Sketches Include Archived Grades");
+    free_all_grades(g_head);
+    g_head = NULL;
+    TEST_ASSERT(course_grade_summary(3907, &summary) && summary.count == 1 && summary.mean == 92.0f,
+                "Freeing Grades Keeps Archived Sketches");
+
+    archive_unload_all();
+    remove("test_archive/2022-FALL.arc");
+    remove("test_archive/" ARCHIVE_MANIFEST);
+    rmdir("test_archive");
+    archive_set_directory(ARCHIVE_DIR);
+    free_fixture(s_head, c_head, p_head, e_head, g_head);
+}
+
+void run_term_range_tests() {
+    printf("\n--- Running Term/Date Range Tests ---\n");
+
+    Enrollment *e_head = NULL;
+    Grade *g_head = NULL;
+    Grade **grades;
+    Enrollment **rows;
+    char buffer[20];
+    int i;
+
+    TEST_ASSERT(semester_to_term("2021-FALL") < semester_to_term("2022-SPRING") &&
+                semester_to_term("2022-spring") == semester_to_term("2022-SPRING") &&
+                semester_to_term("2022-AUTUMN") == TERM_NONE, "Semester Ordinals Follow Calendar Order");
+    term_to_semester(semester_to_term("2023-SUMMER"), buffer, sizeof(buffer));
+    TEST_ASSERT(strcmp(buffer, "2023-SUMMER") == 0, "Semester Ordinal Round Trip");
+    TEST_ASSERT(date_to_day("1970-01-01") == 0 && date_to_day("2024-03-01") - date_to_day("2024-02-28") == 2 &&
+                date_to_day("2023-02-29") == DAY_NONE, "Day Numbers Count Leap Days");
+    day_to_date(date_to_day("2000-02-29"), buffer);
+    TEST_ASSERT(strcmp(buffer, "2000-02-29") == 0, "Day Number Round Trip");
+
+    const char *semesters[4] = {"2022-FALL", "2021-SPRING", "2023-FALL", "2021-FALL"};
+    const char *dates[4] = {"2022-09-01", "2021-02-01", "2023-09-05", "2021-09-01"};
+    for (i = 0; i < 4; i++) {
+        Enrollment e; memset(&e, 0, sizeof(Enrollment));
+        e.id = 39100 + i; e.student_id = 3800000; e.course_id = 3908; e.professor_id = 7908;
+        strcpy(e.semester, semesters[i]); strcpy(e.date, dates[i]); strcpy(e.status, "Completed");
+        add_enrollment(&e_head, &e);
+        Grade g; memset(&g, 0, sizeof(Grade));
+        g.id = get_next_grade_id(g_head); g.enrollment_id = e.id; g.student_id = 3800000; g.course_id = 3908;
+        g.numeric_grade = 60.0f + i; strcpy(g.semester, semesters[i]);
+        add_grade(&g_head, &g);
+    }
+
+    int count = grades_in_term_range(g_head, semester_to_term("2021-FALL"), semester_to_term("2022-FALL"), &grades);
+    TEST_ASSERT(count == 2 && strcmp(grades[0]->semester, "2021-FALL") == 0 &&
+                strcmp(grades[1]->semester, "2022-FALL") == 0, "Grades In Term Range, Ordered By Term");
+    count = enrollments_in_date_range(e_head, date_to_day("2021-06-01"), date_to_day("2022-12-31"), &rows);
+    TEST_ASSERT(count == 2 && rows[0]->id == 39103 && rows[1]->id == 39100, "Enrollments In Date Range, Ordered By Date");
+    delete_enrollment(&e_head, 39103);
+    count = enrollments_in_term_range(e_head, semester_to_term("2021-SPRING"), semester_to_term("2021-FALL"), &rows);
+    TEST_ASSERT(count == 1 && rows[0]->id == 39101, "Range Index Follows Deletes");
+
+    free_fixture(NULL, NULL, NULL, e_head, g_head);
+}
+
+void run_term_gpa_tests() {
+    printf("\n--- Running Term GPA Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Grade *g_head = NULL;
+    int i;
+
+    Student s; memset(&s, 0, sizeof(Student));
+    s.id = 3900000; strcpy(s.first_name, "Term"); strcpy(s.last_name, "Student");
+    strcpy(s.email, "term@t.com"); s.enrollment_year = 2021;
+    add_student(&s_head, &s);
+    make_course(&c_head, 3909, "CS396", "Term GPA", 3, 10);
+    make_course(&c_head, 3910, "CS397", "Term GPA", 4, 10);
+    // 2021-FALL: 95 (4.0) x 3 credits; 2022-SPRING: 72 (2.0) x 4 credits and 40 (0.0, not earned) x 3 credits
+    const char *semesters[3] = {"2021-FALL", "2022-SPRING", "2022-SPRING"};
+    const int courses[3] = {3909, 3910, 3909};
+    const float scores[3] = {95.0f, 72.0f, 40.0f};
+    for (i = 0; i < 3; i++) {
+        Grade g; memset(&g, 0, sizeof(Grade));
+        g.id = get_next_grade_id(g_head); g.student_id = 3900000; g.course_id = courses[i];
+        g.numeric_grade = scores[i]; strcpy(g.semester, semesters[i]);
+        add_grade(&g_head, &g);
+    }
+    Student *st = get_student_by_id(3900000);
+    int fall = semester_to_term("2021-FALL"), spring = semester_to_term("2022-SPRING");
+    TermRecord history[MAX_STUDENT_TERMS];
+
+    TEST_ASSERT(student_term_history(st, history, MAX_STUDENT_TERMS) == 2 && history[1].credits_attempted == 7 &&
+                history[1].credits_earned == 4, "Term Totals Track Attempted And Earned Credits");
+    TEST_ASSERT(student_term_gpa(st, fall) == 4.0f && student_term_gpa(st, spring) == 8.0f / 7.0f, "Term GPA");
+    TEST_ASSERT(student_cumulative_gpa(st, fall) == 4.0f && student_cumulative_gpa(st, TERM_LATEST) == 20.0f / 10.0f &&
+                calculate_student_gpa(3900000, g_head, c_head) == 2.0f, "Cumulative GPA At A Past Term");
+
+    update_grade(find_grade_by_id(g_head, g_head->next->next->id), 90.0f, NULL);
+    TEST_ASSERT(student_term_gpa(st, spring) == 20.0f / 7.0f, "Rescored Grade Updates Term Totals");
+    Course c_new = *get_course_by_id(3909); c_new.credits = 1;
+    update_course(get_course_by_id(3909), &c_new);
+    TEST_ASSERT(student_term_gpa(st, fall) == 4.0f && student_cumulative_gpa(st, TERM_LATEST) == 16.0f / 6.0f, "Credit Change Recounts Grades");
+    delete_grade(&g_head, g_head->id);
+    TEST_ASSERT(student_term_history(st, history, MAX_STUDENT_TERMS) == 1 && history[0].term == spring, "Emptied Term Disappears");
+
+    // Silinen öğrencinin ve kursun satırları yetim kalır; aynı ID yeniden eklenince geri bağlanır
+    Enrollment *e_head = NULL;
+    Enrollment e; memset(&e, 0, sizeof(Enrollment));
+    e.id = 1; e.student_id = 3900000; e.course_id = 3910; strcpy(e.semester, "2022-SPRING"); strcpy(e.status, "Enrolled");
+    add_enrollment(&e_head, &e);
+    Course c_back = *get_course_by_id(3910);
+    delete_student(&s_head, 3900000);
+    delete_course(&c_head, 3910);
+    add_student(&s_head, &s);
+    st = get_student_by_id(3900000);
+    TEST_ASSERT(st->first_grade != NULL && st->first_grade->next_by_student == st->last_grade &&
+                st->last_grade->next_by_student == NULL && st->first_enrollment == e_head &&
+                student_term_gpa(st, spring) == 4.0f, "Re-added Student Gets Its Orphan Rows Back");
+    add_course(&c_head, &c_back);
+    Course *back = get_course_by_id(3910);
+    TEST_ASSERT(back->first_grade != NULL && back->first_grade == back->last_grade && back->first_enrollment == e_head &&
+                back->seats_taken == 1 && student_term_gpa(st, spring) == 12.0f / 5.0f, "Re-added Course Gets Its Orphan Rows Back");
+
+    free_fixture(s_head, c_head, NULL, e_head, g_head);
+}
+
+void run_ranking_tests() {
+    printf("\n--- Running Class Ranking Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Grade *g_head = NULL;
+    Student *top[RANKING_MAX_K];
+    int i, size = 0;
+    const float gpas[5] = {3.10f, 3.90f, 2.50f, 3.90f, 4.00f};
+
+    for (i = 0; i < 5; i++) {
+        Student s; memset(&s, 0, sizeof(Student));
+        s.id = 4000000 + i; strcpy(s.first_name, "Rank"); sprintf(s.last_name, "Student%d", i);
+        sprintf(s.email, "rank%d@t.com", i);
+        s.enrollment_year = 2022; strcpy(s.major, (i < 4) ? "Rank Major" : "Other Major");
+        add_student(&s_head, &s);
+        student_set_gpa(get_student_by_id(s.id), gpas[i]);
+    }
+
+    int count = ranking_top_k(s_head, "rank major", 2022, 3, top, &size);
+    TEST_ASSERT(count == 3 && size == 4 && top[0]->id == 4000001 && top[1]->id == 4000003 && top[2]->id == 4000000,
+                "Top-K Within Major And Year");
+    Student *low = get_student_by_id(4000002);
+    TEST_ASSERT(ranking_class_rank(s_head, low, &size) == 4 && size == 4 &&
+                ranking_class_rank(s_head, get_student_by_id(4000003), NULL) == 1, "Class Rank With Shared Ties");
+    student_set_gpa(low, 3.95f);
+    TEST_ASSERT(pending_count == 1 && ranking_class_rank(s_head, low, NULL) == 1 && pending_count == 0,
+                "GPA Change Reinserted Without A Full Sort");
+    Student moved = *get_student_by_id(4000000);
+    strcpy(moved.major, "Other Major");
+    update_student(get_student_by_id(4000000), &moved);
+    TEST_ASSERT(ranking_class_rank(s_head, get_student_by_id(4000000), &size) == 2 && size == 2 &&
+                ranking_class_rank(s_head, low, &size) == 1 && size == 3, "Major Change Refiles Into New Class");
+    count = ranking_top_k(s_head, "", 2022, 2, top, &size);
+    TEST_ASSERT(count == 2 && size == 5 && top[0]->id == 4000004 && top[1]->id == 4000002,
+                "Top-K Across Every Major Of A Year");
+
+    Course c; memset(&c, 0, sizeof(Course));
+    c.id = 3911; strcpy(c.code, "CS398"); strcpy(c.name, "Ranking"); c.credits = 12; c.capacity = 10;
+    add_course(&c_head, &c);
+    for (i = 0; i < 2; i++) {
+        Grade g; memset(&g, 0, sizeof(Grade));
+        g.id = get_next_grade_id(g_head); g.student_id = 4000000 + i; g.course_id = 3911;
+        g.numeric_grade = (i == 0) ? 95.0f : 70.0f; strcpy(g.semester, "2023-FALL");
+        add_grade(&g_head, &g);
+    }
+    DeansListEntry entries[5];
+    count = deans_list(s_head, semester_to_term("2023-FALL"), DEANS_LIST_MIN_GPA, DEANS_LIST_MIN_CREDITS, entries, 5);
+    TEST_ASSERT(count == 1 && entries[0].student->id == 4000000 && entries[0].term_gpa == 4.0f, "Dean's List");
+    free_all_grades(g_head);
+    count = deans_list(s_head, semester_to_term("2023-FALL"), DEANS_LIST_MIN_GPA, DEANS_LIST_MIN_CREDITS, entries, 5);
+    TEST_ASSERT(count == 0, "Dean's List Forgets Cleared Grades");
+    free_all_courses(c_head);
+    free_all_students(s_head);
+
+    // Parallel sort on a list long enough to be split across threads
+    s_head = NULL;
+    for (i = 0; i < RANKING_PARALLEL_MIN + 500; i++) {
+        Student s; memset(&s, 0, sizeof(Student));
+        s.id = 4100000 + i; sprintf(s.email, "bulk%d@t.com", i);
+        s.enrollment_year = 2020 + i % 4; strcpy(s.major, "Bulk");
+        add_student(&s_head, &s);
+        get_student_by_id(s.id)->gpa = (float)((i * 7919) % 401) / 100.0f;
+    }
+    ranking_class_rank(s_head, s_head, NULL);
+    int sorted = (rank_count == RANKING_PARALLEL_MIN + 500);
+    for (i = 1; i < rank_count && sorted; i++) sorted = ranked_ahead(rank_order[i - 1], rank_order[i]);
+    TEST_ASSERT(sorted, "Parallel Full Sort Orders Every Student");
+    free_all_students(s_head);
+}
+
+void run_batch_transcript_tests() {
+    printf("\n--- Running Batch Transcript Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Grade *g_head = NULL;
+    TranscriptBuffer buf;
+    char path[64];
+    const long students = TRANSCRIPT_MIN_CHUNK * 2 + 17;
+    long i;
+    int threads = 0;
+
+    Course c; memset(&c, 0, sizeof(Course));
+    c.id = 3912; strcpy(c.code, "CS397"); strcpy(c.name, "Batch"); c.credits = 3; c.capacity = 10;
+    add_course(&c_head, &c);
+    for (i = 0; i < students; i++) {
+        Student s; memset(&s, 0, sizeof(Student));
+        s.id = 4200000 + (int)i; strcpy(s.first_name, "Batch"); sprintf(s.last_name, "Student%ld", i);
+        sprintf(s.email, "batch%ld@t.com", i); s.enrollment_year = 2022; strcpy(s.major, "Batch");
+        add_student(&s_head, &s);
+        if (i % 3 == 0) {
+            Grade g; memset(&g, 0, sizeof(Grade));
+            g.id = 500000 + (int)i; g.student_id = s.id; g.course_id = 3912;
+            g.numeric_grade = 60.0f + (float)(i % 40); strcpy(g.semester, (i % 2) ? "2023-FALL" : "2024-SPRING");
+            add_grade(&g_head, &g);
+        }
+    }
+
+    // Expected output: every transcript rendered in list order on this thread
+    size_t expected_length = 0, expected_capacity = 1 << 16;
+    char *expected = (char *)malloc(expected_capacity);
+    Student *s;
+    transcript_buffer_init(&buf);
+    for (s = s_head; s != NULL && expected != NULL; s = s->next) {
+        render_student_transcript(s, &buf);
+        while (expected_length + buf.length > expected_capacity) expected_capacity *= 2;
+        expected = (char *)realloc(expected, expected_capacity);
+        if (expected != NULL) memcpy(expected + expected_length, buf.text, buf.length);
+        expected_length += buf.length;
+    }
+    TEST_ASSERT(expected != NULL && strstr(expected, "CS397") != NULL && strstr(expected, "Student0 ") != NULL,
+                "Transcript Rendered Into Buffer");
+
+    long written = generate_transcripts(s_head, TRANSCRIPT_SINGLE_FILE, "test_transcripts.txt", &threads);
+    char *actual = (char *)malloc(expected_length + 1);
+    size_t actual_length = 0;
+    FILE *file = fopen("test_transcripts.txt", "r");
+    if (file != NULL && actual != NULL) {
+        actual_length = fread(actual, 1, expected_length + 1, file);
+        fclose(file);
+    }
+    TEST_ASSERT(written == students && threads >= 1 && actual_length == expected_length &&
+                memcmp(actual, expected, expected_length) == 0, "Single File Keeps List Order Across Workers");
+    remove("test_transcripts.txt");
+
+    written = generate_transcripts(s_head, TRANSCRIPT_PER_STUDENT, "test_transcripts", NULL);
+    render_student_transcript(get_student_by_id(4200003), &buf);
+    actual_length = 0;
+    file = fopen("test_transcripts/transcript_4200003.txt", "r");
+    if (file != NULL && actual != NULL) {
+        actual_length = fread(actual, 1, expected_length, file);
+        fclose(file);
+    }
+    TEST_ASSERT(written == students && actual_length == buf.length && memcmp(actual, buf.text, buf.length) == 0,
+                "One File Per Student");
+    for (i = 0; i < students; i++) {
+        sprintf(path, "test_transcripts/transcript_%ld.txt", 4200000 + i);
+        remove(path);
+    }
+    rmdir("test_transcripts");
+
+    // Kataloğu olmayan dersin notu sayılmaz ama transkriptte 0 krediyle görünür
+    Grade uncounted; memset(&uncounted, 0, sizeof(Grade));
+    uncounted.id = 599999; uncounted.student_id = 4200000; uncounted.course_id = 3999;
+    uncounted.numeric_grade = 77.0f; strcpy(uncounted.semester, "2022-FALL");
+    add_grade(&g_head, &uncounted);
+    render_student_transcript(get_student_by_id(4200000), &buf);
+    TEST_ASSERT(strstr(buf.text, "2022-FALL       0       77.00") != NULL &&
+                strstr(buf.text, "2022-FALL subtotal: 0 credits") != NULL, "Uncounted Grade Listed With Zero Credits");
+
+    transcript_buffer_free(&buf);
+    free(expected);
+    free(actual);
+    free_fixture(s_head, c_head, NULL, NULL, g_head);
+}
+
+static CubeRow* find_cube_row(CubeRow *rows, int count, const char *label) {
+    int i;
+    for (i = 0; i < count; i++) {
+        if (strcmp(rows[i].label, label) == 0) return &rows[i];
+    }
+    return NULL;
+}
+
+void run_grade_cube_tests() {
+    printf("\n--- Running Grade Cube Tests ---\n");
+
+    Course *c_head = NULL;
+    Grade *g_head = NULL;
+    CubeFilter filter;
+    CubeRow *rows = NULL, *rebuilt = NULL, *row;
+    int i, count;
+    const int course_ids[3] = {3913, 3914, 3915};
+    const char *departments[3] = {"Cube Dept A", "Cube Dept B", "Cube Dept A"};
+    const int grade_course[5] = {3913, 3913, 3913, 3914, 3915};
+    const float grade_score[5] = {90.0f, 40.0f, 70.0f, 80.0f, 55.0f};
+    const char *grade_semester[5] = {"2023-FALL", "2023-FALL", "2024-SPRING", "2023-FALL", "2024-SPRING"};
+
+    for (i = 0; i < 3; i++) {
+        Course c; memset(&c, 0, sizeof(Course));
+        c.id = course_ids[i]; sprintf(c.code, "CUBE%d", i); strcpy(c.name, "Cube"); c.credits = 3; c.capacity = 10;
+        strcpy(c.department, departments[i]);
+        add_course(&c_head, &c);
+    }
+    for (i = 0; i < 5; i++) {
+        Grade g; memset(&g, 0, sizeof(Grade));
+        g.id = 600001 + i; g.student_id = 4300000 + i; g.course_id = grade_course[i];
+        g.numeric_grade = grade_score[i]; strcpy(g.semester, grade_semester[i]);
+        add_grade(&g_head, &g);
+    }
+    grade_cube_build(g_head);
+
+    count = grade_cube_rollup(g_head, CUBE_BY_DEPARTMENT, NULL, &rows);
+    row = find_cube_row(rows, count, "Cube Dept A");
+    TEST_ASSERT(row != NULL && row->stats.count == 4 && row->stats.sum == 255.0 && row->stats.passed == 3 &&
+                row->stats.bands[GRADE_BANDS - 1] == 1 && cube_stats_pass_rate(&row->stats) == 75.0f,
+                "Roll-Up By Department");
+    free(rows);
+
+    cube_filter_clear(&filter);
+    strcpy(filter.department, "cube dept a");
+    count = grade_cube_rollup(g_head, CUBE_BY_TERM, &filter, &rows);
+    TEST_ASSERT(count == 2 && strcmp(rows[0].label, "2023-FALL") == 0 && rows[0].stats.count == 2 &&
+                cube_stats_mean(&rows[0].stats) == 65.0f && strcmp(rows[1].label, "2024-SPRING") == 0,
+                "Drill Down Department Into Semesters");
+    free(rows);
+
+    // Mutations update cells in place; the cube is never rebuilt
+    update_grade(find_grade_by_id(g_head, 600002), 60.0f, NULL);
+    delete_grade(&g_head, 600004);
+    Grade g; memset(&g, 0, sizeof(Grade));
+    g.id = 600006; g.student_id = 4300006; g.course_id = 3914; g.numeric_grade = 95.0f; strcpy(g.semester, "2024-SPRING");
+    add_grade(&g_head, &g);
+    count = grade_cube_rollup(g_head, CUBE_BY_DEPARTMENT, NULL, &rows);
+    row = find_cube_row(rows, count, "Cube Dept A");
+    CubeRow *dept_b = find_cube_row(rows, count, "Cube Dept B");
+    TEST_ASSERT(grade_cube_is_built() && row != NULL && row->stats.passed == 4 && row->stats.sum == 275.0 &&
+                dept_b != NULL && dept_b->stats.count == 1 && cube_stats_stddev(&dept_b->stats) == 0.0f,
+                "Grade Mutations Update The Cube Incrementally");
+    free(rows);
+
+    cube_filter_clear(&filter);
+    filter.from_term = filter.to_term = semester_to_term("2024-SPRING");
+    count = grade_cube_rollup(g_head, CUBE_BY_COURSE, &filter, &rows);
+    grade_cube_build(g_head);
+    int rebuilt_count = grade_cube_rollup(g_head, CUBE_BY_COURSE, &filter, &rebuilt);
+    int same = (count == rebuilt_count && count > 0);
+    for (i = 0; same && i < count; i++) {
+        same = (rows[i].key == rebuilt[i].key && rows[i].stats.count == rebuilt[i].stats.count &&
+                rows[i].stats.sum == rebuilt[i].stats.sum && rows[i].stats.passed == rebuilt[i].stats.passed);
+    }
+    TEST_ASSERT(same, "Incremental Cube Matches A Full Rebuild");
+    free(rows);
+    free(rebuilt);
+
+    free_all_grades(g_head);
+    TEST_ASSERT(!grade_cube_is_built(), "Freeing Grades Drops The Cube");
+    free_all_courses(c_head);
+}
+
+void run_grade_stats_tests() {
+    printf("\n--- Running Grade Distribution Sketch Tests ---\n");
+
+    GradeSketch sketch;
+    GradeSummary summary;
+    int i;
+
+    memset(&sketch, 0, sizeof(GradeSketch));
+    for (i = 9; i >= 1; i--) grade_sketch_add(&sketch, (float)i);
+    grade_sketch_summary(&sketch, &summary);
+    TEST_ASSERT(summary.exact && summary.count == 9 && summary.median == 5.0f && summary.q1 == 3.0f &&
+                summary.q3 == 7.0f && summary.min == 1.0f && summary.max == 9.0f &&
+                fabsf(summary.stddev - sqrtf(60.0f / 9.0f)) < 0.001f, "Exact Quartiles And Welford Moments");
+    grade_sketch_add(&sketch, 100.0f);
+    grade_sketch_summary(&sketch, &summary);
+    TEST_ASSERT(summary.outliers_high == 1 && summary.outliers_low == 0, "Outlier Above The Upper Fence");
+    grade_sketch_remove(&sketch, 100.0f);
+    grade_sketch_summary(&sketch, &summary);
+    TEST_ASSERT(summary.count == 9 && fabsf(summary.mean - 5.0f) < 0.0001f && summary.max == 9.0f,
+                "Removing A Score Restores The Summary");
+    grade_sketch_free(&sketch);
+
+    for (i = 0; i < SKETCH_EXACT_MAX + 200; i++) grade_sketch_add(&sketch, (float)(i % 100) + 0.25f);
+    grade_sketch_summary(&sketch, &summary);
+    TEST_ASSERT(!summary.exact && summary.count == SKETCH_EXACT_MAX + 200 &&
+                fabsf(summary.median - 45.25f) <= SKETCH_BIN_WIDTH && fabsf(summary.max - 99.25f) <= SKETCH_BIN_WIDTH,
+                "Histogram Quartiles Within Half A Bin");
+    for (i = 0; i < SKETCH_EXACT_MAX + 200; i++) grade_sketch_remove(&sketch, (float)(i % 100) + 0.25f);
+    grade_sketch_summary(&sketch, &summary);
+    TEST_ASSERT(summary.count == 0 && summary.exact && sketch.bins == NULL, "Emptied Sketch Returns To Exact Mode");
+    grade_sketch_free(&sketch);
+
+    // Birleştirme: iki özetin birleşimi, tüm puanları tek özete eklemekle aynı özeti vermeli
+    GradeSketch left, right, combined;
+    GradeSummary merged;
+    int round;
+    for (round = 0; round < 2; round++) {
+        int left_count = (round == 0) ? 7 : SKETCH_EXACT_MAX + 50, right_count = (round == 0) ? 5 : 120;
+        memset(&left, 0, sizeof(GradeSketch));
+        memset(&right, 0, sizeof(GradeSketch));
+        memset(&combined, 0, sizeof(GradeSketch));
+        for (i = 0; i < left_count; i++) {
+            grade_sketch_add(&left, (float)((i * 37) % 101));
+            grade_sketch_add(&combined, (float)((i * 37) % 101));
+        }
+        for (i = 0; i < right_count; i++) {
+            grade_sketch_add(&right, 40.0f + (float)((i * 13) % 61) / 2.0f);
+            grade_sketch_add(&combined, 40.0f + (float)((i * 13) % 61) / 2.0f);
+        }
+        grade_sketch_merge(&left, &right);
+        grade_sketch_summary(&left, &merged);
+        grade_sketch_summary(&combined, &summary);
+        TEST_ASSERT(merged.count == summary.count && merged.exact == summary.exact && merged.median == summary.median &&
+                    merged.q1 == summary.q1 && merged.q3 == summary.q3 && merged.min == summary.min &&
+                    merged.max == summary.max && fabsf(merged.mean - summary.mean) < 0.001f &&
+                    fabsf(merged.stddev - summary.stddev) < 0.001f && merged.outliers_low == summary.outliers_low &&
+                    memcmp(merged.bands, summary.bands, sizeof(merged.bands)) == 0,
+                    (round == 0) ? "Merged Exact Sketches Match The Combined Sketch"
+                                 : "Merged Histogram Sketches Match The Combined Sketch");
+        grade_sketch_free(&left);
+        grade_sketch_free(&right);
+        grade_sketch_free(&combined);
+    }
+
+    Course *c_head = NULL;
+    Grade *g_head = NULL;
+    Course c; memset(&c, 0, sizeof(Course));
+    c.id = 3916; strcpy(c.code, "CS396"); strcpy(c.name, "Stats"); c.credits = 3; c.capacity = 10;
+    add_course(&c_head, &c);
+    for (i = 0; i < 6; i++) {
+        Grade g; memset(&g, 0, sizeof(Grade));
+        g.id = 700001 + i; g.student_id = 4400000 + i; g.course_id = 3916;
+        g.numeric_grade = 50.0f + 10.0f * i; strcpy(g.semester, (i < 3) ? "2023-FALL" : "2024-SPRING");
+        add_grade(&g_head, &g);
+    }
+    course_grade_summary(3916, &summary);
+    TEST_ASSERT(summary.count == 6 && summary.median == 75.0f && calculate_course_average(NULL, 3916) == 75.0f,
+                "Course Summary Without Walking Grades");
+    update_grade(find_grade_by_id(g_head, 700001), 5.0f, NULL);
+    delete_grade(&g_head, 700006);
+    GradeSummary section;
+    section_grade_summary(3916, semester_to_term("2023-FALL"), &section);
+    course_grade_summary(3916, &summary);
+    int terms[MAX_COURSE_TERMS];
+    TEST_ASSERT(section.count == 3 && section.min == 5.0f && summary.count == 5 && summary.max == 90.0f &&
+                course_grade_terms(3916, terms, MAX_COURSE_TERMS) == 2, "Updates And Deletes Keep Sketches Current");
+    free_all_grades(g_head);
+    TEST_ASSERT(!course_grade_summary(3916, &summary), "Freeing Grades Clears Sketches");
+    free_all_courses(c_head);
+}
+
+// Test rows for the join engine: a key, a tag and a chain pointer
+typedef struct JoinTestRow {
+    int key;
+    int tag;
+    struct JoinTestRow *next;
+} JoinTestRow;
+
+typedef struct JoinTestOutput {
+    int left_tags[32];
+    int right_tags[32];
+    int count;
+} JoinTestOutput;
+
+static JoinTestRow join_test_index_rows[3] = {{10, 100, NULL}, {20, 200, NULL}, {30, 300, NULL}};
+
+static int join_test_key(const void *row) {
+    return ((const JoinTestRow *)row)->key;
+}
+
+static void* join_test_lookup(int key) {
+    int i;
+    for (i = 0; i < 3; i++) {
+        if (join_test_index_rows[i].key == key) return &join_test_index_rows[i];
+    }
+    return NULL;
+}
+
+static void join_test_emit(const void *left, const void *right, void *ctx) {
+    JoinTestOutput *out = (JoinTestOutput *)ctx;
+    if (out->count >= 32) return;
+    out->left_tags[out->count] = ((const JoinTestRow *)left)->tag;
+    out->right_tags[out->count] = (right != NULL) ? ((const JoinTestRow *)right)->tag : 0;
+    out->count++;
+}
+
+static void join_test_link(JoinTestRow *rows, int count) {
+    int i;
+    for (i = 0; i < count; i++) rows[i].next = (i + 1 < count) ? &rows[i + 1] : NULL;
+}
+
+void run_join_tests() {
+    printf("\n--- Running Hash Join Tests ---\n");
+
+    JoinTestOutput out;
+    JoinTestRow small[4] = {{1, 1, NULL}, {2, 2, NULL}, {2, 3, NULL}, {3, 4, NULL}};
+    JoinTestRow large[6] = {{2, 11, NULL}, {4, 12, NULL}, {2, 13, NULL}, {5, 14, NULL}, {6, 15, NULL}, {7, 16, NULL}};
+    join_test_link(small, 4);
+    join_test_link(large, 6);
+    JoinSide small_side = join_chain(small, offsetof(JoinTestRow, next), join_test_key);
+    JoinSide large_side = join_chain(large, offsetof(JoinTestRow, next), join_test_key);
+
+    memset(&out, 0, sizeof(out));
+    long emitted = hash_join(&large_side, &small_side, JOIN_INNER, join_test_emit, &out);
+    TEST_ASSERT(emitted == 4 && out.count == 4 &&
+                out.left_tags[0] == 11 && out.right_tags[0] == 2 && out.left_tags[1] == 11 && out.right_tags[1] == 3 &&
+                out.left_tags[2] == 13 && out.right_tags[2] == 2 && out.left_tags[3] == 13 && out.right_tags[3] == 3,
+                "Inner Join With Duplicate Keys In Probe Order");
+
+    memset(&out, 0, sizeof(out));
+    emitted = hash_join(&small_side, &large_side, JOIN_LEFT_OUTER, join_test_emit, &out);
+    TEST_ASSERT(emitted == 6 && out.left_tags[0] == 2 && out.right_tags[0] == 11 && out.left_tags[1] == 3 &&
+                out.right_tags[1] == 11 && out.left_tags[4] == 1 && out.right_tags[4] == 0 &&
+                out.left_tags[5] == 4 && out.right_tags[5] == 0, "Left Outer Join With Left Side As Build Side");
+
+    memset(&out, 0, sizeof(out));
+    emitted = hash_join(&large_side, &small_side, JOIN_LEFT_OUTER, join_test_emit, &out);
+    TEST_ASSERT(emitted == 8 && out.left_tags[2] == 12 && out.right_tags[2] == 0 &&
+                out.left_tags[7] == 16 && out.right_tags[7] == 0, "Left Outer Join With Right Side As Build Side");
+
+    JoinTestRow probes[4] = {{30, 1, NULL}, {99, 2, NULL}, {10, 3, NULL}, {30, 4, NULL}};
+    JoinSide probe_array = join_array(probes, 4, sizeof(JoinTestRow), join_test_key);
+    JoinSide index_side = join_index(join_test_lookup);
+    memset(&out, 0, sizeof(out));
+    emitted = hash_join(&probe_array, &index_side, JOIN_LEFT_OUTER, join_test_emit, &out);
+    TEST_ASSERT(emitted == 4 && out.right_tags[0] == 300 && out.right_tags[1] == 0 && out.right_tags[2] == 100 &&
+                out.right_tags[3] == 300, "Array Side Probes A Unique Index");
+    memset(&out, 0, sizeof(out));
+    emitted = hash_join(&index_side, &probe_array, JOIN_INNER, join_test_emit, &out);
+    TEST_ASSERT(emitted == 3 && out.left_tags[0] == 300 && out.right_tags[0] == 1, "Index On The Left Side Of An Inner Join");
+    memset(&out, 0, sizeof(out));
+    TEST_ASSERT(hash_join(&index_side, &probe_array, JOIN_LEFT_OUTER, join_test_emit, &out) == -1 &&
+                hash_join(&index_side, &index_side, JOIN_INNER, join_test_emit, &out) == -1 && out.count == 0,
+                "Joins That Would Scan An Index-Only Side Are Rejected");
+
+    JoinSide empty = join_chain(NULL, offsetof(JoinTestRow, next), join_test_key);
+    memset(&out, 0, sizeof(out));
+    TEST_ASSERT(hash_join(&empty, &small_side, JOIN_LEFT_OUTER, join_test_emit, &out) == 0 &&
+                hash_join(&small_side, &empty, JOIN_INNER, join_test_emit, &out) == 0 &&
+                hash_join(&small_side, &empty, JOIN_LEFT_OUTER, join_test_emit, &out) == 4, "Joins With An Empty Side");
+
+    Course *c_head = NULL;
+    Grade *g_head = NULL;
+    Course c; memset(&c, 0, sizeof(Course));
+    c.id = 3917; strcpy(c.code, "CS397"); strcpy(c.name, "Joins"); c.credits = 4; c.capacity = 10;
+    add_course(&c_head, &c);
+    Grade g; memset(&g, 0, sizeof(Grade));
+    g.id = 710001; g.student_id = 4499999; g.course_id = 3917; g.numeric_grade = 95.0f; strcpy(g.semester, "2024-SPRING");
+    add_grade(&g_head, &g);
+    g.id = 710002; g.student_id = 4499998; g.numeric_grade = 10.0f;
+    add_grade(&g_head, &g);
+    TEST_ASSERT(calculate_student_gpa(4499999, g_head, c_head) == 4.0f && calculate_student_gpa(4499999, g_head, NULL) == 0.0f,
+                "GPA Of An Unlisted Student Through The Course Index");
+    free_fixture(NULL, c_head, NULL, NULL, g_head);
+}
+
+#define TEST_SERVER_SOCKET "test_server.sock"
+
+static ServerData server_test_data;
+static int server_test_result = 0;
+
+static void* server_test_thread(void *arg) {
+    (void)arg;
+    server_test_result = run_server(TEST_SERVER_SOCKET, &server_test_data);
+    return NULL;
+}
+
+// Sunucuya bağlanır; dinlemeye başlamadıysa kısa aralıklarla yeniden dener
+static int server_test_connect(void) {
+    struct sockaddr_un addr;
+    struct timespec pause = {0, 20000000};
+    int attempt;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, TEST_SERVER_SOCKET);
+    for (attempt = 0; attempt < 100; attempt++) {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0) return fd;
+        close(fd);
+        nanosleep(&pause, NULL);
+    }
+    return -1;
+}
+
+// Bir istek satırı gönderir ve "OK <n>" + n satırlık ya da "ERR" yanıtının tamamını okur
+static const char* server_test_call(int fd, const char *request) {
+    static char reply[4096];
+    int len = 0, lines = 0, expected = -1;
+    reply[0] = '\0';
+    if (write(fd, request, strlen(request)) < 0) return reply;
+    while (len < (int)sizeof(reply) - 1 && read(fd, reply + len, 1) == 1) {
+        if (reply[len++] != '\n') continue;
+        reply[len] = '\0';
+        if (expected < 0) expected = (strncmp(reply, "OK ", 3) == 0) ? atoi(reply + 3) : 0;
+        else lines++;
+        if (lines == expected) break;
+    }
+    reply[len] = '\0';
+    return reply;
+}
+
+void run_server_tests() {
+    printf("\n--- Running Server Tests ---\n");
+
+    Student *s_head = NULL;
+    Course *c_head = NULL;
+    Professor *p_head = NULL;
+    Enrollment *e_head = NULL;
+    Grade *g_head = NULL;
+
+    make_students(&s_head, 3500000, 2, "Sock", 2024);
+    make_students(&s_head, 3500002, 1, "Sock", 2022);
+    make_course(&c_head, 3905, "CS395", "Sockets", 3, 1);
+    make_professor(&p_head, 7905);
+
+    server_test_data.s_head = &s_head;
+    server_test_data.c_head = &c_head;
+    server_test_data.p_head = &p_head;
+    server_test_data.e_head = &e_head;
+    server_test_data.g_head = &g_head;
+    pthread_t server;
+    pthread_create(&server, NULL, server_test_thread, NULL);
+    int fd = server_test_connect();
+    TEST_ASSERT(fd >= 0, "Client Connects To Server Socket");
+    if (fd < 0) {
+        pthread_cancel(server);
+        pthread_join(server, NULL);
+        return;
+    }
+
+    const char *r = server_test_call(fd, "ENROLL 3500000 3905 7905 2025-FALL\n");
+    TEST_ASSERT(strncmp(r, "OK 1\n", 5) == 0 && atoi(r + 5) > 0, "ENROLL Over Socket Takes The Seat");
+    r = server_test_call(fd, "ENROLL 3500001 3905 7905 2025-FALL\n");
+    TEST_ASSERT(strcmp(r, "OK 1\nWAITLISTED,1,1\n") == 0, "ENROLL On Full Course Waitlists");
+    r = server_test_call(fd, "ENROLL 3500002 3905 7905 2025-FALL\n");
+    TEST_ASSERT(strcmp(r, "OK 1\nWAITLISTED,1,2\n") == 0, "Earlier Class Year Is Placed Ahead On ENROLL");
+    r = server_test_call(fd, "WAITLIST 3500002 3905\n");
+    TEST_ASSERT(strcmp(r, "OK 1\n1,2\n") == 0, "WAITLIST Reports Place And Length");
+    r = server_test_call(fd, "WAITLIST 3500001 3905\n");
+    TEST_ASSERT(strcmp(r, "OK 1\n2,2\n") == 0, "Later Class Year Waits Behind");
+
+    r = server_test_call(fd, "DROP 3500000 3905\n");
+    TEST_ASSERT(strcmp(r, "OK 0\n") == 0, "DROP Over Socket");
+    r = server_test_call(fd, "WAITLIST 3500002 3905\n");
+    TEST_ASSERT(strncmp(r, "ERR", 3) == 0, "DROP Promotes The Head Of The Waitlist");
+    r = server_test_call(fd, "ROSTER 3905\n");
+    TEST_ASSERT(strncmp(r, "OK 2\n", 5) == 0 && strstr(r, "3500002,Sock,Student2,2025-FALL,Enrolled\n") != NULL &&
+                strstr(r, "3500000,Sock,Student0,2025-FALL,Dropped\n") != NULL, "ROSTER From Report Thread");
+
+    r = server_test_call(fd, "GRADE 3500002 3905 nan 2025-FALL\n");
+    TEST_ASSERT(strncmp(r, "ERR", 3) == 0, "GRADE Rejects NaN");
+    r = server_test_call(fd, "GRADE 3500002 3905 85abc 2025-FALL\n");
+    TEST_ASSERT(strncmp(r, "ERR", 3) == 0, "GRADE Rejects Trailing Garbage In Score");
+    r = server_test_call(fd, "GRADE 3500002 3905 85 2025-FALL\n");
+    TEST_ASSERT(strncmp(r, "OK 1\n", 5) == 0, "GRADE Over Socket");
+    r = server_test_call(fd, "TRANSCRIPT 3500002\n");
+    TEST_ASSERT(strncmp(r, "OK 2\n", 5) == 0 && strstr(r, "CS395,2025-FALL,85.00,") != NULL,
+                "TRANSCRIPT From Report Thread");
+    r = server_test_call(fd, "GRADESTATS 3905\n");
+    TEST_ASSERT(strncmp(r, "OK 8\ncount,1\nmean,85.00\n", 24) == 0 && strstr(r, "median,85.00\n") != NULL,
+                "GRADESTATS From Report Thread");
+    r = server_test_call(fd, "AUDIT 3500002\n");
+    TEST_ASSERT(strncmp(r, "OK 7\nCS101,MISSING,-\n", 21) == 0 && strstr(r, "CREDITS,3,120\nSTATUS,NOT_ELIGIBLE\n") != NULL,
+                "AUDIT From Report Thread");
+    r = server_test_call(fd, "AUDIT 3599999\n");
+    TEST_ASSERT(strncmp(r, "ERR", 3) == 0, "AUDIT Of Unknown Student");
+
+    r = server_test_call(fd, "SHUTDOWN\n");
+    close(fd);
+    pthread_join(server, NULL);
+    TEST_ASSERT(strcmp(r, "OK 0\n") == 0 && server_test_result == 1, "SHUTDOWN Stops The Server");
+
+    waitlist_clear();
+    free_fixture(s_head, c_head, p_head, e_head, g_head);
+}
@@ -1,41 +1,75 @@
-#include <stdio.h>
-#include <stdlib.h>
-
-// --- TEST ARAÇLARI ---
-#include "test_utils.h"
-
-// --- ANA PROJE DOSYALARI (UNITY BUILD) ---
-// Hepsini buraya dahil ediyoruz ki bağlama hatası olmasın.
-#include "../src/utils.c"
-#include "../src/grade.c"
-#include "../src/course.c"
-#include "../src/enrollment.c"
-#include "../src/professor.c"
-#include "../src/student.c" 
-
-
-// --- TEST DOSYALARI ---
-#include "test_student.c"
-#include "test_course.c"
-#include "test_professor.c"
-#include "test_integration.c"
-
-int main() {
-    printf("=========================================\n");
-    printf("   FULL SYSTEM TEST SUITE STARTING\n");
-    printf("=========================================\n");
-
-    
-    run_student_tests();
-    run_course_tests();
-    run_professor_tests();
-    run_integration_tests();
-    
-    print_test_summary();
-
-    printf("\nAll tests were completed. Enter for exit...\n");
-    getchar();
-
-    return 0;
-}
-
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+// --- TEST ARAÇLARI ---
+#include "test_utils.h"
+
+// --- ANA PROJE DOSYALARI (UNITY BUILD) ---
+// Hepsini buraya dahil ediyoruz ki bağlama hatası olmasın.
+#include "../src/utils.c"
+#include "../src/index.c"
+#include "../src/trie.c"
+#include "../src/bloom.c"
+#include "../src/section.c"
+#include "../src/grade.c"
+#include "../src/course.c"
+#include "../src/enrollment.c"
+#include "../src/professor.c"
+#include "../src/student.c" 
+#include "../src/integrity.c"
+#include "../src/snapshot.c"
+#include "../src/waitlist.c"
+#include "../src/registration.c"
+#include "../src/archive.c"
+#include "../src/ranking.c"
+#include "../src/transcript.c"
+#include "../src/cube.c"
+#include "../src/gradestats.c"
+#include "../src/join.c"
+#include "../src/server.c"
+#include "../src/curriculum.c"
+
+
+// --- TEST DOSYALARI ---
+#include "test_student.c"
+#include "test_course.c"
+#include "test_professor.c"
+#include "test_integration.c"
+
+int main() {
+    printf("=========================================\n");
+    printf("   FULL SYSTEM TEST SUITE STARTING\n");
+    printf("=========================================\n");
+
+    
+    run_student_tests();
+    run_course_tests();
+    run_professor_tests();
+    run_integration_tests();
+    run_enrollment_stress_test();
+    run_waitlist_tests();
+    run_bulk_registration_tests();
+    run_grade_import_tests();
+    run_curve_tests();
+    run_rollover_tests();
+    run_archive_tests();
+    run_term_range_tests();
+    run_term_gpa_tests();
+    run_ranking_tests();
+    run_batch_transcript_tests();
+    run_grade_cube_tests();
+    run_grade_stats_tests();
+    run_join_tests();
+    run_server_tests();
+    
+    print_test_summary();
+
+    printf("\nAll tests were completed. Enter for exit...\n");
+    getchar();
+
+    return 0;
+}
+
@@ -1,45 +1,93 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include "../src/student.h"  // "../" demek: Bir üst klasördeki student.h'a git demek
-#include "test_utils.h"
-
-// Testleri çalıştıran fonksiyon
-void run_student_tests() {
-    printf("\n--- Running Student Module Tests ---\n");
-
-    Student *head = NULL;
-
-    // 1. TEST: Öðrenci Ekleme
-    Student s1;
-    s1.id = 1001;
-    strcpy(s1.first_name, "Ali");
-    strcpy(s1.last_name, "Veli");
-    strcpy(s1.email, "ali@univ.edu");
-    strcpy(s1.phone, "555-1234");
-    s1.enrollment_year = 2024;
-    strcpy(s1.major, "CS");
-    s1.gpa = 3.0;
-    s1.next = NULL;
-
-    int result = add_student(&head, &s1);
-    TEST_ASSERT(result == 1, "Student Added Successfully");
-    TEST_ASSERT(head != NULL, "List Head is not NULL");
-
-    // 2. TEST: Aynı ID ile Ekleme (Hata vermeli)
-    result = add_student(&head, &s1);
-    TEST_ASSERT(result == 0, "Prevent Duplicate ID");
-
-    // 3. TEST: Arama
-    Student *found = find_student_by_id(head, 1001);
-    TEST_ASSERT(found != NULL, "Student Found by ID");
-    
-    // 4. TEST: Silme
-    result = delete_student(&head, 1001);
-    TEST_ASSERT(result == 1, "Student Deleted Successfully");
-    TEST_ASSERT(head == NULL, "List is Empty After Delete");
-
-    // Temizlik
-    free_all_students(&head);
-}
-
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../src/student.h"  // "../" demek: Bir üst klasördeki student.h'a git demek
+#include "test_utils.h"
+
+// Testleri çalıştıran fonksiyon
+void run_student_tests() {
+    printf("\n--- Running Student Module Tests ---\n");
+
+    Student *head = NULL;
+
+    // 1. TEST: Öðrenci Ekleme
+    Student s1;
+    s1.id = 1001;
+    strcpy(s1.first_name, "Ali");
+    strcpy(s1.last_name, "Veli");
+    strcpy(s1.email, "ali@univ.edu");
+    strcpy(s1.phone, "555-1234");
+    s1.enrollment_year = 2024;
+    strcpy(s1.major, "CS");
+    s1.gpa = 3.0;
+    s1.next = NULL;
+
+    int result = add_student(&head, &s1);
+    TEST_ASSERT(result == 1, "Student Added Successfully");
+    TEST_ASSERT(head != NULL, "List Head is not NULL");
+
+    // 2. TEST: Aynı ID ile Ekleme (Hata vermeli)
+    result = add_student(&head, &s1);
+    TEST_ASSERT(result == 0, "Prevent Duplicate ID");
+
+    // 3. TEST: Arama
+    Student *found = find_student_by_id(head, 1001);
+    TEST_ASSERT(found != NULL, "Student Found by ID");
+
+    // 4. TEST: E-posta ve isim indeksleri
+    TEST_ASSERT(find_student_by_email(head, "ALI@univ.edu") == found, "Student Found by Email (Index)");
+    TEST_ASSERT(find_student_by_name(head, "ali", "VELI") == found, "Student Found by Name (Index)");
+
+    Student changed = *found;
+    strcpy(changed.email, "ali.veli@univ.edu");
+    update_student(found, &changed);
+    TEST_ASSERT(find_student_by_email(head, "ali@univ.edu") == NULL, "Old Email Removed from Index");
+    TEST_ASSERT(find_student_by_email(head, "ali.veli@univ.edu") == found, "New Email Re-keyed in Index");
+
+    Student *matches[5];
+    strcpy(changed.last_name, "Yılmaz");
+    update_student(found, &changed);
+    TEST_ASSERT(search_students_by_prefix(head, "YIL", matches, 5) == 1, "Prefix Search Ignores Turkish Diacritics");
+    
+    // 5. TEST: Silme
+    result = delete_student(&head, 1001);
+    TEST_ASSERT(result == 1, "Student Deleted Successfully");
+    TEST_ASSERT(head == NULL, "List is Empty After Delete");
+    TEST_ASSERT(find_student_by_email(&s1, "ali.veli@univ.edu") == NULL, "Deleted Student Removed from Index");
+
+    int i;
+    // 6. TEST: Sona ekleme, son düğüm silindikten sonra da sırayı korur
+    for (i = 0; i < 3; i++) {
+        Student s; memset(&s, 0, sizeof(Student));
+        s.id = 1101 + i; sprintf(s.email, "tail%d@univ.edu", i);
+        add_student(&head, &s);
+    }
+    delete_student(&head, 1103);
+    Student s4; memset(&s4, 0, sizeof(Student));
+    s4.id = 1104; strcpy(s4.email, "tail4@univ.edu");
+    add_student(&head, &s4);
+    TEST_ASSERT(head != NULL && head->id == 1101 && head->next->id == 1102 && head->next->next->id == 1104 &&
+                head->next->next->next == NULL, "Append Keeps Order After Deleting The Tail");
+    delete_student(&head, 1101);
+    delete_student(&head, 1102);
+    delete_student(&head, 1104);
+
+    // 7. TEST: Mükerrer ID filtresi (Bloom)
+    BloomFilter filter = {NULL, 0, 0, 0, 0};
+    IdIndex ids = {NULL, 0, 0};
+    int missed = 0, false_hits = 0;
+    for (i = 1; i <= 1000; i++) {
+        id_index_insert(&ids, i, &filter);
+        bloom_insert(&filter, &ids, i);
+    }
+    for (i = 1; i <= 1000; i++) missed += !bloom_may_contain(&filter, i);
+    for (i = 100001; i <= 110000; i++) false_hits += bloom_may_contain(&filter, i);
+    TEST_ASSERT(missed == 0, "Bloom Filter Keeps Every ID After Growing");
+    TEST_ASSERT(false_hits < 500, "Bloom Filter Rules Out Most New IDs");
+    bloom_clear(&filter);
+    id_index_clear(&ids);
+
+    // Temizlik
+    free_all_students(&head);
+}
+